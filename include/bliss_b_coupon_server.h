@@ -0,0 +1,137 @@
+#ifndef __BLISS_B_COUPON_SERVER_H__
+#define __BLISS_B_COUPON_SERVER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "bliss_b_keys.h"
+#include "bliss_b_signatures.h"
+#include "entropy.h"
+
+/*
+ * Coupon server: a producer thread that computes coupons for one
+ * private key (see the coupon API in bliss_b_signatures.h) and keeps
+ * them in a ring buffer. Signing threads take coupons from the ring
+ * with bliss_b_ctx_sign_server.
+ *
+ * The ring has a single producer and many consumers, and it's
+ * lock-free: each slot has a sequence number, consumers claim a slot
+ * with a compare-and-swap on head, and the producer only waits for
+ * the slot it writes next to be released. A signer never waits for
+ * the producer: if the ring is empty, it computes the coupon itself
+ * (and this is counted as a fallback).
+ *
+ * The producer fills the ring up to high_watermark coupons, then
+ * sleeps until the number of coupons drops to low_watermark.
+ *
+ * Fields:
+ * - ctx: the producer's signing context (key, sampler, NTT state)
+ * - capacity: number of slots (a power of two), mask = capacity - 1
+ * - coupon_size: size of a coupon (4n integers)
+ * - slots: capacity * coupon_size integers
+ * - seq: sequence numbers: slot i is ready for the producer if
+ *   seq[i] = tail, and ready for a consumer if seq[i] = head + 1
+ * - head: number of coupons taken so far (updated by the consumers)
+ * - tail: number of coupons produced so far (updated by the producer)
+ * - fallbacks: number of times a consumer found the ring empty
+ * - running: cleared to stop the producer
+ * - sleeping: true while the producer waits for the low watermark
+ * - lock, wakeup: used to wake up the producer
+ *
+ * head, tail, seq, fallbacks, running, and sleeping are accessed
+ * atomically.
+ */
+typedef struct {
+  bliss_b_sign_ctx_t ctx;
+  uint32_t capacity;
+  uint32_t mask;
+  uint32_t coupon_size;
+  uint32_t low_watermark;
+  uint32_t high_watermark;
+  int32_t *slots;
+  uint64_t *seq;
+  uint64_t head;
+  uint64_t tail;
+  uint64_t fallbacks;
+  bool running;
+  bool sleeping;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t wakeup;
+} bliss_b_coupon_server_t;
+
+/*
+ * Counters (to size the ring)
+ * - capacity: size of the ring
+ * - occupancy: number of coupons in the ring
+ * - produced: number of coupons computed by the producer
+ * - consumed: number of coupons taken from the ring
+ * - fallbacks: number of signing attempts that found the ring empty
+ *
+ * The fallback rate is fallbacks / (consumed + fallbacks).
+ */
+typedef struct {
+  uint32_t capacity;
+  uint32_t occupancy;
+  uint64_t produced;
+  uint64_t consumed;
+  uint64_t fallbacks;
+} bliss_b_coupon_stats_t;
+
+
+/*
+ * Initialize a server for private_key and start the producer thread.
+ * - entropy: an initialized entropy object, used only by the producer
+ *   (it must not be used by other threads while the server runs)
+ * - capacity: number of slots in the ring, rounded up to a power of two
+ * - low_watermark, high_watermark: the producer stops when the ring has
+ *   high_watermark coupons and restarts when it has low_watermark coupons.
+ *   We must have low_watermark < high_watermark <= capacity.
+ *
+ * Returns BLISS_B_NO_ERROR on success, or a negative error code:
+ * - BLISS_B_BAD_ARGS: the key's kind is not supported or the
+ *   watermarks are wrong
+ * - BLISS_B_NO_MEM: failed to allocate the ring or to start the thread
+ *
+ * If the returned code is negative, there is nothing to delete.
+ */
+extern int32_t bliss_b_coupon_server_init(bliss_b_coupon_server_t *server, const bliss_private_key_t *private_key,
+                                          entropy_t *entropy, uint32_t capacity,
+                                          uint32_t low_watermark, uint32_t high_watermark);
+
+/*
+ * Stop the producer, then zero and free the ring.
+ * No other thread may use the server during or after this call.
+ */
+extern void bliss_b_coupon_server_delete(bliss_b_coupon_server_t *server);
+
+/*
+ * Take the oldest coupon from the ring and copy it into coupon
+ * (4n integers). The slot is zeroed.
+ * - returns false if the ring is empty (and counts a fallback)
+ *
+ * Never blocks. Safe to call from several threads.
+ */
+extern bool bliss_b_coupon_server_take(bliss_b_coupon_server_t *server, int32_t *coupon);
+
+/*
+ * Read the counters
+ */
+extern void bliss_b_coupon_server_stats(bliss_b_coupon_server_t *server, bliss_b_coupon_stats_t *stats);
+
+/*
+ * Sign msg using ctx, taking coupons from the server's ring (and
+ * from ctx's own pool first, if it has one). When no coupon is
+ * available, the coupon is computed inline as in bliss_b_ctx_sign.
+ *
+ * ctx must be bound to the same private key as the server. Each
+ * signing thread must have its own context.
+ *
+ * Returns the same codes as bliss_b_ctx_sign, or BLISS_B_BAD_ARGS if
+ * the keys don't match.
+ */
+extern int32_t bliss_b_ctx_sign_server(bliss_b_sign_ctx_t *ctx, bliss_b_coupon_server_t *server,
+                                       bliss_signature_t *signature, const uint8_t *msg, size_t msg_sz);
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef __BLISS_B_KERNELS_H
+#define __BLISS_B_KERNELS_H
+
+#include <stdint.h>
+
+#include "bliss_b_params.h"
+
+/*
+ * Hot loops of signing and verification, specialized for each kind.
+ *
+ * The loops take n, q, d, mod_p, and kappa from a table entry built
+ * for one kind, where they are compile-time constants: the compiler
+ * can then unroll the loops and replace x % q by multiplications.
+ * The signing and verification contexts pick the entry once, in
+ * bliss_b_sign_ctx_init and bliss_b_verify_ctx_init.
+ *
+ * The fields kind, n, q, d, mod_p, and kappa are the parameters of
+ * the entry (the same as in bliss_param_t).
+ */
+typedef struct bliss_b_kernels_s {
+  bliss_kind_t kind;
+  uint32_t n;
+  int32_t q;
+  uint32_t d;
+  int32_t mod_p;
+  uint32_t kappa;
+
+  /* steps 2 and 2b of signing: v is a * y1 (in [0, q-1])
+     v := (2 * zeta * v + y2) mod 2q and dv := drop_bits(v) mod p */
+  void (*coupon)(int32_t *v, int32_t *dv, const int32_t *y2);
+
+  /* step 7 of signing: v is in [0, 2q-1]
+     z2 := drop_bits(v) - drop_bits((v - z2) mod 2q), reduced modulo p
+     to the interval [-p/2, p/2] */
+  void (*compress_z2)(int32_t *z2, const int32_t *v);
+
+  /* verification: v is a * z1 (in [0, q-1]) and c_indices are the kappa indices of c
+     v := (2 * zeta * v + zeta * q * c) mod 2q then v := (drop_bits(v) + z2) mod p */
+  void (*verify_v)(int32_t *v, const uint32_t *c_indices, const int32_t *z2);
+
+  /* output := input * 2^d */
+  void (*mul2d)(int32_t *output, const int32_t *input);
+
+  /* vector_max_norm, vector_norm2, vector_scalar_product (see bliss_b_utils.h) */
+  int32_t (*max_norm)(const int32_t *v);
+  int32_t (*norm2)(const int32_t *v);
+  int32_t (*scalar_product)(const int32_t *v1, const int32_t *v2);
+
+  /* greedy_sc with the kappa indices of c (see greedy_sc.h) */
+  void (*greedy_sc)(const int8_t *s1x, const int8_t *s2x, const uint32_t *c_indices, int32_t *v1, int32_t *v2);
+} bliss_b_kernels_t;
+
+
+/*
+ * Kernels for kind, or NULL if kind is not supported
+ */
+extern const bliss_b_kernels_t *bliss_b_kernels(bliss_kind_t kind);
+
+#endif
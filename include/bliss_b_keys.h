@@ -14,6 +14,9 @@
  *
  * For Bliss-B0, n is 256.
  * For Bliss-B1 to 4, n is 512.
+ *
+ * s1x and s2x are compact copies of s1 and s2 used by the signing
+ * function (int8 arrays of size 2n, see greedy_sc.h).
  */
 typedef struct {
   bliss_kind_t kind;                 /* Bliss variant             */
@@ -21,6 +24,8 @@ typedef struct {
   int32_t *s1;                       /* sparse polynomial s1      */
   int32_t *s2;                       /* sparse polynomial s2      */
   int32_t *a;                        /* NTT of s1/s2              */
+  int8_t *s1x;                       /* extension of s1           */
+  int8_t *s2x;                       /* extension of s2           */
 } bliss_private_key_t;
 
 /*
@@ -52,14 +57,14 @@ typedef struct {
  * - BLISS_B_RETRY: failed to construct an invertible polynomial for private_key->s1
  *   (currently, the code tries 10 times at most)
  *
- * If the returned code is negative, then private_key->s1, s2, a are all NULL.
+ * If the returned code is negative, then private_key->s1, s2, a, s1x, s2x are all NULL.
  */
 extern int32_t bliss_b_private_key_gen(bliss_private_key_t *private_key, bliss_kind_t kind, entropy_t *entropy);
 
 /*
  * Delete the memory associated with the private_key
  * - this also zeroes out the keys
- * - this can be called if private_key->s1, s2, and a are all NULL,
+ * - this can be called if private_key->s1, s2, a, s1x, and s2x are all NULL,
  *   in which case the function does nothing.
  */
 extern void bliss_b_private_key_delete(bliss_private_key_t *private_key);
@@ -3,7 +3,11 @@
 
 #include <stdint.h>
 #include "bliss_b_params.h"
+#include "bliss_b_kernels.h"
+#include "bliss_b_keys.h"
 #include "entropy.h"
+#include "sampler.h"
+#include "ntt_api.h"
 
 
 typedef struct {
@@ -14,6 +18,77 @@ typedef struct {
 } bliss_signature_t;
 
 
+/*
+ * Signing context: everything bliss_b_sign needs besides the message.
+ *
+ * A context is bound to one private key and one entropy source. It
+ * owns the parameters, the NTT state, the sampler, and all the
+ * scratch buffers, so signing through a context does not allocate
+ * memory. A context must not be shared between threads.
+ *
+ * - p: parameters for private_key->kind
+ * - kernels: loops specialized for private_key->kind
+ * - private_key: the key (not owned by the context, must outlive it)
+ * - entropy: our source of randomness (also not owned)
+ * - hash: buffer for SHA3_512(msg) followed by the n_vector (hash_sz bytes)
+ * - ntt: scratch NTT for multiply_ntt_into (to compute a * y1)
+ * - y1, y2, v, dv, v1, v2: work polynomials of size n
+ * - coupons: pool of precomputed (y1, y2, v, dv) (see the coupon API below)
+ *   coupon_capacity = size of the pool, coupon_count = number of coupons
+ *   in the pool, coupon_head = index of the oldest one
+ */
+typedef struct {
+  bliss_param_t p;
+  const bliss_b_kernels_t *kernels;
+  const bliss_private_key_t *private_key;
+  entropy_t *entropy;
+  sampler_t sampler;
+  ntt_state_t state;
+  uint8_t *hash;
+  uint32_t hash_sz;
+  ntt_t ntt;
+  int32_t *y1;
+  int32_t *y2;
+  int32_t *v;
+  int32_t *dv;
+  int32_t *v1;
+  int32_t *v2;
+  int32_t *coupons;
+  uint32_t coupon_capacity;
+  uint32_t coupon_count;
+  uint32_t coupon_head;
+} bliss_b_sign_ctx_t;
+
+
+/*
+ * Verification context: bound to one public key.
+ *
+ * It keeps the parameters, the NTT state, and the scratch buffers
+ * needed by bliss_b_verify, so verifying through a context does
+ * not touch the heap. A context must not be shared between threads.
+ *
+ * - p: parameters for public_key->kind
+ * - kernels: loops specialized for public_key->kind
+ * - public_key: the key (not owned by the context, must outlive it)
+ * - ntt: scratch NTT
+ * - hash: buffer for SHA3_512(msg) followed by the n_vector (hash_sz bytes)
+ * - tz2, v: work polynomials of size n
+ * - indices: recomputed c (kappa indices)
+ */
+typedef struct {
+  bliss_param_t p;
+  const bliss_b_kernels_t *kernels;
+  const bliss_public_key_t *public_key;
+  ntt_state_t state;
+  ntt_t ntt;
+  uint8_t *hash;
+  uint32_t hash_sz;
+  int32_t *tz2;
+  int32_t *v;
+  uint32_t *indices;
+} bliss_b_verify_ctx_t;
+
+
 /*  Generates a signature of a message given a bliss_b private key.
  *
  *  - signature; structure to store the result
@@ -28,9 +103,178 @@ typedef struct {
 extern int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *private_key, const uint8_t *msg, size_t msg_sz, entropy_t *entropy);
 
 
+/*
+ * Sign a batch of messages with the same key, using nthreads threads.
+ * - msgs[i] is a message of lens[i] bytes, for i = 0 ... count-1
+ * - its signature is stored in sigs[i] (allocated by this function,
+ *   as in bliss_b_sign)
+ * - nthreads = 0 means one thread per processor. The calling thread
+ *   is one of the workers.
+ * - entropy: the caller's entropy object. Each thread gets its own
+ *   entropy object, seeded from this one.
+ *
+ * The work is split between the threads, and a thread that's done
+ * with its share steals work from the others (the time to sign a
+ * message varies a lot because of the restarts).
+ *
+ * Returns BLISS_B_NO_ERROR if all the messages are signed. Otherwise,
+ * returns a negative error code (the first error that occurred) and
+ * all of sigs[0 ... count-1] are deleted.
+ */
+extern int32_t bliss_b_sign_batch(const bliss_private_key_t *private_key, const uint8_t *const msgs[], const size_t lens[],
+                                  bliss_signature_t sigs[], uint32_t count, uint32_t nthreads, entropy_t *entropy);
+
+
+/*
+ * Initialize a signing context for private_key.
+ * - entropy: an initialized entropy object, used by all signatures
+ *   produced through this context.
+ *
+ * Returns BLISS_B_NO_ERROR on success, or a negative error code:
+ * - BLISS_B_BAD_ARGS: the key's kind is not supported
+ * - BLISS_B_NO_MEM: failed to allocate the buffers
+ *
+ * If the returned code is negative, there is nothing to delete.
+ */
+extern int32_t bliss_b_sign_ctx_init(bliss_b_sign_ctx_t *ctx, const bliss_private_key_t *private_key, entropy_t *entropy);
+
+/*
+ * Delete the context: zero and free the scratch buffers.
+ */
+extern void bliss_b_sign_ctx_delete(bliss_b_sign_ctx_t *ctx);
+
+/*
+ * Sign msg using an initialized context.
+ * - signature must have been initialized by bliss_signature_init for
+ *   the same kind as the context's key. Its buffers are overwritten.
+ *
+ * Each attempt (including restarts) takes the oldest coupon from the
+ * context's pool, or computes a fresh one if the pool is empty.
+ *
+ * Returns 0 on success, or a negative error code on failure.
+ * No memory is allocated.
+ */
+extern int32_t bliss_b_ctx_sign(bliss_b_sign_ctx_t *ctx, bliss_signature_t *signature, const uint8_t *msg, size_t msg_sz);
+
+
+/*
+ * Coupons (offline/online signing)
+ *
+ * Steps 1 to 2b of the signing algorithm don't depend on the message:
+ * sample y1 and y2, compute v = (2 * xi * a * y1 + y2) mod 2q, and
+ * dv = drop_bits(v). A coupon stores (y1, y2, v, dv), so this work can
+ * be done ahead of time (e.g., when the caller is idle). Signing with a
+ * coupon only hashes, runs greedy_sc, and does the rejection steps.
+ *
+ * A coupon is used at most once: it's removed from the pool and zeroed
+ * when bliss_b_ctx_sign takes it. Coupons are as sensitive as the
+ * private key.
+ */
+
+/*
+ * Allocate a pool for up to capacity coupons. This replaces the
+ * existing pool (its coupons are discarded). capacity = 0 removes
+ * the pool.
+ *
+ * Returns BLISS_B_NO_ERROR on success, or BLISS_B_NO_MEM (in which
+ * case the context has no pool).
+ */
+extern int32_t bliss_b_sign_ctx_reserve_coupons(bliss_b_sign_ctx_t *ctx, uint32_t capacity);
+
+/*
+ * Compute up to count coupons and add them to the pool (fewer
+ * if the pool becomes full).
+ * Returns the number of coupons added.
+ */
+extern uint32_t bliss_b_sign_ctx_precompute(bliss_b_sign_ctx_t *ctx, uint32_t count);
+
+/*
+ * Number of coupons available in the pool
+ */
+extern uint32_t bliss_b_sign_ctx_coupons(const bliss_b_sign_ctx_t *ctx);
+
+/*
+ * Compute one coupon and store it in coupon (an array of 4n integers)
+ * rather than in the pool. This uses ctx's sampler, entropy, and NTT
+ * state. (The coupon server uses this, see bliss_b_coupon_server.h.)
+ */
+extern void bliss_b_sign_ctx_compute_coupon(bliss_b_sign_ctx_t *ctx, int32_t *coupon);
+
+
 extern int32_t bliss_b_verify(const bliss_signature_t *signature,  const bliss_public_key_t *public_key, const uint8_t *msg, size_t msg_sz);
 
 
+/*
+ * Initialize a verification context for public_key.
+ *
+ * Returns BLISS_B_NO_ERROR on success, or a negative error code:
+ * - BLISS_B_BAD_ARGS: the key's kind is not supported
+ * - BLISS_B_NO_MEM: failed to allocate the buffers
+ *
+ * If the returned code is negative, there is nothing to delete.
+ */
+extern int32_t bliss_b_verify_ctx_init(bliss_b_verify_ctx_t *ctx, const bliss_public_key_t *public_key);
+
+/*
+ * Delete the context: free the buffers.
+ */
+extern void bliss_b_verify_ctx_delete(bliss_b_verify_ctx_t *ctx);
+
+/*
+ * Verify signature of msg using an initialized context.
+ * - the signature kind must match the context's public key.
+ *
+ * Returns the same codes as bliss_b_verify:
+ * - BLISS_B_NO_ERROR if the signature is valid
+ * - BLISS_B_VERIFY_FAIL if it is not
+ * - BLISS_B_BAD_DATA if the signature's norms are out of bounds
+ * No memory is allocated.
+ */
+extern int32_t bliss_b_ctx_verify(bliss_b_verify_ctx_t *ctx, const bliss_signature_t *signature, const uint8_t *msg, size_t msg_sz);
+
+/*
+ * Same as bliss_b_ctx_verify, given the message's hash:
+ * - digest must be SHA3_512(msg) (SHA3_512_DIGEST_LENGTH bytes)
+ * - az1 is either NULL or the product a * z1 of the public key and
+ *   signature->z1 (n coefficients in [0, q-1]), for callers that
+ *   compute it with the batch NTT.
+ */
+extern int32_t bliss_b_ctx_verify_digest(bliss_b_verify_ctx_t *ctx, const bliss_signature_t *signature,
+                                         const uint8_t *digest, const int32_t *az1);
+
+/*
+ * Verify a batch of signatures with the same public key, using nthreads threads.
+ * - sigs[i] is a signature of msgs[i], a message of lens[i] bytes,
+ *   for i = 0 ... count-1
+ * - valid: bitmap of (count + 7)/8 bytes: bit (i & 7) of valid[i >> 3]
+ *   is set if sigs[i] is valid, and cleared otherwise
+ * - nthreads = 0 means one thread per processor. The calling thread
+ *   is one of the workers.
+ *
+ * The messages are hashed four at a time (with sha3_512x4) when
+ * they have the same length, and the products a * z1 are computed
+ * eight at a time with the batch NTT (unless the NTT backend is
+ * faster on one polynomial).
+ *
+ * Returns BLISS_B_NO_ERROR if all the signatures were checked (whether
+ * they're valid or not), or BLISS_B_NO_MEM if the contexts can't be
+ * allocated (then valid is all zeros).
+ */
+extern int32_t bliss_b_verify_batch(const bliss_public_key_t *public_key, const bliss_signature_t sigs[],
+                                    const uint8_t *const msgs[], const size_t lens[], uint32_t count,
+                                    uint8_t *valid, uint32_t nthreads);
+
+
+/*
+ * Allocate the buffers of a signature of the given kind.
+ * - return BLISS_B_NO_ERROR if this works
+ * - return BLISS_B_BAD_ARGS if kind is not supported
+ * - return BLISS_B_NO_MEM if the allocation fails
+ *
+ * On failure, signature->z1, z2, and c are NULL.
+ */
+extern int32_t bliss_signature_init(bliss_signature_t *signature, bliss_kind_t kind);
+
 extern void bliss_signature_delete(bliss_signature_t *signature);
 
 
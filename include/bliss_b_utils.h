@@ -21,6 +21,17 @@ static inline void secure_free(int32_t **ptr_p, size_t len){
   *ptr_p = NULL;
 }
 
+/*
+ * Same thing for int8_t arrays
+ */
+extern void zero_int8_array(int8_t *ptr, size_t len);
+
+static inline void secure_free_int8(int8_t **ptr_p, size_t len){
+  zero_int8_array(*ptr_p, len);
+  free(*ptr_p);
+  *ptr_p = NULL;
+}
+
 
 
 
@@ -0,0 +1,31 @@
+#ifndef __CDTABLES_H
+#define __CDTABLES_H
+
+#include <stdint.h>
+
+/*
+ * Cumulative distribution tables for sampler_gauss_CDT.
+ *
+ * These tables are generated by ../tools/tables.
+ *
+ * For sigma = 100, 215, 107, 250, 271:
+ * - cdt[i] = floor(2^64 * Pr(|x| <= i)) where x is sampled from
+ *   the discrete Gaussian used by the Bernoulli sampler
+ *   (Pr(x) proportional to exp(-x^2/f) with f = k_sigma^2/ln 2)
+ * - the last entry is the last i such that cdt[i] < 2^64 - 1
+ * - guide has 257 entries: guide[j] is the smallest i such that
+ *   cdt[i] > j * 2^56, and guide[256] = table size.
+ */
+
+/*
+ * Get the table for sigma and store its size in *size
+ * - return NULL if we don't have the table
+ */
+extern const uint64_t *get_cdt(uint32_t sigma, uint32_t *size);
+
+/*
+ * Get the guide table for sigma (NULL if we don't have it)
+ */
+extern const uint16_t *get_cdt_guide(uint32_t sigma);
+
+#endif
@@ -4,12 +4,27 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "shake128.h"
+
 #define SHA3_512_DIGEST_LENGTH 64
 #define EPOOL_HASH_COUNT 10
 #define HASH_LEN_UINT16  (SHA3_512_DIGEST_LENGTH/sizeof(uint16_t))
 #define HASH_LEN_UINT64  (SHA3_512_DIGEST_LENGTH/sizeof(uint64_t))
 
 
+/*
+ * Generators used to refill the pools:
+ * - ENTROPY_SHAKE128: the seed is absorbed once into a SHAKE128 state,
+ *   then the pools are refilled by squeezing 168-byte blocks.
+ * - ENTROPY_SHA3_512: the original generator. Each 64-byte block
+ *   is sha3_512(seed), then seed is incremented. Use this to reproduce
+ *   results (e.g., signatures or keys) obtained with older versions.
+ */
+typedef enum entropy_generator_e {
+  ENTROPY_SHAKE128,
+  ENTROPY_SHA3_512,
+} entropy_generator_t;
+
 /*  Based on the DDLL version */
 typedef struct entropy_s {
   uint64_t   bit_pool;
@@ -17,19 +32,30 @@ typedef struct entropy_s {
   uint16_t   int16_pool[HASH_LEN_UINT16 * EPOOL_HASH_COUNT];
   uint64_t   int64_pool[HASH_LEN_UINT64 * EPOOL_HASH_COUNT];
   uint8_t    seed[SHA3_512_DIGEST_LENGTH];
-  uint32_t   bit_index;
+  uint32_t   bit_count;                      /* number of unused bits in bit_pool */
   uint32_t   char_index;
   uint32_t   int16_index;
   uint32_t   int64_index;
+  entropy_generator_t generator;
+  uint32_t   xof_index;                      /* next byte to use in xof_block */
+  uint64_t   xof_state[25];                  /* SHAKE128 state */
+  uint8_t    xof_block[SHAKE128_RATE];       /* last block squeezed */
  } entropy_t;
 
 
 /*
  * Initialize using a random seed
  * - the seed must be 64 bytes
+ * - this uses the ENTROPY_SHAKE128 generator
  */
 extern void entropy_init(entropy_t *entropy, const uint8_t *seed);
 
+/*
+ * Initialize using a random seed and the given generator
+ * - the seed must be 64 bytes
+ */
+extern void entropy_init_generator(entropy_t *entropy, const uint8_t *seed, entropy_generator_t generator);
+
 /*
  * Get one random bit, unsigned char, or 64-bit unsigned integer
  */
@@ -45,6 +71,39 @@ extern uint64_t  entropy_random_uint64(entropy_t *entropy);
  */
 extern uint32_t entropy_random_bits(entropy_t *entropy, uint32_t n);
 
+/*
+ * Bernoulli trial: return true with probability p
+ * - p is the fixed-point number 0.p[0]p[1]...p[words-1] (in binary,
+ *   64 bits per word, most significant word first)
+ * - the random bits are taken from the same pool as entropy_random_bits,
+ *   and only the bits needed to decide are used.
+ *
+ * The inline version handles the common case (the decision is made
+ * by the bits left in bit_pool); entropy_random_below_slow does the rest.
+ */
+extern bool entropy_random_below_slow(entropy_t *entropy, const uint64_t *p, uint32_t words);
+
+#if defined(__GNUC__)
+static inline bool entropy_random_below(entropy_t *entropy, const uint64_t *p, uint32_t words) {
+  uint64_t d;
+  uint32_t n;
+
+  // fast path: the first bits of bit_pool and p[0] that differ decide
+  if (entropy->bit_count > 0) {
+    d = (entropy->bit_pool ^ p[0]) & (~((uint64_t) 0) << (64 - entropy->bit_count));
+    if (d != 0) {
+      n = (uint32_t) __builtin_clzll(d) + 1;  // number of bits used
+      entropy->bit_pool = n == 64 ? 0 : entropy->bit_pool << n;
+      entropy->bit_count -= n;
+      return (p[0] >> (64 - n)) & 1;
+    }
+  }
+  return entropy_random_below_slow(entropy, p, words);
+}
+#else
+#define entropy_random_below entropy_random_below_slow
+#endif
+
 
 #endif
 
@@ -0,0 +1,48 @@
+#ifndef __GREEDY_SC_H
+#define __GREEDY_SC_H
+
+#include <stdint.h>
+
+/*
+ * GreedySC (step 4 of the signing algorithm) on a compact
+ * representation of the secret key.
+ *
+ * For a polynomial s of size n with small coefficients, the
+ * extension sx of s is the array of 2n int8 defined by
+ *   sx[i] = -s[i] and sx[n + i] = s[i]   for 0 <= i < n.
+ * Then the product x^k * s mod (x^n + 1) is the window
+ * sx[n - k ... 2n - k - 1], so the rotations in greedy_sc don't
+ * need to split the loops.
+ */
+
+/*
+ * Store the extension of s into sx
+ * - s must have n coefficients in [-128, 127]
+ * - sx must have room for 2n elements
+ */
+extern void greedy_sc_extend(int8_t *sx, const int32_t *s, uint32_t n);
+
+/*
+ * Input:  s1x, s2x are the extensions of the secret key s1, s2
+ *         c_indices correspond to the sparse polynomial c
+ * Output: v1 and v2 are output polynomials of size n.
+ *
+ * n must be a multiple of 16 and the coefficients of v1 and v2 must
+ * fit in 16 bits (i.e., kappa * max |s2[i]| < 2^15).
+ *
+ * The computation uses AVX2 or SSE2 if available.
+ */
+extern void greedy_sc(const int8_t *s1x, const int8_t *s2x, uint32_t n, const uint32_t *c_indices, uint32_t kappa,
+                      int32_t *v1, int32_t *v2);
+
+/*
+ * Same thing for n = 256 and n = 512: the loops are specialized
+ * for these sizes.
+ */
+extern void greedy_sc_256(const int8_t *s1x, const int8_t *s2x, const uint32_t *c_indices, uint32_t kappa,
+                          int32_t *v1, int32_t *v2);
+
+extern void greedy_sc_512(const int8_t *s1x, const int8_t *s2x, const uint32_t *c_indices, uint32_t kappa,
+                          int32_t *v1, int32_t *v2);
+
+#endif
@@ -18,6 +18,71 @@ typedef void *ntt_state_t;
 typedef void *ntt_t;   //might be better to bite the bullet and admit it is int32_t*
 
 
+/*
+ * NTT implementations (backends):
+ * - NTT_BACKEND_BLZZD: portable C code from ntt_blzzd.c (all kinds)
+ * - NTT_BACKEND_RED: portable C code from ntt_red.c, using the
+ *   Longa-Naehrig reduction (n=512, q=12289 only)
+ * - NTT_BACKEND_AVX2: AVX2 assembly from ntt_asm.S (n=512, q=12289 only,
+ *   x86_64 processors that support AVX2)
+ * - NTT_BACKEND_INT16: AVX2 code on packed 16-bit integers from
+ *   ntt_api_int16.c (q=12289 and q=7681, so all kinds, x86_64 processors
+ *   that support AVX2)
+ * - NTT_BACKEND_AVX512: same as NTT_BACKEND_AVX2, with the AVX-512 kernels
+ *   from ntt_asm.S (n=512, q=12289 only, x86_64 processors that support
+ *   AVX-512F)
+ *
+ * All backends use the same NTT representation, so NTTs computed
+ * by one backend can be used by another one (e.g., public keys).
+ *
+ * NTT_BACKEND_AUTO means: pick the fastest backend that supports
+ * the kind and the processor.
+ */
+typedef enum ntt_backend_e {
+  NTT_BACKEND_AUTO,
+  NTT_BACKEND_BLZZD,
+  NTT_BACKEND_RED,
+  NTT_BACKEND_AVX2,
+  NTT_BACKEND_INT16,
+  NTT_BACKEND_AVX512,
+} ntt_backend_t;
+
+#define NUM_NTT_BACKENDS (NTT_BACKEND_AVX512+1)
+
+/*
+ * Select the backend used by init_ntt_state:
+ * - by default, init_ntt_state uses the backend named in the environment
+ *   variable BLISS_NTT ("auto", "blzzd", "red", "avx2", "int16",
+ *   or "avx512"),
+ *   or NTT_BACKEND_AUTO if BLISS_NTT is not set (or invalid).
+ * - ntt_force_backend(b) overrides BLISS_NTT for all subsequent
+ *   calls to init_ntt_state. ntt_force_backend(NTT_BACKEND_AUTO)
+ *   restores the automatic selection.
+ *
+ * If the selected backend can't be used (unsupported kind or processor),
+ * init_ntt_state falls back to NTT_BACKEND_AUTO.
+ *
+ * This is intended for benchmarking and testing: it should be called
+ * before any state is created (it's not thread safe).
+ */
+extern void ntt_force_backend(ntt_backend_t backend);
+
+/*
+ * Check whether backend b can be used for kind on this processor.
+ */
+extern bool ntt_backend_supported(ntt_backend_t backend, bliss_kind_t kind);
+
+/*
+ * Name of a backend ("auto", "blzzd", "red", "avx2", "int16", "avx512")
+ */
+extern const char *ntt_backend_name(ntt_backend_t backend);
+
+/*
+ * Backend used by state
+ */
+extern ntt_backend_t ntt_state_backend(const ntt_state_t state);
+
+
 extern ntt_state_t init_ntt_state(bliss_kind_t kind);
 
 extern void delete_ntt_state(ntt_state_t state);
@@ -40,20 +105,65 @@ extern void product_ntt(const ntt_state_t state, ntt_t output, const ntt_t lhs,
 extern bool invert_polynomial(const ntt_state_t state, ntt_t output, const polynomial_t input);
 
 
+/*
+ * Batch API: k polynomials (or NTTs) stored in an interleaved array
+ * of n * k integers, where coefficient i of polynomial l is a[i * k + l].
+ *
+ * Every butterfly then works on k consecutive integers, so the inner
+ * loops are full-width SIMD loops at every stage. The results are the
+ * same as those of forward_ntt, inverse_ntt, and product_ntt on each
+ * polynomial. The loops are fastest when k is a multiple of 8.
+ *
+ * - forward_ntt_batch: output = NTT(input) for each lane
+ * - inverse_ntt_batch: output = inverse NTT(input) for each lane
+ * - product_ntt_batch: output = lhs * rhs (pointwise) for each lane,
+ *   where rhs is a single NTT (not interleaved), for example a public key.
+ *
+ * output may be equal to input (or lhs).
+ */
+extern void forward_ntt_batch(const ntt_state_t state, int32_t *output, const int32_t *input, uint32_t k);
+
+extern void inverse_ntt_batch(const ntt_state_t state, int32_t *output, const int32_t *input, uint32_t k);
+
+extern void product_ntt_batch(const ntt_state_t state, int32_t *output, const int32_t *lhs, const ntt_t rhs, uint32_t k);
+
+/*
+ * Conversion to and from the interleaved layout:
+ * - interleave: output[i * k + l] = polys[l][i]
+ * - deinterleave: polys[l][i] = input[i * k + l]
+ */
+extern void interleave_polynomials(const ntt_state_t state, int32_t *output, const int32_t *const polys[], uint32_t k);
+
+extern void deinterleave_polynomials(const ntt_state_t state, int32_t *const polys[], const int32_t *input, uint32_t k);
+
+
 
 /*
  * Multiplies lhs by rhs and places the result in result.
  * - lhs is a polynomial of degree n.
  * - rhs is an ntt of a polynomial of degree n.
+ * - scratch is an ntt (from init_ntt) used as working space:
+ *   lhs is read once and result is written once, so result may
+ *   be equal to lhs.
+ *
+ * This does not allocate memory. Where the backend supports it, the
+ * pointwise product is fused with the last round of the forward NTT
+ * and the first round of the inverse NTT.
  *
  * returns a polynomial of degree n, whose int32_t coeffs are in [0, q)
  */
+extern void multiply_ntt_into(const ntt_state_t state, polynomial_t result, const polynomial_t lhs, const ntt_t rhs,
+                              ntt_t scratch);
+
+/*
+ * Same thing with a temporary scratch ntt: this allocates memory so
+ * it should not be used on the hot paths (bliss_b_signatures.c uses
+ * the scratch ntt of its contexts).
+ */
 static inline void multiply_ntt(const ntt_state_t state, polynomial_t result, polynomial_t lhs, ntt_t rhs){
   ntt_t temp = init_ntt(state);
 
-  forward_ntt(state, temp, lhs);
-  product_ntt(state, temp, temp,  rhs);
-  inverse_ntt(state, result, temp);
+  multiply_ntt_into(state, result, lhs, rhs, temp);
   delete_ntt(state, temp);
 }
 
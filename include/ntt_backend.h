@@ -0,0 +1,71 @@
+#ifndef __NTT_BACKEND_H
+#define __NTT_BACKEND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ntt_api.h"
+
+/*
+ * Internals of the NTT API: an ntt_state_t is a pointer to an
+ * ntt_state_simple_t, which stores a table of functions (ntt_ops_t)
+ * for the backend selected by init_ntt_state.
+ *
+ * Each backend must use the same NTT representation as ntt_blzzd:
+ * - the NTT of a is in bit-reverse order, with coefficients in [0, q-1]
+ *   (this is the output of a Cooley-Tukey transform on a in standard
+ *   order, so no backend needs a bit-reverse shuffle)
+ * - the roots are the ones of the parameter tables (psi = w[1])
+ * and the forward NTT must accept inputs such that |a[i]| < 2^31/q.
+ */
+
+typedef struct ntt_state_simple_s ntt_state_simple_t;
+
+typedef struct ntt_ops_s {
+  ntt_backend_t backend;
+  const char *name;
+  /* check whether the backend works for n and q on this processor */
+  bool (*supported)(uint32_t n, int32_t q);
+  /* build the backend's own tables in s->data (NULL if the backend has none):
+     return false if we're out of memory */
+  bool (*init)(ntt_state_simple_t *s);
+  /* output = NTT(input) */
+  void (*forward)(const ntt_state_simple_t *s, int32_t *output, const int32_t *input);
+  /* output = inverse NTT(input): input and output are in [0, q-1] */
+  void (*inverse)(const ntt_state_simple_t *s, int32_t *output, const int32_t *input);
+  /* output = lhs * rhs (pointwise): lhs, rhs, and output are in [0, q-1] */
+  void (*product)(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs);
+  /* output = lhs * rhs where rhs is an NTT, using scratch (n integers) as working
+     space (NULL if the backend has no fused version: see multiply_ntt_into) */
+  void (*multiply)(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs,
+                   int32_t *scratch);
+} ntt_ops_t;
+
+struct ntt_state_simple_s {
+  const ntt_ops_t *ops;   /* backend */
+  int32_t  q;             /* field modulus  */
+  int64_t  barrett;       /* Barrett constant for q (see ntt_blzzd.h) */
+  uint32_t n;             /* ring size (x^n+1)  */
+  int32_t  inv_n;         /* 1/n (mod q) */
+  const int32_t *psi_rev;      /* twiddle factors of the forward NTT (see ntt32_fwd) */
+  const int32_t *inv_psi_rev;  /* twiddle factors of the inverse NTT (see ntt32_inv) */
+  void *data;             /* backend tables (see init), freed by delete_ntt_state */
+};
+
+/*
+ * The backends: ntt_avx2_ops, ntt_avx512_ops, and ntt_int16_ops are
+ * defined on x86_64 only
+ */
+extern const ntt_ops_t ntt_blzzd_ops;
+extern const ntt_ops_t ntt_red_ops;
+
+#if defined(BLISS_NTT_ASM)
+extern const ntt_ops_t ntt_avx2_ops;
+extern const ntt_ops_t ntt_avx512_ops;
+#endif
+
+#if defined(__GNUC__) && defined(__x86_64__)
+extern const ntt_ops_t ntt_int16_ops;
+#endif
+
+#endif
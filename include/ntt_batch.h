@@ -0,0 +1,27 @@
+#ifndef __NTT_BATCH_H
+#define __NTT_BATCH_H
+
+#include <stdint.h>
+
+#include "ntt_backend.h"
+
+/*
+ * Batch NTT kernels used by forward_ntt_batch, inverse_ntt_batch,
+ * and product_ntt_batch (see ntt_api.h).
+ *
+ * The k polynomials are interleaved: coefficient i of polynomial l
+ * is stored in a[i * k + l]. The results are the same as those of
+ * ntt_blzzd (and so of all the backends).
+ */
+
+// output = NTT(input) for k interleaved polynomials
+extern void ntt_batch_forward(const ntt_state_simple_t *s, int32_t *output, const int32_t *input, uint32_t k);
+
+// output = inverse NTT(input): input and output are in [0, q-1]
+extern void ntt_batch_inverse(const ntt_state_simple_t *s, int32_t *output, const int32_t *input, uint32_t k);
+
+// output[i * k + l] = lhs[i * k + l] * rhs[i]: rhs is one NTT (not interleaved)
+extern void ntt_batch_product(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs,
+                              uint32_t k);
+
+#endif
@@ -7,20 +7,39 @@
 #include <stdint.h>
 #include <stddef.h>
 
-// FFT operation (forward and inverse).
-void ntt32_fft(int32_t v[], uint32_t n, int32_t q, const int32_t w[]);
+// Barrett constant for q: m = floor(2^NTT32_BARRETT_SHIFT / q).
+// The functions below take q and m = ntt32_barrett(q).
+#define NTT32_BARRETT_SHIFT 43
 
-// Flip the order after inverse FFT.
-void ntt32_flp(int32_t v[], uint32_t n, int32_t q);
+int64_t ntt32_barrett(int32_t q);
+
+// Forward NTT v = NTT(t): t in standard order, v in bit-reverse order.
+// p[k + j] = psi^(n/2k) * omega^(n/2k)^bitrev(j) for k = 1, 2, ..., n/2 and j < k.
+void ntt32_fwd(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], const int32_t p[]);
+
+// Inverse NTT v = NTT^-1(t): t in bit-reverse order, v in standard order.
+// p[k + j] = psi^-(n/2k) * omega^-(n/2k)^bitrev(j), inv_n = 1/n mod q.
+void ntt32_inv(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], const int32_t p[], int32_t inv_n);
+
+// Negacyclic product v = t * u, where u is in the NTT representation (u = ntt32_fwd(...)):
+// same as ntt32_fwd, ntt32_xmu, and ntt32_inv with the last forward round, the product,
+// and the first inverse round fused. pf and pi are the tables of ntt32_fwd and ntt32_inv.
+// w is a scratch array of n integers.
+void ntt32_mul(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], const int32_t u[], int32_t w[],
+               const int32_t pf[], const int32_t pi[], int32_t inv_n);
 
 // Elementvise vector product  v = t (*) u
-void ntt32_xmu(int32_t v[], uint32_t n, int32_t q, const int32_t t[], const int32_t u[]);
+void ntt32_xmu(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], const int32_t u[]);
+
+// Elementwise inverse v = 1/t (Montgomery's trick): all t[i] must be non-zero.
+// w is a scratch array of n integers.
+void ntt32_xinv(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], int32_t w[]);
 
 // Multiply vector with a scalar  v = v * c
-void ntt32_cmu(int32_t v[], uint32_t n, int32_t q, const int32_t t[], int32_t c);
+void ntt32_cmu(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], int32_t c);
 
-// Compute x^n (mod q).
-int32_t ntt32_pwr(int32_t x, int32_t n, int32_t q);
+// Compute x^n (mod q) for 0 <= x < q.
+int32_t ntt32_pwr(int32_t x, int32_t n, int32_t q, int64_t m);
 
 #endif
 
@@ -0,0 +1,51 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 512
+ * - psi = 10302
+ * - omega = psi^2 = 3400
+ * - inverse of psi = 8974
+ * - inverse of omega = 2859
+ * - inverse of n = 12265
+ * - inverse of k = 8193
+ */
+
+#ifndef __NTT_RED512_TABLES_H
+#define __NTT_RED512_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt_red512_psi = 10302;
+static const int32_t ntt_red512_omega = 3400;
+static const int32_t ntt_red512_inv_psi = 8974;
+static const int32_t ntt_red512_inv_omega = 2859;
+static const int32_t ntt_red512_inv_n = 12265;
+static const int32_t ntt_red512_inv_k = 8193;
+static const int32_t ntt_red512_rescale8 = 4411;
+static const int32_t ntt_red512_rescale6 = 2832;
+
+/*
+ * POWERS OF PSI
+ */
+extern const int16_t ntt_red512_psi_powers[512];
+extern const int16_t ntt_red512_inv_psi_powers[512];
+extern const int16_t ntt_red512_scaled_inv_psi_powers[512];
+extern const int16_t ntt_red512_scaled_inv_psi_powers_var[512];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const int16_t ntt_red512_omega_powers[512];
+extern const int16_t ntt_red512_omega_powers_rev[512];
+extern const int16_t ntt_red512_inv_omega_powers[512];
+extern const int16_t ntt_red512_inv_omega_powers_rev[512];
+extern const int16_t ntt_red512_mixed_powers[512];
+extern const int16_t ntt_red512_mixed_powers_rev[512];
+extern const int16_t ntt_red512_inv_mixed_powers[512];
+extern const int16_t ntt_red512_inv_mixed_powers_rev[512];
+
+#endif /* __NTT_RED512_TABLES_H */
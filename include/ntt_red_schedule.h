@@ -0,0 +1,60 @@
+#ifndef __NTT_RED_SCHEDULE_H
+#define __NTT_RED_SCHEDULE_H
+
+#include <stdint.h>
+
+/*
+ * BD: lazy multiplication for the red and avx2 backends (n=512, q=12289).
+ *
+ * The ntt_red functions don't reduce modulo q: red(x) and the NTT
+ * butterflies let the coefficients grow. The full product
+ *   forward NTT, pointwise product, inverse NTT
+ * only needs a reduction pass where the coefficients could otherwise
+ * overflow 32 bits. A schedule is the list of steps for the product,
+ * with reductions only where they are needed.
+ *
+ * The schedule is data, so that the interval analysis in
+ * ntt_variants/interval_abstraction checks the schedule compiled into
+ * the library (make check_bounds). It fails if a step may overflow.
+ *
+ * Steps, applied to the array a (the result), with the factor each
+ * step multiplies the result by (modulo q):
+ * - NTT_RED_CENTER: a[i] = lhs[i] * arg mod q in [-(q-1)/2, (q-1)/2]   (arg)
+ * - NTT_RED_FORWARD: mulntt_red_ct_std2rev with ntt_red512_mixed_powers_rev   (1)
+ * - NTT_RED_REDUCE: reduce_array   (3)
+ * - NTT_RED_REDUCE_TWICE: reduce_array_twice   (9)
+ * - NTT_RED_PRODUCT: a[i] = red(a[i] * rhs[i]), rhs[i] in [0, q-1]   (3)
+ * - NTT_RED_INVERSE: nttmul_red_gs_rev2std with ntt_red512_inv_mixed_powers_rev
+ *   (n, since there's no division by n)
+ * - NTT_RED_SCALE: a[i] = red(a[i] * arg)   (3 * arg)
+ * - NTT_RED_CORRECT: map [-q, 2q-1] to [0, q-1]   (1)
+ * - NTT_RED_END: end of the schedule
+ *
+ * The first step must be NTT_RED_CENTER (a is not initialized before
+ * it), the last step must be NTT_RED_CORRECT, and the product of the
+ * factors must be 1 modulo q (check_bounds checks all three).
+ */
+typedef enum ntt_red_op_e {
+  NTT_RED_END,
+  NTT_RED_CENTER,
+  NTT_RED_FORWARD,
+  NTT_RED_REDUCE,
+  NTT_RED_REDUCE_TWICE,
+  NTT_RED_PRODUCT,
+  NTT_RED_INVERSE,
+  NTT_RED_SCALE,
+  NTT_RED_CORRECT,
+} ntt_red_op_t;
+
+typedef struct ntt_red_step_s {
+  ntt_red_op_t op;
+  int32_t arg;
+} ntt_red_step_t;
+
+/*
+ * Schedule used by multiply_ntt_into (see ntt_red512_schedule.c):
+ * lhs must satisfy |lhs[i]| < 2^31/q as for forward_ntt.
+ */
+extern const ntt_red_step_t ntt_red512_mul_schedule[];
+
+#endif /* __NTT_RED_SCHEDULE_H */
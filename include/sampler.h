@@ -10,14 +10,36 @@
 #include "entropy.h"
 #include "bliss_b_params.h"
 
+/*
+ * Gaussian sampling methods:
+ * - SAMPLER_BERNOULLI: Algorithms 11 and 12 of DDLL (tables from tables.h)
+ * - SAMPLER_CDT: binary search in a cumulative distribution table
+ *   (tables from cdtables.h)
+ */
+typedef enum sampler_method_e {
+  SAMPLER_BERNOULLI,
+  SAMPLER_CDT,
+} sampler_method_t;
+
+/*
+ * Bounds on ell and precision/64 (see tables.h)
+ */
+#define SAMPLER_MAX_ELL   22
+#define SAMPLER_MAX_WORDS 2
+
 typedef struct sampler_s {
   entropy_t *entropy;
+  sampler_method_t method; /* method used by sampler_gauss and sampler_gauss_n */
   const uint8_t *c;      /* the table we will use for Boolean sampling (from tables.h) */
-  const uint8_t *cdt;    /* the cumulative distribution table we will use (from cdtables.h) */
+  const uint64_t *cdt;   /* the cumulative distribution table we will use (from cdtables.h) */
+  const uint16_t *cdt_guide; /* guide table for cdt (from cdtables.h) */
+  uint32_t cdt_size;     /* number of entries in cdt */
   uint32_t sigma;        /* the standard deviation of the distribution */
   uint32_t ell;          /* rows in the table     */
   uint32_t precision;    /* precision used in computing the tables */
   uint32_t columns;      /* columns = precision/8 */
+  uint32_t words;        /* words = precision/64 */
+  uint64_t c_words[SAMPLER_MAX_ELL * SAMPLER_MAX_WORDS]; /* c as native 64bit words: row i is c_words[i * words ...] */
   uint16_t k_sigma;      /* k_sigma = ceiling[ sqrt(2*ln 2) * sigma ]  */
   uint16_t k_sigma_bits; /* number of significant bits in k_sigma */
 } sampler_t;
@@ -35,6 +57,15 @@ typedef struct sampler_s {
  */
 extern bool sampler_init(sampler_t *sampler, uint32_t sigma, uint32_t ell, uint32_t precision, entropy_t *entropy);
 
+/*
+ * Select the method used by sampler_gauss and sampler_gauss_n.
+ * sampler_init selects SAMPLER_BERNOULLI.
+ *
+ * This returns false (and keeps the current method) if there's no table
+ * for the sampler's sigma.
+ */
+extern bool sampler_set_method(sampler_t *sampler, sampler_method_t method);
+
 
 /* 
  * Sampling Bernoulli_p with p a constant in [0, 1]
@@ -44,6 +75,9 @@ extern bool sampler_init(sampler_t *sampler, uint32_t sigma, uint32_t ell, uint3
  * - the constant is encoded using big-endian format
  *
  * - returns true with probability p, false with probability 1-p
+ *
+ * sampler_gauss and sampler_ber_exp don't use this function: they
+ * use the rows of the table converted to 64bit words (c_words).
  */
 extern bool sampler_ber(sampler_t *sampler, const uint8_t *val);
 
@@ -73,15 +107,29 @@ extern uint32_t sampler_pos_binary(sampler_t *sample);
 
 /* 
  * Sampling the Gaussian distribution exp(-x^2/(2*sigma*sigma))
+ * using the sampler's method.
  * Returns the sampled value.
  * Does not fail.
  */
 extern int32_t sampler_gauss(sampler_t *sampler);
 
+/*
+ * Fill out[0 ... n-1] with n independent samples from the same
+ * distribution as sampler_gauss.
+ * This draws the random bits in bulk and runs the rejection steps over
+ * arrays, so it's faster than n calls to sampler_gauss (but it does not
+ * consume the random bits in the same order).
+ */
+extern void sampler_gauss_n(sampler_t *sampler, int32_t *out, uint32_t n);
+
 /* 
  * Sampling the Gaussian distribution exp(-x^2/(2*sigma*sigma)) using a cumulative distribution table
  * Returns the sampled value.
  * Does not fail.
+ *
+ * The sampler must have a table (i.e., sampler->cdt must not be NULL).
+ * Sampling |x| takes one 64bit random word, the guide table narrows
+ * the binary search to a few entries.
  */
 extern int32_t sampler_gauss_CDT(sampler_t *sampler);
 
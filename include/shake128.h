@@ -17,4 +17,12 @@ extern void sha3_256(unsigned char *output, const unsigned char *input, unsigned
 
 extern void sha3_512(unsigned char *output, const unsigned char *input, unsigned int inputByteLen);
 
+/*
+ * Four independent hashes: output[i] = sha3_512(input[i]) for i = 0 ... 3.
+ * - all inputs have length inputByteLen
+ * - each output must be an array of 64 bytes
+ * On x86_64 processors with AVX2, the four hashes are computed in parallel.
+ */
+extern void sha3_512x4(unsigned char *const output[4], const unsigned char *const input[4], unsigned int inputByteLen);
+
 #endif /* __SHAKE128_H */
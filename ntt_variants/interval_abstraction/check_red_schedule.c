@@ -0,0 +1,238 @@
+/*
+ * Check the reduction schedule compiled into the library
+ * (ntt_red512_mul_schedule in ../../src/ntt_red512_schedule.c).
+ *
+ * We run the interval analysis on every step of the schedule, starting
+ * from the worst-case inputs:
+ * - lhs[i] in [-2^31/q, 2^31/q] (the precondition of forward_ntt)
+ * - rhs[i] in [0, q-1] (an NTT)
+ * and we check that
+ * - no interval exceeds [INT32_MIN, INT32_MAX], including the
+ *   intermediate rounds of the NTTs
+ * - the product lhs[i] * arg in NTT_RED_CENTER fits 32 bits, and the
+ *   64bit products in NTT_RED_PRODUCT and NTT_RED_SCALE are within
+ *   the bounds required by mul_reduce_array and scalar_mul_reduce_array
+ * - the schedule starts with NTT_RED_CENTER and ends with
+ *   NTT_RED_CORRECT, on inputs in [-q, 2q-1]
+ * - the factors of all the steps multiply to 1 modulo q
+ *
+ * This is built and run by 'make check_bounds' in the top-level
+ * directory. It returns 1 if the schedule is unsafe.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ntt_red_interval.h"
+#include "ntt_red512_tables.h"
+#include "ntt_red_schedule.h"
+
+#define Q 12289
+#define N 512
+
+/*
+ * Bounds on the 64bit products in mul_reduce_array and scalar_mul_reduce_array
+ */
+#define MIN_PRODUCT (-8796042698752LL)
+#define MAX_PRODUCT 8796093026303LL
+
+static const char *const op_name[] = {
+  "end", "center", "forward", "reduce", "reduce_twice", "product", "inverse", "scale", "correct",
+};
+
+static interval_t *a[N];
+static interval_t *rhs[N];
+
+static uint32_t errors;
+
+static int64_t mul_mod(int64_t x, int64_t y) {
+  x = (x * y) % Q;
+  return x < 0 ? x + Q : x;
+}
+
+static int64_t min4(int64_t a, int64_t b, int64_t c, int64_t d) {
+  if (b < a) a = b;
+  if (c < a) a = c;
+  return d < a ? d : a;
+}
+
+static int64_t max4(int64_t a, int64_t b, int64_t c, int64_t d) {
+  if (b > a) a = b;
+  if (c > a) a = c;
+  return d > a ? d : a;
+}
+
+/*
+ * Check that x * y fits the bounds of the 64bit products for x in a[i] and y in [l, h]
+ */
+static void check_products(uint32_t step, int64_t l, int64_t h) {
+  int64_t min, max;
+  uint32_t i;
+
+  for (i = 0; i < N; i++) {
+    min = min4(a[i]->min * l, a[i]->min * h, a[i]->max * l, a[i]->max * h);
+    max = max4(a[i]->min * l, a[i]->min * h, a[i]->max * l, a[i]->max * h);
+    if (min < MIN_PRODUCT || max > MAX_PRODUCT) {
+      fprintf(stderr, "step %"PRIu32" (%s): possible overflow in a[%"PRIu32"] * [%"PRId64", %"PRId64"]\n",
+              step, op_name[ntt_red512_mul_schedule[step].op], i, l, h);
+      errors ++;
+      return;
+    }
+  }
+}
+
+/*
+ * Check that all intervals are in [INT32_MIN, INT32_MAX] after a step
+ */
+static void check_int32(uint32_t step) {
+  uint32_t i;
+
+  for (i = 0; i < N; i++) {
+    if (a[i]->min < (int64_t) INT32_MIN || a[i]->max > (int64_t) INT32_MAX) {
+      fprintf(stderr, "step %"PRIu32" (%s): possible overflow: a[%"PRIu32"] in [%"PRId64", %"PRId64"]\n",
+              step, op_name[ntt_red512_mul_schedule[step].op], i, a[i]->min, a[i]->max);
+      errors ++;
+      return;
+    }
+  }
+}
+
+static void show_bounds(uint32_t step) {
+  int64_t min, max;
+  uint32_t i;
+
+  min = a[0]->min;
+  max = a[0]->max;
+  for (i = 1; i < N; i++) {
+    if (a[i]->min < min) min = a[i]->min;
+    if (a[i]->max > max) max = a[i]->max;
+  }
+  printf("step %"PRIu32": %-12s a[i] in [%"PRId64", %"PRId64"]\n",
+         step, op_name[ntt_red512_mul_schedule[step].op], min, max);
+}
+
+static void set_all(interval_t **v, int64_t min, int64_t max) {
+  uint32_t i;
+
+  for (i = 0; i < N; i++) {
+    delete_interval(v[i]);
+    v[i] = interval(min, max);
+  }
+}
+
+int main(void) {
+  const ntt_red_step_t *step;
+  interval_t *c[N];
+  int64_t bound, factor;
+  uint32_t i, k;
+
+  abstract_verbose = false;
+
+  bound = INT32_MAX / Q;
+  for (i = 0; i < N; i++) {
+    a[i] = interval(-bound, bound);
+    rhs[i] = interval(0, Q - 1);
+  }
+
+  if (ntt_red512_mul_schedule[0].op != NTT_RED_CENTER) {
+    fprintf(stderr, "the schedule must start with NTT_RED_CENTER\n");
+    return 1;
+  }
+
+  factor = 1;
+  for (k = 0; ntt_red512_mul_schedule[k].op != NTT_RED_END; k++) {
+    step = ntt_red512_mul_schedule + k;
+    switch (step->op) {
+    case NTT_RED_CENTER:
+      // lhs[i] * arg is computed on 32 bits
+      if (step->arg < 0 || bound * step->arg > INT32_MAX) {
+        fprintf(stderr, "step %"PRIu32" (center): possible overflow in lhs[i] * %"PRId32"\n", k, step->arg);
+        errors ++;
+      }
+      set_all(a, -(Q - 1)/2, (Q - 1)/2);
+      factor = mul_mod(factor, step->arg);
+      break;
+
+    case NTT_RED_FORWARD:
+      abstract_mulntt_red_ct_std2rev(a, N, ntt_red512_mixed_powers_rev);
+      break;
+
+    case NTT_RED_REDUCE:
+      abstract_reduce_array(a, N);
+      factor = mul_mod(factor, 3);
+      break;
+
+    case NTT_RED_REDUCE_TWICE:
+      abstract_reduce_array_twice(a, N);
+      factor = mul_mod(factor, 9);
+      break;
+
+    case NTT_RED_PRODUCT:
+      check_products(k, 0, Q - 1);
+      abstract_mul_reduce_array(c, N, (const interval_t **) a, (const interval_t **) rhs);
+      for (i = 0; i < N; i++) {
+        delete_interval(a[i]);
+        a[i] = c[i];
+      }
+      factor = mul_mod(factor, 3);
+      break;
+
+    case NTT_RED_INVERSE:
+      abstract_nttmul_red_gs_rev2std(a, N, ntt_red512_inv_mixed_powers_rev);
+      factor = mul_mod(factor, N);
+      break;
+
+    case NTT_RED_SCALE:
+      check_products(k, step->arg, step->arg);
+      abstract_scalar_mul_reduce_array(a, N, step->arg);
+      factor = mul_mod(factor, mul_mod(3, step->arg));
+      break;
+
+    case NTT_RED_CORRECT:
+      for (i = 0; i < N; i++) {
+        if (a[i]->min < -Q || a[i]->max >= 2 * Q) {
+          fprintf(stderr, "step %"PRIu32" (correct): a[%"PRIu32"] in [%"PRId64", %"PRId64"] is not in [-q, 2q-1]\n",
+                  k, i, a[i]->min, a[i]->max);
+          errors ++;
+          break;
+        }
+      }
+      if (i == N) {
+        abstract_correct(a, N);
+      }
+      break;
+
+    default:
+      fprintf(stderr, "step %"PRIu32": invalid operation %d\n", k, (int) step->op);
+      return 1;
+    }
+
+    check_int32(k);
+    show_bounds(k);
+    if (errors > 0) break;
+  }
+
+  if (errors == 0 && (k == 0 || ntt_red512_mul_schedule[k - 1].op != NTT_RED_CORRECT)) {
+    fprintf(stderr, "the schedule must end with NTT_RED_CORRECT\n");
+    errors ++;
+  }
+  if (errors == 0 && factor != 1) {
+    fprintf(stderr, "the schedule multiplies the result by %"PRId64" (mod q), not by 1\n", factor);
+    errors ++;
+  }
+  errors += abstract_overflows;
+
+  for (i = 0; i < N; i++) {
+    delete_interval(a[i]);
+    delete_interval(rhs[i]);
+  }
+
+  if (errors > 0) {
+    printf("ntt_red512_mul_schedule: FAILED\n");
+    return 1;
+  }
+  printf("ntt_red512_mul_schedule: no overflow\n");
+
+  return 0;
+}
@@ -229,18 +229,24 @@ void abstract_scalar_mul_reduce_array(interval_t **a, uint32_t n, int32_t c) {
 /*
  * Print intervals & check overflow
  */
+bool abstract_verbose = true;
+uint32_t abstract_overflows = 0;
+
 static void show_intervals(const char *prefix, uint32_t loop_counter, interval_t **a, uint32_t n) {
   uint32_t i;
 
-  printf("%s[%"PRIu32"]\n", prefix, loop_counter);
-  for (i=0; i<n; i++) {
-    printf("     a[%"PRIu32"] in [%"PRId64", %"PRId64"]\n",  i, a[i]->min, a[i]->max);
+  if (abstract_verbose) {
+    printf("%s[%"PRIu32"]\n", prefix, loop_counter);
+    for (i=0; i<n; i++) {
+      printf("     a[%"PRIu32"] in [%"PRId64", %"PRId64"]\n",  i, a[i]->min, a[i]->max);
+    }
+    printf("\n");
   }
-  printf("\n");
 
   for (i=0; i<n; i++) {
     if (a[i]->min < (int64_t) INT32_MIN || a[i]->max > (int64_t) INT32_MAX) {
       printf("    Warnning: possible overflow for a[%"PRIu32"]: bounds = [%"PRId64", %"PRId64"]\n", i, a[i]->min, a[i]->max);
+      abstract_overflows ++;
     }
   }
 
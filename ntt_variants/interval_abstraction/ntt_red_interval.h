@@ -61,9 +61,20 @@
 #ifndef NTT_RED_INTERVAL_H
 #define NTT_RED_INTERVAL_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "intervals.h"
 
+
+/*
+ * Reporting: the NTT functions below print the intervals after every
+ * main iteration if abstract_verbose is true (the default).
+ * abstract_overflows counts the warnings (intervals not included in
+ * [INT32_MIN, INT32_MAX]), whether they're printed or not.
+ */
+extern bool abstract_verbose;
+extern uint32_t abstract_overflows;
+
 /*****************
  * NORMALIZATION *
  ****************/
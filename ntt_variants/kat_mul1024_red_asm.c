@@ -64,5 +64,10 @@ int main(void){
   printf("\nTesting ntt_red1024_product5_asm (KAT values)\n");
   test_mul_from_KAT_values(ntt_red1024_product5_asm);
 
+  if (avx512_supported()) {
+    printf("\nTesting ntt_red1024_product5_avx512 (KAT values)\n");
+    test_mul_from_KAT_values(ntt_red1024_product5_avx512);
+  }
+
   return 0;
 }
@@ -1,9 +1,16 @@
 /*
- * Build tables for ntts.h (using Q=12289)
+ * Build tables for ntt_red.h
  *
- * Input: n and psi such that
- * - psi^n = -1 modulo Q
+ * Input: n, psi, and optionally q (default 12289) such that
+ * - psi^n = -1 modulo q
  * - n is a power of two
+ * - q is prime and q = k * 2^m + 1 with k odd (e.g., 12289 = 3 * 2^12 + 1
+ *   or 7681 = 15 * 2^9 + 1)
+ *
+ * For q=12289, the tables are named ntt_red<n>_xxx and stored in
+ * ntt_red<n>_tables.h and ntt_red<n>_tables.c. For other q, they are
+ * named ntt_red<n>_q<q>_xxx and stored in ntt_red<n>_q<q>_tables.h
+ * and ntt_red<n>_q<q>_tables.c.
  */
 
 #include <assert.h>
@@ -16,6 +23,7 @@
 typedef struct parameters_s {
   uint32_t q;        // modulus
   uint32_t k;        // q is (k * 2^m + 1)
+  uint32_t m;
   uint32_t inv_k;    // inverse of k modulo q
   uint32_t n;        // size
   uint32_t inv_n;    // inverse of n
@@ -115,14 +123,18 @@ static uint32_t reverse(uint32_t i, uint32_t k) {
 
 /*
  * Search for k such that q-1 = k * a power of 2
+ * - the exponent is stored in *m
  */
-static uint32_t find_k(uint32_t q) {
-  uint32_t x;
+static uint32_t find_k(uint32_t q, uint32_t *m) {
+  uint32_t x, i;
 
   x = q-1;
+  i = 0;
   while ((x & 1) == 0) {
     x >>= 1;
+    i ++;
   }
+  *m = i;
   return x;
 }
 
@@ -227,6 +239,21 @@ static void build_rev_table(uint32_t *a, uint32_t n, uint32_t q, uint32_t x, uin
   }
 }
 
+/*
+ * Prefix of all names: ntt_red<n> or ntt_red<n>_q<q>
+ */
+#define BUFFER_SIZE 100
+
+static char prefix[BUFFER_SIZE];
+
+static void set_prefix(uint32_t n, uint32_t q) {
+  if (q == 12289) {
+    snprintf(prefix, BUFFER_SIZE, "ntt_red%"PRIu32, n);
+  } else {
+    snprintf(prefix, BUFFER_SIZE, "ntt_red%"PRIu32"_q%"PRIu32, n, q);
+  }
+}
+
 /*
  * Convert from [0 .. q-1] to [-(q-1)/2, +(q-1)/2]
  */
@@ -238,13 +265,13 @@ static int32_t shift(uint32_t x, uint32_t q) {
 
 /*
  * Print table a:
- * - name = string to use for the array + we add the prefix ntt_red<n>
+ * - name = string to use for the array + we add the prefix
  */
 static void print_table(FILE *f, const char* name, uint32_t *a, uint32_t n, uint32_t q) {
   uint32_t i, k;
 
   k = 0;
-  fprintf(f, "const int16_t ntt_red%"PRIu32"_%s[%"PRIu32"] = {\n", n, name, n);
+  fprintf(f, "const int16_t %s_%s[%"PRIu32"] = {\n", prefix, name, n);
   for (i=0; i<n; i++) {
     if (k == 0) fprintf(f, "   ");
     fprintf(f, " %5"PRId32",", shift(a[i], q));
@@ -268,6 +295,7 @@ static void print_header(FILE *f, parameters_t *p) {
 	  " * Parameters:\n"
 	  " * - q = %"PRIu32"\n"
 	  " * - k = %"PRIu32"\n"
+	  " * - m = %"PRIu32"\n"
 	  " * - n = %"PRIu32"\n"
 	  " * - psi = %"PRIu32"\n"
 	  " * - omega = psi^2 = %"PRIu32"\n"
@@ -276,7 +304,7 @@ static void print_header(FILE *f, parameters_t *p) {
 	  " * - inverse of n = %"PRIu32"\n"
 	  " * - inverse of k = %"PRIu32"\n"
 	  " */\n\n", 
-	  p->q, p->k, p->n, p->psi, p->phi,
+	  p->q, p->k, p->m, p->n, p->psi, p->phi,
 	  p->inv_psi, p->inv_phi, p->inv_n, p->inv_k);
 }
 
@@ -287,12 +315,25 @@ static void print_comment(FILE *f, const char *what) {
   fprintf(f, "/*\n * %s\n */\n", what);
 }
 
-static void print_param_def(FILE *f, const char *name, uint32_t n, uint32_t val) {
-  fprintf(f, "static const int32_t ntt_red%"PRIu32"_%s = %"PRIu32";\n", n, name, val);
+static void print_param_def(FILE *f, const char *name, uint32_t val) {
+  fprintf(f, "static const int32_t %s_%s = %"PRIu32";\n", prefix, name, val);
 }
 
 static void print_table_decl(FILE *f, const char *name, uint32_t n) {
-  fprintf(f, "extern const int16_t ntt_red%"PRIu32"_%s[%"PRIu32"];\n", n, name, n);
+  fprintf(f, "extern const int16_t %s_%s[%"PRIu32"];\n", prefix, name, n);
+}
+
+/*
+ * Guard for the header: upper-case prefix
+ */
+static void print_guard(FILE *f) {
+  const char *c;
+
+  fprintf(f, "__");
+  for (c = prefix; *c != '\0'; c++) {
+    fputc((*c >= 'a' && *c <= 'z') ? *c - 'a' + 'A' : *c, f);
+  }
+  fprintf(f, "_TABLES_H");
 }
 
 static void print_declarations(FILE *f, parameters_t *p) {
@@ -301,19 +342,22 @@ static void print_declarations(FILE *f, parameters_t *p) {
   print_header(f, p);
   n = p->n;
 
-  fprintf(f, "#ifndef __NTT_RED%"PRIu32"_TABLES_H\n", n);
-  fprintf(f, "#define __NTT_RED%"PRIu32"_TABLES_H\n\n", n);
+  fprintf(f, "#ifndef ");
+  print_guard(f);
+  fprintf(f, "\n#define ");
+  print_guard(f);
+  fprintf(f, "\n\n");
   fprintf(f, "#include <stdint.h>\n\n");
 
   print_comment(f, "PARAMETERS");
-  print_param_def(f, "psi", n, p->psi);
-  print_param_def(f, "omega", n, p->phi);
-  print_param_def(f, "inv_psi", n, p->inv_psi);
-  print_param_def(f, "inv_omega", n, p->inv_phi);
-  print_param_def(f, "inv_n", n, p->inv_n);
-  print_param_def(f, "inv_k", n, p->inv_k);
-  print_param_def(f, "rescale8", n, rescale_factor8(p->inv_n, p->inv_k, p->q));
-  print_param_def(f, "rescale6", n, rescale_factor6(p->inv_n, p->inv_k, p->q));
+  print_param_def(f, "psi", p->psi);
+  print_param_def(f, "omega", p->phi);
+  print_param_def(f, "inv_psi", p->inv_psi);
+  print_param_def(f, "inv_omega", p->inv_phi);
+  print_param_def(f, "inv_n", p->inv_n);
+  print_param_def(f, "inv_k", p->inv_k);
+  print_param_def(f, "rescale8", rescale_factor8(p->inv_n, p->inv_k, p->q));
+  print_param_def(f, "rescale6", rescale_factor6(p->inv_n, p->inv_k, p->q));
   fprintf(f, "\n");
 
   print_comment(f, "POWERS OF PSI");
@@ -334,7 +378,9 @@ static void print_declarations(FILE *f, parameters_t *p) {
   print_table_decl(f, "inv_mixed_powers_rev", n);
   fprintf(f, "\n");
 
-  fprintf(f, "#endif /* __NTT_RED%"PRIu32"_TABLES_H */\n", n);
+  fprintf(f, "#endif /* ");
+  print_guard(f);
+  fprintf(f, " */\n");
 }
 
 /*
@@ -356,7 +402,7 @@ static void print_tables(FILE *f, parameters_t *p) {
 
   print_header(f, p);
 
-  fprintf(f, "#include \"ntt_red%"PRIu32"_tables.h\"\n\n", n);
+  fprintf(f, "#include \"%s_tables.h\"\n\n", prefix);
 
   // powers of psi * inverse(k)
   build_power_table(table, n, q, p->inv_k, p->psi);
@@ -398,18 +444,16 @@ static void print_tables(FILE *f, parameters_t *p) {
 }
 
 /*
- * Open file: name is "ntt<size>_tables.h" or "ntt<size>_tables.c"
+ * Open file: name is "<prefix>_tables.h" or "<prefix>_tables.c"
  * - return NULL if we can't create the file
  */
-#define BUFFER_SIZE 100
-
-static FILE *open_file(uint32_t n, const char *suffix) {
+static FILE *open_file(const char *suffix) {
   char filename[BUFFER_SIZE];
   int len;
   FILE *f;
 
   f = NULL;
-  len = snprintf(filename, BUFFER_SIZE, "ntt_red%"PRIu32"_tables.%s", n, suffix);
+  len = snprintf(filename, BUFFER_SIZE, "%s_tables.%s", prefix, suffix);
   if (len < BUFFER_SIZE) {
     f = fopen(filename, "w");
   }
@@ -417,18 +461,28 @@ static FILE *open_file(uint32_t n, const char *suffix) {
 }
 
 int main(int argc, char *argv[]) {
-  uint32_t q, k, inv_k, psi, phi, n, log_n, i, inv_n, inv_psi, inv_phi;
+  uint32_t q, k, m, inv_k, psi, phi, n, log_n, i, inv_n, inv_psi, inv_phi;
   long x;
   parameters_t params;
   FILE *f;
 
-  if (argc != 3) {
-    fprintf(stderr, "Usage: %s <size> <psi>\n", argv[0]);
+  if (argc != 3 && argc != 4) {
+    fprintf(stderr, "Usage: %s <size> <psi> [q]\n", argv[0]);
     exit(EXIT_FAILURE);
   }
+
   q = 12289;
+  if (argc == 4) {
+    // q * q must fit in 32 bits (for power)
+    x = atol(argv[3]);
+    if (x <= 2 || x >= 65536 || (x & 1) == 0) {
+      fprintf(stderr, "Invalid q: %ld. It must be odd and between 3 and 65535\n", x);
+      exit(EXIT_FAILURE);
+    }
+    q = (uint32_t) x;
+  }
 
-  k = find_k(q);
+  k = find_k(q, &m);
   if (k == 0 || k >= q) {
     fprintf(stderr, "Extracted k = %"PRIu32", not between 1 and q-1\n", k);
     exit(EXIT_FAILURE);
@@ -485,6 +539,7 @@ int main(int argc, char *argv[]) {
 
   params.q = q;
   params.k = k;
+  params.m = m;
   params.inv_k = inv_k;
   params.n = n;
   params.inv_n = inv_n;
@@ -494,17 +549,19 @@ int main(int argc, char *argv[]) {
   params.inv_psi = inv_psi;
   params.inv_phi = inv_phi;
 
-  f = open_file(n, "h");
+  set_prefix(n, q);
+
+  f = open_file("h");
   if (f == NULL) {
-    fprintf(stderr, "failed to open file 'ntt_red%"PRIu32"_tables.h'\n", n);
+    fprintf(stderr, "failed to open file '%s_tables.h'\n", prefix);
     exit(EXIT_FAILURE);
   }
   print_declarations(f, &params);
   fclose(f);
 
-  f = open_file(n, "c");
+  f = open_file("c");
   if (f == NULL) {
-    fprintf(stderr, "failed to open file 'ntt_red%"PRIu32"_tables.h'\n", n);
+    fprintf(stderr, "failed to open file '%s_tables.c'\n", prefix);
     exit(EXIT_FAILURE);
   }
   print_tables(f, &params);
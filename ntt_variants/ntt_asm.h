@@ -218,5 +218,37 @@ extern void ntt_red_gs_std2rev_asm(int32_t *a, uint32_t n, const int16_t *p);
  */
 extern void nttmul_red_gs_std2rev_asm(int32_t *a, uint32_t n, const int16_t *p);
 
+/*********************
+ *  AVX-512 KERNELS  *
+ ********************/
+
+/*
+ * Versions of some of the functions above that use the AVX-512F
+ * instructions (16 integers per register instead of 8). They produce
+ * results in the same ranges as the AVX2 functions and must be called
+ * only if avx512_supported() returns true.
+ */
+extern bool avx512_supported(void);
+
+/*
+ * Same as reduce_array_twice_asm and mul_reduce_array_asm:
+ * - n must be positive and a multiple of 16
+ */
+extern void reduce_array_twice_avx512(int32_t *a, uint32_t n);
+extern void mul_reduce_array_avx512(int32_t *a, uint32_t n, const int32_t *b, const int32_t *c);
+
+/*
+ * Same as ntt_red_ct_std2rev_asm, mulntt_red_ct_std2rev_asm, and
+ * nttmul_red_gs_rev2std_asm (versions 3, 4, and 6), except that
+ * n must be a power of two and at least 32.
+ *
+ * ntt_red_ct_std2rev_avx512 does not skip the multiplication by
+ * p[t] = inverse(3) in the first block of each round, so its output
+ * may differ from ntt_red_ct_std2rev_asm. It's the same modulo Q.
+ */
+extern void ntt_red_ct_std2rev_avx512(int32_t *a, uint32_t n, const int16_t *p);
+extern void mulntt_red_ct_std2rev_avx512(int32_t *a, uint32_t n, const int16_t *p);
+extern void nttmul_red_gs_rev2std_avx512(int32_t *a, uint32_t n, const int16_t *p);
+
 
 #endif
@@ -1,9 +1,14 @@
 /*
  * BD: variant implementations of NTT and Inverse NTT.
  *
- * All variants are specialized to Q=12289
+ * All variants are specialized to Q=12289 by default.
  * In all variants, we assume: omega is a primitive n-th
  * root of unity and psi^2 = omega.
+ *
+ * Compiling with -DNTT_RED_Q=7681 gives the same functions
+ * for Q = 7681 = 15 * 2^9 + 1. The bounds in the comments are
+ * for Q=12289. For Q=7681, the NTTs grow much faster and
+ * need reductions between rounds (see test_red_bounds).
  */
 
 #include <assert.h>
@@ -21,10 +26,33 @@
  * - red(x) = k * (x & mask) - (x >> m)
  *   where mask = (2^m - 1).
  */
+#ifndef NTT_RED_Q
+#define NTT_RED_Q 12289
+#endif
+
+#if NTT_RED_Q == 12289
 #define Q 12289
 #define K 3
 #define M 12
-#define MASK 4095
+#define INV_K 8193
+#elif NTT_RED_Q == 7681
+#define Q 7681
+#define K 15
+#define M 9
+#define INV_K 7169
+#else
+#error "NTT_RED_Q must be 12289 or 7681"
+#endif
+
+#define MASK ((1 << M) - 1)
+
+/*
+ * Bounds on x * y in mul_red: the result k * (z & mask) - (z >> m)
+ * fits in 32 bits. For Q=12289, that's
+ *   -8796042698752 <= x * y <= 8796093026303
+ */
+#define MIN_PRODUCT (- ((INT64_C(2147483647) - K * MASK) << M))
+#define MAX_PRODUCT ((INT64_C(1) << (31 + M)) + MASK)
 
 
 /*
@@ -32,17 +60,17 @@
  */
 // single reduction
 static int32_t red(int32_t x) {
-  return 3 * (x & 4095) - (x >> 12);
+  return K * (x & MASK) - (x >> M);
 }
 
 // reduction of x * y using 64 bit arithmetic
 static int32_t mul_red(int32_t x, int32_t y) {
   int64_t z;
   z = (int64_t) x * y;
-  assert(-8796042698752 <= z && z <= 8796093026303);
-  x = z & 4095;
-  y = z >> 12;
-  return 3 * x - y;
+  assert(MIN_PRODUCT <= z && z <= MAX_PRODUCT);
+  x = z & MASK;
+  y = z >> M;
+  return K * x - y;
 }
 
 #if 0
@@ -82,14 +110,15 @@ void normalize(int32_t *a, uint32_t n) {
 }
 
 /*
- * Same thing but also multiply all coefficients by inverse(3).
+ * Same thing but also multiply all coefficients by inverse(3)
+ * (by inverse(k) in general).
  */
 void normalize_inv3(int32_t *a, uint32_t n) {
   uint32_t i;
   int32_t x;
 
   for (i=0; i<n; i++) {
-    x = ((int64_t) a[i] * 8193) % Q;
+    x = ((int64_t) a[i] * INV_K) % Q;
     if (x < 0) x += Q;
     assert(0 <= x && x < Q);
     a[i] = x;
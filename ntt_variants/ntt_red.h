@@ -44,6 +44,9 @@
  *   m is 12
  *   k is 3
  *
+ * ntt_red.c can also be compiled for Q = 7681 (Bliss-B0) with
+ * -DNTT_RED_Q=7681. Then m is 9 and k is 15.
+ *
  */
 
 #ifndef NTT_RED_H
@@ -0,0 +1,471 @@
+/*
+ * Parameters:
+ * - q = 7681
+ * - k = 15
+ * - m = 9
+ * - n = 256
+ * - psi = 7146
+ * - omega = psi^2 = 2028
+ * - inverse of psi = 7480
+ * - inverse of omega = 1996
+ * - inverse of n = 7651
+ * - inverse of k = 7169
+ */
+
+#include "ntt_red256_q7681_tables.h"
+
+const int16_t ntt_red256_q7681_psi_powers[256] = {
+     -512, -2596, -1401, -3203,   742,  2442,  -700, -1869,
+     1385, -3599, -2466, -1822,  -717,  -455, -2367, -1020,
+      349, -2371,  1120,   -82, -2216,  2686,  -663,  1379,
+     -389,   728,  2251,  1632,  2514,  -815, -1792, -1405,
+    -1063,   311,  2597,   866, -2450, -2701,  1007, -1075,
+     -950,  1304,  1331,  2248,  3237, -3570, -2619,  3223,
+    -3761,  -287,   -75,  1720,  1520,   986,  2479,  2548,
+    -3643, -1969,  1118,   988,  1409, -1077,   120, -2752,
+    -2432,  3031,  -894,  2068,  -316,    78, -3325, -3117,
+      818,   187,  -192,  2867,  2355,  -241, -1642,  2836,
+     3578, -1661, -2361,  3451, -2845,  1237, -1229, -3051,
+    -3768,  3458,  1091,    71,   420, -1951,  -831,  -913,
+    -3129,  -443, -1106,   273,  -116,   612,  2863, -3186,
+     -672, -1487, -3279,  2997,  1934,  2245, -2839, -1973,
+     3258,   557,  1564,   489,  -461,   843,  2174, -3259,
+      -22, -3592,  1470, -2988,   932,   645,   570,  2290,
+     3810, -2885,  -406,  2142, -1501, -3470, -2352, -1364,
+       45, -1032,  -912, -3664,  1585, -3065,  3722, -1891,
+    -2207, -2129,  2227,  -890,   -72,   115,   -77,  2790,
+    -2536, -2777,  3262, -1583,  1995,   334, -2027,  1424,
+    -1421,  -184, -1413,  3217,  -551,  2907, -3683, -3612,
+    -3192,  2538,  1707,   794, -2335, -2778,  3797, -3611,
+    -3727, -3115,  -252, -3438,  3571,  2084, -1195,  1802,
+     3736, -1700,  3142,  1169, -3254, -2697, -1133,  -644,
+    -1105,  -262,  1912, -1347, -1369,  2720, -3491,  1202,
+     2134,  2779,  3349, -2042,  1768, -1117, -1523,   619,
+     -882,  3329,   977,  -387,  -342, -1374, -2286,  1731,
+     3316,   251, -3708,  2082,  -125, -2254,   -27,  -917,
+     -989,  -874,  -951,  1839,  -697, -3474,  -212, -1795,
+      200,   534, -1493,   -69, -1490, -1674, -3087,   130,
+     -421,  2486, -1197,  2872,  -320,  2218, -3756, -2962,
+     2384,  -394,  3403,  -208,  3746,   631,   379, -3059,
+};
+
+const int16_t ntt_red256_q7681_psi_powers_rev[256] = {
+        0,  -512,  -512, -2432,  -512, -2432, -1063, -3129,
+     -512, -2432, -1063, -3129,   349,  3578, -3761,  3258,
+     -512, -2432, -1063, -3129,   349,  3578, -3761,  3258,
+     1385,   818,  -950,  -672,  -389, -3768, -3643,   -22,
+     -512, -2432, -1063, -3129,   349,  3578, -3761,  3258,
+     1385,   818,  -950,  -672,  -389, -3768, -3643,   -22,
+      742,  -316, -2450,  -116, -2216, -2845,  1520,  -461,
+     -717,  2355,  3237,  1934,  2514,   420,  1409,   932,
+     -512, -2432, -1063, -3129,   349,  3578, -3761,  3258,
+     1385,   818,  -950,  -672,  -389, -3768, -3643,   -22,
+      742,  -316, -2450,  -116, -2216, -2845,  1520,  -461,
+     -717,  2355,  3237,  1934,  2514,   420,  1409,   932,
+    -1401,  -894,  2597, -1106,  1120, -2361,   -75,  1564,
+    -2466,  -192,  1331, -3279,  2251,  1091,  1118,  1470,
+     -700, -3325,  1007,  2863,  -663, -1229,  2479,  2174,
+    -2367, -1642, -2619, -2839, -1792,  -831,   120,   570,
+     -512, -2432, -1063, -3129,   349,  3578, -3761,  3258,
+     1385,   818,  -950,  -672,  -389, -3768, -3643,   -22,
+      742,  -316, -2450,  -116, -2216, -2845,  1520,  -461,
+     -717,  2355,  3237,  1934,  2514,   420,  1409,   932,
+    -1401,  -894,  2597, -1106,  1120, -2361,   -75,  1564,
+    -2466,  -192,  1331, -3279,  2251,  1091,  1118,  1470,
+     -700, -3325,  1007,  2863,  -663, -1229,  2479,  2174,
+    -2367, -1642, -2619, -2839, -1792,  -831,   120,   570,
+    -2596,  3031,   311,  -443, -2371, -1661,  -287,   557,
+    -3599,   187,  1304, -1487,   728,  3458, -1969, -3592,
+     2442,    78, -2701,   612,  2686,  1237,   986,   843,
+     -455,  -241, -3570,  2245,  -815, -1951, -1077,   645,
+    -3203,  2068,   866,   273,   -82,  3451,  1720,   489,
+    -1822,  2867,  2248,  2997,  1632,    71,   988, -2988,
+    -1869, -3117, -1075, -3186,  1379, -3051,  2548, -3259,
+    -1020,  2836,  3223, -1973, -1405,  -913, -2752,  2290,
+};
+
+const int16_t ntt_red256_q7681_inv_psi_powers[256] = {
+     -512,  3059,  -379,  -631, -3746,   208, -3403,   394,
+    -2384,  2962,  3756, -2218,   320, -2872,  1197, -2486,
+      421,  -130,  3087,  1674,  1490,    69,  1493,  -534,
+     -200,  1795,   212,  3474,   697, -1839,   951,   874,
+      989,   917,    27,  2254,   125, -2082,  3708,  -251,
+    -3316, -1731,  2286,  1374,   342,   387,  -977, -3329,
+      882,  -619,  1523,  1117, -1768,  2042, -3349, -2779,
+    -2134, -1202,  3491, -2720,  1369,  1347, -1912,   262,
+     1105,   644,  1133,  2697,  3254, -1169, -3142,  1700,
+    -3736, -1802,  1195, -2084, -3571,  3438,   252,  3115,
+     3727,  3611, -3797,  2778,  2335,  -794, -1707, -2538,
+     3192,  3612,  3683, -2907,   551, -3217,  1413,   184,
+     1421, -1424,  2027,  -334, -1995,  1583, -3262,  2777,
+     2536, -2790,    77,  -115,    72,   890, -2227,  2129,
+     2207,  1891, -3722,  3065, -1585,  3664,   912,  1032,
+      -45,  1364,  2352,  3470,  1501, -2142,   406,  2885,
+    -3810, -2290,  -570,  -645,  -932,  2988, -1470,  3592,
+       22,  3259, -2174,  -843,   461,  -489, -1564,  -557,
+    -3258,  1973,  2839, -2245, -1934, -2997,  3279,  1487,
+      672,  3186, -2863,  -612,   116,  -273,  1106,   443,
+     3129,   913,   831,  1951,  -420,   -71, -1091, -3458,
+     3768,  3051,  1229, -1237,  2845, -3451,  2361,  1661,
+    -3578, -2836,  1642,   241, -2355, -2867,   192,  -187,
+     -818,  3117,  3325,   -78,   316, -2068,   894, -3031,
+     2432,  2752,  -120,  1077, -1409,  -988, -1118,  1969,
+     3643, -2548, -2479,  -986, -1520, -1720,    75,   287,
+     3761, -3223,  2619,  3570, -3237, -2248, -1331, -1304,
+      950,  1075, -1007,  2701,  2450,  -866, -2597,  -311,
+     1063,  1405,  1792,   815, -2514, -1632, -2251,  -728,
+      389, -1379,   663, -2686,  2216,    82, -1120,  2371,
+     -349,  1020,  2367,   455,   717,  1822,  2466,  3599,
+    -1385,  1869,   700, -2442,  -742,  3203,  1401,  2596,
+};
+
+const int16_t ntt_red256_q7681_scaled_inv_psi_powers[256] = {
+    -2117,  3062,  -982, -2324, -1417,   620, -1724,   879,
+      -16,  3216, -1212, -2180,   363, -3834,  2534, -2388,
+     3766,  3453, -2763,  2331,    10, -2010, -3083, -2478,
+    -1187,   476, -3504, -2348,  3407, -1198,  2687, -2417,
+     1914,  -664,  2887,  3469,  1702,  3543,  2190, -2373,
+      751,  2669,  1201, -3290,   724,   415,  1076, -1208,
+    -2984,   666, -3289,   523,  2411,  -708, -3631,   136,
+     3388,  2621,  3168,   755,  1865,  1504, -2745, -1287,
+    -2467, -3398,  -611,   -85,  1723,  -678, -1980, -1432,
+     3635,  -940, -3085, -2076,  2502, -3637,  1342,  -907,
+    -2037,  2344, -2603,   895, -3232, -3253,   968, -2543,
+    -3484,  1313, -2759,  1527,   313, -1465,  2587,  2321,
+     2020,  1073,  -605, -1291, -1663, -3701, -1156,  1926,
+    -3076,  3796, -2577,  3350,  2578, -3551,  -582,  1767,
+    -1841,  1353, -3118, -3124, -1918,  1468, -3190,  3667,
+      309,  -661,  2284,  1776, -3650, -3726, -3812, -1888,
+     3119,  2923, -3767, -3252,   767,  -547,  2413, -1110,
+      361, -3432, -1458,  1180,   931, -2787,  -526, -1808,
+     2401,  1302,  -548,  2614, -3106,  2145, -1009,  3103,
+    -1542,  2702,  2249,  1130,  3300, -2734, -3498, -3554,
+       21,  3460,  3511,   941,  2884, -3609,  3395,  1214,
+     1778,  3629,   266,   301,   947,  1678,   686,   372,
+     2038, -2545, -3082, -2679,   809, -1308,  1754,   772,
+    -1552, -2969, -2349,  3608, -3194, -3210,     6, -1206,
+    -3386, -3023,   824,  3358,   970, -2945,   508, -2255,
+       76,    86, -1924,  2674,   196,  -991,  -515,  3662,
+     1314, -2960,  3523, -1471,  3793, -1974, -2638,   249,
+     3718, -2261,  1282,  3472,  1099,  1850, -3162, -1961,
+     2430,  3154,  3569, -3036,  3437,   453,  1119, -2170,
+    -1647,   764,    56, -3575, -3439,   -51,  2570, -1943,
+    -1188,   677,  2181,  -564, -1851,  3363,   -35,  -646,
+     -731,   992,   314, -1666, -3098,   537,  -403, -3488,
+};
+
+const int16_t ntt_red256_q7681_scaled_inv_psi_powers_var[256] = {
+     -103, -2340,  1799,  -592,  3777,  1242,  3831, -1931,
+    -3600,  1586,  3816,  1084, -2816, -2378,  1756,   370,
+     2440,  1144,   486,  2167,  2250,   929, -2385,  3163,
+     1760,  -434,  2743,  1689, -1525,  -715, -2224,  1526,
+      514, -3461, -3310, -2937, -1100, -1649,  1166,  3745,
+       -7,  1407,  1390, -2874,  1599,  1203, -3692, -2965,
+    -3153, -3770, -2649,  2460, -2876,  2001, -2789,  -124,
+     1881, -1712, -1533,   893, -2830,   436, -3145,  2303,
+    -2043,  3550,   783, -3763,  3625,  1070,    -2,   402,
+     3689,  3568, -2835,  1441,  2237,  3542,  2391,  3312,
+     2535, -2589, -1919,  1669,  2495, -2230,  2732, -3781,
+     -438,  3547,  1386, -2070,  1296,   658, -1681,   -83,
+     1321,  3314,  2133,  1403,  2194, -3177,  1054,  3214,
+     -810,  1509, -3750,  1012, -3706,  -151,  -373, -1837,
+      549, -2815, -2579,  3752, -1414,    17, -3417,  3208,
+      396, -2786,  -727,   188,   617, -1121,  2572, -2345,
+     2804, -2891, -2665, -2005,  3593,  -179, -2426,  3723,
+    -3266,  3581,  2233, -3335,  2088,  2767, -3135,   293,
+     2555,  1072,  -404, -3287,   121, -1278,  3405,  -796,
+    -1305,  1151,  -921,   777, -2557,  -670, -3588,  -826,
+    -2956,  2719, -1168, -3343,  3696,  2161,  3456, -3366,
+      638,  2339, -1598, -1404, -1993,  1181,   730,  -791,
+    -2310,  3450, -2160, -3657, -2319, -2422,  2919, -2963,
+    -3555,   222,  1464, -2386,  3364,  -236,  1350, -2515,
+    -1431,  3434,  1056,  2812,  3182, -2059,  -915,  -429,
+     1738, -3693, -2764,  2532, -1986,  -226,  -660,  2083,
+     3772,  2247,  1532,  -692,   834,  1348, -2113,  2258,
+     -679, -1779, -3428, -2262,  1483,  1476,  2883, -3408,
+     1399,  2998, -3480,   509, -2456,  2072, -1698,  3334,
+    -1887,  2918, -2762,  2130,  2006, -3794,  2175,   642,
+     1535, -1295,  -859,  3677, -1701, -3744,  -194,   589,
+    -3174,   451,  1521,  1519,  1921, -2071,  1497, -1338,
+};
+
+const int16_t ntt_red256_q7681_omega_powers[256] = {
+        0,  -512,  -512,  3810,  -512, -2432,  3810, -1105,
+     -512, -1063, -2432, -3129,  3810, -1421, -1105,  -989,
+     -512,   349, -1063, -3761, -2432,  3578, -3129,  3258,
+     3810, -2207, -1421, -3727, -1105,  -882,  -989,  -421,
+     -512,  1385,   349,  -389, -1063,  -950, -3761, -3643,
+    -2432,   818,  3578, -3768, -3129,  -672,  3258,   -22,
+     3810,    45, -2207, -2536, -1421, -3192, -3727,  3736,
+    -1105,  2134,  -882,  3316,  -989,   200,  -421,  2384,
+     -512,   742,  1385,  -717,   349, -2216,  -389,  2514,
+    -1063, -2450,  -950,  3237, -3761,  1520, -3643,  1409,
+    -2432,  -316,   818,  2355,  3578, -2845, -3768,   420,
+    -3129,  -116,  -672,  1934,  3258,  -461,   -22,   932,
+     3810, -1501,    45,  1585, -2207,   -72, -2536,  1995,
+    -1421,  -551, -3192, -2335, -3727,  3571,  3736, -3254,
+    -1105, -1369,  2134,  1768,  -882,  -342,  3316,  -125,
+     -989,  -697,   200, -1490,  -421,  -320,  2384,  3746,
+     -512, -1401,   742,  -700,  1385, -2466,  -717, -2367,
+      349,  1120, -2216,  -663,  -389,  2251,  2514, -1792,
+    -1063,  2597, -2450,  1007,  -950,  1331,  3237, -2619,
+    -3761,   -75,  1520,  2479, -3643,  1118,  1409,   120,
+    -2432,  -894,  -316, -3325,   818,  -192,  2355, -1642,
+     3578, -2361, -2845, -1229, -3768,  1091,   420,  -831,
+    -3129, -1106,  -116,  2863,  -672, -3279,  1934, -2839,
+     3258,  1564,  -461,  2174,   -22,  1470,   932,   570,
+     3810,  -406, -1501, -2352,    45,  -912,  1585,  3722,
+    -2207,  2227,   -72,   -77, -2536,  3262,  1995, -2027,
+    -1421, -1413,  -551, -3683, -3192,  1707, -2335,  3797,
+    -3727,  -252,  3571, -1195,  3736,  3142, -3254, -1133,
+    -1105,  1912, -1369, -3491,  2134,  3349,  1768, -1523,
+     -882,   977,  -342, -2286,  3316, -3708,  -125,   -27,
+     -989,  -951,  -697,  -212,   200, -1493, -1490, -3087,
+     -421, -1197,  -320, -3756,  2384,  3403,  3746,   379,
+};
+
+const int16_t ntt_red256_q7681_omega_powers_rev[256] = {
+        0,  -512,  -512,  3810,  -512,  3810, -2432, -1105,
+     -512,  3810, -2432, -1105, -1063, -1421, -3129,  -989,
+     -512,  3810, -2432, -1105, -1063, -1421, -3129,  -989,
+      349, -2207,  3578,  -882, -3761, -3727,  3258,  -421,
+     -512,  3810, -2432, -1105, -1063, -1421, -3129,  -989,
+      349, -2207,  3578,  -882, -3761, -3727,  3258,  -421,
+     1385,    45,   818,  2134,  -950, -3192,  -672,   200,
+     -389, -2536, -3768,  3316, -3643,  3736,   -22,  2384,
+     -512,  3810, -2432, -1105, -1063, -1421, -3129,  -989,
+      349, -2207,  3578,  -882, -3761, -3727,  3258,  -421,
+     1385,    45,   818,  2134,  -950, -3192,  -672,   200,
+     -389, -2536, -3768,  3316, -3643,  3736,   -22,  2384,
+      742, -1501,  -316, -1369, -2450,  -551,  -116,  -697,
+    -2216,   -72, -2845,  -342,  1520,  3571,  -461,  -320,
+     -717,  1585,  2355,  1768,  3237, -2335,  1934, -1490,
+     2514,  1995,   420,  -125,  1409, -3254,   932,  3746,
+     -512,  3810, -2432, -1105, -1063, -1421, -3129,  -989,
+      349, -2207,  3578,  -882, -3761, -3727,  3258,  -421,
+     1385,    45,   818,  2134,  -950, -3192,  -672,   200,
+     -389, -2536, -3768,  3316, -3643,  3736,   -22,  2384,
+      742, -1501,  -316, -1369, -2450,  -551,  -116,  -697,
+    -2216,   -72, -2845,  -342,  1520,  3571,  -461,  -320,
+     -717,  1585,  2355,  1768,  3237, -2335,  1934, -1490,
+     2514,  1995,   420,  -125,  1409, -3254,   932,  3746,
+    -1401,  -406,  -894,  1912,  2597, -1413, -1106,  -951,
+     1120,  2227, -2361,   977,   -75,  -252,  1564, -1197,
+    -2466,  -912,  -192,  3349,  1331,  1707, -3279, -1493,
+     2251,  3262,  1091, -3708,  1118,  3142,  1470,  3403,
+     -700, -2352, -3325, -3491,  1007, -3683,  2863,  -212,
+     -663,   -77, -1229, -2286,  2479, -1195,  2174, -3756,
+    -2367,  3722, -1642, -1523, -2619,  3797, -2839, -3087,
+    -1792, -2027,  -831,   -27,   120, -1133,   570,   379,
+};
+
+const int16_t ntt_red256_q7681_inv_omega_powers[256] = {
+        0,  -512,  -512, -3810,  -512,  1105, -3810,  2432,
+     -512,   989,  1105,  1421, -3810,  3129,  2432,  1063,
+     -512,   421,   989,   882,  1105,  3727,  1421,  2207,
+    -3810, -3258,  3129, -3578,  2432,  3761,  1063,  -349,
+     -512, -2384,   421,  -200,   989, -3316,   882, -2134,
+     1105, -3736,  3727,  3192,  1421,  2536,  2207,   -45,
+    -3810,    22, -3258,   672,  3129,  3768, -3578,  -818,
+     2432,  3643,  3761,   950,  1063,   389,  -349, -1385,
+     -512, -3746, -2384,   320,   421,  1490,  -200,   697,
+      989,   125, -3316,   342,   882, -1768, -2134,  1369,
+     1105,  3254, -3736, -3571,  3727,  2335,  3192,   551,
+     1421, -1995,  2536,    72,  2207, -1585,   -45,  1501,
+    -3810,  -932,    22,   461, -3258, -1934,   672,   116,
+     3129,  -420,  3768,  2845, -3578, -2355,  -818,   316,
+     2432, -1409,  3643, -1520,  3761, -3237,   950,  2450,
+     1063, -2514,   389,  2216,  -349,   717, -1385,  -742,
+     -512,  -379, -3746, -3403, -2384,  3756,   320,  1197,
+      421,  3087,  1490,  1493,  -200,   212,   697,   951,
+      989,    27,   125,  3708, -3316,  2286,   342,  -977,
+      882,  1523, -1768, -3349, -2134,  3491,  1369, -1912,
+     1105,  1133,  3254, -3142, -3736,  1195, -3571,   252,
+     3727, -3797,  2335, -1707,  3192,  3683,   551,  1413,
+     1421,  2027, -1995, -3262,  2536,    77,    72, -2227,
+     2207, -3722, -1585,   912,   -45,  2352,  1501,   406,
+    -3810,  -570,  -932, -1470,    22, -2174,   461, -1564,
+    -3258,  2839, -1934,  3279,   672, -2863,   116,  1106,
+     3129,   831,  -420, -1091,  3768,  1229,  2845,  2361,
+    -3578,  1642, -2355,   192,  -818,  3325,   316,   894,
+     2432,  -120, -1409, -1118,  3643, -2479, -1520,    75,
+     3761,  2619, -3237, -1331,   950, -1007,  2450, -2597,
+     1063,  1792, -2514, -2251,   389,   663,  2216, -1120,
+     -349,  2367,   717,  2466, -1385,   700,  -742,  1401,
+};
+
+const int16_t ntt_red256_q7681_inv_omega_powers_rev[256] = {
+        0,  -512,  -512, -3810,  -512, -3810,  1105,  2432,
+     -512, -3810,  1105,  2432,   989,  3129,  1421,  1063,
+     -512, -3810,  1105,  2432,   989,  3129,  1421,  1063,
+      421, -3258,  3727,  3761,   882, -3578,  2207,  -349,
+     -512, -3810,  1105,  2432,   989,  3129,  1421,  1063,
+      421, -3258,  3727,  3761,   882, -3578,  2207,  -349,
+    -2384,    22, -3736,  3643, -3316,  3768,  2536,   389,
+     -200,   672,  3192,   950, -2134,  -818,   -45, -1385,
+     -512, -3810,  1105,  2432,   989,  3129,  1421,  1063,
+      421, -3258,  3727,  3761,   882, -3578,  2207,  -349,
+    -2384,    22, -3736,  3643, -3316,  3768,  2536,   389,
+     -200,   672,  3192,   950, -2134,  -818,   -45, -1385,
+    -3746,  -932,  3254, -1409,   125,  -420, -1995, -2514,
+     1490, -1934,  2335, -3237, -1768, -2355, -1585,   717,
+      320,   461, -3571, -1520,   342,  2845,    72,  2216,
+      697,   116,   551,  2450,  1369,   316,  1501,  -742,
+     -512, -3810,  1105,  2432,   989,  3129,  1421,  1063,
+      421, -3258,  3727,  3761,   882, -3578,  2207,  -349,
+    -2384,    22, -3736,  3643, -3316,  3768,  2536,   389,
+     -200,   672,  3192,   950, -2134,  -818,   -45, -1385,
+    -3746,  -932,  3254, -1409,   125,  -420, -1995, -2514,
+     1490, -1934,  2335, -3237, -1768, -2355, -1585,   717,
+      320,   461, -3571, -1520,   342,  2845,    72,  2216,
+      697,   116,   551,  2450,  1369,   316,  1501,  -742,
+     -379,  -570,  1133,  -120,    27,   831,  2027,  1792,
+     3087,  2839, -3797,  2619,  1523,  1642, -3722,  2367,
+     3756, -2174,  1195, -2479,  2286,  1229,    77,   663,
+      212, -2863,  3683, -1007,  3491,  3325,  2352,   700,
+    -3403, -1470, -3142, -1118,  3708, -1091, -3262, -2251,
+     1493,  3279, -1707, -1331, -3349,   192,   912,  2466,
+     1197, -1564,   252,    75,  -977,  2361, -2227, -1120,
+      951,  1106,  1413, -2597, -1912,   894,   406,  1401,
+};
+
+const int16_t ntt_red256_q7681_mixed_powers[256] = {
+        0,  3810, -2432, -1105, -1063, -3129, -1421,  -989,
+      349, -3761,  3578,  3258, -2207, -3727,  -882,  -421,
+     1385,  -389,  -950, -3643,   818, -3768,  -672,   -22,
+       45, -2536, -3192,  3736,  2134,  3316,   200,  2384,
+      742,  -717, -2216,  2514, -2450,  3237,  1520,  1409,
+     -316,  2355, -2845,   420,  -116,  1934,  -461,   932,
+    -1501,  1585,   -72,  1995,  -551, -2335,  3571, -3254,
+    -1369,  1768,  -342,  -125,  -697, -1490,  -320,  3746,
+    -1401,  -700, -2466, -2367,  1120,  -663,  2251, -1792,
+     2597,  1007,  1331, -2619,   -75,  2479,  1118,   120,
+     -894, -3325,  -192, -1642, -2361, -1229,  1091,  -831,
+    -1106,  2863, -3279, -2839,  1564,  2174,  1470,   570,
+     -406, -2352,  -912,  3722,  2227,   -77,  3262, -2027,
+    -1413, -3683,  1707,  3797,  -252, -1195,  3142, -1133,
+     1912, -3491,  3349, -1523,   977, -2286, -3708,   -27,
+     -951,  -212, -1493, -3087, -1197, -3756,  3403,   379,
+    -2596, -3203,  2442, -1869, -3599, -1822,  -455, -1020,
+    -2371,   -82,  2686,  1379,   728,  1632,  -815, -1405,
+      311,   866, -2701, -1075,  1304,  2248, -3570,  3223,
+     -287,  1720,   986,  2548, -1969,   988, -1077, -2752,
+     3031,  2068,    78, -3117,   187,  2867,  -241,  2836,
+    -1661,  3451,  1237, -3051,  3458,    71, -1951,  -913,
+     -443,   273,   612, -3186, -1487,  2997,  2245, -1973,
+      557,   489,   843, -3259, -3592, -2988,   645,  2290,
+    -2885,  2142, -3470, -1364, -1032, -3664, -3065, -1891,
+    -2129,  -890,   115,  2790, -2777, -1583,   334,  1424,
+     -184,  3217,  2907, -3612,  2538,   794, -2778, -3611,
+    -3115, -3438,  2084,  1802, -1700,  1169, -2697,  -644,
+     -262, -1347,  2720,  1202,  2779, -2042, -1117,   619,
+     3329,  -387, -1374,  1731,   251,  2082, -2254,  -917,
+     -874,  1839, -3474, -1795,   534,   -69, -1674,   130,
+     2486,  2872,  2218, -2962,  -394,  -208,   631, -3059,
+};
+
+const int16_t ntt_red256_q7681_mixed_powers_rev[256] = {
+        0,  3810, -2432, -1105, -1063, -1421, -3129,  -989,
+      349, -2207,  3578,  -882, -3761, -3727,  3258,  -421,
+     1385,    45,   818,  2134,  -950, -3192,  -672,   200,
+     -389, -2536, -3768,  3316, -3643,  3736,   -22,  2384,
+      742, -1501,  -316, -1369, -2450,  -551,  -116,  -697,
+    -2216,   -72, -2845,  -342,  1520,  3571,  -461,  -320,
+     -717,  1585,  2355,  1768,  3237, -2335,  1934, -1490,
+     2514,  1995,   420,  -125,  1409, -3254,   932,  3746,
+    -1401,  -406,  -894,  1912,  2597, -1413, -1106,  -951,
+     1120,  2227, -2361,   977,   -75,  -252,  1564, -1197,
+    -2466,  -912,  -192,  3349,  1331,  1707, -3279, -1493,
+     2251,  3262,  1091, -3708,  1118,  3142,  1470,  3403,
+     -700, -2352, -3325, -3491,  1007, -3683,  2863,  -212,
+     -663,   -77, -1229, -2286,  2479, -1195,  2174, -3756,
+    -2367,  3722, -1642, -1523, -2619,  3797, -2839, -3087,
+    -1792, -2027,  -831,   -27,   120, -1133,   570,   379,
+    -2596, -2885,  3031,  -262,   311,  -184,  -443,  -874,
+    -2371, -2129, -1661,  3329,  -287, -3115,   557,  2486,
+    -3599, -1032,   187,  2779,  1304,  2538, -1487,   534,
+      728, -2777,  3458,   251, -1969, -1700, -3592,  -394,
+     2442, -3470,    78,  2720, -2701,  2907,   612, -3474,
+     2686,   115,  1237, -1374,   986,  2084,   843,  2218,
+     -455, -3065,  -241, -1117, -3570, -2778,  2245, -1674,
+     -815,   334, -1951, -2254, -1077, -2697,   645,   631,
+    -3203,  2142,  2068, -1347,   866,  3217,   273,  1839,
+      -82,  -890,  3451,  -387,  1720, -3438,   489,  2872,
+    -1822, -3664,  2867, -2042,  2248,   794,  2997,   -69,
+     1632, -1583,    71,  2082,   988,  1169, -2988,  -208,
+    -1869, -1364, -3117,  1202, -1075, -3612, -3186, -1795,
+     1379,  2790, -3051,  1731,  2548,  1802, -3259, -2962,
+    -1020, -1891,  2836,   619,  3223, -3611, -1973,   130,
+    -1405,  1424,  -913,  -917, -2752,  -644,  2290, -3059,
+};
+
+const int16_t ntt_red256_q7681_inv_mixed_powers[256] = {
+        0, -3810,  1105,  2432,   989,  1421,  3129,  1063,
+      421,   882,  3727,  2207, -3258, -3578,  3761,  -349,
+    -2384,  -200, -3316, -2134, -3736,  3192,  2536,   -45,
+       22,   672,  3768,  -818,  3643,   950,   389, -1385,
+    -3746,   320,  1490,   697,   125,   342, -1768,  1369,
+     3254, -3571,  2335,   551, -1995,    72, -1585,  1501,
+     -932,   461, -1934,   116,  -420,  2845, -2355,   316,
+    -1409, -1520, -3237,  2450, -2514,  2216,   717,  -742,
+     -379, -3403,  3756,  1197,  3087,  1493,   212,   951,
+       27,  3708,  2286,  -977,  1523, -3349,  3491, -1912,
+     1133, -3142,  1195,   252, -3797, -1707,  3683,  1413,
+     2027, -3262,    77, -2227, -3722,   912,  2352,   406,
+     -570, -1470, -2174, -1564,  2839,  3279, -2863,  1106,
+      831, -1091,  1229,  2361,  1642,   192,  3325,   894,
+     -120, -1118, -2479,    75,  2619, -1331, -1007, -2597,
+     1792, -2251,   663, -1120,  2367,  2466,   700,  1401,
+     3059,  -631,   208,   394,  2962, -2218, -2872, -2486,
+     -130,  1674,    69,  -534,  1795,  3474, -1839,   874,
+      917,  2254, -2082,  -251, -1731,  1374,   387, -3329,
+     -619,  1117,  2042, -2779, -1202, -2720,  1347,   262,
+      644,  2697, -1169,  1700, -1802, -2084,  3438,  3115,
+     3611,  2778,  -794, -2538,  3612, -2907, -3217,   184,
+    -1424,  -334,  1583,  2777, -2790,  -115,   890,  2129,
+     1891,  3065,  3664,  1032,  1364,  3470, -2142,  2885,
+    -2290,  -645,  2988,  3592,  3259,  -843,  -489,  -557,
+     1973, -2245, -2997,  1487,  3186,  -612,  -273,   443,
+      913,  1951,   -71, -3458,  3051, -1237, -3451,  1661,
+    -2836,   241, -2867,  -187,  3117,   -78, -2068, -3031,
+     2752,  1077,  -988,  1969, -2548,  -986, -1720,   287,
+    -3223,  3570, -2248, -1304,  1075,  2701,  -866,  -311,
+     1405,   815, -1632,  -728, -1379, -2686,    82,  2371,
+     1020,   455,  1822,  3599,  1869, -2442,  3203,  2596,
+};
+
+const int16_t ntt_red256_q7681_inv_mixed_powers_rev[256] = {
+        0, -3810,  1105,  2432,   989,  3129,  1421,  1063,
+      421, -3258,  3727,  3761,   882, -3578,  2207,  -349,
+    -2384,    22, -3736,  3643, -3316,  3768,  2536,   389,
+     -200,   672,  3192,   950, -2134,  -818,   -45, -1385,
+    -3746,  -932,  3254, -1409,   125,  -420, -1995, -2514,
+     1490, -1934,  2335, -3237, -1768, -2355, -1585,   717,
+      320,   461, -3571, -1520,   342,  2845,    72,  2216,
+      697,   116,   551,  2450,  1369,   316,  1501,  -742,
+     -379,  -570,  1133,  -120,    27,   831,  2027,  1792,
+     3087,  2839, -3797,  2619,  1523,  1642, -3722,  2367,
+     3756, -2174,  1195, -2479,  2286,  1229,    77,   663,
+      212, -2863,  3683, -1007,  3491,  3325,  2352,   700,
+    -3403, -1470, -3142, -1118,  3708, -1091, -3262, -2251,
+     1493,  3279, -1707, -1331, -3349,   192,   912,  2466,
+     1197, -1564,   252,    75,  -977,  2361, -2227, -1120,
+      951,  1106,  1413, -2597, -1912,   894,   406,  1401,
+     3059, -2290,   644,  2752,   917,   913, -1424,  1405,
+     -130,  1973,  3611, -3223,  -619, -2836,  1891,  1020,
+     2962,  3259, -1802, -2548, -1731,  3051, -2790, -1379,
+     1795,  3186,  3612,  1075, -1202,  3117,  1364,  1869,
+      208,  2988, -1169,  -988, -2082,   -71,  1583, -1632,
+       69, -2997,  -794, -2248,  2042, -2867,  3664,  1822,
+    -2872,  -489,  3438, -1720,   387, -3451,   890,    82,
+    -1839,  -273, -3217,  -866,  1347, -2068, -2142,  3203,
+     -631,  -645,  2697,  1077,  2254,  1951,  -334,   815,
+     1674, -2245,  2778,  3570,  1117,   241,  3065,   455,
+    -2218,  -843, -2084,  -986,  1374, -1237,  -115, -2686,
+     3474,  -612, -2907,  2701, -2720,   -78,  3470, -2442,
+      394,  3592,  1700,  1969,  -251, -3458,  2777,  -728,
+     -534,  1487, -2538, -1304, -2779,  -187,  1032,  3599,
+    -2486,  -557,  3115,   287, -3329,  1661,  2129,  2371,
+      874,   443,   184,  -311,   262, -3031,  2885,  2596,
+};
+
@@ -0,0 +1,52 @@
+/*
+ * Parameters:
+ * - q = 7681
+ * - k = 15
+ * - m = 9
+ * - n = 256
+ * - psi = 7146
+ * - omega = psi^2 = 2028
+ * - inverse of psi = 7480
+ * - inverse of omega = 1996
+ * - inverse of n = 7651
+ * - inverse of k = 7169
+ */
+
+#ifndef __NTT_RED256_Q7681_TABLES_H
+#define __NTT_RED256_Q7681_TABLES_H
+
+#include <stdint.h>
+
+/*
+ * PARAMETERS
+ */
+static const int32_t ntt_red256_q7681_psi = 7146;
+static const int32_t ntt_red256_q7681_omega = 2028;
+static const int32_t ntt_red256_q7681_inv_psi = 7480;
+static const int32_t ntt_red256_q7681_inv_omega = 1996;
+static const int32_t ntt_red256_q7681_inv_n = 7651;
+static const int32_t ntt_red256_q7681_inv_k = 7169;
+static const int32_t ntt_red256_q7681_rescale8 = 5564;
+static const int32_t ntt_red256_q7681_rescale6 = 7578;
+
+/*
+ * POWERS OF PSI
+ */
+extern const int16_t ntt_red256_q7681_psi_powers[256];
+extern const int16_t ntt_red256_q7681_inv_psi_powers[256];
+extern const int16_t ntt_red256_q7681_scaled_inv_psi_powers[256];
+extern const int16_t ntt_red256_q7681_scaled_inv_psi_powers_var[256];
+
+/*
+ * TABLES FOR NTT COMPUTATION
+ */
+extern const int16_t ntt_red256_q7681_omega_powers[256];
+extern const int16_t ntt_red256_q7681_omega_powers_rev[256];
+extern const int16_t ntt_red256_q7681_inv_omega_powers[256];
+extern const int16_t ntt_red256_q7681_inv_omega_powers_rev[256];
+extern const int16_t ntt_red256_q7681_mixed_powers[256];
+extern const int16_t ntt_red256_q7681_mixed_powers_rev[256];
+extern const int16_t ntt_red256_q7681_inv_mixed_powers[256];
+extern const int16_t ntt_red256_q7681_inv_mixed_powers_rev[256];
+
+#endif /* __NTT_RED256_Q7681_TABLES_H */
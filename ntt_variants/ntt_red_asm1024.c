@@ -125,3 +125,21 @@ void ntt_red1024_product5_asm(int32_t *c, int32_t *a, int32_t *b) {
   reduce_array_twice_asm(c, 1024);
   correct_asm(c, 1024);
 }
+
+void ntt_red1024_product5_avx512(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array_asm(a, 1024);
+  mulntt_red1024_ct_std2rev_avx512(a);
+  reduce_array_asm(a, 1024);
+
+  shift_array_asm(b, 1024);
+  mulntt_red1024_ct_std2rev_avx512(b);
+  reduce_array_asm(b, 1024);
+
+  mul_reduce_array_avx512(c, 1024, a, b); // c[i] = 3 * a[i] * b[i]
+  reduce_array_twice_avx512(c, 1024);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red1024_gs_rev2std_avx512(c);
+  scalar_mul_reduce_array_asm(c, 1024, ntt_red1024_rescale8);
+  reduce_array_twice_avx512(c, 1024);
+  correct_asm(c, 1024);
+}
@@ -71,6 +71,26 @@ static inline void inttmul_red1024_gs_std2rev_asm(int32_t *a) {
 }
 
 
+/*
+ * AVX-512 versions (call only if avx512_supported() is true)
+ */
+static inline void ntt_red1024_ct_std2rev_avx512(int32_t *a) {
+  ntt_red_ct_std2rev_avx512(a, 1024, ntt_red1024_omega_powers_rev);
+}
+
+static inline void intt_red1024_ct_std2rev_avx512(int32_t *a) {
+  ntt_red_ct_std2rev_avx512(a, 1024, ntt_red1024_inv_omega_powers_rev);
+}
+
+static inline void mulntt_red1024_ct_std2rev_avx512(int32_t *a) {
+  mulntt_red_ct_std2rev_avx512(a, 1024, ntt_red1024_mixed_powers_rev);
+}
+
+static inline void inttmul_red1024_gs_rev2std_avx512(int32_t *a) {
+  nttmul_red_gs_rev2std_avx512(a, 1024, ntt_red1024_inv_mixed_powers_rev);
+}
+
+
 /*
  * PRODUCTS
  */
@@ -91,4 +111,10 @@ extern void ntt_red1024_product3_asm(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red1024_product4_asm(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red1024_product5_asm(int32_t *c, int32_t *a, int32_t *b);
 
+/*
+ * Same as product5, using the AVX-512 kernels where there's one.
+ * Call only if avx512_supported() is true.
+ */
+extern void ntt_red1024_product5_avx512(int32_t *c, int32_t *a, int32_t *b);
+
 #endif /* __NTT_RED_ASM1024_H */
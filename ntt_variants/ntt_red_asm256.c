@@ -127,3 +127,21 @@ void ntt_red256_product5_asm(int32_t *c, int32_t *a, int32_t *b) {
   reduce_array_twice_asm(c, 256);
   correct_asm(c, 256);
 }
+
+void ntt_red256_product5_avx512(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array_asm(a, 256);
+  mulntt_red256_ct_std2rev_avx512(a);
+  reduce_array_asm(a, 256);
+
+  shift_array_asm(b, 256);
+  mulntt_red256_ct_std2rev_avx512(b);
+  reduce_array_asm(b, 256);
+
+  mul_reduce_array_avx512(c, 256, a, b); // c[i] = 3 * a[i] * b[i]
+  reduce_array_twice_avx512(c, 256);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red256_gs_rev2std_avx512(c);
+  scalar_mul_reduce_array_asm(c, 256, ntt_red256_rescale8);
+  reduce_array_twice_avx512(c, 256);
+  correct_asm(c, 256);
+}
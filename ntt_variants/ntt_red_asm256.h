@@ -70,6 +70,26 @@ static inline void inttmul_red256_gs_std2rev_asm(int32_t *a) {
 }
 
 
+/*
+ * AVX-512 versions (call only if avx512_supported() is true)
+ */
+static inline void ntt_red256_ct_std2rev_avx512(int32_t *a) {
+  ntt_red_ct_std2rev_avx512(a, 256, ntt_red256_omega_powers_rev);
+}
+
+static inline void intt_red256_ct_std2rev_avx512(int32_t *a) {
+  ntt_red_ct_std2rev_avx512(a, 256, ntt_red256_inv_omega_powers_rev);
+}
+
+static inline void mulntt_red256_ct_std2rev_avx512(int32_t *a) {
+  mulntt_red_ct_std2rev_avx512(a, 256, ntt_red256_mixed_powers_rev);
+}
+
+static inline void inttmul_red256_gs_rev2std_avx512(int32_t *a) {
+  nttmul_red_gs_rev2std_avx512(a, 256, ntt_red256_inv_mixed_powers_rev);
+}
+
+
 /*
  * PRODUCTS
  */
@@ -90,4 +110,10 @@ extern void ntt_red256_product3_asm(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red256_product4_asm(int32_t *c, int32_t *a, int32_t *b);
 extern void ntt_red256_product5_asm(int32_t *c, int32_t *a, int32_t *b);
 
+/*
+ * Same as product5, using the AVX-512 kernels where there's one.
+ * Call only if avx512_supported() is true.
+ */
+extern void ntt_red256_product5_avx512(int32_t *c, int32_t *a, int32_t *b);
+
 #endif /* __NTT_RED_ASM256_H */
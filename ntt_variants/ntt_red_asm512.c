@@ -127,3 +127,21 @@ void ntt_red512_product5_asm(int32_t *c, int32_t *a, int32_t *b) {
   reduce_array_twice_asm(c, 512);
   correct_asm(c, 512);
 }
+
+void ntt_red512_product5_avx512(int32_t *c, int32_t *a, int32_t *b) {
+  shift_array_asm(a, 512);
+  mulntt_red512_ct_std2rev_avx512(a);
+  reduce_array_asm(a, 512);
+
+  shift_array_asm(b, 512);
+  mulntt_red512_ct_std2rev_avx512(b);
+  reduce_array_asm(b, 512);
+
+  mul_reduce_array_avx512(c, 512, a, b); // c[i] = 3 * a[i] * b[i]
+  reduce_array_twice_avx512(c, 512);  // c[i] = 9 * c[i] mod Q
+
+  inttmul_red512_gs_rev2std_avx512(c);
+  scalar_mul_reduce_array_asm(c, 512, ntt_red512_rescale8);
+  reduce_array_twice_avx512(c, 512);
+  correct_asm(c, 512);
+}
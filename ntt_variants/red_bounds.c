@@ -5,24 +5,44 @@
 #include "red_bounds.h"
 
 /*
- * 12289 is 3 * 2^12 + 1
- * MASK = 2^12 - 1
+ * Modulus: q = k * 2^m + 1 and mask = 2^m - 1
+ * Default: 12289 = 3 * 2^12 + 1
  */
-#define Q 12289
-#define K 3
-#define MASK 4095
+static int64_t red_q = 12289;
+static int64_t red_k = 3;
+static int64_t red_m = 12;
+static int64_t red_mask = 4095;
 
+bool set_red_modulus(int64_t q) {
+  int64_t k, m;
 
-static int64_t red(int64_t x) {
-  return (3 * (x & 4095)) - (x >> 12);
+  if (q < 3 || (q & 1) == 0) return false;
+
+  k = q - 1;
+  m = 0;
+  while ((k & 1) == 0) {
+    k >>= 1;
+    m ++;
+  }
+
+  red_q = q;
+  red_k = k;
+  red_m = m;
+  red_mask = ((int64_t) 1 << m) - 1;
+
+  return true;
+}
+
+int64_t red(int64_t x) {
+  return (red_k * (x & red_mask)) - (x >> red_m);
 }
 
 static int64_t divd(int64_t x) {
-  return x >> 12;
+  return x >> red_m;
 }
 
 static int64_t remd(int64_t x) {
-  return x & 4095;
+  return x & red_mask;
 }
 
 
@@ -39,7 +59,7 @@ int64_t max_red(int64_t a, int64_t b, int64_t *m) {
   
   assert(a <= b);
 
-  d = a | 4095;
+  d = a | red_mask;
   d = (d <= b) ? d : b;
   r = red(d);
   *m = d;
@@ -55,7 +75,7 @@ int64_t min_red(int64_t a, int64_t b, int64_t *m) {
 
   assert(a <= b);
 
-  d = b & ~4095;
+  d = b & ~red_mask;
   d = (d >= a) ? d : a;
   r = red(d);
   *m = d;
@@ -69,9 +89,9 @@ int64_t min_red(int64_t a, int64_t b, int64_t *m) {
  */
 
 /*
- * GCD of w and 4096
+ * GCD of w and 2^m
  */
-static int64_t gcd4096(int64_t w) {
+static int64_t gcd2m(int64_t w) {
   int64_t g;
 
   g = 1;
@@ -80,20 +100,20 @@ static int64_t gcd4096(int64_t w) {
     w >>= 1;
   }
   // g is the largest power of two that divides w
-  return (g < 4096) ? g : 4096;
+  return (g <= red_mask) ? g : red_mask + 1;
 }
 
 /*
- * Largest y such that (w x)>>12 == (w y)>>12 are equal.
+ * Largest y such that (w x)>>m == (w y)>>m are equal.
  * So, for any z such that x <= z <= y, we have red(w y) >= red(w z).
  */
 static int64_t lmax(int64_t w, int64_t x) {
   int64_t y, k;
 
-  k = (4095 - ((w * x) & 4095))/w;  // floor((4096 - 1 - r0)/w) where r0 = (w * x) & 4095
+  k = (red_mask - remd(w * x))/w;  // floor((2^m - 1 - r0)/w) where r0 = (w * x) & mask
   y =  x + k;
-  assert((w * y) >> 12 == (w * x) >> 12);
-  assert((w * (y+1)) >> 12 > (w * x) >> 12);
+  assert(divd(w * y) == divd(w * x));
+  assert(divd(w * (y+1)) > divd(w * x));
 
   return y;
 }
@@ -118,11 +138,11 @@ int64_t max_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
   x_max = b;
   r_max = red(pw * b);
 
-  // The remainder of (w * x) by 4096 is a multiple of gcd(4096, w)
-  // so it's at most h = 4096 - gcd(4096, w).
+  // The remainder of (w * x) by 2^m is a multiple of gcd(2^m, w)
+  // so it's at most h = 2^m - gcd(2^m, w).
   // We then have red(w * x) <= - divd(w * x) + g,
-  h = 4096 - gcd4096(w);
-  g = 3 * h;
+  h = red_mask + 1 - gcd2m(w);
+  g = red_k * h;
 
   x = a;
   for (;;) {
@@ -149,16 +169,16 @@ int64_t max_red_mul(int64_t a, int64_t b, int64_t w, int64_t *m) {
 
 
 /*
- * Smallest y such that (w x) >> 12 == (w y) >> 12.
+ * Smallest y such that (w x) >> m == (w y) >> m.
  * For any z such that y <= z <= x, we have red(w y) <= red(w z).
  */
 static int64_t lmin(int64_t w, int64_t x) {
   int64_t y, k;
 
-  k = ((w * x) & 4095)/w;
+  k = remd(w * x)/w;
   y = x - k;
-  assert((w * y) >> 12 == (w * x) >> 12);
-  assert((w * (y - 1)) >> 12 < (w * x) >> 12);
+  assert(divd(w * y) == divd(w * x));
+  assert(divd(w * (y - 1)) < divd(w * x));
 
   return y;
 }
@@ -224,10 +244,10 @@ int64_t max_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, in
     assert(w < 0);
 
     // d = min (w*x)/2^m for |x| <= b
-    // so red(w*x) <= -d + 3*4095 for |x| <= b
+    // so red(w*x) <= -d + k * mask for |x| <= b
     // also for any w' such that w <= w' < 0
     d = divd(w * b);
-    if ( -d + 3 * 4095 <= r_max) {
+    if ( -d + red_k * red_mask <= r_max) {
       break;
     }
     r = max_red_mul(a, b, w, &x);
@@ -246,7 +266,7 @@ int64_t max_red_mul_interval(int64_t a, int64_t b, int64_t low, int64_t high, in
 
     // min of (w*x)/2^m is -(w * b)/2^m
     d = divd(- w * b);
-    if ( -d + 3 * 4095 <= r_max) {
+    if ( -d + red_k * red_mask <= r_max) {
       break;
     }
     r = max_red_mul(a, b, w, &x);
@@ -5,8 +5,21 @@
 #ifndef __RED_BOUNDS_H
 #define __RED_BOUNDS_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+/*
+ * The reduction: q = k * 2^m + 1 with k odd, and
+ *    red(x) = k * (x & (2^m - 1)) - (x >> m)
+ * The default modulus is q = 12289 (k = 3, m = 12).
+ *
+ * set_red_modulus(q) selects another modulus for all the functions
+ * below (e.g., q = 7681: k = 15, m = 9). It returns false if q is
+ * even or less than 3.
+ */
+extern bool set_red_modulus(int64_t q);
+extern int64_t red(int64_t x);
+
 /*
  * Maximum of red(x) for a <= x <= b
  * - red(x) is returned, x is stored in *m
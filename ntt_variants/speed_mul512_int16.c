@@ -0,0 +1,145 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "bliss_b_params.h"
+#include "ntt_api.h"
+#include "sort.h"
+
+/*
+ * Speed of the int16 backend of the library (ntt_api_int16.c) for
+ * n=512, q=12289, compared with the AVX2 backend (ntt_asm.S).
+ *
+ * This uses the library: build it first (make in the top-level
+ * directory), and run with LD_LIBRARY_PATH=../lib.
+ */
+
+/*
+ * PERFORMANCE MEASUREMENTS
+ */
+
+/*
+ * For speed measurements: counter of CPU cycles
+ */
+static inline uint64_t cpucycles(void) {
+  uint64_t result;
+  __asm__ volatile(".byte 15;.byte 49;shlq $32,%%rdx;orq %%rdx,%%rax"
+    : "=a" (result) ::  "%rdx");
+  return result;
+}
+
+#define NTESTS 102400
+
+static uint64_t t[NTESTS];
+
+// Average run time
+static uint64_t average_time(void) {
+  uint64_t s;
+  uint32_t i;
+
+  s = 0;
+  for (i=0; i<NTESTS; i++) {
+    s += t[i];
+  }
+  return s/NTESTS;
+}
+
+// Median
+static uint64_t median_time(void) {
+  uint32_t i;
+
+  sort(t, NTESTS);
+  for (i=1; i<NTESTS; i++) {
+    if (t[i] < t[i-1]) {
+      fprintf(stderr, "BUG in sort\n");
+      exit(1);
+    }
+  }
+
+  return t[NTESTS/2];
+}
+
+static void print_results(const char *s, uint64_t c) {
+  uint32_t i;
+
+  for(i=0 ;i<NTESTS-1; i++) {
+    t[i] = t[i+1] - t[i];
+  }
+  t[i] = c - t[i];
+
+  printf("%s\n", s);
+  printf("median: %"PRIu64"\n", median_time());
+  printf("average: %"PRIu64"\n", average_time());
+  printf("\n");
+}
+
+static ntt_state_t get_state(ntt_backend_t backend) {
+  ntt_state_t state;
+
+  ntt_force_backend(backend);
+  state = init_ntt_state(BLISS_B_1);
+  if (state == NULL || ntt_state_backend(state) != backend) {
+    printf("backend %s is not supported\n\n", ntt_backend_name(backend));
+    if (state != NULL) delete_ntt_state(state);
+    return NULL;
+  }
+  return state;
+}
+
+static void test_mul(void) {
+  int32_t a[512], b[512], c[512], w[512];
+  ntt_state_t state;
+  uint32_t i;
+
+  state = get_state(NTT_BACKEND_INT16);
+  if (state == NULL) return;
+
+  for (i=0; i<512; i++) {
+    a[i] = i;
+    b[i] = i;
+  }
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    forward_ntt(state, c, a);
+  }
+  print_results("int16 forward_ntt ", cpucycles());
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    product_ntt(state, c, c, b);
+  }
+  print_results("int16 product_ntt ", cpucycles());
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    inverse_ntt(state, c, b);
+  }
+  print_results("int16 inverse_ntt ", cpucycles());
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    multiply_ntt_into(state, c, a, b, w);
+  }
+  print_results("int16 multiply_ntt_into ", cpucycles());
+
+  delete_ntt_state(state);
+
+  state = get_state(NTT_BACKEND_AVX2);
+  if (state == NULL) return;
+
+  for (i=0; i<NTESTS; i++) {
+    t[i] = cpucycles();
+    multiply_ntt_into(state, c, a, b, w);
+  }
+  print_results("avx2 multiply_ntt_into ", cpucycles());
+
+  delete_ntt_state(state);
+}
+
+int main(void){
+  printf("Testing the int16 NTT backend (n=512)\n\n");
+  test_mul();
+  return 0;
+}
@@ -469,6 +469,22 @@ int main(void) {
   speed_test2("ntt_red1024_product3_asm", ntt_red1024_product3_asm);
   speed_test2("ntt_red1024_product4_asm", ntt_red1024_product4_asm);
   speed_test2("ntt_red1024_product5_asm", ntt_red1024_product5_asm);
+
+  if (avx512_supported()) {
+    printf("\nAVX-512\n\n");
+    test_simple_polys("ntt_red1024_ct_std2rev_avx512", ntt_red1024_ct_std2rev_avx512, ntt_red1024_omega, true);
+    test_simple_polys("intt_red1024_ct_std2rev_avx512", intt_red1024_ct_std2rev_avx512, ntt_red1024_inv_omega, true);
+    test_forward_inverse("ntt_red1024_ct_std2rev_avx512", "intt_red1024_gs_rev2std_asm", ntt_red1024_ct_std2rev_avx512, intt_red1024_gs_rev2std_asm);
+    test_forward_inverse("intt_red1024_gs_rev2std_asm", "ntt_red1024_ct_std2rev_avx512", intt_red1024_gs_rev2std_asm, ntt_red1024_ct_std2rev_avx512);
+    test_simple_products("ntt_red1024_product5_avx512", ntt_red1024_product5_avx512);
+
+    speed_test("ntt_red1024_ct_std2rev_avx512", ntt_red1024_ct_std2rev_avx512);
+    speed_test("mulntt_red1024_ct_std2rev_avx512", mulntt_red1024_ct_std2rev_avx512);
+    speed_test("inttmul_red1024_gs_rev2std_avx512", inttmul_red1024_gs_rev2std_avx512);
+    speed_test2("ntt_red1024_product5_avx512", ntt_red1024_product5_avx512);
+  } else {
+    printf("AVX-512 is not supported\n");
+  }
   
   return 0;
 }
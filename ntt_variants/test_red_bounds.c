@@ -6,11 +6,7 @@
 
 #include "red_bounds.h"
 #include "test_ntt_red_tables.h"
-
-static int64_t red(int64_t x) {
-  return (3 * (x & 4095)) - (x >> 12);
-}
-
+#include "ntt_red256_q7681_tables.h"
 
 // maximum of |red(x)| for |x| <= b
 static int64_t max_abs_red(int64_t b) {
@@ -273,6 +269,64 @@ static void show_ct_bounds(const char *name, uint32_t n, const int16_t *p) {
 }
 
 
+/*
+ * Bounds for each round of an NTT, with a reduction (reduce_array)
+ * before any round that may overflow 32 bits:
+ * - n = size, p = table, b0 = bound on the input
+ * - CT: round t uses p[t ... 2t-1] for t=1, 2, ..., n/2
+ * - GS: same for t=n/2, ..., 2, 1
+ * Return the number of reductions.
+ */
+static int64_t ct_round_bound(int64_t b, uint32_t t, const int16_t *p) {
+  uint32_t j;
+  int64_t c, d;
+
+  c = ct_bound_fixed(b, p[t]);
+  for (j=1; j<t; j++) {
+    d = ct_bound_fixed(b, p[t + j]);
+    if (d > c) c = d;
+  }
+  return c;
+}
+
+static int64_t gs_round_bound(int64_t b, uint32_t t, const int16_t *p) {
+  uint32_t j;
+  int64_t c, d;
+
+  c = gs_bound_fixed(b, p[t]);
+  for (j=1; j<t; j++) {
+    d = gs_bound_fixed(b, p[t + j]);
+    if (d > c) c = d;
+  }
+  return c;
+}
+
+static uint32_t show_rounds(const char *name, uint32_t n, const int16_t *p, int64_t b0, bool ct) {
+  uint32_t t, r, reductions;
+  int64_t b, c;
+
+  printf("Rounds of %s: bound on input = %"PRId64"\n", name, b0);
+  b = b0;
+  r = 0;
+  reductions = 0;
+  for (t = ct ? 1 : n/2; t > 0 && t < n; t = ct ? 2 * t : t/2) {
+    r ++;
+    c = ct ? ct_round_bound(b, t, p) : gs_round_bound(b, t, p);
+    if (c > INT32_MAX) {
+      b = max_abs_red(b);
+      printf("  reduction before round %"PRIu32": bound = %"PRId64"\n", r, b);
+      reductions ++;
+      c = ct ? ct_round_bound(b, t, p) : gs_round_bound(b, t, p);
+    }
+    printf("  round %"PRIu32": bound = %"PRId64"\n", r, c);
+    b = c;
+  }
+  printf("  %"PRIu32" reductions\n\n", reductions);
+
+  return reductions;
+}
+
+
 int main(void) {
   int64_t min, max, min_x, max_x, min_y, max_y, b, nb, a, na;
 
@@ -430,6 +484,37 @@ int main(void) {
   show_ct_bounds("mulntt2048_red_ct_rev2std", 2048, shoup_sred_scaled_ntt2048_12289);
   show_ct_bounds("mulntt2048_red_ct_std2rev", 2048, rev_shoup_sred_scaled_ntt2048_12289);
 
+  show_rounds("mulntt512_red_ct_std2rev", 512, rev_shoup_sred_scaled_ntt512_12289, 6144, true);
+  show_rounds("inttmul512_red_gs_rev2std", 512, rev_shoup_sred_scaled_ntt512_12289, 12288, false);
+
+  /*
+   * q = 7681 = 15 * 2^9 + 1 (Bliss-B0), n = 256
+   *
+   * |red(w * x)| can be up to |w * x|/2^9 + 15 * 511 with |w| <= 3840,
+   * so a CT round can multiply the bound by 8.5 (instead of 2.5 for
+   * q = 12289), and the NTTs need reductions between rounds.
+   */
+  printf("\nq = 7681\n\n");
+  set_red_modulus(7681);
+
+  printf("Bounds on absolute value after repeated reductions\n\n");
+  b = INT32_MAX;
+  do {
+    nb = b;
+    b = max_abs_red(nb);
+    printf("  |x| <= %"PRId64" ==> |red(x)| <= %"PRId64"\n", nb, b);
+  } while (b < nb);
+  printf("\n");
+
+  printf("Base CT iterations: B0 = 3840, -3840 <= w <= 3840\n\n");
+  ct_iteration(3840, -3840, 3840);
+  printf("Base GS iterations: B0 = 3840, -3840 <= w <= 3840\n\n");
+  gs_iteration(3840, -3840, 3840);
+
+  show_rounds("ntt256_q7681_red_ct_std2rev", 256, ntt_red256_q7681_omega_powers_rev, 3840, true);
+  show_rounds("mulntt256_q7681_red_ct_std2rev", 256, ntt_red256_q7681_mixed_powers_rev, 3840, true);
+  show_rounds("inttmul256_q7681_red_gs_rev2std", 256, ntt_red256_q7681_inv_mixed_powers_rev, 7680, false);
+
   return 0;
 }
 
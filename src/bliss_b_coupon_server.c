@@ -0,0 +1,237 @@
+// for clock_gettime with -std=c99
+#define _POSIX_C_SOURCE 200809L
+
+#include <assert.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bliss_b_errors.h"
+#include "bliss_b_utils.h"
+#include "bliss_b_coupon_server.h"
+
+/*
+ * The ring is a bounded queue with per-slot sequence numbers
+ * (Vyukov's algorithm, restricted to a single producer):
+ * - initially seq[i] = i for all slots
+ * - the producer writes coupon number t into slot t & mask when
+ *   seq[t & mask] = t, then sets seq[t & mask] to t + 1
+ * - a consumer claims coupon number h when seq[h & mask] = h + 1 by
+ *   incrementing head from h to h + 1 (compare-and-swap). It copies the
+ *   coupon, then sets seq[h & mask] to h + capacity (the slot's next
+ *   value of t).
+ *
+ * We use the GCC/clang __atomic builtins.
+ */
+
+/*
+ * Bound on the time the producer sleeps without checking the ring.
+ * Consumers signal the producer without blocking (they use trylock),
+ * so a wakeup can be missed; the producer then waits at most this long.
+ */
+#define SLEEP_NSEC 10000000L  // 10 ms
+
+static inline uint64_t load_acquire(const uint64_t *p) {
+  return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static inline void store_release(uint64_t *p, uint64_t v) {
+  __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+static inline uint32_t occupancy(const bliss_b_coupon_server_t *server) {
+  return (uint32_t) (load_acquire(&server->tail) - load_acquire(&server->head));
+}
+
+static inline bool is_running(const bliss_b_coupon_server_t *server) {
+  return __atomic_load_n(&server->running, __ATOMIC_ACQUIRE);
+}
+
+/*
+ * Sleep until the occupancy is down to the low watermark
+ */
+static void producer_sleep(bliss_b_coupon_server_t *server) {
+  struct timespec deadline;
+
+  pthread_mutex_lock(&server->lock);
+  __atomic_store_n(&server->sleeping, true, __ATOMIC_SEQ_CST);
+  while (is_running(server) && occupancy(server) > server->low_watermark) {
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += SLEEP_NSEC;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec ++;
+      deadline.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(&server->wakeup, &server->lock, &deadline);
+  }
+  __atomic_store_n(&server->sleeping, false, __ATOMIC_SEQ_CST);
+  pthread_mutex_unlock(&server->lock);
+}
+
+static void *producer(void *arg) {
+  bliss_b_coupon_server_t *server;
+  uint64_t t;
+  uint32_t i;
+
+  server = arg;
+  t = server->tail;
+  while (is_running(server)) {
+    if (occupancy(server) >= server->high_watermark) {
+      producer_sleep(server);
+      continue;
+    }
+
+    i = (uint32_t) t & server->mask;
+    // a consumer may still be copying the previous coupon out of this slot
+    if (load_acquire(server->seq + i) != t) {
+      sched_yield();
+      continue;
+    }
+    bliss_b_sign_ctx_compute_coupon(&server->ctx, server->slots + (size_t) i * server->coupon_size);
+    store_release(server->seq + i, t + 1);
+    t ++;
+    store_release(&server->tail, t);
+  }
+
+  return NULL;
+}
+
+/*
+ * Wake up the producer if it's sleeping and the occupancy is low.
+ * This doesn't block: if the lock is taken, the producer is awake
+ * or about to check the occupancy (or it will time out).
+ */
+static void wake_producer(bliss_b_coupon_server_t *server) {
+  if (__atomic_load_n(&server->sleeping, __ATOMIC_SEQ_CST) &&
+      occupancy(server) <= server->low_watermark &&
+      pthread_mutex_trylock(&server->lock) == 0) {
+    pthread_cond_signal(&server->wakeup);
+    pthread_mutex_unlock(&server->lock);
+  }
+}
+
+bool bliss_b_coupon_server_take(bliss_b_coupon_server_t *server, int32_t *coupon) {
+  int32_t *c;
+  uint64_t h, s;
+  uint32_t i;
+
+  h = __atomic_load_n(&server->head, __ATOMIC_RELAXED);
+  for (;;) {
+    i = (uint32_t) h & server->mask;
+    s = load_acquire(server->seq + i);
+    if (s == h + 1) {
+      // coupon h is ready: try to claim it
+      if (__atomic_compare_exchange_n(&server->head, &h, h + 1, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+        break;
+      }
+      // h now holds the current head
+    } else if (s < h + 1) {
+      // empty
+      __atomic_fetch_add(&server->fallbacks, 1, __ATOMIC_RELAXED);
+      wake_producer(server);
+      return false;
+    } else {
+      // another consumer took coupon h
+      h = __atomic_load_n(&server->head, __ATOMIC_RELAXED);
+    }
+  }
+
+  c = server->slots + (size_t) i * server->coupon_size;
+  memcpy(coupon, c, server->coupon_size * sizeof(int32_t));
+  zero_int_array(c, server->coupon_size);
+  store_release(server->seq + i, h + server->capacity);
+  wake_producer(server);
+
+  return true;
+}
+
+void bliss_b_coupon_server_stats(bliss_b_coupon_server_t *server, bliss_b_coupon_stats_t *stats) {
+  uint64_t head, tail;
+
+  head = load_acquire(&server->head);
+  tail = load_acquire(&server->tail);
+  stats->capacity = server->capacity;
+  stats->occupancy = (uint32_t) (tail - head);
+  stats->produced = tail;
+  stats->consumed = head;
+  stats->fallbacks = __atomic_load_n(&server->fallbacks, __ATOMIC_RELAXED);
+}
+
+int32_t bliss_b_coupon_server_init(bliss_b_coupon_server_t *server, const bliss_private_key_t *private_key,
+                                   entropy_t *entropy, uint32_t capacity,
+                                   uint32_t low_watermark, uint32_t high_watermark) {
+  int32_t retcode;
+  uint32_t size, i;
+
+  if (low_watermark >= high_watermark || high_watermark > capacity || capacity > (1u << 20)) {
+    return BLISS_B_BAD_ARGS;
+  }
+
+  retcode = bliss_b_sign_ctx_init(&server->ctx, private_key, entropy);
+  if (retcode != BLISS_B_NO_ERROR) {
+    return retcode;
+  }
+
+  size = 1;
+  while (size < capacity) size <<= 1;
+
+  server->capacity = size;
+  server->mask = size - 1;
+  server->coupon_size = 4 * server->ctx.p.n;
+  server->low_watermark = low_watermark;
+  server->high_watermark = high_watermark;
+  server->head = 0;
+  server->tail = 0;
+  server->fallbacks = 0;
+  server->running = true;
+  server->sleeping = false;
+  server->slots = calloc((size_t) size * server->coupon_size, sizeof(int32_t));
+  server->seq = malloc(size * sizeof(uint64_t));
+  if (server->slots == NULL || server->seq == NULL) {
+    goto fail;
+  }
+  for (i = 0; i < size; i++) {
+    server->seq[i] = i;
+  }
+
+  if (pthread_mutex_init(&server->lock, NULL) != 0) {
+    goto fail;
+  }
+  if (pthread_cond_init(&server->wakeup, NULL) != 0) {
+    pthread_mutex_destroy(&server->lock);
+    goto fail;
+  }
+  if (pthread_create(&server->thread, NULL, producer, server) != 0) {
+    pthread_cond_destroy(&server->wakeup);
+    pthread_mutex_destroy(&server->lock);
+    goto fail;
+  }
+
+  return BLISS_B_NO_ERROR;
+
+ fail:
+  free(server->slots);
+  free(server->seq);
+  server->slots = NULL;
+  server->seq = NULL;
+  bliss_b_sign_ctx_delete(&server->ctx);
+
+  return BLISS_B_NO_MEM;
+}
+
+void bliss_b_coupon_server_delete(bliss_b_coupon_server_t *server) {
+  __atomic_store_n(&server->running, false, __ATOMIC_RELEASE);
+  pthread_mutex_lock(&server->lock);
+  pthread_cond_signal(&server->wakeup);
+  pthread_mutex_unlock(&server->lock);
+  pthread_join(server->thread, NULL);
+
+  pthread_cond_destroy(&server->wakeup);
+  pthread_mutex_destroy(&server->lock);
+
+  secure_free(&server->slots, (size_t) server->capacity * server->coupon_size);
+  free(server->seq);
+  server->seq = NULL;
+  bliss_b_sign_ctx_delete(&server->ctx);
+}
@@ -0,0 +1,171 @@
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bliss_b_kernels.h"
+#include "greedy_sc.h"
+#include "modulii.h"
+
+/*
+ * The loops take the parameters as arguments and are always inlined
+ * in the instances below, where the parameters are constants.
+ *
+ * one_q2 = 1/(q + 2) mod 2q is zeta in the signing algorithm.
+ */
+
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+/* iam: bliss-06-13-2013
+ *
+ *   on page 21 of DDLL: every x between [-q, q) and any positive integer d, x can be uniquely written
+ *   as  x = [x]_d * 2^d  + r where r is in [-2^(d -1), 2^(d -1)).
+ *
+ *   this is computing: x --> [x]_d for x in [0, 2q)
+ */
+static ALWAYS_INLINE int32_t drop_bits(int32_t x, uint32_t d, int32_t q) {
+  assert(0 < d && d < 31 && 0 <= x && x < 2 * q);
+
+  x = x >= q ? x - 2 * q : x;
+  return (x >> d) + ((x >> (d - 1)) & 1);
+}
+
+static ALWAYS_INLINE void coupon(int32_t *v, int32_t *dv, const int32_t *y2, uint32_t n, int32_t q, uint32_t d,
+                                 int32_t mod_p, int32_t one_q2) {
+  uint32_t i;
+
+  for (i = 0; i < n; i++) {
+    assert(0 <= v[i] && v[i] < q);
+    v[i] = smodq(2 * v[i] * one_q2 + y2[i], 2 * q);
+    dv[i] = smodq(drop_bits(v[i], d, q), mod_p);
+  }
+}
+
+static ALWAYS_INLINE void compress_z2(int32_t *z2, const int32_t *v, uint32_t n, int32_t q, uint32_t d,
+                                      int32_t mod_p) {
+  uint32_t i;
+  int32_t x;
+
+  for (i = 0; i < n; i++) {
+    x = drop_bits(v[i], d, q) - drop_bits(smodq(v[i] - z2[i], 2 * q), d, q);
+    if (x < -mod_p/2) {
+      x += mod_p;
+    } else if (x > mod_p/2) {
+      x -= mod_p;
+    }
+    assert(-mod_p/2 <= x && x < mod_p/2);
+    z2[i] = x;
+  }
+}
+
+static ALWAYS_INLINE void verify_v(int32_t *v, const uint32_t *c_indices, const int32_t *z2, uint32_t n,
+                                   int32_t q, uint32_t d, int32_t mod_p, int32_t one_q2, uint32_t kappa) {
+  uint32_t i, idx;
+
+  for (i = 0; i < n; i++) {
+    assert(0 <= v[i] && v[i] < q);
+    v[i] = smodq(2 * v[i] * one_q2, 2 * q);
+  }
+  for (i = 0; i < kappa; i++) {
+    idx = c_indices[i];
+    v[idx] = smodq(v[idx] + q * one_q2, 2 * q);
+  }
+  for (i = 0; i < n; i++) {
+    v[i] = smodq(drop_bits(v[i], d, q) + z2[i], mod_p);
+  }
+}
+
+static ALWAYS_INLINE void mul2d(int32_t *output, const int32_t *input, uint32_t n, uint32_t d) {
+  uint32_t i;
+
+  for (i = 0; i < n; i++) {
+    output[i] = input[i] << d;
+  }
+}
+
+static ALWAYS_INLINE int32_t max_norm(const int32_t *v, uint32_t n) {
+  uint32_t i;
+  int32_t max;
+
+  max = 0;
+  for (i = 0; i < n; i++) {
+    if (v[i] > max) {
+      max = v[i];
+    } else if (-v[i] > max) {
+      max = -v[i];
+    }
+  }
+
+  return max;
+}
+
+static ALWAYS_INLINE int32_t scalar_product(const int32_t *v1, const int32_t *v2, uint32_t n) {
+  uint32_t i;
+  int32_t sum;
+
+  sum = 0;
+  for (i = 0; i < n; i++) {
+    sum += v1[i] * v2[i];
+  }
+
+  return sum;
+}
+
+
+/*
+ * Instances: name_kernels is the table entry for kind
+ */
+#define KERNELS_INSTANCE(name, kind, q, n, d, mod_p, one_q2, kappa)    \
+  static void name##_coupon(int32_t *v, int32_t *dv, const int32_t *y2) { \
+    coupon(v, dv, y2, n, q, d, mod_p, one_q2);                         \
+  }                                                                     \
+  static void name##_compress_z2(int32_t *z2, const int32_t *v) {       \
+    compress_z2(z2, v, n, q, d, mod_p);                                 \
+  }                                                                     \
+  static void name##_verify_v(int32_t *v, const uint32_t *c_indices, const int32_t *z2) { \
+    verify_v(v, c_indices, z2, n, q, d, mod_p, one_q2, kappa);          \
+  }                                                                     \
+  static void name##_mul2d(int32_t *output, const int32_t *input) {     \
+    mul2d(output, input, n, d);                                         \
+  }                                                                     \
+  static int32_t name##_max_norm(const int32_t *v) {                    \
+    return max_norm(v, n);                                              \
+  }                                                                     \
+  static int32_t name##_norm2(const int32_t *v) {                       \
+    return scalar_product(v, v, n);                                     \
+  }                                                                     \
+  static int32_t name##_scalar_product(const int32_t *v1, const int32_t *v2) { \
+    return scalar_product(v1, v2, n);                                   \
+  }                                                                     \
+  static void name##_greedy_sc(const int8_t *s1x, const int8_t *s2x, const uint32_t *c_indices, \
+                               int32_t *v1, int32_t *v2) {              \
+    greedy_sc_##n(s1x, s2x, c_indices, kappa, v1, v2);                  \
+  }                                                                     \
+  static const bliss_b_kernels_t name##_kernels = {                     \
+    kind, n, q, d, mod_p, kappa,                                        \
+    name##_coupon, name##_compress_z2, name##_verify_v, name##_mul2d,   \
+    name##_max_norm, name##_norm2, name##_scalar_product, name##_greedy_sc, \
+  };
+
+/*
+ * Same parameters as in bliss_b_params.c
+ */
+KERNELS_INSTANCE(bliss_b_0, BLISS_B_0, 7681, 256, 5, 480, 3841, 12)
+KERNELS_INSTANCE(bliss_b_1, BLISS_B_1, 12289, 512, 10, 24, 6145, 23)
+KERNELS_INSTANCE(bliss_b_2, BLISS_B_2, 12289, 512, 10, 24, 6145, 23)
+KERNELS_INSTANCE(bliss_b_3, BLISS_B_3, 12289, 512, 9, 48, 6145, 30)
+KERNELS_INSTANCE(bliss_b_4, BLISS_B_4, 12289, 512, 8, 96, 6145, 39)
+
+static const bliss_b_kernels_t *const bliss_b_kernels_table[] = {
+  &bliss_b_0_kernels, &bliss_b_1_kernels, &bliss_b_2_kernels, &bliss_b_3_kernels, &bliss_b_4_kernels,
+};
+
+const bliss_b_kernels_t *bliss_b_kernels(bliss_kind_t kind) {
+  if (BLISS_B_0 <= kind && kind <= BLISS_B_4) {
+    return bliss_b_kernels_table[kind];
+  }
+  return NULL;
+}
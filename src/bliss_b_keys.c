@@ -10,6 +10,7 @@
 #include "entropy.h"
 
 #include "ntt_api.h"
+#include "greedy_sc.h"
 
 /*
    Constructs a random polyomial
@@ -135,15 +136,20 @@ static void check_key(bliss_private_key_t *key, bliss_param_t *p, ntt_state_t st
  */
 static int32_t bliss_b_private_key_init(bliss_private_key_t *private_key, bliss_kind_t kind, uint32_t n){
   int32_t *f, *g, *a;
+  int8_t *fx, *gx;
 
   /* we calloc so we do not have to zero them out later */
   f = NULL;
   g = NULL;
   a = NULL;
+  fx = NULL;
+  gx = NULL;
   f = calloc(n, sizeof(int32_t));
   g = calloc(n, sizeof(int32_t));
   a = calloc(n, sizeof(int32_t));
-  if (f == NULL || g == NULL || a == NULL) {
+  fx = calloc(2 * n, sizeof(int8_t));
+  gx = calloc(2 * n, sizeof(int8_t));
+  if (f == NULL || g == NULL || a == NULL || fx == NULL || gx == NULL) {
     goto fail;
   }
 
@@ -152,6 +158,8 @@ static int32_t bliss_b_private_key_init(bliss_private_key_t *private_key, bliss_
   private_key->s1 = f;
   private_key->s2 = g;
   private_key->a = a;
+  private_key->s1x = fx;
+  private_key->s2x = gx;
 
   return BLISS_B_NO_ERROR;
 
@@ -160,6 +168,8 @@ static int32_t bliss_b_private_key_init(bliss_private_key_t *private_key, bliss_
   free(f);
   free(g);
   free(a);
+  free(fx);
+  free(gx);
 
   return BLISS_B_NO_MEM;
 
@@ -177,6 +187,8 @@ void bliss_b_private_key_delete(bliss_private_key_t *private_key){
   secure_free(&private_key->s1, n);
   secure_free(&private_key->s2, n);
   secure_free(&private_key->a, n);
+  secure_free_int8(&private_key->s1x, 2 * n);
+  secure_free_int8(&private_key->s2x, 2 * n);
 }
 
 /*
@@ -190,6 +202,7 @@ void bliss_b_private_key_delete(bliss_private_key_t *private_key){
  *   f is stored in private_key->s1,
  *   g is stored in private_key->s2,
  *   NTT(a_q) is stored in private_key->a
+ *   the extensions of f and g are stored in private_key->s1x, s2x
  *
  * Error codes:
  * - BLISS_B_BAD_ARGS: kind is not supported
@@ -248,6 +261,10 @@ int32_t bliss_b_private_key_gen(bliss_private_key_t *private_key, bliss_kind_t k
       product_ntt(state, private_key->a, t, u); // a := NTT((2g - 1)/f)
       negate_ntt(state, private_key->a);        // a := NTT( - (2g - 1)/f)
 
+      /* compact copies for greedy_sc */
+      greedy_sc_extend(private_key->s1x, private_key->s1, p.n);
+      greedy_sc_extend(private_key->s2x, private_key->s2, p.n);
+
 #if 0
       // BD: for debugging (iam: must do it before cleanup)
       check_key(private_key, &p, state);
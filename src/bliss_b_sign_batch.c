@@ -0,0 +1,263 @@
+// for sysconf with -std=c99
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "bliss_b_errors.h"
+#include "bliss_b_signatures.h"
+#include "bliss_b_utils.h"
+
+/*
+ * Batch signing with a pool of threads.
+ *
+ * Each worker owns a range [lo, hi) of message indices, packed into
+ * one 64bit word (lo in the low-order half) so that it can be updated
+ * atomically. The worker takes indices from the front of its range.
+ * When its range is empty, it steals the back half of another
+ * worker's range. Both operations are compare-and-swap on the range,
+ * so a worker never waits for another one.
+ *
+ * Each worker has its own signing context (NTT state, sampler, and
+ * scratch buffers) and its own entropy object, seeded from the
+ * caller's entropy. The private key is shared (read only).
+ *
+ * We use the GCC/clang __atomic builtins.
+ */
+
+#define MAX_THREADS 256
+
+typedef struct batch_s batch_t;
+
+typedef struct {
+  uint64_t range;
+  uint32_t id;
+  batch_t *batch;
+  entropy_t entropy;
+  bliss_b_sign_ctx_t ctx;
+  pthread_t thread;
+} worker_t;
+
+struct batch_s {
+  const bliss_private_key_t *private_key;
+  const uint8_t *const *msgs;
+  const size_t *lens;
+  bliss_signature_t *sigs;
+  uint32_t nworkers;
+  worker_t *workers;
+  int32_t error;   // first error code (0 if none)
+};
+
+static inline uint64_t make_range(uint32_t lo, uint32_t hi) {
+  return (uint64_t) lo | ((uint64_t) hi << 32);
+}
+
+static inline uint32_t range_lo(uint64_t r) {
+  return (uint32_t) r;
+}
+
+static inline uint32_t range_hi(uint64_t r) {
+  return (uint32_t) (r >> 32);
+}
+
+/*
+ * Take the first index of w's range: store it in *i
+ * - return false if the range is empty
+ */
+static bool take_index(worker_t *w, uint32_t *i) {
+  uint64_t r;
+  uint32_t lo, hi;
+
+  r = __atomic_load_n(&w->range, __ATOMIC_ACQUIRE);
+  do {
+    lo = range_lo(r);
+    hi = range_hi(r);
+    if (lo >= hi) {
+      return false;
+    }
+  } while (! __atomic_compare_exchange_n(&w->range, &r, make_range(lo + 1, hi), false,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+  *i = lo;
+
+  return true;
+}
+
+/*
+ * Steal the back half of another worker's range (rounded up) and make
+ * it w's range (w's range must be empty).
+ * - return false if all the ranges are empty
+ */
+static bool steal(worker_t *w) {
+  batch_t *batch;
+  worker_t *victim;
+  uint64_t r;
+  uint32_t k, lo, hi, half;
+
+  batch = w->batch;
+  for (k = 1; k < batch->nworkers; k++) {
+    victim = batch->workers + (w->id + k) % batch->nworkers;
+    r = __atomic_load_n(&victim->range, __ATOMIC_ACQUIRE);
+    for (;;) {
+      lo = range_lo(r);
+      hi = range_hi(r);
+      if (lo >= hi) break;
+      half = (hi - lo + 1) / 2;
+      if (__atomic_compare_exchange_n(&victim->range, &r, make_range(lo, hi - half), false,
+                                      __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        __atomic_store_n(&w->range, make_range(hi - half, hi), __ATOMIC_RELEASE);
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+static void *worker(void *arg) {
+  worker_t *w;
+  batch_t *batch;
+  bliss_signature_t *sig;
+  int32_t retcode, none;
+  uint32_t i;
+
+  w = arg;
+  batch = w->batch;
+  for (;;) {
+    if (! take_index(w, &i)) {
+      if (! steal(w)) break;
+      continue;
+    }
+    if (__atomic_load_n(&batch->error, __ATOMIC_RELAXED) != BLISS_B_NO_ERROR) {
+      continue;  // skip the rest
+    }
+
+    sig = batch->sigs + i;
+    retcode = bliss_signature_init(sig, batch->private_key->kind);
+    if (retcode == BLISS_B_NO_ERROR) {
+      retcode = bliss_b_ctx_sign(&w->ctx, sig, batch->msgs[i], batch->lens[i]);
+    }
+    if (retcode != BLISS_B_NO_ERROR) {
+      none = BLISS_B_NO_ERROR;
+      __atomic_compare_exchange_n(&batch->error, &none, retcode, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+  }
+
+  return NULL;
+}
+
+/*
+ * Number of processors (or 1 if we can't tell)
+ */
+static uint32_t num_processors(void) {
+  long n;
+
+  n = sysconf(_SC_NPROCESSORS_ONLN);
+  if (n < 1) return 1;
+  if (n > MAX_THREADS) return MAX_THREADS;
+  return (uint32_t) n;
+}
+
+int32_t bliss_b_sign_batch(const bliss_private_key_t *private_key, const uint8_t *const msgs[], const size_t lens[],
+                           bliss_signature_t sigs[], uint32_t count, uint32_t nthreads, entropy_t *entropy) {
+  batch_t batch;
+  worker_t *workers;
+  uint8_t seed[SHA3_512_DIGEST_LENGTH];
+  uint64_t x;
+  uint32_t i, j, started;
+  int32_t retcode;
+
+  for (i = 0; i < count; i++) {
+    sigs[i].kind = private_key->kind;
+    sigs[i].z1 = NULL;
+    sigs[i].z2 = NULL;
+    sigs[i].c = NULL;
+  }
+
+  if (nthreads == 0) {
+    nthreads = num_processors();
+  }
+  if (nthreads > MAX_THREADS) {
+    nthreads = MAX_THREADS;
+  }
+  if (nthreads > count) {
+    nthreads = count;
+  }
+  if (nthreads == 0) {
+    return BLISS_B_NO_ERROR;   // count = 0
+  }
+
+  workers = calloc(nthreads, sizeof(worker_t));
+  if (workers == NULL) {
+    return BLISS_B_NO_MEM;
+  }
+
+  batch.private_key = private_key;
+  batch.msgs = msgs;
+  batch.lens = lens;
+  batch.sigs = sigs;
+  batch.nworkers = nthreads;
+  batch.workers = workers;
+  batch.error = BLISS_B_NO_ERROR;
+
+  /*
+   * Contexts and entropy: worker i's seed is 64 bytes from the caller's entropy
+   */
+  retcode = BLISS_B_NO_ERROR;
+  for (i = 0; i < nthreads; i++) {
+    for (j = 0; j < SHA3_512_DIGEST_LENGTH; j += 8) {
+      x = entropy_random_uint64(entropy);
+      seed[j] = (uint8_t) x; seed[j + 1] = (uint8_t) (x >> 8);
+      seed[j + 2] = (uint8_t) (x >> 16); seed[j + 3] = (uint8_t) (x >> 24);
+      seed[j + 4] = (uint8_t) (x >> 32); seed[j + 5] = (uint8_t) (x >> 40);
+      seed[j + 6] = (uint8_t) (x >> 48); seed[j + 7] = (uint8_t) (x >> 56);
+    }
+    entropy_init(&workers[i].entropy, seed);
+    retcode = bliss_b_sign_ctx_init(&workers[i].ctx, private_key, &workers[i].entropy);
+    if (retcode != BLISS_B_NO_ERROR) {
+      break;
+    }
+    workers[i].id = i;
+    workers[i].batch = &batch;
+    workers[i].range = make_range((uint32_t) ((uint64_t) count * i / nthreads),
+                                  (uint32_t) ((uint64_t) count * (i + 1) / nthreads));
+  }
+  zero_int8_array((int8_t *) seed, sizeof(seed));
+  if (retcode != BLISS_B_NO_ERROR) {
+    nthreads = i;   // contexts 0 ... i-1 need to be deleted
+    goto done;
+  }
+
+  /*
+   * Worker 0 runs in the calling thread. If we can't start a thread,
+   * its range is stolen by the others.
+   */
+  started = 0;
+  for (i = 1; i < nthreads; i++) {
+    if (pthread_create(&workers[i].thread, NULL, worker, workers + i) != 0) {
+      break;
+    }
+    started = i;
+  }
+  worker(workers);
+  for (i = 1; i <= started; i++) {
+    pthread_join(workers[i].thread, NULL);
+  }
+
+  retcode = batch.error;
+
+ done:
+  for (i = 0; i < nthreads; i++) {
+    bliss_b_sign_ctx_delete(&workers[i].ctx);
+  }
+  zero_int8_array((int8_t *) workers, batch.nworkers * sizeof(worker_t));
+  free(workers);
+
+  if (retcode != BLISS_B_NO_ERROR) {
+    for (i = 0; i < count; i++) {
+      bliss_signature_delete(sigs + i);
+    }
+  }
+
+  return retcode;
+}
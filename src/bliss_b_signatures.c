@@ -7,24 +7,14 @@
 #include "bliss_b_utils.h"
 #include "sampler.h"
 #include "shake128.h"
-#include "modulii.h"
 
 #include "ntt_api.h"
+#include "greedy_sc.h"
+#include "bliss_b_coupon_server.h"
 
 #define VERBOSE_RESTARTS  false
 
 
-/* iam: bliss-06-13-2013 */
-static void mul2d(int32_t *output, const int32_t *input, uint32_t n, uint32_t d){
-  uint32_t i;
-
-  assert(0 < d && d < 31);
-
-  for (i = 0; i < n; i++){
-    output[i] = input[i] << d;
-  }
-}
-
 #ifndef NDEBUG
 static bool check_arg(int32_t v[], uint32_t n, int32_t q){
   uint32_t i;
@@ -38,84 +28,6 @@ static bool check_arg(int32_t v[], uint32_t n, int32_t q){
 }
 #endif
 
-/* iam: bliss-06-13-2013
- *
- *   on page 21 of DDLL: every x between [-q, q) and any positive integer d, x can be uniquely written
- *   as  x = [x]_d * 2^d  + r where r is in [-2^(d -1), 2^(d -1)).
- *
- *   this is computing: x --> [x]_d
- *
- */
-static void drop_bits(int32_t *output, const int32_t *input, uint32_t n, uint32_t d, int32_t q) {
-  uint32_t i;
-  int32_t x;
-  //  int32_t  delta, half_delta;
-
-  assert(0 < d && d < 31);
-
-  //  delta = 1<<d;
-  //  half_delta = delta >> 1;
-  for (i = 0; i < n; i++) {
-    //    output[i] = (input[i] + half_delta) / delta;
-    x = input[i] >= q ? input[i] - 2 * q : input[i];
-    output[i] = (x >> d) + ((x >> (d - 1)) & 1);
-  }
-}
-
-/*
- * GreedySC (derived from blzzd version)
- *
- * should be static once we choose one and use it.
- *
- * Input:  s1, s2, are the polynomial components of the secret key.
- *         c_indices correspond to the sparse polynomial
- *
- * Output: v1 and v2 are output polynomials of size n.
- */
-static void greedy_sc(const int32_t *s1, const int32_t *s2, uint32_t n,  const uint32_t *c_indices, uint32_t kappa, int32_t *v1, int32_t *v2){
-  uint32_t index, i, k;
-  int32_t sign;
-
-  for (i = 0; i < n; i++) {
-    v1[i] = 0;
-    v2[i] = 0;
-  }
-
-  for (k = 0; k < kappa; k++) {
-    index = c_indices[k];
-    sign = 0;
-    /* \xi_i = sign(<v, si>) */
-    for (i = 0; i < n - index; i++) {
-      sign += s1[i] * v1[index + i] + s2[i] * v2[index + i];
-    }
-    for (i = n - index; i < n; i++) {
-      sign -= s1[i] * v1[index + i - n] + s2[i] * v2[index + i - n];
-    }
-    /* v = v - \xi_i . si */
-    if (sign > 0) {
-      for (i = 0; i < n - index; i++) {
-        v1[index + i] -= s1[i];
-        v2[index + i] -= s2[i];
-      }
-      for (i = n - index; i < n; i++) {
-        v1[index + i - n] += s1[i];
-        v2[index + i - n] += s2[i];
-      }
-    } else {
-      for (i = 0; i < n - index; i++) {
-        v1[index + i] += s1[i];
-        v2[index + i] += s2[i];
-      }
-      for (i = n - index; i < n; i++) {
-        v1[index + i - n] -= s1[i];
-        v2[index + i - n] -= s2[i];
-      }
-    }
-  }
-}
-
-
-
 static void generateC(uint32_t *indices, uint32_t kappa, const int32_t *n_vector, uint32_t n, uint8_t *hash, uint32_t hash_sz) {
   uint8_t whash[SHA3_512_DIGEST_LENGTH];
   uint8_t array[512];  // size we need is either 256 (for Bliss 0) or 512 for others
@@ -376,116 +288,231 @@ static void check_before_drop(const bliss_private_key_t *key, uint8_t *hash, uin
 
 #endif
 
-int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *private_key, const uint8_t *msg, size_t msg_sz, entropy_t *entropy){
-  sampler_t sampler;
-  bliss_b_error_t retval;
-  bliss_param_t p;
-  ntt_state_t state;
-
-  // parameters extracted from p: n = size, kappa = number of nonzero indices
-  uint32_t n, kappa;
-  // these are the private key (a is stored as NTT)
-  int32_t *a, *s1, *s2;
-  // the signature is stored in z1, z2, indices
-  int32_t *z1 = NULL, *z2 = NULL;
-  uint32_t *indices = NULL;
-  // all these are auxiliary buffers, malloc'ed in this function
-  int32_t *y1 = NULL, *y2 = NULL, *v = NULL, *dv = NULL, *v1 = NULL, *v2 = NULL;
-  uint8_t *hash = NULL;
-  uint32_t i, norm_v, hash_sz;
-  int32_t prod_zv;
-  bool b;
-
+/*
+ * Signing context
+ */
+int32_t bliss_b_sign_ctx_init(bliss_b_sign_ctx_t *ctx, const bliss_private_key_t *private_key, entropy_t *entropy){
+  bliss_param_t *p;
+  uint32_t n;
 
-  if (! bliss_params_init(&p, private_key->kind)) {
+  p = &ctx->p;
+  if (! bliss_params_init(p, private_key->kind)) {
     // bad kind/not supported
     return BLISS_B_BAD_ARGS;
   }
+  ctx->kernels = bliss_b_kernels(private_key->kind);
 
-  a = private_key->a;
-  s1 = private_key->s1;
-  s2 = private_key->s2;
-
-  n = p.n;
+  /* initialize our sampler */
+  if (!sampler_init(&ctx->sampler, p->sigma, p->ell, p->precision, entropy)) {
+    return BLISS_B_BAD_ARGS;
+  }
 
-  kappa = p.kappa;
+  n = p->n;
+  ctx->private_key = private_key;
+  ctx->entropy = entropy;
+  ctx->hash_sz = SHA3_512_DIGEST_LENGTH + 2 * n;
 
   //opaque, but clearly a pointer type.
-  state = init_ntt_state(private_key->kind);
-  if (state == NULL) {
+  ctx->state = init_ntt_state(private_key->kind);
+  if (ctx->state == NULL) {
+    return BLISS_B_NO_MEM;
+  }
+  ctx->ntt = init_ntt(ctx->state);
+  ctx->hash = malloc(ctx->hash_sz);
+  ctx->y1 = calloc(6 * n, sizeof(int32_t));
+  if (ctx->ntt == NULL || ctx->hash == NULL || ctx->y1 == NULL) {
+    if (ctx->ntt != NULL) delete_ntt(ctx->state, ctx->ntt);
+    delete_ntt_state(ctx->state);
+    free(ctx->hash);
+    free(ctx->y1);
     return BLISS_B_NO_MEM;
   }
 
+  /* all work polynomials are carved out of the y1 block */
+  ctx->y2 = ctx->y1 + n;
+  ctx->v = ctx->y2 + n;
+  ctx->dv = ctx->v + n;
+  ctx->v1 = ctx->dv + n;
+  ctx->v2 = ctx->v1 + n;
 
-  /* initialize our sampler */
-  if (!sampler_init(&sampler, p.sigma, p.ell, p.precision, entropy)) {
-    retval = BLISS_B_BAD_ARGS;
-    goto fail;
-  }
+  /* no coupons */
+  ctx->coupons = NULL;
+  ctx->coupon_capacity = 0;
+  ctx->coupon_count = 0;
+  ctx->coupon_head = 0;
 
-  /* make working space */
-  hash_sz =  SHA3_512_DIGEST_LENGTH + 2 * n;
+  return BLISS_B_NO_ERROR;
+}
 
-  hash = malloc(hash_sz);
-  if(hash ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
+void bliss_b_sign_ctx_delete(bliss_b_sign_ctx_t *ctx){
+  zero_int_array(ctx->ntt, ctx->p.n);
+  delete_ntt(ctx->state, ctx->ntt);
+  ctx->ntt = NULL;
+  delete_ntt_state(ctx->state);
+  ctx->state = NULL;
+
+  free(ctx->hash);
+  ctx->hash = NULL;
+
+  secure_free(&ctx->y1, 6 * ctx->p.n);
+  ctx->y2 = NULL;
+  ctx->v = NULL;
+  ctx->dv = NULL;
+  ctx->v1 = NULL;
+  ctx->v2 = NULL;
+
+  secure_free(&ctx->coupons, 4 * ctx->coupon_capacity * ctx->p.n);
+  ctx->coupon_capacity = 0;
+  ctx->coupon_count = 0;
+  ctx->coupon_head = 0;
+}
 
-  z1 = malloc(n * sizeof(int32_t));
-  if(z1 ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
 
-  z2 = malloc(n * sizeof(int32_t));
-  if(z2 ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
+/*
+ * Coupons: a coupon is a block of 4n integers that stores y1, y2, v, dv
+ * in this order (the same layout as ctx->y1 ... ctx->dv).
+ */
 
-  v1 = malloc(n * sizeof(int32_t));
-  if(v1 ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
+/*
+ * Steps 1 to 2b of the signing algorithm: store a new coupon in c
+ */
+void bliss_b_sign_ctx_compute_coupon(bliss_b_sign_ctx_t *ctx, int32_t *c){
+  const bliss_param_t *p;
+  int32_t *y1, *y2, *v, *dv;
+  uint32_t n;
 
-  v2 = malloc(n * sizeof(int32_t));
-  if(v2 ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
+  p = &ctx->p;
+  n = p->n;
+  y1 = c;
+  y2 = c + n;
+  v = c + 2 * n;
+  dv = c + 3 * n;
 
-  y1 = malloc(n * sizeof(int32_t));
-  if(y1 ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
+  /* 1: choose y1, y2 */
+  sampler_gauss_n(&ctx->sampler, y1, n);
+  sampler_gauss_n(&ctx->sampler, y2, n);
+
+  /* 2: compute v = ((2 * xi * a * y1) + y2) mod 2q */
+  multiply_ntt_into(ctx->state, v, y1, ctx->private_key->a, ctx->ntt);
 
-  y2 = malloc(n * sizeof(int32_t));
-  if(y2 ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
+  /* 2 (cont'd) and 2b: drop bits mod_p */
+  ctx->kernels->coupon(v, dv, y2);
+}
+
+/*
+ * Move the oldest coupon of ctx's pool into ctx->y1 ... ctx->dv
+ * - return false if the pool is empty
+ */
+static bool take_coupon(bliss_b_sign_ctx_t *ctx){
+  int32_t *c;
+  uint32_t size;
+
+  if (ctx->coupon_count == 0) {
+    return false;
   }
 
-  v = calloc(n, sizeof(int32_t));
-  if(v ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
+  size = 4 * ctx->p.n;
+  c = ctx->coupons + ctx->coupon_head * size;
+  memcpy(ctx->y1, c, size * sizeof(int32_t));
+  zero_int_array(c, size);
+
+  ctx->coupon_head ++;
+  if (ctx->coupon_head == ctx->coupon_capacity) {
+    ctx->coupon_head = 0;
   }
+  ctx->coupon_count --;
 
-  dv = calloc(n, sizeof(int32_t));
-  if(dv ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
+  return true;
+}
+
+int32_t bliss_b_sign_ctx_reserve_coupons(bliss_b_sign_ctx_t *ctx, uint32_t capacity){
+  secure_free(&ctx->coupons, 4 * ctx->coupon_capacity * ctx->p.n);
+  ctx->coupon_capacity = 0;
+  ctx->coupon_count = 0;
+  ctx->coupon_head = 0;
+
+  if (capacity > 0) {
+    ctx->coupons = calloc(4 * (size_t) capacity * ctx->p.n, sizeof(int32_t));
+    if (ctx->coupons == NULL) {
+      return BLISS_B_NO_MEM;
+    }
+    ctx->coupon_capacity = capacity;
   }
 
-  indices = calloc(kappa, sizeof(int32_t));
-  if(indices ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
+  return BLISS_B_NO_ERROR;
+}
+
+uint32_t bliss_b_sign_ctx_precompute(bliss_b_sign_ctx_t *ctx, uint32_t count){
+  uint32_t k, tail;
+
+  for (k = 0; k < count && ctx->coupon_count < ctx->coupon_capacity; k++) {
+    tail = ctx->coupon_head + ctx->coupon_count;
+    if (tail >= ctx->coupon_capacity) {
+      tail -= ctx->coupon_capacity;
+    }
+    bliss_b_sign_ctx_compute_coupon(ctx, ctx->coupons + tail * 4 * ctx->p.n);
+    ctx->coupon_count ++;
   }
 
+  return k;
+}
+
+uint32_t bliss_b_sign_ctx_coupons(const bliss_b_sign_ctx_t *ctx){
+  return ctx->coupon_count;
+}
+
+
+/*
+ * Signature using ctx: the coupons are taken from ctx's pool, then
+ * from server (if server is not NULL), or computed.
+ */
+static int32_t ctx_sign(bliss_b_sign_ctx_t *ctx, bliss_b_coupon_server_t *server, bliss_signature_t *signature,
+                        const uint8_t *msg, size_t msg_sz){
+  const bliss_param_t *p;
+  const bliss_b_kernels_t *k;
+  sampler_t *sampler;
+
+  // parameters extracted from p: n = size, kappa = number of nonzero indices
+  uint32_t n, kappa;
+  // these are the private key (a is stored as NTT, s1x and s2x are the compact copies of s1 and s2)
+  int32_t *a;
+  int8_t *s1x, *s2x;
+  // the signature is stored in z1, z2, indices
+  int32_t *z1, *z2;
+  uint32_t *indices;
+  // all these are auxiliary buffers, owned by the context
+  int32_t *y1, *y2, *v, *dv, *v1, *v2;
+  uint8_t *hash;
+  uint32_t i, norm_v, hash_sz;
+  int32_t prod_zv;
+  bool b;
+
+  p = &ctx->p;
+  k = ctx->kernels;
+  assert(signature->kind == p->kind);
+  assert(signature->z1 != NULL && signature->z2 != NULL && signature->c != NULL);
+
+  a = ctx->private_key->a;
+  s1x = ctx->private_key->s1x;
+  s2x = ctx->private_key->s2x;
+
+  n = p->n;
+  kappa = p->kappa;
+
+  sampler = &ctx->sampler;
+
+  hash = ctx->hash;
+  hash_sz = ctx->hash_sz;
+  y1 = ctx->y1;
+  y2 = ctx->y2;
+  v = ctx->v;
+  dv = ctx->dv;
+  v1 = ctx->v1;
+  v2 = ctx->v2;
+
+  z1 = signature->z1;
+  z2 = signature->z2;
+  indices = signature->c;
 
   /* 0: compute the hash of the msg */
 
@@ -509,43 +536,20 @@ int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *p
     printf("\n");
   }
 
-  /* 1 restart: choose y1, y2 */
+  /* 1 restart: take a coupon (y1, y2, v, dv) or compute one */
 
  restart:
 
-  for(i = 0; i < n; i++){
-    y1[i] = sampler_gauss(&sampler);
-    y2[i] = sampler_gauss(&sampler);
-  }
-
-  /* 2: compute v = ((2 * xi * a * y1) + y2) mod 2q */
-  multiply_ntt(state, v, y1, a);
-
-  for (i=0; i<n; i++) {
-    // this is v[i] = (2 * v[i] * xi + y2[i]) % q2
-    v[i] = smodq(2 * v[i] * p.one_q2 + y2[i], p.q2);
-  }
-
-  if (false) {
-    printf("sign: v before drop bits\n");
-    for (i=0; i<n; i++) {
-      printf(" %d", v[i]);
-      if ((i & 15) == 15) printf("\n");
-    }
+  if (! take_coupon(ctx) &&
+      (server == NULL || ! bliss_b_coupon_server_take(server, y1))) {
+    bliss_b_sign_ctx_compute_coupon(ctx, y1);
   }
 
 #if 0
   // DEBUG
-  check_before_drop(private_key, hash, hash_sz, v, y1, y2, &p, state);
+  check_before_drop(ctx->private_key, hash, hash_sz, v, y1, y2, p, ctx->state);
 #endif
 
-  /* 2b: drop bits mod_p */
-  assert(check_arg(v, n, p.q2));
-  drop_bits(dv, v, n, p.d, p.q);
-  for (i=0; i<n; i++) {
-    dv[i] = smodq(dv[i], p.mod_p);
-  }
-
   /* 3: generateC of v and the hash of the msg */
   if (false) {
     printf("sign: input to generateC\n");
@@ -568,24 +572,24 @@ int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *p
 
   /* 4: (v1, v2) = greedySC(c) */
 
-  greedy_sc(s1, s2, n, indices, kappa, v1, v2);
+  k->greedy_sc(s1x, s2x, indices, v1, v2);
 
   /* 4a: continue with probability 1/(M exp(-|v|^2/2sigma^2) otherwise restart */
   // NOTE: we can do the ber_exp earlier since it does not depend on z
-  norm_v = (uint32_t)(vector_norm2(v1, n) + vector_norm2(v2, n));
+  norm_v = (uint32_t)(k->norm2(v1) + k->norm2(v2));
 
-  if (p.M <= norm_v) {
-    fprintf(stdout, "M = %d norm = %d\n", (int)p.M, (int)norm_v);
+  if (p->M <= norm_v) {
+    fprintf(stdout, "M = %d norm = %d\n", (int)p->M, (int)norm_v);
   }
-  assert(p.M > norm_v);
+  assert(p->M > norm_v);
 
-  if (! sampler_ber_exp(&sampler, p.M - norm_v)) {
+  if (! sampler_ber_exp(sampler, p->M - norm_v)) {
     if (VERBOSE_RESTARTS) { fprintf(stdout, "--> sampler_ber_exp false\n");  }
     goto restart;
   }
 
   /* 5: choose a random bit b */
-  b = entropy_random_bit(entropy);
+  b = entropy_random_bit(ctx->entropy);
 
   /* 6: (z1, z2) = (y1, y2) + (-1)^b * (v1, v2) */
 
@@ -602,8 +606,8 @@ int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *p
   }
 
   /* 6a: continue with probability 1/cosh(<z, v>/sigma^2)) otherwise restart */
-  prod_zv = vector_scalar_product(z1, v1, n) + vector_scalar_product(z2, v2, n);
-  if (! sampler_ber_cosh(&sampler, prod_zv)) {
+  prod_zv = k->scalar_product(z1, v1) + k->scalar_product(z2, v2);
+  if (! sampler_ber_cosh(sampler, prod_zv)) {
     if (VERBOSE_RESTARTS){ fprintf(stdout, "--> sampler_ber_cosh false\n"); }
     goto restart;
   }
@@ -624,22 +628,8 @@ int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *p
   }
 
   /* 7: z2 = (drop_bits(v) - drop_bits(v - z2)) mod p  */
-  for (i=0; i<n; i++) {
-    y1[i] = smodq(v[i] - z2[i], p.q2);
-  }
-  assert(check_arg(v, n, p.q2));
-  drop_bits(v, v, n, p.d, p.q);   // drop_bits(v)
-  assert(check_arg(y1, n, p.q2));
-  drop_bits(y1, y1, n, p.d, p.q); // drop_bits(v - z2)
-  for (i=0; i<n; i++) {
-    z2[i] = v[i] - y1[i];
-    if (z2[i] <  -p.mod_p/2) {
-      z2[i] += p.mod_p;
-    } else if (z2[i] >  p.mod_p/2) {
-      z2[i] -= p.mod_p;
-    }
-    assert(-p.mod_p/2 <= z2[i] && z2[i] < p.mod_p/2);
-  }
+  assert(check_arg(v, n, p->q2));
+  k->compress_z2(z2, v);
 
   if (false) {
     printf("*** After drop bits ***\n");
@@ -653,16 +643,16 @@ int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *p
 
 
   /* 8: Also need to check norms akin to what happens in the entry to verify for BLISS-0, BLISS-3 and BLISS-4 */
-  if (vector_max_norm(z1, n) > p.b_inf) {
+  if (k->max_norm(z1) > p->b_inf) {
     if(true || VERBOSE_RESTARTS){ fprintf(stdout, "--> norm z1 too high\n"); }
     goto restart;
   }
-  mul2d(y2, z2, n, p.d);
-  if (vector_max_norm(y2, n) > p.b_inf) {
+  k->mul2d(y2, z2);
+  if (k->max_norm(y2) > p->b_inf) {
     if(true || VERBOSE_RESTARTS){ fprintf(stdout, "--> norm z2*2^d too high\n"); }
     goto restart;
   }
-  if (vector_norm2(z1,  n) + vector_norm2(y2, n) > p.b_l2){
+  if (k->norm2(z1) + k->norm2(y2) > p->b_l2){
     if(true || VERBOSE_RESTARTS){ fprintf(stdout, "--> euclidean norm too high\n"); }
     goto restart;
   }
@@ -677,37 +667,47 @@ int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *p
     printf("\n\n");
   }
 
-  signature->kind = p.kind;
-  signature->z1 = z1;
-  signature->z2 = z2;
-  signature->c = (uint32_t *)indices;
-
-  /* need to free some stuff */
+  /* don't leave y1, y2, v1, v2 lying around: they leak the key */
+  zero_int_array(ctx->y1, 6 * n);
 
-  retval = BLISS_B_NO_ERROR;
+  return BLISS_B_NO_ERROR;
+}
 
-  goto cleanup;
 
- fail:
+int32_t bliss_b_ctx_sign(bliss_b_sign_ctx_t *ctx, bliss_signature_t *signature, const uint8_t *msg, size_t msg_sz){
+  return ctx_sign(ctx, NULL, signature, msg, msg_sz);
+}
 
-  secure_free(&z1, n);
-  secure_free(&z2, n);
-  secure_free((int32_t **)&indices, kappa);
+int32_t bliss_b_ctx_sign_server(bliss_b_sign_ctx_t *ctx, bliss_b_coupon_server_t *server,
+                                bliss_signature_t *signature, const uint8_t *msg, size_t msg_sz){
+  if (server->ctx.private_key != ctx->private_key) {
+    return BLISS_B_BAD_ARGS;
+  }
+  return ctx_sign(ctx, server, signature, msg, msg_sz);
+}
 
- cleanup:
 
-  free(hash);
-  hash = NULL;
+/*
+ * One-shot signature: build a context, sign, delete the context.
+ */
+int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *private_key, const uint8_t *msg, size_t msg_sz, entropy_t *entropy){
+  bliss_b_sign_ctx_t ctx;
+  int32_t retval;
 
-  delete_ntt_state(state);
+  retval = bliss_b_sign_ctx_init(&ctx, private_key, entropy);
+  if (retval != BLISS_B_NO_ERROR) {
+    return retval;
+  }
 
-  secure_free(&v, n);
-  secure_free(&dv, n);
-  secure_free(&y1, n);
-  secure_free(&y2, n);
-  secure_free(&v1, n);
-  secure_free(&v2, n);
+  retval = bliss_signature_init(signature, private_key->kind);
+  if (retval == BLISS_B_NO_ERROR) {
+    retval = bliss_b_ctx_sign(&ctx, signature, msg, msg_sz);
+    if (retval != BLISS_B_NO_ERROR) {
+      bliss_signature_delete(signature);
+    }
+  }
 
+  bliss_b_sign_ctx_delete(&ctx);
 
   return retval;
 }
@@ -715,101 +715,126 @@ int32_t bliss_b_sign(bliss_signature_t *signature,  const bliss_private_key_t *p
 
 
 
-int32_t bliss_b_verify(const bliss_signature_t *signature,  const bliss_public_key_t *public_key, const uint8_t *msg, size_t msg_sz){
-  bliss_b_error_t retval;
-  bliss_param_t p;
+/*
+ * Verification context
+ */
+int32_t bliss_b_verify_ctx_init(bliss_b_verify_ctx_t *ctx, const bliss_public_key_t *public_key){
+  bliss_param_t *p;
+  uint32_t n;
+
+  p = &ctx->p;
+  if (! bliss_params_init(p, public_key->kind)) {
+    // bad kind/not supported
+    return BLISS_B_BAD_ARGS;
+  }
+  ctx->kernels = bliss_b_kernels(public_key->kind);
+
+  n = p->n;
+  ctx->public_key = public_key;
+  ctx->hash_sz = SHA3_512_DIGEST_LENGTH + 2 * n;
+
+  //opaque, but clearly a pointer type.
+  ctx->state = init_ntt_state(public_key->kind);
+  if (ctx->state == NULL) {
+    return BLISS_B_NO_MEM;
+  }
+  ctx->ntt = init_ntt(ctx->state);
+  ctx->hash = malloc(ctx->hash_sz);
+  ctx->tz2 = calloc(2 * n, sizeof(int32_t));
+  ctx->indices = calloc(p->kappa, sizeof(uint32_t));
+  if (ctx->ntt == NULL || ctx->hash == NULL || ctx->tz2 == NULL || ctx->indices == NULL) {
+    if (ctx->ntt != NULL) delete_ntt(ctx->state, ctx->ntt);
+    delete_ntt_state(ctx->state);
+    free(ctx->hash);
+    free(ctx->tz2);
+    free(ctx->indices);
+    return BLISS_B_NO_MEM;
+  }
+  ctx->v = ctx->tz2 + n;
+
+  return BLISS_B_NO_ERROR;
+}
+
+void bliss_b_verify_ctx_delete(bliss_b_verify_ctx_t *ctx){
+  delete_ntt(ctx->state, ctx->ntt);
+  ctx->ntt = NULL;
+
+  delete_ntt_state(ctx->state);
+  ctx->state = NULL;
+
+  free(ctx->hash);
+  ctx->hash = NULL;
+
+  free(ctx->tz2);
+  ctx->tz2 = NULL;
+  ctx->v = NULL;
+
+  free(ctx->indices);
+  ctx->indices = NULL;
+}
+
+
+/*
+ * Verification: ctx->hash must contain SHA3_512(msg) in its first
+ * SHA3_512_DIGEST_LENGTH bytes.
+ * - az1 is either NULL or the product a * z1 computed by the caller.
+ */
+static int32_t ctx_verify_hashed(bliss_b_verify_ctx_t *ctx, const bliss_signature_t *signature, const int32_t *az1){
+  const bliss_param_t *p;
+  const bliss_b_kernels_t *k;
   ntt_state_t state;
 
-  // parameters extracted from p: n = size, q = modulus
+  // parameters extracted from p: n = size
   uint32_t n, kappa;
-  int32_t  q;
 
   uint32_t i;
 
-  int32_t *a, *z1, *z2, *tz2 = NULL, *v = NULL;
-  uint32_t *c_indices, *indices = NULL;
-  uint32_t idx;
+  int32_t *a, *z1, *z2, *tz2, *v;
+  uint32_t *c_indices, *indices;
 
-  uint8_t *hash = NULL;
+  uint8_t *hash;
   size_t hash_sz;
 
-  assert(public_key->kind == signature->kind);
-
-  if (! bliss_params_init(&p, public_key->kind)) {
-    // bad kind/not supported
-    return BLISS_B_BAD_ARGS;
-  }
+  p = &ctx->p;
+  k = ctx->kernels;
+  assert(p->kind == signature->kind);
 
-  a = public_key->a;
+  a = ctx->public_key->a;
 
-  n = p.n;
-  q = p.q;
+  n = p->n;
 
-  kappa = p.kappa;
+  kappa = p->kappa;
 
   z1 = signature->z1;         /* length n */
   z2 = signature->z2;         /* length n */
   c_indices = signature->c;   /* length kappa */
 
-  //opaque, but clearly a pointer type.
-  state = init_ntt_state(public_key->kind);
-  if (state == NULL) {
-    return BLISS_B_NO_MEM;
-  }
-
-  tz2 = calloc(n, sizeof(int32_t));
-  if(tz2 ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
+  state = ctx->state;
+  tz2 = ctx->tz2;
+  v = ctx->v;
+  indices = ctx->indices;
+  hash = ctx->hash;
+  hash_sz = ctx->hash_sz;
 
   /* first check the norms */
 
-  if (vector_max_norm(z1, n) > p.b_inf){
-    retval = BLISS_B_BAD_DATA;
-    goto fail;
+  if (k->max_norm(z1) > p->b_inf){
+    return BLISS_B_BAD_DATA;
   }
 
   /* multiply z2 by 2^d */
-  mul2d(tz2, z2, n, p.d);
+  k->mul2d(tz2, z2);
 
-  if(vector_max_norm(tz2, n) > p.b_inf){
-    retval = BLISS_B_BAD_DATA;
-    goto fail;
+  if(k->max_norm(tz2) > p->b_inf){
+    return BLISS_B_BAD_DATA;
   }
 
-  if (vector_norm2(z1, n) + vector_norm2(tz2, n) > p.b_l2){
-    retval = BLISS_B_BAD_DATA;
-    goto fail;
-  }
-
-  /* make working space */
-
-  hash_sz =  SHA3_512_DIGEST_LENGTH + 2 * n;
-
-  hash = malloc(hash_sz);
-  if(hash ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
-
-  v = calloc(n, sizeof(int32_t));
-  if(v ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
-  }
-
-  indices = calloc(kappa, sizeof(int32_t));
-  if(indices ==  NULL){
-    retval = BLISS_B_NO_MEM;
-    goto fail;
+  if (k->norm2(z1) + k->norm2(tz2) > p->b_l2){
+    return BLISS_B_BAD_DATA;
   }
 
   /* start the real work */
 
-  /* hash the message into the first SHA3_512_DIGEST_LENGTH bytes of the hash */
-  sha3_512(hash, msg, msg_sz);
-
   if (false) {
     printf("verify hash\n");
     for (i=0; i<SHA3_512_DIGEST_LENGTH; i++) {
@@ -844,35 +869,17 @@ int32_t bliss_b_verify(const bliss_signature_t *signature,  const bliss_public_k
   }
 
   /* v = a * z1 */
-  multiply_ntt(state, v, z1, a);
-
-  /* v = (1/(q + 2)) * a * z1 mod 2q */
-  for (i = 0; i < n; i++){
-    assert(0 <= v[i] && v[i] < q);
-    v[i] = smodq(2*v[i]*p.one_q2, p.q2);
-  }
-
-  /* v += (q/q+2) * c */
-  for (i = 0; i < kappa; i++) {
-    idx = c_indices[i];
-    v[idx] = smodq(v[idx] + (q * p.one_q2), p.q2); // TODO: store that in parameters?
-  }
-
-  if (false) {
-    printf("verify: v before drop bits\n");
-    for (i=0; i<n; i++) {
-      printf(" %d", v[i]);
-      if ((i & 15) == 15) printf("\n");
-    }
+  if (az1 != NULL) {
+    memcpy(v, az1, n * sizeof(int32_t));
+  } else {
+    multiply_ntt_into(state, v, z1, a, ctx->ntt);
   }
 
-  assert(check_arg(v, n, p.q2));
-  drop_bits(v, v, n, p.d, p.q);
-
-  /*  v += z_2  mod p. */
-  for (i = 0; i < n; i++) {
-    v[i] = smodq(v[i] + z2[i], p.mod_p);
-  }
+  /*
+   * v = (1/(q + 2)) * a * z1 + (q/q+2) * c mod 2q
+   * then v = drop_bits(v) + z2 mod p
+   */
+  k->verify_v(v, c_indices, z2);
 
   if (false) {
     printf("verify: input to generateC\n");
@@ -892,35 +899,71 @@ int32_t bliss_b_verify(const bliss_signature_t *signature,  const bliss_public_k
     printf("\n");
   }
 
-  retval = BLISS_B_NO_ERROR;
-
   for (i = 0; i < kappa; i++){
     if (indices[i] != c_indices[i]){
-      retval = BLISS_B_VERIFY_FAIL;
-      break;
+      return BLISS_B_VERIFY_FAIL;
     }
   }
 
+  return BLISS_B_NO_ERROR;
+}
 
- fail:
 
-  delete_ntt_state(state);
+int32_t bliss_b_ctx_verify(bliss_b_verify_ctx_t *ctx, const bliss_signature_t *signature, const uint8_t *msg, size_t msg_sz){
+  /* hash the message into the first SHA3_512_DIGEST_LENGTH bytes of the hash */
+  sha3_512(ctx->hash, msg, msg_sz);
+  return ctx_verify_hashed(ctx, signature, NULL);
+}
 
-  free(tz2);
-  tz2 = NULL;
+int32_t bliss_b_ctx_verify_digest(bliss_b_verify_ctx_t *ctx, const bliss_signature_t *signature, const uint8_t *digest,
+                                  const int32_t *az1){
+  memcpy(ctx->hash, digest, SHA3_512_DIGEST_LENGTH);
+  return ctx_verify_hashed(ctx, signature, az1);
+}
 
-  free(v);
-  v = NULL;
 
-  free(indices);
-  indices = NULL;
+/*
+ * One-shot verification: build a context, verify, delete the context.
+ */
+int32_t bliss_b_verify(const bliss_signature_t *signature,  const bliss_public_key_t *public_key, const uint8_t *msg, size_t msg_sz){
+  bliss_b_verify_ctx_t ctx;
+  int32_t retval;
 
-  free(hash);
-  hash = NULL;
+  assert(public_key->kind == signature->kind);
+
+  retval = bliss_b_verify_ctx_init(&ctx, public_key);
+  if (retval != BLISS_B_NO_ERROR) {
+    return retval;
+  }
+  retval = bliss_b_ctx_verify(&ctx, signature, msg, msg_sz);
+  bliss_b_verify_ctx_delete(&ctx);
 
   return retval;
 }
 
+int32_t bliss_signature_init(bliss_signature_t *signature, bliss_kind_t kind){
+  bliss_param_t p;
+
+  signature->kind = kind;
+  signature->z1 = NULL;
+  signature->z2 = NULL;
+  signature->c = NULL;
+
+  if (! bliss_params_init(&p, kind)) {
+    return BLISS_B_BAD_ARGS;
+  }
+
+  signature->z1 = calloc(p.n, sizeof(int32_t));
+  signature->z2 = calloc(p.n, sizeof(int32_t));
+  signature->c = calloc(p.kappa, sizeof(uint32_t));
+  if (signature->z1 == NULL || signature->z2 == NULL || signature->c == NULL) {
+    bliss_signature_delete(signature);
+    return BLISS_B_NO_MEM;
+  }
+
+  return BLISS_B_NO_ERROR;
+}
+
 void bliss_signature_delete(bliss_signature_t *signature){
   assert(signature != NULL);
 
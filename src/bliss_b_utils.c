@@ -17,6 +17,12 @@ void zero_int_array(int32_t *ptr, size_t len){
   }
 }
 
+void zero_int8_array(int8_t *ptr, size_t len){
+  if (ptr != NULL){
+    SecureZeroMemory((void *)ptr, len);
+  }
+}
+
 #else
 
 #include<string.h>
@@ -31,6 +37,12 @@ void zero_int_array(int32_t *ptr, size_t len){
   }
 }
 
+void zero_int8_array(int8_t *ptr, size_t len){
+  if (ptr != NULL) {
+    memset_func((void *)ptr, 0, len);
+  }
+}
+
 #endif
 
 
@@ -0,0 +1,259 @@
+// for sysconf with -std=c99
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bliss_b_errors.h"
+#include "bliss_b_signatures.h"
+#include "ntt_api.h"
+#include "shake128.h"
+
+/*
+ * Batch verification with a pool of threads.
+ *
+ * All verifications cost about the same, so there's no need for work
+ * stealing (as in bliss_b_sign_batch): the workers take blocks of
+ * BLOCK consecutive signatures from a shared counter. A block covers
+ * whole bytes of the result bitmap, so two workers never write to the
+ * same byte.
+ *
+ * In a block, the messages are hashed four at a time with sha3_512x4
+ * (if the four messages have the same length), and the products a * z1
+ * are computed with the batch NTT on BLOCK interleaved lanes. Then
+ * each signature is checked against its digest and product by
+ * bliss_b_ctx_verify_digest, using the worker's verification context.
+ *
+ * The AVX2, AVX-512, and int16 backends are at least as fast on one
+ * polynomial as the batch NTT is per lane, so with these backends we let
+ * bliss_b_ctx_verify_digest compute the products.
+ *
+ * We use the GCC/clang __atomic builtins.
+ */
+
+#define MAX_THREADS 256
+
+#define LANES 4
+#define BLOCK 8
+
+typedef struct batch_s batch_t;
+
+/*
+ * - lanes: BLOCK interleaved polynomials (n * BLOCK integers)
+ * - az1: the products a * z1 (BLOCK polynomials of n integers),
+ *   or NULL if we don't use the batch NTT
+ */
+typedef struct {
+  batch_t *batch;
+  bliss_b_verify_ctx_t ctx;
+  int32_t *lanes;
+  int32_t *az1;
+  pthread_t thread;
+} worker_t;
+
+struct batch_s {
+  const bliss_public_key_t *public_key;
+  const bliss_signature_t *sigs;
+  const uint8_t *const *msgs;
+  const size_t *lens;
+  uint8_t *valid;
+  uint32_t count;
+  uint32_t next;   // first signature not taken yet
+};
+
+/*
+ * Hash msgs[i ... i+n-1] into digests[0 ... n-1]
+ */
+static void hash_messages(const batch_t *batch, uint32_t i, uint32_t n, uint8_t digests[][SHA3_512_DIGEST_LENGTH]) {
+  const unsigned char *input[LANES];
+  unsigned char *output[LANES];
+  const size_t *lens;
+  uint32_t j, k;
+
+  lens = batch->lens + i;
+  for (j = 0; j < n; j += LANES) {
+    if (j + LANES <= n && lens[j] == lens[j + 1] && lens[j] == lens[j + 2] && lens[j] == lens[j + 3]) {
+      for (k = 0; k < LANES; k++) {
+        input[k] = batch->msgs[i + j + k];
+        output[k] = digests[j + k];
+      }
+      sha3_512x4(output, input, lens[j]);
+    } else {
+      for (k = j; k < n && k < j + LANES; k++) {
+        sha3_512(digests[k], batch->msgs[i + k], lens[k]);
+      }
+    }
+  }
+}
+
+/*
+ * Compute a * sigs[i + j].z1 into w->az1 + j * n for j = 0 ... count-1.
+ * A signature with the wrong kind or a too large z1 is rejected by
+ * bliss_b_ctx_verify_digest before it looks at the product, so we
+ * use a zero lane for it.
+ */
+static void multiply_z1(worker_t *w, uint32_t i, uint32_t count) {
+  const bliss_b_verify_ctx_t *ctx;
+  const bliss_signature_t *sig;
+  int32_t *polys[BLOCK];
+  uint32_t j, k, n;
+
+  ctx = &w->ctx;
+  n = ctx->p.n;
+  for (j = 0; j < BLOCK; j++) {
+    sig = j < count ? w->batch->sigs + i + j : NULL;
+    if (sig != NULL && sig->kind == ctx->p.kind && ctx->kernels->max_norm(sig->z1) <= (int32_t) ctx->p.b_inf) {
+      for (k = 0; k < n; k++) {
+        w->lanes[k * BLOCK + j] = sig->z1[k];
+      }
+    } else {
+      for (k = 0; k < n; k++) {
+        w->lanes[k * BLOCK + j] = 0;
+      }
+    }
+    polys[j] = w->az1 + j * n;
+  }
+
+  forward_ntt_batch(ctx->state, w->lanes, w->lanes, BLOCK);
+  product_ntt_batch(ctx->state, w->lanes, w->lanes, ctx->public_key->a, BLOCK);
+  inverse_ntt_batch(ctx->state, w->lanes, w->lanes, BLOCK);
+  deinterleave_polynomials(ctx->state, polys, w->lanes, BLOCK);
+}
+
+static void *worker(void *arg) {
+  worker_t *w;
+  batch_t *batch;
+  const bliss_signature_t *sig;
+  const int32_t *az1;
+  uint8_t digests[BLOCK][SHA3_512_DIGEST_LENGTH];
+  uint32_t i, j, n;
+  uint8_t bits;
+
+  w = arg;
+  batch = w->batch;
+  for (;;) {
+    i = __atomic_fetch_add(&batch->next, BLOCK, __ATOMIC_RELAXED);
+    if (i >= batch->count) break;
+    n = batch->count - i;
+    if (n > BLOCK) n = BLOCK;
+
+    hash_messages(batch, i, n, digests);
+    if (w->az1 != NULL) {
+      multiply_z1(w, i, n);
+    }
+    bits = 0;
+    for (j = 0; j < n; j++) {
+      sig = batch->sigs + i + j;
+      az1 = w->az1 != NULL ? w->az1 + j * w->ctx.p.n : NULL;
+      if (sig->kind == batch->public_key->kind &&
+          bliss_b_ctx_verify_digest(&w->ctx, sig, digests[j], az1) == BLISS_B_NO_ERROR) {
+        bits |= (uint8_t) (1u << j);
+      }
+    }
+    batch->valid[i / BLOCK] = bits;
+  }
+
+  return NULL;
+}
+
+/*
+ * Number of processors (or 1 if we can't tell)
+ */
+static uint32_t num_processors(void) {
+  long n;
+
+  n = sysconf(_SC_NPROCESSORS_ONLN);
+  if (n < 1) return 1;
+  if (n > MAX_THREADS) return MAX_THREADS;
+  return (uint32_t) n;
+}
+
+int32_t bliss_b_verify_batch(const bliss_public_key_t *public_key, const bliss_signature_t sigs[],
+                             const uint8_t *const msgs[], const size_t lens[], uint32_t count,
+                             uint8_t *valid, uint32_t nthreads) {
+  batch_t batch;
+  worker_t *workers;
+  ntt_backend_t backend;
+  uint32_t i, blocks, started;
+  int32_t retcode;
+
+  blocks = (count + BLOCK - 1) / BLOCK;
+  memset(valid, 0, blocks);
+
+  if (nthreads == 0) {
+    nthreads = num_processors();
+  }
+  if (nthreads > MAX_THREADS) {
+    nthreads = MAX_THREADS;
+  }
+  if (nthreads > blocks) {
+    nthreads = blocks;
+  }
+  if (nthreads == 0) {
+    return BLISS_B_NO_ERROR;   // count = 0
+  }
+
+  workers = calloc(nthreads, sizeof(worker_t));
+  if (workers == NULL) {
+    return BLISS_B_NO_MEM;
+  }
+
+  batch.public_key = public_key;
+  batch.sigs = sigs;
+  batch.msgs = msgs;
+  batch.lens = lens;
+  batch.valid = valid;
+  batch.count = count;
+  batch.next = 0;
+
+  retcode = BLISS_B_NO_ERROR;
+  for (i = 0; i < nthreads; i++) {
+    retcode = bliss_b_verify_ctx_init(&workers[i].ctx, public_key);
+    if (retcode != BLISS_B_NO_ERROR) {
+      break;
+    }
+    workers[i].batch = &batch;
+    backend = ntt_state_backend(workers[i].ctx.state);
+    if (backend != NTT_BACKEND_AVX2 && backend != NTT_BACKEND_AVX512 && backend != NTT_BACKEND_INT16) {
+      workers[i].lanes = malloc((size_t) workers[i].ctx.p.n * BLOCK * sizeof(int32_t));
+      workers[i].az1 = malloc((size_t) workers[i].ctx.p.n * BLOCK * sizeof(int32_t));
+      if (workers[i].lanes == NULL || workers[i].az1 == NULL) {
+        retcode = BLISS_B_NO_MEM;
+        i ++;   // to delete context i
+        break;
+      }
+    }
+  }
+  if (retcode != BLISS_B_NO_ERROR) {
+    nthreads = i;   // contexts 0 ... i-1 need to be deleted
+    goto done;
+  }
+
+  /*
+   * Worker 0 runs in the calling thread. If we can't start a thread,
+   * the others do its share.
+   */
+  started = 0;
+  for (i = 1; i < nthreads; i++) {
+    if (pthread_create(&workers[i].thread, NULL, worker, workers + i) != 0) {
+      break;
+    }
+    started = i;
+  }
+  worker(workers);
+  for (i = 1; i <= started; i++) {
+    pthread_join(workers[i].thread, NULL);
+  }
+
+ done:
+  for (i = 0; i < nthreads; i++) {
+    bliss_b_verify_ctx_delete(&workers[i].ctx);
+    free(workers[i].lanes);
+    free(workers[i].az1);
+  }
+  free(workers);
+
+  return retcode;
+}
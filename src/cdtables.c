@@ -0,0 +1,2357 @@
+#include <stdlib.h> // for NULL
+
+#include "cdtables.h"
+
+/*
+ *  Cumulative distribution tables for sampler_gauss_CDT.
+ *
+ *  These tables are generated by ../tools/tables (function init_cdt):
+ *  the table depends only on sigma.
+ *
+ *  BLISS 0:   sigma = 100
+ *  BLISS I:   sigma = 215
+ *  BLISS II:  sigma = 107
+ *  BLISS III: sigma = 250
+ *  BLISS IV:  sigma = 271
+ *
+ *  cdt_bliss_<sigma>[i] = floor(2^64 * Pr(|x| <= i)) where x is sampled
+ *  from the same distribution as the Bernoulli sampler: Pr(x) is
+ *  proportional to exp(-x^2/f) with f = k_sigma^2/ln 2.
+ *  cdt_guide_bliss_<sigma>[j] = smallest i such that cdt[i] > j * 2^56.
+ */
+
+#define CDT_100_SIZE 918
+
+static const uint64_t cdt_bliss_100[CDT_100_SIZE] = {
+	0x0104e08027c3ce8bULL, 0x030e9ada5272cc30ULL, 0x0518414290bcc036ULL, 0x0721c66ea173292dULL,
+	0x092b1d16cdccc4e6ULL, 0x0b3437f6ed1a0a7cULL, 0x0d3d09cf6805b770ULL, 0x0f4585663b40744aULL,
+	0x114d9d87f976af97ULL, 0x13554508cc6fee89ULL, 0x155c6ec57536f8d6ULL, 0x17630da44b2a7130ULL,
+	0x1969149639d59dcdULL, 0x1b6e7697bd715b8cULL, 0x1d7326b1dded73adULL, 0x1f7717fb2862cea1ULL,
+	0x217a3d98a6cf46bcULL, 0x237c8abed5fc2b57ULL, 0x257df2b29970d80aULL, 0x277e68ca2d531c2aULL,
+	0x297de06e16178c55ULL, 0x2b7c4d1a0de43ae2ULL, 0x2d79a25def88bbd9ULL, 0x2f75d3de9eeec637ULL,
+	0x3170d556eee735f7ULL, 0x336a9a988437a92cULL, 0x3563178cb5cd6da2ULL, 0x375a403569faf490ULL,
+	0x395008adf0a5862dULL, 0x3b44652bda4977d0ULL, 0x3d3749ffcbbbb428ULL, 0x3f28ab964e8ff63eULL,
+	0x41187e789e0bad01ULL, 0x4306b74d708e1604ULL, 0x44f34ad9bd56bac0ULL, 0x46de2e017e941bdbULL,
+	0x48c755c86fa4f9b2ULL, 0x4aaeb752c7775052ULL, 0x4c9447e5eef0c729ULL, 0x4e77fce9334d01e8ULL,
+	0x5059cbe6745ef01dULL, 0x5239aa8acea2eb9fULL, 0x54178ea741102b6cULL, 0x55f36e314e98c811ULL,
+	0x57cd3f439b4848d7ULL, 0x59a4f81e84f16ce6ULL, 0x5b7a8f28b75ca193ULL, 0x5d4dfaefbbe956d3ULL,
+	0x5f1f322884952432ULL, 0x60ee2baff25c7393ULL, 0x62bade8b56e92b04ULL, 0x648541e8f1849460ULL,
+	0x664d4d20674287a3ULL, 0x6812f7b3365ca3edULL, 0x69d6394d24b52aecULL, 0x6b9709c4a979da8cULL,
+	0x6d55611b51dfe973ULL, 0x6f11377e20f31352ULL, 0x70ca8545ea726b00ULL, 0x728142f7a8b670a8ULL,
+	0x74356944cd9cb2bdULL, 0x75e6f10b8e76080aULL, 0x7795d3572af5386cULL, 0x794209602f1cb00fULL,
+	0x7aeb8c8cb02a9e81ULL, 0x7c9256708483a737ULL, 0x7e3660cd769d0c46ULL, 0x7fd7a59372e7fdbcULL,
+	0x81761ee0b0c07851ULL, 0x8311c701d662dc81ULL, 0x84aa987217ec2411ULL, 0x86408ddb5169568eULL,
+	0x87d3a2161bfb962dULL, 0x8963d029de16d4d2ULL, 0x8af1134cd6e1f52fULL, 0x8c7b66e424bfcd99ULL,
+	0x8e02c683c7093127ULL, 0x8f872dee9b00d025ULL, 0x91089916540a6a5aULL, 0x9287041b6f2f7426ULL,
+	0x94026b4d21fbf317ULL, 0x957acb2944bef6dbULL, 0x96f0205c383ab08eULL, 0x986267c0c6d0c41bULL,
+	0x99d19e60013805b6ULL, 0x9b3dc17116c96810ULL, 0x9ca6ce5929726f0bULL, 0x9e0cc2ab1d5c060dULL,
+	0x9f6f9c2764552091ULL, 0xa0cf58bbc5110f43ULL, 0xa22bf6831e49f3b4ULL, 0xa38573c525d83857ULL,
+	0xa4dbcef623d06a27ULL, 0xa62f06b6a9b944c0ULL, 0xa77f19d345ec3107ULL, 0xa8cc07443332e191ULL,
+	0xaa15ce2d04b51e9fULL, 0xab5c6ddc4e4a3606ULL, 0xac9fe5cb4941e16aULL, 0xade0359d75b8ceaeULL,
+	0xaf1d5d20388d4bf6ULL, 0xb0575c4a7608e909ULL, 0xb18e333c29542c62ULL, 0xb2c1e23df8c9c1edULL,
+	0xb3f269c0c73ecca4ULL, 0xb51fca5d42564319ULL, 0xb64a04d36df5791eULL, 0xb7711a0a2cf02e77ULL,
+	0xb8950b0ec702abafULL, 0xb9b5d9146c30a2dbULL, 0xbad38573b59fb230ULL, 0xbbee11aa24048a1aULL,
+	0xbd057f599bb9d7a6ULL, 0xbe19d047de982ee6ULL, 0xbf2b065e03a6474bULL, 0xc03923a7ecb8ee03ULL,
+	0xc1442a53ba1a1fe4ULL, 0xc24c1cb13c4ec5f5ULL, 0xc350fd3164129481ULL, 0xc452ce65b0a18d9cULL,
+	0xc55192ff9c66a496ULL, 0xc64d4dd00826f85aULL, 0xc74601c6a4c10f42ULL, 0xc83bb1f15b976f34ULL,
+	0xc92e617bb5bdd981ULL, 0xca1e13ae42005a6eULL, 0xcb0acbedf9db412bULL, 0xcbf48dbba57af5e9ULL,
+	0xccdb5cb33eda8119ULL, 0xcdbf3c8b54177095ULL, 0xcea0311469119d73ULL, 0xcf7e3e38586d282aULL,
+	0xd05967f9b40ccfcbULL, 0xd131b273251a9527ULL, 0xd20721d6cbb4637cULL, 0xd2d9ba6d9e523ddcULL,
+	0xd3a98096c8fb3331ULL, 0xd47678c70c5e1a37ULL, 0xd540a7881ce2d3c3ULL, 0xd608117801c88b65ULL,
+	0xd6ccbb48746525ffULL, 0xd78ea9be3f99c276ULL, 0xd84de1b09f8fe2dfULL, 0xd90a6808a1d28469ULL,
+	0xd9c441c085d619b7ULL, 0xda7b73e31e0206a7ULL, 0xdb30038b314de5b9ULL, 0xdbe1f5e2dd84867fULL,
+	0xdc915022fa3e39a7ULL, 0xdd3e17927ca3a2bfULL, 0xdde85185dc09e981ULL, 0xde90035e7778c498ULL,
+	0xdf353289fc2a765eULL, 0xdfd7e481cd157165ULL, 0xe0781eca6b8ef64cULL, 0xe115e6f2e1159733ULL,
+	0xe1b142942a52268fULL, 0xe24a3750a35d2fafULL, 0xe2e0cad37556aed5ULL, 0xe37502d0055d558bULL,
+	0xe406e50164f23dd7ULL, 0xe4967729c3d5846cULL, 0xe523bf11e367d6b1ULL, 0xe5aec2888b9c95fbULL,
+	0xe63787620187c543ULL, 0xe6be13777f928a7cULL, 0xe7426ca6af60a044ULL, 0xe7c498d12570a812ULL,
+	0xe8449ddbde80e0b4ULL, 0xe8c281aebec15853ULL, 0xe93e4a3412dc4514ULL, 0xe9b7fd5812dcc371ULL,
+	0xea2fa10866fbcd9eULL, 0xeaa53b33ae5ad43eULL, 0xeb18d1c907b2f5b0ULL, 0xeb8a6ab79bff6744ULL,
+	0xebfa0bee2b2939f0ULL, 0xec67bb5a9aba3b5aULL, 0xecd37ee9869c4bfeULL, 0xed3d5c85d3ea1bf5ULL,
+	0xeda55a1845d5d9a5ULL, 0xee0b7d8714a9f850ULL, 0xee6fccb586e7d039ULL, 0xeed24d838c8776e4ULL,
+	0xef3305cd5c5bcc06ULL, 0xef91fb6b139d56f9ULL, 0xefef3430579e30f3ULL, 0xf04ab5ebf9a8da35ULL,
+	0xf0a486679d0b7b8fULL, 0xf0fcab675f50ba38ULL, 0xf1532aa982a6ea21ULL, 0xf1a809e61a761288ULL,
+	0xf1fb4eceba24e1caULL, 0xf24cff0e260c5826ULL, 0xf29d204806999db7ULL, 0xf2ebb8189d9d25e0ULL,
+	0xf338cc147dc5f24aULL, 0xf38461c84447790eULL, 0xf3ce7eb854a86501ULL, 0xf417286096b81c23ULL,
+	0xf45e643436a8af22ULL, 0xf4a4379d674a8d92ULL, 0xf4e8a7fd26671533ULL, 0xf52bbaab0336ceefULL,
+	0xf56d74f4e6efeab8ULL, 0xf5addc1edf694bacULL, 0xf5ecf562ebce380dULL, 0xf62ac5f0cb5e84c7ULL,
+	0xf66752edce36da47ULL, 0xf6a2a174a81c7869ULL, 0xf6dcb6954547a93aULL, 0xf7159754a127de2eULL,
+	0xf74d48ac9f1c414fULL, 0xf783cf8be51b53aaULL, 0xf7b930d5b844041cULL, 0xf7ed7161db527d3fULL,
+	0xf82095fc6ef2bee9ULL, 0xf852a365d3eaef48ULL, 0xf8839e528f172916ULL, 0xf8b38b6b2f3067f3ULL,
+	0xf8e26f4c34581112ULL, 0xf9104e85f96175cbULL, 0xf93d2d9c9ed28eaaULL, 0xf9691107f7951078ULL,
+	0xf993fd337750e19fULL, 0xf9bdf67e2268dcdfULL, 0xf9e7013a7f92b69dULL, 0xfa0f21ae8b02c473ULL,
+	0xfa365c13ab24527aULL, 0xfa5cb496a6d71f86ULL, 0xfa822f579d2a88f7ULL, 0xfaa6d069fe8edfdaULL,
+	0xfaca9bd4877553d4ULL, 0xfaed95913c56d4afULL, 0xfb0fc18d671a4175ULL, 0xfb3123a995d2338dULL,
+	0xfb51bfb99acaad5eULL, 0xfb7199848ddeeecaULL, 0xfb90b4c4cf0fadc6ULL, 0xfbaf15280a51ef1cULL,
+	0xfbccbe4f3c8eba33ULL, 0xfbe9b3ceb9cbe35eULL, 0xfc05f92e347629b9ULL, 0xfc2191e8c5c4e8ebULL,
+	0xfc3c816cf72fa364ULL, 0xfc56cb1cccedaf62ULL, 0xfc70724dd17857e0ULL, 0xfc897a492207cab3ULL,
+	0xfca1e64b7c033634ULL, 0xfcb9b9854b5c8349ULL, 0xfcd0f71ab9d023faULL, 0xfce7a223bf017b38ULL,
+	0xfcfdbdac316c7006ULL, 0xfd134cb3d824cc98ULL, 0xfd28522e7d5c1977ULL, 0xfd3cd10401a6b4f5ULL,
+	0xfd50cc106ff8f889ULL, 0xfd64462412554f8fULL, 0xfd774203872435dcULL, 0xfd89c267d72f2818ULL,
+	0xfd9bc9fe8c37a435ULL, 0xfdad5b69c8236d51ULL, 0xfdbe79405cb75c15ULL, 0xfdcf260de3da1ae0ULL,
+	0xfddf6452d858440fULL, 0xfdef3684af237017ULL, 0xfdfe9f0df105d947ULL, 0xfe0da04e54c45365ULL,
+	0xfe1c3c9ad9a86e7aULL, 0xfe2a763de26cb56dULL, 0xfe384f77508512eeULL, 0xfe45ca7c9fbd8156ULL,
+	0xfe52e979022944bbULL, 0xfe5fae8d7c5d0930ULL, 0xfe6c1bd101ee5a62ULL, 0xfe7833509233051dULL,
+	0xfe83f70f553b0ed7ULL, 0xfe8f6906b9000b25ULL, 0xfe9a8b268ec4b319ULL, 0xfea55f55289fbe6bULL,
+	0xfeafe76f772d1accULL, 0xfeba25492760b9cfULL, 0xfec41aacc0764a84ULL, 0xfecdc95bc1f94ffdULL,
+	0xfed7330ec1e122bcULL, 0xfee059758abc8736ULL, 0xfee93e3739e8a035ULL, 0xfef1e2f25dcf2027ULL,
+	0xfefa493d1427b8cbULL, 0xff0272a52838e4d4ULL, 0xff0a60b03114434dULL, 0xff1214dbafcad86bULL,
+	0xff19909d2d95a372ULL, 0xff20d56259ef14e3ULL, 0xff27e491289a0bbbULL, 0xff2ebf87ef931bd2ULL,
+	0xff35679d84e8fa84ULL, 0xff3bde215c7909aaULL, 0xff42245ba58d1383ULL, 0xff483b8d68576493ULL,
+	0xff4e24f0a34a8a97ULL, 0xff53e1b8684a1971ULL, 0xff597310f9b1f089ULL, 0xff5eda1fe7319443ULL,
+	0xff6418042a794820ULL, 0xff692dd643b6aea5ULL, 0xff6e1ca855decc73ULL, 0xff72e58642c363c9ULL,
+	0xff778975c6f1b546ULL, 0xff7c09769558c9deULL, 0xff80668272b580dbULL, 0xff84a18d50c2b313ULL,
+	0xff88bb85692bd2aaULL, 0xff8cb55358408444ULL, 0xff908fda3767c3e9ULL, 0xff944bf7b7513caeULL,
+	0xff97ea8439e38eabULL, 0xff9b6c52ebe652ecULL, 0xff9ed231de66c09dULL, 0xffa21cea1fd5e9fbULL,
+	0xffa54d3fd4df9a6bULL, 0xffa863f250f8f176ULL, 0xffab61bc2ea5e882ULL, 0xffae475367750290ULL,
+	0xffb115696bb07699ULL, 0xffb3ccab39c435baULL, 0xffb66dc175583edcULL, 0xffb8f9507e1ec13fULL,
+	0xffbb6ff886559ef4ULL, 0xffbdd255a8faef48ULL, 0xffc020ffffb42fdbULL, 0xffc25c8bb867e14bULL,
+	0xffc485892a895a3dULL, 0xffc69c84ec16a8faULL, 0xffc8a207e64868c5ULL, 0xffca969769f37cc7ULL,
+	0xffcc7ab5439cae93ULL, 0xffce4edfcf3e3a0eULL, 0xffd013920bbf5c0eULL, 0xffd1c943ae1e03e2ULL,
+	0xffd37069344ad2c8ULL, 0xffd50973f7b79e68ULL, 0xffd694d23f98b588ULL, 0xffd812ef52d92f70ULL,
+	0xffd9843389c297ddULL, 0xffdae9045f5851f4ULL, 0xffdc41c482671543ULL, 0xffdd8ed3e648efc6ULL,
+	0xffded08fd35e3fd3ULL, 0xffe00752f73c2009ULL, 0xffe133757490c68eULL, 0xffe2554cf2be5f8fULL,
+	0xffe36d2cad2cf171ULL, 0xffe47b658253df26ULL, 0xffe58046027ba2f5ULL, 0xffe67c1a7e386170ULL,
+	0xffe76f2d149df98eULL, 0xffe859c5c12e3bbdULL, 0xffe93c2a6981f653ULL, 0xffea169eeaad8a27ULL,
+	0xffeae9652661be2cULL, 0xffebb4bd0fc98c8aULL, 0xffec78e4b825a778ULL, 0xffed36185b267726ULL,
+	0xffedec926b055520ULL, 0xffee9c8b9c5dcc74ULL, 0xffef463af1c7a841ULL, 0xffefe9d5c7329cd6ULL,
+	0xfff0878fdd04597bULL, 0xfff11f9b62f9d300ULL, 0xfff1b22902cc98bcULL, 0xfff23f67ea9d073bULL,
+	0xfff2c785d7222d06ULL, 0xfff34aaf1da0370eULL, 0xfff3c90eb5a63b36ULL, 0xfff442ce42943818ULL,
+	0xfff4b8161cea21b1ULL, 0xfff5290d5b60d318ULL, 0xfff595d9dbcdbd71ULL, 0xfff5fea04bd22c8cULL,
+	0xfff663843156f94eULL, 0xfff6c4a7f2d5820dULL, 0xfff7222cdf6ec05dULL, 0xfff77c3336d15388ULL,
+	0xfff7d2da30ef561eULL, 0xfff826400584d45eULL, 0xfff87681f36fb850ULL, 0xfff8c3bc47d9ff64ULL,
+	0xfff90e0a65370c65ULL, 0xfff95586ca14e746ULL, 0xfff99a4b17c23b04ULL, 0xfff9dc7018c9e08eULL,
+	0xfffa1c0dc744c3ffULL, 0xfffa593b5302f00cULL, 0xfffa940f278c89c7ULL, 0xfffacc9ef1fb8531ULL,
+	0xfffb02ffa6aed942ULL, 0xfffb374586d7f837ULL, 0xfffb698425e34ef9ULL, 0xfffb99ce6ebc8ca2ULL,
+	0xfffbc836a8ef70d8ULL, 0xfffbf4ce7da5dde0ULL, 0xfffc1fa6fc83e901ULL, 0xfffc48d0a062a1afULL,
+	0xfffc705b53ea45bcULL, 0xfffc9656760c968eULL, 0xfffcbad0de600101ULL, 0xfffcddd8e15c475eULL,
+	0xfffcff7c54795a63ULL, 0xfffd1fc892310c01ULL, 0xfffd3eca7de44411ULL, 0xfffd5c8e87a45cc6ULL,
+	0xfffd7920afe14a52ULL, 0xfffd948c8afd2e93ULL, 0xfffdaedd44c5f755ULL, 0xfffdc81da3d5a322ULL,
+	0xfffde0580cd9c621ULL, 0xfffdf79685c2e60dULL, 0xfffe0de2b8dc41d9ULL, 0xfffe2345f7cc9708ULL,
+	0xfffe37c93e80744fULL, 0xfffe4b7535fea697ULL, 0xfffe5e5237274b01ULL, 0xfffe70684d5e0e05ULL,
+	0xfffe81bf39201d6dULL, 0xfffe925e7286504dULL, 0xfffea24d2bb405d4ULL, 0xfffeb19253333949ULL,
+	0xfffec034963e4728ULL, 0xfffece3a62f7dcdaULL, 0xfffedba9ea918a4bULL, 0xfffee88923616a12ULL,
+	0xfffef4ddcae752a1ULL, 0xffff00ad67c200abULL, 0xffff0bfd4b94a875ULL, 0xffff16d294dd59b9ULL,
+	0xffff213230bc9f45ULL, 0xffff2b20dcaec174ULL, 0xffff34a328371045ULL, 0xffff3dbd767d97bbULL,
+	0xffff4673ffdf9ef9ULL, 0xffff4ecad3735076ULL, 0xffff56c5d87ee781ULL, 0xffff5e68cfe3bd3bULL,
+	0xffff65b7557d8d1aULL, 0xffff6cb4e1764715ULL, 0xffff7364c98ec373ULL, 0xffff79ca425caa78ULL,
+	0xffff7fe8607ddff7ULL, 0xffff85c219c1c123ULL, 0xffff8b5a464880f8ULL, 0xffff90b3a198edbfULL,
+	0xffff95d0cbace85fULL, 0xffff9ab449f4d472ULL, 0xffff9f6088524632ULL, 0xffffa3d7da0a31beULL,
+	0xffffa81c7aaedd60ULL, 0xffffac308f01d6eeULL, 0xffffb01625ce2aa4ULL, 0xffffb3cf38bb1854ULL,
+	0xffffb75dad178217ULL, 0xffffbac3549e4e34ULL, 0xffffbe01ee33f465ULL, 0xffffc11b269d6d20ULL,
+	0xffffc4109930b821ULL, 0xffffc6e3d07f2df1ULL, 0xffffc99646f9cecaULL, 0xffffcc29678fbfe8ULL,
+	0xffffce9e8e4726d2ULL, 0xffffd0f708d09110ULL, 0xffffd3341715153eULL, 0xffffd556ebbf595eULL,
+	0xffffd760acbfa8e6ULL, 0xffffd95273cb43ebULL, 0xffffdb2d4ed70f97ULL, 0xffffdcf2408dceebULL,
+	0xffffdea240c209adULL, 0xffffe03e3cdbc65dULL, 0xffffe1c718423ad6ULL, 0xffffe33dacc19656ULL,
+	0xffffe4a2caed0689ULL, 0xffffe5f73a7d1845ULL, 0xffffe73bbaaa939aULL, 0xffffe8710285f1f9ULL,
+	0xffffe997c14b8c33ULL, 0xffffeab09eb49d3fULL, 0xffffebbc3b4535beULL, 0xffffecbb30973b6aULL,
+	0xffffedae11a28ebfULL, 0xffffee956b02705dULL, 0xffffef71c3383eccULL, 0xfffff0439aeba4a2ULL,
+	0xfffff10b6d284e2aULL, 0xfffff1c9af993cfcULL, 0xfffff27ed2c1cf47ULL, 0xfffff32b42348fcfULL,
+	0xfffff3cf64c7e300ULL, 0xfffff46b9cc8a4bfULL, 0xfffff500482aca13ULL, 0xfffff58dc0b8190dULL,
+	0xfffff6145c3d08ceULL, 0xfffff6946cb3dadfULL, 0xfffff70e406dfe94ULL, 0xfffff782223bce91ULL,
+	0xfffff7f05992b806ULL, 0xfffff8592ab1dac1ULL, 0xfffff8bcd6c5308eULL, 0xfffff91b9c074a09ULL,
+	0xfffff975b5e1ae68ULL, 0xfffff9cb5d0beb6bULL, 0xfffffa1cc7a96217ULL, 0xfffffa6a2965dc72ULL,
+	0xfffffab3b390f823ULL, 0xfffffaf995387144ULL, 0xfffffb3bfb415883ULL, 0xfffffb7b10803f18ULL,
+	0xfffffbb6fdd062e5ULL, 0xfffffbefea29e48eULL, 0xfffffc25fab71128ULL, 0xfffffc5952e8c89cULL,
+	0xfffffc8a148a09aaULL, 0xfffffcb85fd2ac16ULL, 0xfffffce45379513cULL, 0xfffffd0e0cc492f6ULL,
+	0xfffffd35a79b788aULL, 0xfffffd5b3e9538efULL, 0xfffffd7eeb085197ULL, 0xfffffda0c518f883ULL,
+	0xfffffdc0e3c6f047ULL, 0xfffffddf5cfac454ULL, 0xfffffdfc4592739bULL, 0xfffffe17b16d8f7fULL,
+	0xfffffe31b378d4acULL, 0xfffffe4a5db94350ULL, 0xfffffe61c156bbf9ULL, 0xfffffe77eea6261dULL,
+	0xfffffe8cf5332525ULL, 0xfffffea0e3c960b2ULL, 0xfffffeb3c87d648dULL, 0xfffffec5b0b51c9dULL,
+	0xfffffed6a92ff105ULL, 0xfffffee6be0e8669ULL, 0xfffffef5fada2632ULL, 0xffffff046a8bd27fULL,
+	0xffffff121793094dULL, 0xffffff1f0bdc3a47ULL, 0xffffff2b50d6f26dULL, 0xffffff36ef7bc0d7ULL,
+	0xffffff41f051d775ULL, 0xffffff4c5b746ad0ULL, 0xffffff563897d37cULL, 0xffffff5f8f0e73f9ULL,
+	0xffffff6865cd6589ULL, 0xffffff70c370ee6dULL, 0xffffff78ae40c3f5ULL, 0xffffff802c341a93ULL,
+	0xffffff8742f5862eULL, 0xffffff8df7e6acbbULL, 0xffffff945023cd2bULL, 0xffffff9a50871c8dULL,
+	0xffffff9ffdabfb3eULL, 0xffffffa55bf203eaULL, 0xffffffaa6f7ff60eULL, 0xffffffaf3c467d9bULL,
+	0xffffffb3c602d941ULL, 0xffffffb8104160e8ULL, 0xffffffbc1e5fedb4ULL, 0xffffffbff3902506ULL,
+	0xffffffc392d9a7b1ULL, 0xffffffc6ff1c26baULL, 0xffffffca3b115ebbULL, 0xffffffcd494efb2dULL,
+	0xffffffd02c486298ULL, 0xffffffd2e6506cbfULL, 0xffffffd5799b03d0ULL, 0xffffffd7e83eb183ULL,
+	0xffffffda3436191aULL, 0xffffffdc5f615f1dULL, 0xffffffde6b877fb7ULL, 0xffffffe05a57946eULL,
+	0xffffffe22d6a0a0dULL, 0xffffffe3e641c772ULL, 0xffffffe5864d45f5ULL, 0xffffffe70ee79c1aULL,
+	0xffffffe881597b2eULL, 0xffffffe9deda2066ULL, 0xffffffeb28903a26ULL, 0xffffffec5f92c1edULL,
+	0xffffffed84e9cb80ULL, 0xffffffee998f49caULL, 0xffffffef9e6fc9f2ULL, 0xfffffff0946b2522ULL,
+	0xfffffff17c55296dULL, 0xfffffff256f63a41ULL, 0xfffffff3250be8cdULL, 0xfffffff3e74984c0ULL,
+	0xfffffff49e58a5bcULL, 0xfffffff54ad9addaULL, 0xfffffff5ed644594ULL, 0xfffffff68687d169ULL,
+	0xfffffff716cbe183ULL, 0xfffffff79eb09bafULL, 0xfffffff81eaf1ff4ULL, 0xfffffff89739e7f8ULL,
+	0xfffffff908bd2191ULL, 0xfffffff9739f04a5ULL, 0xfffffff9d84024a2ULL, 0xfffffffa36fbbdc4ULL,
+	0xfffffffa9027fe5dULL, 0xfffffffae4164c51ULL, 0xfffffffb331386f5ULL, 0xfffffffb7d684587ULL,
+	0xfffffffbc359125cULL, 0xfffffffc0526a303ULL, 0xfffffffc430e0d6cULL, 0xfffffffc7d48fa52ULL,
+	0xfffffffcb40dd4efULL, 0xfffffffce78ff841ULL, 0xfffffffd17ffd9dbULL, 0xfffffffd458b327bULL,
+	0xfffffffd705d247aULL, 0xfffffffd989e602cULL, 0xfffffffdbe75465bULL, 0xfffffffde20608dfULL,
+	0xfffffffe0372c983ULL, 0xfffffffe22dbb73fULL, 0xfffffffe405f29dfULL, 0xfffffffe5c19bc32ULL,
+	0xfffffffe762664ceULL, 0xfffffffe8e9e8d7eULL, 0xfffffffea59a296cULL, 0xfffffffebb2fca18ULL,
+	0xfffffffecf74b32dULL, 0xfffffffee27ced42ULL, 0xfffffffef45b5793ULL, 0xffffffff0521b8c5ULL,
+	0xffffffff14e0cebfULL, 0xffffffff23a85da3ULL, 0xffffffff31873dfaULL, 0xffffffff3e8b6a0fULL,
+	0xffffffff4ac20a9aULL, 0xffffffff563782aaULL, 0xffffffff60f77af5ULL, 0xffffffff6b0cec7aULL,
+	0xffffffff74822a96ULL, 0xffffffff7d60ec84ULL, 0xffffffff85b2565aULL, 0xffffffff8d7f017cULL,
+	0xffffffff94cf04a4ULL, 0xffffffff9ba9fb6bULL, 0xffffffffa2170d6bULL, 0xffffffffa81cf4fcULL,
+	0xffffffffadc20589ULL, 0xffffffffb30c318fULL, 0xffffffffb8011047ULL, 0xffffffffbca5e2f6ULL,
+	0xffffffffc0ff99f8ULL, 0xffffffffc512d97dULL, 0xffffffffc8e3fe01ULL, 0xffffffffcc772083ULL,
+	0xffffffffcfd01a83ULL, 0xffffffffd2f289bdULL, 0xffffffffd5e1d3b2ULL, 0xffffffffd8a12900ULL,
+	0xffffffffdb338880ULL, 0xffffffffdd9bc23fULL, 0xffffffffdfdc7a47ULL, 0xffffffffe1f82b3bULL,
+	0xffffffffe3f128d5ULL, 0xffffffffe5c9a236ULL, 0xffffffffe783a419ULL, 0xffffffffe9211ae6ULL,
+	0xffffffffeaa3d49eULL, 0xffffffffec0d82b4ULL, 0xffffffffed5fbbc7ULL, 0xffffffffee9bfd3cULL,
+	0xffffffffefc3acc9ULL, 0xfffffffff0d819e4ULL, 0xfffffffff1da7f1dULL, 0xfffffffff2cc0361ULL,
+	0xfffffffff3adbb30ULL, 0xfffffffff480a9baULL, 0xfffffffff545c1f0ULL, 0xfffffffff5fde781ULL,
+	0xfffffffff6a9efcaULL, 0xfffffffff74aa2b9ULL, 0xfffffffff7e0bb9fULL, 0xfffffffff86ce9f4ULL,
+	0xfffffffff8efd21bULL, 0xfffffffff96a0e07ULL, 0xfffffffff9dc2de7ULL, 0xfffffffffa46b8c1ULL,
+	0xfffffffffaaa2d01ULL, 0xfffffffffb070102ULL, 0xfffffffffb5da391ULL, 0xfffffffffbae7c66ULL,
+	0xfffffffffbf9ec92ULL, 0xfffffffffc404eedULL, 0xfffffffffc81f878ULL, 0xfffffffffcbf38bdULL,
+	0xfffffffffcf85a24ULL, 0xfffffffffd2da248ULL, 0xfffffffffd5f5245ULL, 0xfffffffffd8da6ffULL,
+	0xfffffffffdb8d968ULL, 0xfffffffffde11ebfULL, 0xfffffffffe06a8cbULL, 0xfffffffffe29a619ULL,
+	0xfffffffffe4a4229ULL, 0xfffffffffe68a5a5ULL, 0xfffffffffe84f68fULL, 0xfffffffffe9f5869ULL,
+	0xfffffffffeb7ec62ULL, 0xfffffffffeced17bULL, 0xfffffffffee424acULL, 0xfffffffffef80100ULL,
+	0xffffffffff0a7fbeULL, 0xffffffffff1bb87eULL, 0xffffffffff2bc14aULL, 0xffffffffff3aaeb4ULL,
+	0xffffffffff4893f3ULL, 0xffffffffff5582f5ULL, 0xffffffffff618c77ULL, 0xffffffffff6cc018ULL,
+	0xffffffffff772c6dULL, 0xffffffffff80df0fULL, 0xffffffffff89e4b1ULL, 0xffffffffff92492aULL,
+	0xffffffffff9a1786ULL, 0xffffffffffa15a13ULL, 0xffffffffffa81a6cULL, 0xffffffffffae6187ULL,
+	0xffffffffffb437c0ULL, 0xffffffffffb9a4e2ULL, 0xffffffffffbeb02fULL, 0xffffffffffc3606cULL,
+	0xffffffffffc7bbeaULL, 0xffffffffffcbc889ULL, 0xffffffffffcf8bc5ULL, 0xffffffffffd30ab8ULL,
+	0xffffffffffd64a26ULL, 0xffffffffffd94e7bULL, 0xffffffffffdc1bdaULL, 0xffffffffffdeb61bULL,
+	0xffffffffffe120d2ULL, 0xffffffffffe35f55ULL, 0xffffffffffe574c0ULL, 0xffffffffffe763f5ULL,
+	0xffffffffffe92fa5ULL, 0xffffffffffeada53ULL, 0xffffffffffec6653ULL, 0xffffffffffedd5d0ULL,
+	0xffffffffffef2acfULL, 0xfffffffffff06730ULL, 0xfffffffffff18cb4ULL, 0xfffffffffff29cfaULL,
+	0xfffffffffff39986ULL, 0xfffffffffff483bfULL, 0xfffffffffff55cf4ULL, 0xfffffffffff6265dULL,
+	0xfffffffffff6e11bULL, 0xfffffffffff78e3aULL, 0xfffffffffff82eb6ULL, 0xfffffffffff8c376ULL,
+	0xfffffffffff94d53ULL, 0xfffffffffff9cd15ULL, 0xfffffffffffa4378ULL, 0xfffffffffffab127ULL,
+	0xfffffffffffb16c5ULL, 0xfffffffffffb74e6ULL, 0xfffffffffffbcc17ULL, 0xfffffffffffc1cd7ULL,
+	0xfffffffffffc679eULL, 0xfffffffffffcacddULL, 0xfffffffffffcecfaULL, 0xfffffffffffd2854ULL,
+	0xfffffffffffd5f46ULL, 0xfffffffffffd9221ULL, 0xfffffffffffdc132ULL, 0xfffffffffffdecc1ULL,
+	0xfffffffffffe150fULL, 0xfffffffffffe3a5aULL, 0xfffffffffffe5cdaULL, 0xfffffffffffe7cc4ULL,
+	0xfffffffffffe9a49ULL, 0xfffffffffffeb596ULL, 0xfffffffffffeced5ULL, 0xfffffffffffee62eULL,
+	0xfffffffffffefbc4ULL, 0xffffffffffff0fb9ULL, 0xffffffffffff222bULL, 0xffffffffffff3338ULL,
+	0xffffffffffff42faULL, 0xffffffffffff518bULL, 0xffffffffffff5f00ULL, 0xffffffffffff6b6fULL,
+	0xffffffffffff76ebULL, 0xffffffffffff8188ULL, 0xffffffffffff8b55ULL, 0xffffffffffff9462ULL,
+	0xffffffffffff9cbeULL, 0xffffffffffffa476ULL, 0xffffffffffffab97ULL, 0xffffffffffffb22bULL,
+	0xffffffffffffb83eULL, 0xffffffffffffbdd9ULL, 0xffffffffffffc306ULL, 0xffffffffffffc7cdULL,
+	0xffffffffffffcc35ULL, 0xffffffffffffd045ULL, 0xffffffffffffd405ULL, 0xffffffffffffd77bULL,
+	0xffffffffffffdaacULL, 0xffffffffffffdd9eULL, 0xffffffffffffe055ULL, 0xffffffffffffe2d5ULL,
+	0xffffffffffffe524ULL, 0xffffffffffffe745ULL, 0xffffffffffffe93bULL, 0xffffffffffffeb0aULL,
+	0xffffffffffffecb4ULL, 0xffffffffffffee3dULL, 0xffffffffffffefa7ULL, 0xfffffffffffff0f5ULL,
+	0xfffffffffffff229ULL, 0xfffffffffffff344ULL, 0xfffffffffffff449ULL, 0xfffffffffffff539ULL,
+	0xfffffffffffff616ULL, 0xfffffffffffff6e2ULL, 0xfffffffffffff79eULL, 0xfffffffffffff84aULL,
+	0xfffffffffffff8e9ULL, 0xfffffffffffff97cULL, 0xfffffffffffffa02ULL, 0xfffffffffffffa7eULL,
+	0xfffffffffffffaf0ULL, 0xfffffffffffffb59ULL, 0xfffffffffffffbbaULL, 0xfffffffffffffc13ULL,
+	0xfffffffffffffc64ULL, 0xfffffffffffffcafULL, 0xfffffffffffffcf5ULL, 0xfffffffffffffd34ULL,
+	0xfffffffffffffd6eULL, 0xfffffffffffffda4ULL, 0xfffffffffffffdd6ULL, 0xfffffffffffffe03ULL,
+	0xfffffffffffffe2dULL, 0xfffffffffffffe53ULL, 0xfffffffffffffe76ULL, 0xfffffffffffffe97ULL,
+	0xfffffffffffffeb4ULL, 0xfffffffffffffed0ULL, 0xfffffffffffffee9ULL, 0xffffffffffffff00ULL,
+	0xffffffffffffff15ULL, 0xffffffffffffff28ULL, 0xffffffffffffff3aULL, 0xffffffffffffff4bULL,
+	0xffffffffffffff5aULL, 0xffffffffffffff67ULL, 0xffffffffffffff74ULL, 0xffffffffffffff80ULL,
+	0xffffffffffffff8aULL, 0xffffffffffffff94ULL, 0xffffffffffffff9dULL, 0xffffffffffffffa5ULL,
+	0xffffffffffffffadULL, 0xffffffffffffffb4ULL, 0xffffffffffffffbaULL, 0xffffffffffffffc0ULL,
+	0xffffffffffffffc5ULL, 0xffffffffffffffcaULL, 0xffffffffffffffcfULL, 0xffffffffffffffd3ULL,
+	0xffffffffffffffd7ULL, 0xffffffffffffffdaULL, 0xffffffffffffffddULL, 0xffffffffffffffe0ULL,
+	0xffffffffffffffe3ULL, 0xffffffffffffffe5ULL, 0xffffffffffffffe8ULL, 0xffffffffffffffeaULL,
+	0xffffffffffffffebULL, 0xffffffffffffffedULL, 0xffffffffffffffefULL, 0xfffffffffffffff0ULL,
+	0xfffffffffffffff1ULL, 0xfffffffffffffff3ULL, 0xfffffffffffffff4ULL, 0xfffffffffffffff5ULL,
+	0xfffffffffffffff6ULL, 0xfffffffffffffff7ULL, 0xfffffffffffffff7ULL, 0xfffffffffffffff8ULL,
+	0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffffaULL, 0xfffffffffffffffaULL,
+	0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL,
+	0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+};
+
+static const uint16_t cdt_guide_bliss_100[257] = {
+	   0,    0,    1,    1,    2,    2,    3,    3,    4,    4,    5,    5,    6,    6,    7,    7,
+	   8,    8,    9,    9,   10,   10,   11,   11,   12,   12,   13,   13,   14,   14,   15,   15,
+	  16,   16,   17,   17,   18,   18,   19,   19,   20,   20,   21,   21,   22,   22,   23,   23,
+	  24,   24,   25,   25,   26,   26,   27,   27,   28,   28,   29,   29,   30,   30,   31,   31,
+	  32,   32,   33,   33,   34,   35,   35,   36,   36,   37,   37,   38,   38,   39,   39,   40,
+	  40,   41,   41,   42,   42,   43,   44,   44,   45,   45,   46,   46,   47,   47,   48,   48,
+	  49,   50,   50,   51,   51,   52,   52,   53,   53,   54,   55,   55,   56,   56,   57,   57,
+	  58,   59,   59,   60,   60,   61,   62,   62,   63,   63,   64,   65,   65,   66,   66,   67,
+	  68,   68,   69,   69,   70,   71,   71,   72,   73,   73,   74,   75,   75,   76,   76,   77,
+	  78,   78,   79,   80,   80,   81,   82,   83,   83,   84,   85,   85,   86,   87,   87,   88,
+	  89,   90,   90,   91,   92,   93,   93,   94,   95,   96,   96,   97,   98,   99,  100,  100,
+	 101,  102,  103,  104,  105,  105,  106,  107,  108,  109,  110,  111,  112,  112,  113,  114,
+	 115,  116,  117,  118,  119,  120,  121,  122,  123,  124,  125,  126,  128,  129,  130,  131,
+	 132,  133,  134,  136,  137,  138,  139,  141,  142,  143,  145,  146,  148,  149,  151,  152,
+	 154,  155,  157,  159,  160,  162,  164,  166,  168,  170,  172,  174,  177,  179,  181,  184,
+	 187,  190,  193,  196,  199,  203,  207,  211,  216,  221,  227,  234,  242,  253,  267,  289,
+	 918,
+};
+
+#define CDT_215_SIZE 1975
+
+static const uint64_t cdt_bliss_215[CDT_215_SIZE] = {
+	0x007931decff42987ULL, 0x016b94f1c51a0c5aULL, 0x025df604bcc99daeULL, 0x035053c26cc1e60aULL,
+	0x0442acd598d686d3ULL, 0x0534ffe918910648ULL, 0x06274ba7dcd190adULL, 0x07198ebcf56f071bULL,
+	0x080bc7d396d6345aULL, 0x08fdf5971fa80034ULL, 0x09f016b31e5679bcULL, 0x0ae229d356c0911dULL,
+	0x0bd42da3c7cc5975ULL, 0x0cc620d0b0ffab6dULL, 0x0db8020698170137ULL, 0x0ea9cff24e9a64c4ULL,
+	0x0f9b8940f77048f4ULL, 0x108d2ca00c6e26c8ULL, 0x117eb8bd63e6b77cULL, 0x12702c473635a4bfULL,
+	0x136185ec2348881eULL, 0x1452c45b3825130bULL, 0x1543e643f46c38d2ULL, 0x1634ea564fda3416ULL,
+	0x1725cf42bfc3416cULL, 0x181693ba3c8ce8deULL, 0x1907366e4723b04cULL, 0x19f7b610ee6d1098ULL,
+	0x1ae81154d4b587eaULL, 0x1bd846ed351aa351ULL, 0x1cc8558de8f0da43ULL, 0x1db83beb6d2516a2ULL,
+	0x1ea7f8bae799c414ULL, 0x1f978ab22c7f41b3ULL, 0x2086f087c3a7912cULL, 0x217628f2edd51ec2ULL,
+	0x226532abaa047d9aULL, 0x23540c6abab0f42bULL, 0x2442b4e9ab13b4a7ULL, 0x25312ae2d45d9d85ULL,
+	0x261f6d1162eb5e86ULL, 0x270d7a315b73deb6ULL, 0x27fb50ffa030c03bULL, 0x28e8f039f600dee7ULL,
+	0x29d6569f0984a6c2ULL, 0x2ac382ee74342009ULL, 0x2bb073e8c16e8e54ULL, 0x2c9d284f738380c4ULL,
+	0x2d899ee508b5317dULL, 0x2e75d66d003412ccULL, 0x2f61cdabdf1368b7ULL, 0x304d83673536cde4ULL,
+	0x3138f665a2388318ULL, 0x3224256eda4868d1ULL, 0x330f0f4bab0382b6ULL, 0x33f9b2c60043e4faULL,
+	0x34e40ea8e8e8ec05ULL, 0x35ce21c09b979f0bULL, 0x36b7eada7b731e6fULL, 0x37a168c51cccff4dULL,
+	0x388a9a5049cd758fULL, 0x39737e4d07132e89ULL, 0x3a5c138d984abe22ULL, 0x3b4458e584bd8122ULL,
+	0x3c2c4d299bd7d758ULL, 0x3d13ef2ff9a698c0ULL, 0x3dfb3dd00b4ba91fULL, 0x3ee237e293698dd1ULL,
+	0x3fc8dc41ae85e9eaULL, 0x40af29c8d762c525ULL, 0x41951f54eb4e8260ULL, 0x427abbc42e6a6acfULL,
+	0x435ffdf64fe7b367ULL, 0x4444e4cc6e3ae250ULL, 0x45296f291b457a9dULL, 0x460d9bf06075d4cfULL,
+	0x46f16a07c2dd0b18ULL, 0x47d4d856473ae0a3ULL, 0x48b7e5c475ff8b91ULL, 0x499a913c5f4349a8ULL,
+	0x4a7cd9a99eb3a832ULL, 0x4b5ebdf95f7667bfULL, 0x4c403d1a6001e502ULL, 0x4d2155fcf5eaf05aULL,
+	0x4e02079311a7fdf5ULL, 0x4ee250d0424998dbULL, 0x4fc230a9b92803a9ULL, 0x50a1a6164d85f211ULL,
+	0x5180b00e802846a7ULL, 0x525f4d8c7ee2c0e5ULL, 0x533d7d8c281987b7ULL, 0x541b3f0b0e377d51ULL,
+	0x54f891087b19495cULL, 0x55d57285736d0725ULL, 0x56b1e284ba068597ULL, 0x578de00ad3280787ULL,
+	0x58696a1e07bf72faULL, 0x59447fc66897dea3ULL, 0x5a1f200dd17f6d36ULL, 0x5af949ffec616692ULL,
+	0x5bd2fcaa34547f38ULL, 0x5cac371bf89d3ef0ULL, 0x5d84f8665fa477e2ULL, 0x5e5d3f9c69e1bfe5ULL,
+	0x5f350bd2f4b9de1aULL, 0x600c5c20bd511f7aULL, 0x60e32f9e63518545ULL, 0x61b985666ba4c0cbULL,
+	0x628f5c954321f06fULL, 0x6364b449412f121bULL, 0x64398ba2aa561ffcULL, 0x650de1c3b2cdcc97ULL,
+	0x65e1b5d080f5d3d7ULL, 0x66b506ef2fc6d71aULL, 0x6787d447d135bab6ULL, 0x685a1d04708a7bd1ULL,
+	0x692be05114aa75eaULL, 0x69fd1d5bc2560fd5ULL, 0x6acdd3547e59c854ULL, 0x6b9e016d4fb29afeULL,
+	0x6c6da6da41a5b67bULL, 0x6d3cc2d165cb7d97ULL, 0x6e0b548ad60dcd2cULL, 0x6ed95b40b6998127ULL,
+	0x6fa6d62f37c33396ULL, 0x7073c49497df30edULL, 0x714025b1250c9d2cULL, 0x720bf8c73ef3c619ULL,
+	0x72d73d1b58779f01ULL, 0x73a1f1f3f95a6305ULL, 0x746c1699bfd55b69ULL, 0x7535aa576223c7a2ULL,
+	0x75feac79b000e57fULL, 0x76c71c4f94191817ULL, 0x778ef92a156e2ca2ULL, 0x7856425c58aebcc0ULL,
+	0x791cf73ba180ae3dULL, 0x79e3171f53bed0a3ULL, 0x7aa8a160f4a99985ULL, 0x7b6d955c2c0b00b5ULL,
+	0x7c31f26ec54d7e11ULL, 0x7cf5b7f8b0862b0dULL, 0x7db8e55c03720a6bULL, 0x7e7b79fcfa667918ULL,
+	0x7f3d7541f934cb84ULL, 0x7ffed6938c011b33ULL, 0x80bf9d5c680c48b7ULL, 0x817fc9096c713698ULL,
+	0x823f5909a2d54235ULL, 0x82fe4cce400bfffbULL, 0x83bca3caa4ae40b0ULL, 0x847a5d745da46614ULL,
+	0x8537794324a40d64ULL, 0x85f3f6b0e0a116b5ULL, 0x86afd539a632109aULL, 0x876b145bb7e80fc4ULL,
+	0x8825b3978699fad1ULL, 0x88dfb26fb1a352d1ULL, 0x8999106907168173ULL, 0x8a51cd0a83e2b61fULL,
+	0x8b09e7dd53ed5bb7ULL, 0x8bc1606cd21f3109ULL, 0x8c78364688650e66ULL, 0x8d2e68fa2fa46328ULL,
+	0x8de3f819afa37657ULL, 0x8e98e3391ee575f4ULL, 0x8f4d29eec27a60d7ULL, 0x9000cbd30dc2d756ULL,
+	0x90b3c880a227df5dULL, 0x91661f944ec6a8ecULL, 0x9217d0ad1010604aULL, 0x92c8db6c0f5e1b91ULL,
+	0x93793f74a278f1a0ULL, 0x9428fc6c4b1648c3ULL, 0x94d811fab6486bb6ULL, 0x95867fc9bbe37420ULL,
+	0x963445855dd699b9ULL, 0x96e162dbc779f5e8ULL, 0x978dd77d4cd0cbb7ULL, 0x9839a31c69c06486ULL,
+	0x98e4c56dc13b9205ULL, 0x998f3e281c62e670ULL, 0x9a390d046999b444ULL, 0x9ae231bdbb8fe6fdULL,
+	0x9b8aac114840c6aaULL, 0x9c327bbe67e6b884ULL, 0x9cd9a08693e40eedULL, 0x9d801a2d65a0fb90ULL,
+	0x9e25e878955eb6acULL, 0x9ecb0b2ff8ffeeb8ULL, 0x9f6f821d82c6940eULL, 0xa0134d0d40071454ULL,
+	0xa0b66bcd57d119cfULL, 0xa158de2e098de2ecULL, 0xa1faa401ab9446afULL, 0xa29bbd1ca9b27aceULL,
+	0xa33c295583adb0b8ULL, 0xa3dbe884cbb79ec3ULL, 0xa47afa8524da0b41ULL, 0xa5195f3341586f37ULL,
+	0xa5b7166de107c6e5ULL, 0xa6542015cf9ca65dULL, 0xa6f07c0de2efa8c2ULL, 0xa78c2a3af93850e9ULL,
+	0xa8272a83f73e725aULL, 0xa8c17cd1c68239e1ULL, 0xa95b210f535aed19ULL, 0xa9f417298b0c7886ULL,
+	0xaa8c5f0f59d3e415ULL, 0xab23f8b1a8eac5efULL, 0xabbae4035c81cbeaULL, 0xac5120f951b273ddULL,
+	0xace6af8a5c680b7cULL, 0xad7b8faf45401061ULL, 0xae0fc162c7620941ULL, 0xaea344a18e4ef14eULL,
+	0xaf36196a33a84f07ULL, 0xafc83fbd3cef0fe5ULL, 0xb059b79d193a4260ULL, 0xb0ea810e1ee5c80dULL,
+	0xb17a9c16893919a6ULL, 0xb20a08be760636ffULL, 0xb298c70fe340dcfbULL, 0xb326d716ac8e1bceULL,
+	0xb3b438e088cc67e7ULL, 0xb440ec7d07944001ULL, 0xb4ccf1fd8eb182feULL, 0xb558497557959043ULL,
+	0xb5e2f2f96cc24d71ULL, 0xb66ceea0a72e2c6aULL, 0xb6f63c83aba14cadULL, 0xb77edcbce80bd32bULL,
+	0xb806cf6890d593dfULL, 0xb88e14a49e27285bULL, 0xb914ac90c92c8ed8ULL, 0xb99a974e89516d1cULL,
+	0xba1fd501117712deULL, 0xbaa465cd4d245737ULL, 0xbb2849d9ddaf6cd5ULL, 0xbbab814f1761c8a7ULL,
+	0xbc2e0c56fe9636d4ULL, 0xbcafeb1d44d139cbULL, 0xbd311dcf45d3cf59ULL, 0xbdb1a49c04a8b7aeULL,
+	0xbe317fb428ac5a4dULL, 0xbeb0af49fa8f64d8ULL, 0xbf2f339161543fdaULL, 0xbfad0cbfdf47757cULL,
+	0xc02a3b0c8ef32653ULL, 0xc0a6beb0200da84cULL, 0xc12297e4d4636bceULL, 0xc19dc6e67cbc433eULL,
+	0xc2184bf275bc28e4ULL, 0xc2922747a4bf9f6aULL, 0xc30b592674b3c8f1ULL, 0xc383e1d0d2ea50eaULL,
+	0xc3fbc18a2be944b0ULL, 0xc472f8976836f708ULL, 0xc4e9873ee9220a7aULL, 0xc55f6dc88585be89ULL,
+	0xc5d4ac7d868a9bd4ULL, 0xc64943a8a4639af3ULL, 0xc6bd33960307e20fULL, 0xc7307c932ee93503ULL,
+	0xc7a31eef19a733dbULL, 0xc8151afa16bf836fULL, 0xc8867105d83afbd1ULL, 0xc8f721656b57f836ULL,
+	0xc9672c6d3531e3e3ULL, 0xc9d69272ef661fbaULL, 0xca4553cda4b65bbbULL, 0xcab370d5ada87ff5ULL,
+	0xcb20e9e4ad244020ULL, 0xcb8dbf558d0e7525ULL, 0xcbf9f1847ae257a4ULL, 0xcc6580cee448b698ULL,
+	0xccd06d9373ad4501ULL, 0xcd3ab8320cd2196dULL, 0xcda4610bc9617a2aULL, 0xce0d6882f57e10c3ULL,
+	0xce75cefb0c519f5cULL, 0xcedd94d8b49a5253ULL, 0xcf44ba81bd36c886ULL, 0xcfab405d19b0ec71ULL,
+	0xd01126d2dec7b839ULL, 0xd0766e4c3ef7fea1ULL, 0xd0db1733870452c4ULL, 0xd13f21f41a7c2849ULL,
+	0xd1a28efa704245aeULL, 0xd2055eb40f12a213ULL, 0xd267918f8a07c7e7ULL, 0xd2c927fc7d1fd59aULL,
+	0xd32a226b89c13559ULL, 0xd38a814e533f24cdULL, 0xd3ea45177b5e257eULL, 0xd4496e3a9ed86e87ULL,
+	0xd4a7fd2c51e27805ULL, 0xd505f2621cafb882ULL, 0xd5634e5277f7ac7eULL, 0xd5c01174c97b4015ULL,
+	0xd61c3c41608ab27aULL, 0xd677cf31728c0af8ULL, 0xd6d2cabf178236e3ULL, 0xd72d2f654694e7c7ULL,
+	0xd786fd9fd29948edULL, 0xd7e035eb669ba32cULL, 0xd838d8c5826a05b9ULL, 0xd890e6ac77200a9bULL,
+	0xd8e8601f63b3cd0dULL, 0xd93f459e31842822ULL, 0xd99597a990e85390ULL, 0xd9eb56c2f5c0f484ULL,
+	0xda40836c940ab824ULL, 0xda951e295c728d23ULL, 0xdae9277cf8eb91b1ULL, 0xdb3c9febc946cacaULL,
+	0xdb8f87fadfccb9bdULL, 0xdbe1e02ffdd8e497ULL, 0xdc33a911907765dcULL, 0xdc84e326ad0497c7ULL,
+	0xdcd58ef70dceef22ULL, 0xdd25ad0b0ebb1985ULL, 0xdd753deba9ea728dULL, 0xddc442227463e389ULL,
+	0xde12ba399abf40afULL, 0xde60a6bbddd336f2ULL, 0xdeae08348f65dd21ULL, 0xdefadf2f8edffae4ULL,
+	0xdf472c39460317efULL, 0xdf92efdea5a2657cULL, 0xdfde2aad225e93f4ULL, 0xe028dd32b164a66fULL,
+	0xe07307fdc52fd578ULL, 0xe0bcab9d4a4e9258ULL, 0xe105c8a0a42abbd0ULL, 0xe14e5f97a9d51526ULL,
+	0xe1967112a2d40fe9ULL, 0xe1ddfda243f5f8ddULL, 0xe22505d7ac26980fULL, 0xe26b8a44614853fbULL,
+	0xe2b18b7a4d10e753ULL, 0xe2f70a0bb9e9b8ddULL, 0xe33c068b4fd3e485ULL, 0xe380818c1150049cULL,
+	0xe3c47ba15849c9eaULL, 0xe407f55ed307711cULL, 0xe44aef58811d23b8ULL, 0xe48d6a22b06452a2ULL,
+	0xe4cf6651f9f717f5ULL, 0xe510e47b3f2fadb3ULL, 0xe551e533a6ac06a0ULL, 0xe59269109955964eULL,
+	0xe5d270a7bf6d5539ULL, 0xe611fc8efd9c0d81ULL, 0xe6510d5c7206fca1ULL, 0xe68fa3a67168d648ULL,
+	0xe6cdc003842f342cULL, 0xe70b630a639c7e82ULL, 0xe7488d51f6ee588bULL, 0xe7853f7150889c5bULL,
+	0xe7c179ffab24f0d4ULL, 0xe7fd3d946707047fULL, 0xe8388ac7073577d1ULL, 0xe873622f2eb780fcULL,
+	0xe8adc4649dd7536fULL, 0xe8e7b1ff2f6954abULL, 0xe9212b96d6182810ULL, 0xe95a31c399b59adeULL,
+	0xe992c51d94907989ULL, 0xe9cae63cf0cf572dULL, 0xea0295b9e5d04fc6ULL, 0xea39d42cb58dcd83ULL,
+	0xea70a22daa085966ULL, 0xeaa7005512b57f0bULL, 0xeadcef3b41f3cb57ULL, 0xeb126f788a83ed70ULL,
+	0xeb4781a53d07014fULL, 0xeb7c2659a5820ad7ULL, 0xebb05e2e08e6a848ULL, 0xebe429baa2a1028dULL,
+	0xec178997a22b01bfULL, 0xec4a7e5d28a4cbfaULL, 0xec7d08a346729459ULL, 0xecaf2901f8dfbfc8ULL,
+	0xece0e01127c7651bULL, 0xed122e68a3422d99ULL, 0xed4314a021599b08ULL, 0xed73934f3bc0b7e8ULL,
+	0xeda3ab0d6d923685ULL, 0xedd35c7211140327ULL, 0xee02a8145d804d85ULL, 0xee318e8b64d40d63ULL,
+	0xee60106e11a3060fULL, 0xee8e2e5324f14c3fULL, 0xeebbe8d134125187ULL, 0xeee9407ea68d788cULL,
+	0xef1635f1b40834c4ULL, 0xef42c9c06235b86eULL, 0xef6efc8082cc3332ULL, 0xef9acec7b17fa3b0ULL,
+	0xefc6412b52023e00ULL, 0xeff154408e0a68fdULL, 0xf01c089c535e5406ULL, 0xf0465ed351e5269eULL,
+	0xf0705779f9bdcb2dULL, 0xf099f324795b55f8ULL, 0xf0c33266bba7091fULL, 0xf0ec15d46627f658ULL,
+	0xf1149e00d7303ed7ULL, 0xf13ccb7f240ff1b7ULL, 0xf1649ee2174d88f6ULL, 0xf18c18bc2ee404f4ULL,
+	0xf1b3399f9a86a631ULL, 0xf1da021e39ea44cdULL, 0xf20072c99b144539ULL, 0xf2268c32f8af293dULL,
+	0xf24c4eeb3864bc5aULL, 0xf271bb82e93dda61ULL, 0xf296d28a4207cee8ULL, 0xf2bb94911fbf4c19ULL,
+	0xf2e002270400f72dULL, 0xf3041bdb137f88c4ULL, 0xf327e23c147f7f05ULL, 0xf34b55d86d585f67ULL,
+	0xf36e773e22fb85ccULL, 0xf39146fad7807e5eULL, 0xf3b3c59bc8b6e799ULL, 0xf3d5f3adcebdd99cULL,
+	0xf3f7d1bd5aa0cfdeULL, 0xf419605674fa120cULL, 0xf43aa004bc9a98e1ULL, 0xf45b915365376b76ULL,
+	0xf47c34cd361c7181ULL, 0xf49c8afc88e4b6c6ULL, 0xf4bc946b48381bd7ULL, 0xf4dc51a2ee8e7029ULL,
+	0xf4fbc32c84f7f14eULL, 0xf51ae990a1eb2b09ULL, 0xf539c557681833d9ULL, 0xf55857088541415dULL,
+	0xf5769f2b31188fe3ULL, 0xf5949e462c239854ULL, 0xf5b254dfbea38f83ULL, 0xf5cfc37db78329c6ULL,
+	0xf5eceaa56b499dabULL, 0xf609cadbb312e06bULL, 0xf62664a4eb8d16b4ULL, 0xf642b884f3fb342bULL,
+	0xf65ec6ff2d3cc3f4ULL, 0xf67a909678dad484ULL, 0xf69615cd381a00baULL, 0xf6b157254b119049ULL,
+	0xf6cc55200fc7a947ULL, 0xf6e7103e61528ca2ULL, 0xf701890096fed729ULL, 0xf71bbfe6837ac0a4ULL,
+	0xf735b56f7406527eULL, 0xf74f6a1a2fa88f4fULL, 0xf768de64f6698484ULL, 0xf78212cd80913f55ULL,
+	0xf79b07d0fdeb9e08ULL, 0xf7b3bdec1510f689ULL, 0xf7cc359ae2b38b29ULL, 0xf7e46f58f8f1c655ULL,
+	0xf7fc6ba15ead35f5ULL, 0xf8142aee8ee63f17ULL, 0xf82badba781c8267ULL, 0xf842f47e7bb3e9ecULL,
+	0xf859ffb36d5e586bULL, 0xf870cfd19289f2bdULL, 0xf8876550a1d3fb54ULL, 0xf89dc0a7c280380eULL,
+	0xf8b3e24d8bf4da7aULL, 0xf8c9cab8053ae27fULL, 0xf8df7a5ca482f36eULL, 0xf8f4f1b04eae9351ULL,
+	0xf90a312756ddcc4cULL, 0xf91f39357e0127daULL, 0xf9340a4df26ffb8dULL, 0xf948a4e34f82ff02ULL,
+	0xf95d09679d332299ULL, 0xf971384c4fbc9e73ULL, 0xf985320247463140ULL, 0xf998f6f9cf8c8641ULL,
+	0xf9ac87a29f91b9deULL, 0xf9bfe46bd950f433ULL, 0xf9d30dc4097610ceULL, 0xf9e6041927194ae7ULL,
+	0xf9f8c7d8937ee54bULL, 0xfa0b596f19dac517ULL, 0xfa1db948ef17f676ULL, 0xfa2fe7d1b1a41269ULL,
+	0xfa41e574693e7cb0ULL, 0xfa53b29b86cb70e3ULL, 0xfa654fb0e42ad5a6ULL, 0xfa76bd1dc412cd02ULL,
+	0xfa87fb4ad1edf8cfULL, 0xfa990aa021bd6a0aULL, 0xfaa9eb852ffe3213ULL, 0xfaba9e60e1928c9bULL,
+	0xfacb239983ae992bULL, 0xfadb7b94cbc89b05ULL, 0xfaeba6b7d78cb643ULL, 0xfafba5672cd420e8ULL,
+	0xfb0b7806b99fbebdULL, 0xfb1b1ef9d4161eb4ULL, 0xfb2a9aa33a84d08cULL, 0xfb39eb651365097fULL,
+	0xfb4911a0ed638eb0ULL, 0xfb580db7bf6bdc0fULL, 0xfb66e009e8b67e6fULL, 0xfb7588f730da9787ULL,
+	0xfb8408dec7e2828eULL, 0xfb92601f4663902aULL, 0xfba08f16ad98d06bULL, 0xfbae96226780e184ULL,
+	0xfbbc759f46feb9f9ULL, 0xfbca2de987fd64fbULL, 0xfbd7bf5ccf96a7aeULL, 0xfbe52a542c3c860aULL,
+	0xfbf26f2a15e59e1eULL, 0xfbff8e386e3c5073ULL, 0xfc0c87d880d0ac46ULL, 0xfc195c63034d1671ULL,
+	0xfc260c3015ada1b5ULL, 0xfc329797427a0f48ULL, 0xfc3efeef7f026e5eULL, 0xfc4b428f2b9e519eULL,
+	0xfc5762cc13ee9140ULL, 0xfc635ffb6f2190c0ULL, 0xfc6f3a71e039ff0fULL, 0xfc7af28376580816ULL,
+	0xfc868883ad04ee90ULL, 0xfc91fcc56c810520ULL, 0xfc9d4f9b0a13fd9eULL, 0xfca88156485f85a9ULL,
+	0xfcb3924857b42775ULL, 0xfcbe82c1d66865eeULL, 0xfcc95312d1320b4aULL, 0xfcd4038ac381a118ULL,
+	0xfcde947897e00907ULL, 0xfce9062aa84e2d84ULL, 0xfcf358eebea6c164ULL, 0xfcfd8d12150205eeULL,
+	0xfd07a2e1561b8e73ULL, 0xfd119aa89db9f8cfULL, 0xfd1b74b37918923aULL, 0xfd25314ce752dfb7ULL,
+	0xfd2ed0bf59d201a3ULL, 0xfd385354b4bbe9c6ULL, 0xfd41b9564f645b83ULL, 0xfd4b030cf4bfad9aULL,
+	0xfd5430c0e3d74523ULL, 0xfd5d42b9d03fc15dULL, 0xfd66393ee290cffdULL, 0xfd6f1496b8dea1b9ULL,
+	0xfd77d5076734f6d6ULL, 0xfd807ad67813bb72ULL, 0xfd890648eced2b8aULL, 0xfd9177a33ea5767aULL,
+	0xfd99cf295e13da07ULL, 0xfda20d1eb4852ce8ULL, 0xfdaa31c6243fd0d0ULL, 0xfdb23d6209090422ULL,
+	0xfdba303438ab8b65ULL, 0xfdc20a7e037faab2ULL, 0xfdc9cc8034f46754ULL, 0xfdd1767b141a09e7ULL,
+	0xfdd908ae642dd955ULL, 0xfde083596527070fULL, 0xfde7e6bad444c4f6ULL, 0xfdef3310ec9d7d78ULL,
+	0xfdf6689967af2674ULL, 0xfdfd87917df0a778ULL, 0xfe049035e7644c0bULL, 0xfe0b82c2dc2b3abdULL,
+	0xfe125f741519e9b7ULL, 0xfe192684cc4d89bcULL, 0xfe1fd82fbdc2605cULL, 0xfe2674af27eb0a6bULL,
+	0xfe2cfc3ccc489fa4ULL, 0xfe336f11f003b0a0ULL, 0xfe39cd675c861825ULL, 0xfe40177560159911ULL,
+	0xfe464d73ce6f4214ULL, 0xfe4c6f9a01639082ULL, 0xfe527e1ed9734b99ULL, 0xfe587938be6d11adULL,
+	0xfe5e611da00b90a5ULL, 0xfe643602f6946359ULL, 0xfe69f81dc3778d6cULL, 0xfe6fa7a291ef8f40ULL,
+	0xfe7544c577a20bbdULL, 0xfe7acfba1540f9b9ULL, 0xfe8048b3972c5ac7ULL, 0xfe85afe4b6147161ULL,
+	0xfe8b057fb79c7059ULL, 0xfe9049b66efd9d94ULL, 0xfe957cba3daae226ULL, 0xfe9a9ebc13f4c1f9ULL,
+	0xfe9fafec71adb521ULL, 0xfea4b07b66cedd2dULL, 0xfea9a098941d10caULL, 0xfeae80732bce380eULL,
+	0xfeb35039f22ef3e7ULL, 0xfeb8101b3e488b2fULL, 0xfebcc044fa8717edULL, 0xfec160e4a55fef79ULL,
+	0xfec5f22751f84019ULL, 0xfeca7439a8cbdef7ULL, 0xfecee747e8544121ULL, 0xfed34b7de5af9a8fULL,
+	0xfed7a1070d481e12ULL, 0xfedbe80e637b5929ULL, 0xfee020be8541a6daULL, 0xfee44b41a8d5b49fULL,
+	0xfee867c19e5c14a6ULL, 0xfeec7667d08ad893ULL, 0xfef0775d45513025ULL, 0xfef46aca9e7f0709ULL,
+	0xfef850d81a6c9d5bULL, 0xfefc29ad94a21648ULL, 0xfefff572867ef864ULL, 0xff03b44e07e19b47ULL,
+	0xff076666cfce7e32ULL, 0xff0b0be33517835dULL, 0xff0ea4e92f030bd3ULL, 0xff12319e55f2ef9fULL,
+	0xff15b227e40b4e4cULL, 0xff1926aab5d93399ULL, 0xff1c8f4b4af90c7fULL, 0xff1fec2dc6bce890ULL,
+	0xff233d75f0d283e1ULL, 0xff26834735e915adULL, 0xff29bdc4a856dffeULL, 0xff2ced1100be7ca1ULL,
+	0xff30114e9eb3e3e1ULL, 0xff332a9f89612957ULL, 0xff363925702aeb76ULL, 0xff393d01ab547245ULL,
+	0xff3c36553ca379e9ULL, 0xff3f2540d003a5c1ULL, 0xff4209e4bc2998a8ULL, 0xff44e4610335af52ULL,
+	0xff47b4d553565970ULL, 0xff4a7b61076a0ea5ULL, 0xff4d382327a0dc28ULL, 0xff4feb3a6a1d881cULL,
+	0xff5294c5339647b5ULL, 0xff5534e197f50539ULL, 0xff57cbad5af73316ULL, 0xff5a5945f0cd2940ULL,
+	0xff5cddc87eb90a1dULL, 0xff5f5951dbad2c59ULL, 0xff61cbfe90ea06feULL, 0xff6435eada9b9d41ULL,
+	0xff669732a876678cULL, 0xff68eff19e53b737ULL, 0xff6b404314cd92a1ULL, 0xff6d884219da073fULL,
+	0xff6fc8097165ef54ULL, 0xff71ffb395ef2916ULL, 0xff742f5ab91e3d03ULL, 0xff765718c45f7143ULL,
+	0xff787707597b47ffULL, 0xff7a8f3fd32e6691ULL, 0xff7c9fdb45c0e399ULL, 0xff7ea8f27f9cf9f8ULL,
+	0xff80aa9e09e51ec7ULL, 0xff82a4f629097870ULL, 0xff849812dd5cb515ULL, 0xff86840be3a83e7bULL,
+	0xff8868f8b5bfc9c6ULL, 0xff8a46f08b144154ULL, 0xff8c1e0a59460709ULL, 0xff8dee5cd4b68d90ULL,
+	0xff8fb7fe711946e3ULL, 0xff917b056203e6b2ULL, 0xff9337879b7df72aULL, 0xff94ed9ad28fbeb0ULL,
+	0xff969d547dd07533ULL, 0xff9846c9d5f3c7bfULL, 0xff99ea0fd656a90aULL, 0xff9b873b3d8b6db2ULL,
+	0xff9d1e608de53309ULL, 0xff9eaf940e028f2eULL, 0xffa03ae9c9578966ULL, 0xffa1c07590b6d995ULL,
+	0xffa3404afada6dcdULL, 0xffa4ba7d64eb34f2ULL, 0xffa62f1ff3082d7eULL, 0xffa79e4590ccb76fULL,
+	0xffa90800f1d62884ULL, 0xffaa6c649248a1e4ULL, 0xffabcb82b753266cULL, 0xffad256d6fb2f0caULL,
+	0xffae7a36943608b4ULL, 0xffafc9efc83d1684ULL, 0xffb114aa7a3c7480ULL, 0xffb25a77e43c7d3dULL,
+	0xffb39b690c591673ULL, 0xffb4d78ec54077b8ULL, 0xffb60ef9aeb12c95ULL, 0xffb741ba35f75176ULL,
+	0xffb86fe096690afbULL, 0xffb9997cd9e23737ULL, 0xffbabe9ed93f587cULL, 0xffbbdf563cd7b94fULL,
+	0xffbcfbb27cf6c928ULL, 0xffbe13c2e254b1b6ULL, 0xffbf2796868e245cULL, 0xffc0373c549b5f9fULL,
+	0xffc142c309466c54ULL, 0xffc24a3933a0925bULL, 0xffc34dad357704b5ULL, 0xffc44d2d43c6c4dfULL,
+	0xffc548c7672fbd44ULL, 0xffc640897c6712c0ULL, 0xffc7348134a8ad22ULL, 0xffc824bc1627f69aULL,
+	0xffc911477c7fd227ULL, 0xffc9fa309921c8f6ULL, 0xffcadf8473c46ecbULL, 0xffcbc14fead0fd81ULL,
+	0xffcc9f9fb3d027bfULL, 0xffcd7a805bd622f6ULL, 0xffce51fe47ede8e1ULL, 0xffcf2625b583b097ULL,
+	0xffcff702bace9f7dULL, 0xffd0c4a14739b238ULL, 0xffd18f0d23cbdde4ULL, 0xffd25651f38f69dbULL,
+	0xffd31a7b33f88242ULL, 0xffd3db943d4b03b4ULL, 0xffd499a842ff8060ULL, 0xffd554c254277eebULL,
+	0xffd60ced5bd0f371ULL, 0xffd6c2342168f30eULL, 0xffd774a1491da255ULL, 0xffd8243f543f5f16ULL,
+	0xffd8d118a1a125f5ULL, 0xffd97b376df83432ULL, 0xffda22a5d43ae630ULL, 0xffdac76dcdfed32cULL,
+	0xffdb699933d626a5ULL, 0xffdc0931bdac3809ULL, 0xffdca64103216122ULL, 0xffdd40d07be613e0ULL,
+	0xffddd8e980153005ULL, 0xffde6e95488d9959ULL, 0xffdf01dcef4b0ef1ULL, 0xffdf92c96fbe4439ULL,
+	0xffe02163a7243c53ULL, 0xffe0adb454dce87cULL, 0xffe137c41ac10a1aULL, 0xffe1bf9b7d775926ULL,
+	0xffe24542e4c8ef9eULL, 0xffe2c8c29bf4faadULL, 0xffe34a22d203b255ULL, 0xffe3c96b9a189836ULL,
+	0xffe446a4ebc3fe4aULL, 0xffe4c1d6a353d647ULL, 0xffe53b088223ca70ULL, 0xffe5b2422eeca099ULL,
+	0xffe6278b3612e821ULL, 0xffe69aeb09f4f3bcULL, 0xffe70c6903381fc7ULL, 0xffe77c0c61156609ULL,
+	0xffe7e9dc49a53fa6ULL, 0xffe855dfca2ad61dULL, 0xffe8c01dd75e842eULL, 0xffe9289d4db7a77aULL,
+	0xffe98f64f1b5c3bdULL, 0xffe9f47b7028f880ULL, 0xffea57e75e79ca1bULL, 0xffeab9af3af03efdULL,
+	0xffeb19d96cfa5201ULL, 0xffeb786c4571bad0ULL, 0xffebd56dfee10d2aULL, 0xffec30e4bdc82ffdULL,
+	0xffec8ad690e02d43ULL, 0xffece349715e5b7dULL, 0xffed3a434336e1d4ULL, 0xffed8fc9d55e97b4ULL,
+	0xffede3e2e20c40e7ULL, 0xffee36940ef92719ULL, 0xffee87e2eda111b6ULL, 0xffeed7d4fb819d1dULL,
+	0xffef266fa258f218ULL, 0xffef73b83863de96ULL, 0xffefbfb4009b509aULL, 0xfff00a682af13455ULL,
+	0xfff053d9d48cb674ULL, 0xfff09c0e0805eb87ULL, 0xfff0e309bda0dd8eULL, 0xfff128d1db8800a2ULL,
+	0xfff16d6b36060fb5ULL, 0xfff1b0da8fbf526dULL, 0xfff1f32499ea4d0dULL, 0xfff2344df487db81ULL,
+	0xfff2745b2e9ab86dULL, 0xfff2b350c65e7162ULL, 0xfff2f133297dc91aULL, 0xfff32e06b54888d4ULL,
+	0xfff369cfb6e8c1c2ULL, 0xfff3a4926b977f95ULL, 0xfff3de5300d0ed1fULL, 0xfff417159487ec16ULL,
+	0xfff44ede355920f7ULL, 0xfff485b0e2bd740aULL, 0xfff4bb918d3c088bULL, 0xfff4f084169baaf9ULL,
+	0xfff5248c5213b796ULL, 0xfff557ae047c7a07ULL, 0xfff589ece47f0736ULL, 0xfff5bb4c9ac49250ULL,
+	0xfff5ebd0c2253e0eULL, 0xfff61b7ce7d66b21ULL, 0xfff64a548b9884e5ULL, 0xfff6785b1fe44d45ULL,
+	0xfff6a5940a17a8e3ULL, 0xfff6d202a2a1ec76ULL, 0xfff6fdaa352fac6bULL, 0xfff7288e00d60fc2ULL,
+	0xfff752b1383da72aULL, 0xfff77c1701ccc95fULL, 0xfff7a4c277d175c0ULL, 0xfff7ccb6a8aabe23ULL,
+	0xfff7f3f696f1b8eaULL, 0xfff81a8539a1fc44ULL, 0xfff840657c41a3b0ULL, 0xfff8659a3f08e0a7ULL,
+	0xfff88a265709177aULL, 0xfff8ae0c8e538959ULL, 0xfff8d14fa41f8c7aULL, 0xfff8f3f24cf05359ULL,
+	0xfff915f732ba441eULL, 0xfff93760f507e0fcULL, 0xfff95832291e42a5ULL, 0xfff9786d5a2125b5ULL,
+	0xfff9981509368c10ULL, 0xfff9b72bada9f328ULL, 0xfff9d5b3b50f201bULL, 0xfff9f3af836482a5ULL,
+	0xfffa112173352fceULL, 0xfffa2e0bd5ba754fULL, 0xfffa4a70f2fd0697ULL, 0xfffa665309f5c462ULL,
+	0xfffa81b450ae1fd2ULL, 0xfffa9c96f46019f7ULL, 0xfffab6fd1995e0b0ULL, 0xfffad0e8dc4909d2ULL,
+	0xfffaea5c50016d84ULL, 0xfffb03597ff3a0abULL, 0xfffb1be26f1f1066ULL, 0xfffb33f9186bbf63ULL,
+	0xfffb4b9f6ec7a613ULL, 0xfffb62d75d43b685ULL, 0xfffb79a2c73084e0ULL, 0xfffb9003883a9556ULL,
+	0xfffba5fb7486506eULL, 0xfffbbb8c58cb9e90ULL, 0xfffbd0b7fa712baaULL, 0xfffbe58017a753c8ULL,
+	0xfffbf9e66782b98aULL, 0xfffc0dec9a168743ULL, 0xfffc2194588e5ba5ULL, 0xfffc34df4547e2d4ULL,
+	0xfffc47cefbec1cabULL, 0xfffc5a651188511dULL, 0xfffc6ca314a6b375ULL, 0xfffc7e8a8d66b550ULL,
+	0xfffc901cfd950a2aULL, 0xfffca15be0c35c43ULL, 0xfffcb248ac5fb3afULL, 0xfffcc2e4cfcb906dULL,
+	0xfffcd331b472b83dULL, 0xfffce330bde1b911ULL, 0xfffcf2e349dc20d8ULL, 0xfffd024ab0726b7fULL,
+	0xfffd11684417a7d0ULL, 0xfffd203d51b6d41cULL, 0xfffd2ecb20c7f355ULL, 0xfffd3d12f364db6eULL,
+	0xfffd4b16065dbdbeULL, 0xfffd58d5914d6a26ULL, 0xfffd6652c6ad4dbdULL, 0xfffd738ed3e92dbeULL,
+	0xfffd808ae1729f74ULL, 0xfffd8d4812d43de7ULL, 0xfffd99c786c49df5ULL, 0xfffda60a573901a4ULL,
+	0xfffdb2119977cb55ULL, 0xfffdbdde5e2ab191ULL, 0xfffdc971b170b42dULL, 0xfffdd4cc9aefd36eULL,
+	0xfffddff01de689e7ULL, 0xfffdeadd393d09b8ULL, 0xfffdf594e7963dedULL, 0xfffe00181f60909aULL,
+	0xfffe0a67d2e67667ULL, 0xfffe1484f05ec042ULL, 0xfffe1e7061fcb3c5ULL, 0xfffe282b0dffeb20ULL,
+	0xfffe31b5d6c3fd05ULL, 0xfffe3b119acfed57ULL, 0xfffe443f34e5673aULL, 0xfffe4d3f7c0fc121ULL,
+	0xfffe561343b2cb7eULL, 0xfffe5ebb5b996ab7ULL, 0xfffe67389003fd03ULL, 0xfffe6f8ba9b68cb8ULL,
+	0xfffe77b56e06cfc5ULL, 0xfffe7fb69ee9f4d7ULL, 0xfffe878ffb023ed2ULL, 0xfffe8f423dac6f2eULL,
+	0xfffe96ce1f0cffdaULL, 0xfffe9e34541d2d28ULL, 0xfffea5758eb7d068ULL, 0xfffeac927da60bb9ULL,
+	0xfffeb38bccabc7a7ULL, 0xfffeba6224940326ULL, 0xfffec1162b3cf672ULL, 0xfffec7a883a4096aULL,
+	0xfffece19cdf19deaULL, 0xfffed46aa784aebcULL, 0xfffeda9baafe4394ULL, 0xfffee0ad704cbab8ULL,
+	0xfffee6a08cb6e8beULL, 0xfffeec7592e70f0aULL, 0xfffef22d12f5a96aULL, 0xfffef7c79a74136fULL,
+	0xfffefd45b47705f7ULL, 0xffff02a7e9a0ed6dULL, 0xffff07eec02c193cULL, 0xffff0d1abbf4c4f7ULL,
+	0xffff122c5e82fbadULL, 0xffff1724271455e5ULL, 0xffff1c0292a592c7ULL, 0xffff20c81bfc0cd6ULL,
+	0xffff25753baf0acdULL, 0xffff2a0a6830ecfbULL, 0xffff2e8815d837a8ULL, 0xffff32eeb6e87aebULL,
+	0xffff373ebb9b186cULL, 0xffff3b789227e77bULL, 0xffff3f9ca6cdb7f5ULL, 0xffff43ab63dab462ULL,
+	0xffff47a531b4a3b7ULL, 0xffff4b8a76e10b37ULL, 0xffff4f5b980d30c6ULL, 0xffff5318f815fe37ULL,
+	0xffff56c2f80fc5e5ULL, 0xffff5a59f74de90dULL, 0xffff5dde536a604fULL, 0xffff6150684d26b6ULL,
+	0xffff64b0903387b7ULL, 0xffff67ff23b7507eULL, 0xffff6b3c79d5e4f4ULL, 0xffff6e68e7f738e4ULL,
+	0xffff7184c1f4ad94ULL, 0xffff74905a1fd439ULL, 0xffff778c014915a4ULL, 0xffff7a7806c63f89ULL,
+	0xffff7d54b878f7b0ULL, 0xffff802262d5157fULL, 0xffff82e150e6e223ULL, 0xffff8591cc593fbeULL,
+	0xffff88341d7bb7f7ULL, 0xffff8ac88b48722eULL, 0xffff8d4f5b6a11c4ULL, 0xffff8fc8d2417cbcULL,
+	0xffff923532eb8b0dULL, 0xffff9494bf469efdULL, 0xffff96e7b7f826d2ULL, 0xffff992e5c720829ULL,
+	0xffff9b68eaf7f554ULL, 0xffff9d97a0a4acedULL, 0xffff9fbab96f2418ULL, 0xffffa1d2702f9b98ULL,
+	0xffffa3defea4a024ULL, 0xffffa5e09d77f633ULL, 0xffffa7d784437198ULL, 0xffffa9c3e995b92cULL,
+	0xffffaba602f6f6d9ULL, 0xffffad7e04ed7449ULL, 0xffffaf4c23022480ULL, 0xffffb1108fc51aafULL,
+	0xffffb2cb7cd1ee7cULL, 0xffffb47d1ad40e02ULL, 0xffffb625998afde2ULL, 0xffffb7c527ce878aULL,
+	0xffffb95bf392d60cULL, 0xffffbaea29ec81b9ULL, 0xffffbc6ff7148accULL, 0xffffbded866c4355ULL,
+	0xffffbf63028128b5ULL, 0xffffc0d09510acdaULL, 0xffffc236670bef87ULL, 0xffffc394a09b67d3ULL,
+	0xffffc4eb69227e2fULL, 0xffffc63ae7431718ULL, 0xffffc78340e10ecbULL, 0xffffc8c49b25a616ULL,
+	0xffffc9ff1a82e094ULL, 0xffffcb32e2b6d48cULL, 0xffffcc6016ceec99ULL, 0xffffcd86d92b1b66ULL,
+	0xffffcea74b8101a8ULL, 0xffffcfc18edf068fULL, 0xffffd0d5c3af62e4ULL, 0xffffd1e409bb1f01ULL,
+	0xffffd2ec802d03e3ULL, 0xffffd3ef45947f7cULL, 0xffffd4ec77e87c7cULL, 0xffffd5e4348a2dc2ULL,
+	0xffffd6d69847cdaaULL, 0xffffd7c3bf5f515fULL, 0xffffd8abc5811063ULL, 0xffffd98ec5d26086ULL,
+	0xffffda6cdaf02669ULL, 0xffffdb461ef15ac8ULL, 0xffffdc1aab6984afULL, 0xffffdcea996b28ccULL,
+	0xffffddb6018a2e0bULL, 0xffffde7cfbde379aULL, 0xffffdf3fa004f493ULL, 0xffffdffe05246566ULL,
+	0xffffe0b841ed1732ULL, 0xffffe16e6c9c5536ULL, 0xffffe2209afe5083ULL, 0xffffe2cee2703e17ULL,
+	0xffffe37957e26b7cULL, 0xffffe4200fda4a2aULL, 0xffffe4c31e7471b8ULL, 0xffffe56297669912ULL,
+	0xffffe5fe8e0186d1ULL, 0xffffe6971532f8e1ULL, 0xffffe72c3f87838eULL, 0xffffe7be1f2c6821ULL,
+	0xffffe84cc5f16338ULL, 0xffffe8d8454a72e6ULL, 0xffffe960ae5194d7ULL, 0xffffe9e611c87c84ULL,
+	0xffffea68801a41a3ULL, 0xffffeae8095d06efULL, 0xffffeb64bd53996dULL, 0xffffebdeab6f0845ULL,
+	0xffffec55e2d03555ULL, 0xffffecca72495e9cULL, 0xffffed3c685fa09aULL, 0xffffedabd34c71baULL,
+	0xffffee18c0ff16f8ULL, 0xffffee833f1e11c7ULL, 0xffffeeeb5b088769ULL, 0xffffef5121d7a1c7ULL,
+	0xffffefb4a05fe9e7ULL, 0xfffff015e3329c23ULL, 0xfffff074f69ef62fULL, 0xfffff0d1e6b37f14ULL,
+	0xfffff12cbf3f4935ULL, 0xfffff1858bd32e74ULL, 0xfffff1dc57c30695ULL, 0xfffff2312e26d7fcULL,
+	0xfffff28419dc02cfULL, 0xfffff2d5258666a7ULL, 0xfffff3245b9182d9ULL, 0xfffff371c631917aULL,
+	0xfffff3bd6f649d23ULL, 0xfffff40760f391aaULL, 0xfffff44fa47347bfULL, 0xfffff49643458babULL,
+	0xfffff4db469a1f24ULL, 0xfffff51eb76fb663ULL, 0xfffff5609e94f08bULL, 0xfffff5a104a94b66ULL,
+	0xfffff5dff21e12aaULL, 0xfffff61d6f374abcULL, 0xfffff659840c971cULL, 0xfffff694388a1c7cULL,
+	0xfffff6cd94715e9fULL, 0xfffff7059f5a1a14ULL, 0xfffff73c60b319d3ULL, 0xfffff771dfc308e3ULL,
+	0xfffff7a623a93fffULL, 0xfffff7d9335e8f6dULL, 0xfffff80b15b604f9ULL, 0xfffff83bd15dae38ULL,
+	0xfffff86b6cdf571dULL, 0xfffff899eea144f6ULL, 0xfffff8c75ce6edd9ULL, 0xfffff8f3bdd1ac96ULL,
+	0xfffff91f1761713bULL, 0xfffff9496f756e43ULL, 0xfffff972cbccc26eULL, 0xfffff99b32071f64ULL,
+	0xfffff9c2a7a56d1eULL, 0xfffff9e9320a6a37ULL, 0xfffffa0ed67b4927ULL, 0xfffffa339a204a76ULL,
+	0xfffffa57820553ffULL, 0xfffffa7a931a8542ULL, 0xfffffa9cd234c8e1ULL, 0xfffffabe440e6348ULL,
+	0xfffffadeed477e95ULL, 0xfffffafed266b3cfULL, 0xfffffb1df7d99170ULL, 0xfffffb3c61f51f51ULL,
+	0xfffffb5a14f6600bULL, 0xfffffb771502cfcdULL, 0xfffffb936628e0c1ULL, 0xfffffbaf0c6074ffULL,
+	0xfffffbca0b8b561dULL, 0xfffffbe46775aa6aULL, 0xfffffbfe23d667e1ULL, 0xfffffc17444fc4d2ULL,
+	0xfffffc2fcc6fa65eULL, 0xfffffc47bfb00cc0ULL, 0xfffffc5f21777d76ULL, 0xfffffc75f5196b57ULL,
+	0xfffffc8c3dd69c94ULL, 0xfffffca1fedd8eb5ULL, 0xfffffcb73b4ad8a3ULL, 0xfffffccbf6298ab9ULL,
+	0xfffffce032738cf1ULL, 0xfffffcf3f311fb2dULL, 0xfffffd073add7fb2ULL, 0xfffffd1a0c9eabceULL,
+	0xfffffd2c6b0e4ebdULL, 0xfffffd3e58d5cad3ULL, 0xfffffd4fd88f68ecULL, 0xfffffd60ecc6aa38ULL,
+	0xfffffd7197f8985fULL, 0xfffffd81dc941408ULL, 0xfffffd91bcfa21ceULL, 0xfffffda13b7e35a9ULL,
+	0xfffffdb05a667cd1ULL, 0xfffffdbf1bec2624ULL, 0xfffffdcd823ba910ULL, 0xfffffddb8f750b1cULL,
+	0xfffffde945ac23f7ULL, 0xfffffdf6a6e8e030ULL, 0xfffffe03b5278294ULL, 0xfffffe107258e433ULL,
+	0xfffffe1ce062b317ULL, 0xfffffe29011fafbaULL, 0xfffffe34d65fe935ULL, 0xfffffe4061e8f836ULL,
+	0xfffffe4ba57638c4ULL, 0xfffffe56a2b902ccULL, 0xfffffe615b58e192ULL, 0xfffffe6bd0f3c9f1ULL,
+	0xfffffe76051e4f88ULL, 0xfffffe7ff963d8c7ULL, 0xfffffe89af46d1f1ULL, 0xfffffe932840df08ULL,
+	0xfffffe9c65c30cbaULL, 0xfffffea569360043ULL, 0xfffffeae33fa2656ULL, 0xfffffeb6c767e10cULL,
+	0xfffffebf24cfb4dbULL, 0xfffffec74d7a74a8ULL, 0xfffffecf42a96ce0ULL, 0xfffffed705968db7ULL,
+	0xfffffede9774947fULL, 0xfffffee5f96f3425ULL, 0xfffffeed2cab3cd3ULL, 0xfffffef43246c2bfULL,
+	0xfffffefb0b59442bULL, 0xffffff01b8f3ce93ULL, 0xffffff083c21231dULL, 0xffffff0e95e5da39ULL,
+	0xffffff14c740868dULL, 0xffffff1ad129d718ULL, 0xffffff20b494b8aaULL, 0xffffff26726e7698ULL,
+	0xffffff2c0b9edaceULL, 0xffffff3181084d26ULL, 0xffffff36d387f21dULL, 0xffffff3c03f5c8e0ULL,
+	0xffffff411324c8afULL, 0xffffff4601e2fdacULL, 0xffffff4ad0f9a4feULL, 0xffffff4f812d4867ULL,
+	0xffffff54133dd93dULL, 0xffffff5887e6caceULL, 0xffffff5cdfdf2c3aULL, 0xffffff611bd9c1b7ULL,
+	0xffffff653c851d4fULL, 0xffffff69428bb716ULL, 0xffffff6d2e9404d9ULL, 0xffffff710140914bULL,
+	0xffffff74bb3012b1ULL, 0xffffff785cfd8113ULL, 0xffffff7be7402bf0ULL, 0xffffff7f5a8bcf7dULL,
+	0xffffff82b770a969ULL, 0xffffff85fe7b8d33ULL, 0xffffff893035f809ULL, 0xffffff8c4d262442ULL,
+	0xffffff8f55cf1c60ULL, 0xffffff924ab0cdb0ULL, 0xffffff952c481a81ULL, 0xffffff97fb0eebeeULL,
+	0xffffff9ab77c4352ULL, 0xffffff9d62044b4dULL, 0xffffff9ffb186870ULL, 0xffffffa28327498cULL,
+	0xffffffa4fa9cf7a0ULL, 0xffffffa761e2e575ULL, 0xffffffa9b95ffedcULL, 0xffffffac0178b798ULL,
+	0xffffffae3a8f19f5ULL, 0xffffffb06502d50aULL, 0xffffffb281314aaaULL, 0xffffffb48f759d0dULL,
+	0xffffffb69028bc22ULL, 0xffffffb883a17298ULL, 0xffffffba6a3472a4ULL, 0xffffffbc44346274ULL,
+	0xffffffbe11f1e862ULL, 0xffffffbfd3bbb6deULL, 0xffffffc189de9815ULL, 0xffffffc334a57958ULL,
+	0xffffffc4d459763cULL, 0xffffffc66941e380ULL, 0xffffffc7f3a459b2ULL, 0xffffffc973c4bf95ULL,
+	0xffffffcae9e5544eULL, 0xffffffcc5646b957ULL, 0xffffffcdb927fc36ULL, 0xffffffcf12c69ffdULL,
+	0xffffffd0635ea695ULL, 0xffffffd1ab2a99d0ULL, 0xffffffd2ea639449ULL, 0xffffffd421414a10ULL,
+	0xffffffd54ffa1124ULL, 0xffffffd676c2e9bbULL, 0xffffffd795cf8658ULL, 0xffffffd8ad5253b8ULL,
+	0xffffffd9bd7c808bULL, 0xffffffdac67e0503ULL, 0xffffffdbc885aa34ULL, 0xffffffdcc3c1114cULL,
+	0xffffffddb85cbaa1ULL, 0xffffffdea6840c92ULL, 0xffffffdf8e615a45ULL, 0xffffffe0701dea35ULL,
+	0xffffffe14be1fca6ULL, 0xffffffe221d4d1e5ULL, 0xffffffe2f21cb072ULL, 0xffffffe3bcdeeaf5ULL,
+	0xffffffe4823fe621ULL, 0xffffffe542631e65ULL, 0xffffffe5fd6b2d89ULL, 0xffffffe6b379d01eULL,
+	0xffffffe764afead5ULL, 0xffffffe8112d8fb3ULL, 0xffffffe8b912032bULL, 0xffffffe95c7bc112ULL,
+	0xffffffe9fb88817aULL, 0xffffffea96553d73ULL, 0xffffffeb2cfe33a8ULL, 0xffffffebbf9eeceaULL,
+	0xffffffec4e524095ULL, 0xffffffecd93258e5ULL, 0xffffffed6058b728ULL, 0xffffffede3de37e2ULL,
+	0xffffffee63db16caULL, 0xffffffeee066f2bdULL, 0xffffffef5998d18dULL, 0xffffffefcf8723c4ULL,
+	0xfffffff04247c848ULL, 0xfffffff0b1f00ff0ULL, 0xfffffff11e94c0f9ULL, 0xfffffff1884a1a75ULL,
+	0xfffffff1ef23d796ULL, 0xfffffff2533532f2ULL, 0xfffffff2b490e9a8ULL, 0xfffffff313493e7bULL,
+	0xfffffff36f6ffcd5ULL, 0xfffffff3c9167bb9ULL, 0xfffffff4204da0a5ULL, 0xfffffff47525e25cULL,
+	0xfffffff4c7af4ba9ULL, 0xfffffff517f97e08ULL, 0xfffffff56613b446ULL, 0xfffffff5b20cc508ULL,
+	0xfffffff5fbf3254eULL, 0xfffffff643d4eadeULL, 0xfffffff689bfce9fULL, 0xfffffff6cdc12ef2ULL,
+	0xfffffff70fe611eaULL, 0xfffffff7503b2789ULL, 0xfffffff78ecccbdfULL, 0xfffffff7cba70929ULL,
+	0xfffffff806d599d9ULL, 0xfffffff84063ea9aULL, 0xfffffff8785d1c3eULL, 0xfffffff8aecc05abULL,
+	0xfffffff8e3bb35b2ULL, 0xfffffff91734f4e0ULL, 0xfffffff949434744ULL, 0xfffffff979efee29ULL,
+	0xfffffff9a94469c1ULL, 0xfffffff9d749faceULL, 0xfffffffa0409a43bULL, 0xfffffffa2f8c2ca9ULL,
+	0xfffffffa59da1ffbULL, 0xfffffffa82fbd0d0ULL, 0xfffffffaaaf959f3ULL, 0xfffffffad1da9fcfULL,
+	0xfffffffaf7a751c5ULL, 0xfffffffb1c66eb90ULL, 0xfffffffb4020b68cULL, 0xfffffffb62dbcb06ULL,
+	0xfffffffb849f1177ULL, 0xfffffffba57143beULL, 0xfffffffbc558ee51ULL, 0xfffffffbe45c7167ULL,
+	0xfffffffc02820217ULL, 0xfffffffc1fcfab74ULL, 0xfffffffc3c4b4fa3ULL, 0xfffffffc57faa8e2ULL,
+	0xfffffffc72e34a96ULL, 0xfffffffc8d0aa242ULL, 0xfffffffca675f888ULL, 0xfffffffcbf2a7217ULL,
+	0xfffffffcd72d109aULL, 0xfffffffcee82b39fULL, 0xfffffffd05301979ULL, 0xfffffffd1b39e01aULL,
+	0xfffffffd30a485ebULL, 0xfffffffd45746a9bULL, 0xfffffffd59adcfedULL, 0xfffffffd6d54da7fULL,
+	0xfffffffd806d9287ULL, 0xfffffffd92fbe495ULL, 0xfffffffda503a249ULL, 0xfffffffdb6888304ULL,
+	0xfffffffdc78e249dULL, 0xfffffffdd8180c04ULL, 0xfffffffde829a5efULL, 0xfffffffdf7c64775ULL,
+	0xfffffffe06f12eb4ULL, 0xfffffffe15ad8365ULL, 0xfffffffe23fe5771ULL, 0xfffffffe31e6a78aULL,
+	0xfffffffe3f695bb3ULL, 0xfffffffe4c8947ceULL, 0xfffffffe59492c22ULL, 0xfffffffe65abb5e0ULL,
+	0xfffffffe71b37fa4ULL, 0xfffffffe7d6311efULL, 0xfffffffe88bce3a7ULL, 0xfffffffe93c35a87ULL,
+	0xfffffffe9e78cb98ULL, 0xfffffffea8df7ba1ULL, 0xfffffffeb2f99f93ULL, 0xfffffffebcc95cf7ULL,
+	0xfffffffec650ca55ULL, 0xfffffffecf91ef9aULL, 0xfffffffed88ec67bULL, 0xfffffffee1493ad8ULL,
+	0xfffffffee9c32b14ULL, 0xfffffffef1fe6879ULL, 0xfffffffef9fcb78cULL, 0xffffffff01bfd066ULL,
+	0xffffffff09495f06ULL, 0xffffffff109b03a9ULL, 0xffffffff17b65316ULL, 0xffffffff1e9cd6eeULL,
+	0xffffffff25500df8ULL, 0xffffffff2bd16c6cULL, 0xffffffff32225c3bULL, 0xffffffff38443d57ULL,
+	0xffffffff3e3865f4ULL, 0xffffffff440022d0ULL, 0xffffffff499cb771ULL, 0xffffffff4f0f5e63ULL,
+	0xffffffff5459497dULL, 0xffffffff597ba213ULL, 0xffffffff5e778939ULL, 0xffffffff634e17f9ULL,
+	0xffffffff68005f8aULL, 0xffffffff6c8f6988ULL, 0xffffffff70fc3827ULL, 0xffffffff7547c667ULL,
+	0xffffffff79730846ULL, 0xffffffff7d7eeaf3ULL, 0xffffffff816c54f8ULL, 0xffffffff853c266dULL,
+	0xffffffff88ef3925ULL, 0xffffffff8c8660d5ULL, 0xffffffff90026b44ULL, 0xffffffff93642072ULL,
+	0xffffffff96ac42c0ULL, 0xffffffff99db8f19ULL, 0xffffffff9cf2bd15ULL, 0xffffffff9ff27f23ULL,
+	0xffffffffa2db82aaULL, 0xffffffffa5ae702dULL, 0xffffffffa86beb6dULL, 0xffffffffab14938bULL,
+	0xffffffffada90329ULL, 0xffffffffb029d088ULL, 0xffffffffb2978da9ULL, 0xffffffffb4f2c86aULL,
+	0xffffffffb73c0aa3ULL, 0xffffffffb973da41ULL, 0xffffffffbb9ab966ULL, 0xffffffffbdb12680ULL,
+	0xffffffffbfb79c63ULL, 0xffffffffc1ae9266ULL, 0xffffffffc3967c78ULL, 0xffffffffc56fcb3bULL,
+	0xffffffffc73aec1bULL, 0xffffffffc8f84962ULL, 0xffffffffcaa84a52ULL, 0xffffffffcc4b5339ULL,
+	0xffffffffcde1c585ULL, 0xffffffffcf6bffdaULL, 0xffffffffd0ea5e28ULL, 0xffffffffd25d39b8ULL,
+	0xffffffffd3c4e945ULL, 0xffffffffd521c10dULL, 0xffffffffd67412dfULL, 0xffffffffd7bc2e33ULL,
+	0xffffffffd8fa6034ULL, 0xffffffffda2ef3d6ULL, 0xffffffffdb5a31e2ULL, 0xffffffffdc7c6109ULL,
+	0xffffffffdd95c5efULL, 0xffffffffdea6a33fULL, 0xffffffffdfaf39b4ULL, 0xffffffffe0afc82bULL,
+	0xffffffffe1a88bacULL, 0xffffffffe299bf7eULL, 0xffffffffe3839d2cULL, 0xffffffffe4665c98ULL,
+	0xffffffffe5423403ULL, 0xffffffffe617581aULL, 0xffffffffe6e5fc03ULL, 0xffffffffe7ae5164ULL,
+	0xffffffffe8708874ULL, 0xffffffffe92ccffeULL, 0xffffffffe9e35574ULL, 0xffffffffea9444f0ULL,
+	0xffffffffeb3fc945ULL, 0xffffffffebe60c03ULL, 0xffffffffec873584ULL, 0xffffffffed236cf2ULL,
+	0xffffffffedbad853ULL, 0xffffffffee4d9c8eULL, 0xffffffffeedbdd75ULL, 0xffffffffef65bdcbULL,
+	0xffffffffefeb5f51ULL, 0xfffffffff06ce2c6ULL, 0xfffffffff0ea67f4ULL, 0xfffffffff1640db5ULL,
+	0xfffffffff1d9f1faULL, 0xfffffffff24c31d1ULL, 0xfffffffff2bae96cULL, 0xfffffffff326342aULL,
+	0xfffffffff38e2c99ULL, 0xfffffffff3f2ec7eULL, 0xfffffffff4548cdaULL, 0xfffffffff4b325f0ULL,
+	0xfffffffff50ecf4eULL, 0xfffffffff5679fcaULL, 0xfffffffff5bdad90ULL, 0xfffffffff6110e22ULL,
+	0xfffffffff661d65eULL, 0xfffffffff6b01a83ULL, 0xfffffffff6fbee36ULL, 0xfffffffff7456485ULL,
+	0xfffffffff78c8feeULL, 0xfffffffff7d18260ULL, 0xfffffffff8144d41ULL, 0xfffffffff8550174ULL,
+	0xfffffffff893af58ULL, 0xfffffffff8d066cfULL, 0xfffffffff90b3742ULL, 0xfffffffff9442fa3ULL,
+	0xfffffffff97b5e72ULL, 0xfffffffff9b0d1beULL, 0xfffffffff9e4972aULL, 0xfffffffffa16bbf3ULL,
+	0xfffffffffa474cebULL, 0xfffffffffa765685ULL, 0xfffffffffaa3e4d3ULL, 0xfffffffffad00389ULL,
+	0xfffffffffafabe01ULL, 0xfffffffffb241f3dULL, 0xfffffffffb4c31eaULL, 0xfffffffffb730062ULL,
+	0xfffffffffb9894b0ULL, 0xfffffffffbbcf88fULL, 0xfffffffffbe03570ULL, 0xfffffffffc02547bULL,
+	0xfffffffffc235e8fULL, 0xfffffffffc435c48ULL, 0xfffffffffc6255fdULL, 0xfffffffffc8053c6ULL,
+	0xfffffffffc9d5d7bULL, 0xfffffffffcb97ab6ULL, 0xfffffffffcd4b2d8ULL, 0xfffffffffcef0d05ULL,
+	0xfffffffffd08902bULL, 0xfffffffffd214303ULL, 0xfffffffffd392c10ULL, 0xfffffffffd5051a2ULL,
+	0xfffffffffd66b9d6ULL, 0xfffffffffd7c6a9dULL, 0xfffffffffd9169b6ULL, 0xfffffffffda5bcb4ULL,
+	0xfffffffffdb968fdULL, 0xfffffffffdcc73cfULL, 0xfffffffffddee23dULL, 0xfffffffffdf0b931ULL,
+	0xfffffffffe01fd71ULL, 0xfffffffffe12b39cULL, 0xfffffffffe22e02bULL, 0xfffffffffe328777ULL,
+	0xfffffffffe41adb2ULL, 0xfffffffffe5056f2ULL, 0xfffffffffe5e8729ULL, 0xfffffffffe6c422bULL,
+	0xfffffffffe798baeULL, 0xfffffffffe866749ULL, 0xfffffffffe92d879ULL, 0xfffffffffe9ee29cULL,
+	0xfffffffffeaa88f9ULL, 0xfffffffffeb5ceb9ULL, 0xfffffffffec0b6f0ULL, 0xfffffffffecb4495ULL,
+	0xfffffffffed57a8cULL, 0xfffffffffedf5b9eULL, 0xfffffffffee8ea7fULL, 0xfffffffffef229d0ULL,
+	0xfffffffffefb1c18ULL, 0xffffffffff03c3cfULL, 0xffffffffff0c2355ULL, 0xffffffffff143cf9ULL,
+	0xffffffffff1c12f8ULL, 0xffffffffff23a77bULL, 0xffffffffff2afc9cULL, 0xffffffffff321463ULL,
+	0xffffffffff38f0c6ULL, 0xffffffffff3f93b0ULL, 0xffffffffff45fef6ULL, 0xffffffffff4c3464ULL,
+	0xffffffffff5235b5ULL, 0xffffffffff580496ULL, 0xffffffffff5da2a6ULL, 0xffffffffff631178ULL,
+	0xffffffffff685293ULL, 0xffffffffff6d676fULL, 0xffffffffff72517aULL, 0xffffffffff771217ULL,
+	0xffffffffff7baa9bULL, 0xffffffffff801c54ULL, 0xffffffffff846883ULL, 0xffffffffff88905eULL,
+	0xffffffffff8c9514ULL, 0xffffffffff9077c8ULL, 0xffffffffff943994ULL, 0xffffffffff97db8aULL,
+	0xffffffffff9b5eb4ULL, 0xffffffffff9ec410ULL, 0xffffffffffa20c98ULL, 0xffffffffffa5393cULL,
+	0xffffffffffa84ae4ULL, 0xffffffffffab4272ULL, 0xffffffffffae20bfULL, 0xffffffffffb0e69fULL,
+	0xffffffffffb394ddULL, 0xffffffffffb62c41ULL, 0xffffffffffb8ad88ULL, 0xffffffffffbb196cULL,
+	0xffffffffffbd70a0ULL, 0xffffffffffbfb3d3ULL, 0xffffffffffc1e3abULL, 0xffffffffffc400ccULL,
+	0xffffffffffc60bd3ULL, 0xffffffffffc80557ULL, 0xffffffffffc9ededULL, 0xffffffffffcbc623ULL,
+	0xffffffffffcd8e83ULL, 0xffffffffffcf4792ULL, 0xffffffffffd0f1d2ULL, 0xffffffffffd28dc0ULL,
+	0xffffffffffd41bd4ULL, 0xffffffffffd59c85ULL, 0xffffffffffd71042ULL, 0xffffffffffd8777aULL,
+	0xffffffffffd9d296ULL, 0xffffffffffdb21feULL, 0xffffffffffdc6615ULL, 0xffffffffffdd9f3aULL,
+	0xffffffffffdecdcbULL, 0xffffffffffdff221ULL, 0xffffffffffe10c94ULL, 0xffffffffffe21d77ULL,
+	0xffffffffffe3251dULL, 0xffffffffffe423d3ULL, 0xffffffffffe519e6ULL, 0xffffffffffe6079fULL,
+	0xffffffffffe6ed46ULL, 0xffffffffffe7cb20ULL, 0xffffffffffe8a16fULL, 0xffffffffffe97074ULL,
+	0xffffffffffea386eULL, 0xffffffffffeaf998ULL, 0xffffffffffebb42dULL, 0xffffffffffec6865ULL,
+	0xffffffffffed1677ULL, 0xffffffffffedbe98ULL, 0xffffffffffee60fbULL, 0xffffffffffeefdd1ULL,
+	0xffffffffffef954aULL, 0xfffffffffff02793ULL, 0xfffffffffff0b4dbULL, 0xfffffffffff13d4bULL,
+	0xfffffffffff1c10eULL, 0xfffffffffff2404bULL, 0xfffffffffff2bb2bULL, 0xfffffffffff331d2ULL,
+	0xfffffffffff3a465ULL, 0xfffffffffff41308ULL, 0xfffffffffff47ddcULL, 0xfffffffffff4e502ULL,
+	0xfffffffffff5489bULL, 0xfffffffffff5a8c5ULL, 0xfffffffffff6059eULL, 0xfffffffffff65f42ULL,
+	0xfffffffffff6b5ceULL, 0xfffffffffff7095dULL, 0xfffffffffff75a08ULL, 0xfffffffffff7a7e8ULL,
+	0xfffffffffff7f317ULL, 0xfffffffffff83babULL, 0xfffffffffff881baULL, 0xfffffffffff8c55cULL,
+	0xfffffffffff906a5ULL, 0xfffffffffff945aaULL, 0xfffffffffff9827fULL, 0xfffffffffff9bd36ULL,
+	0xfffffffffff9f5e2ULL, 0xfffffffffffa2c95ULL, 0xfffffffffffa6161ULL, 0xfffffffffffa9456ULL,
+	0xfffffffffffac584ULL, 0xfffffffffffaf4fbULL, 0xfffffffffffb22c9ULL, 0xfffffffffffb4efeULL,
+	0xfffffffffffb79a8ULL, 0xfffffffffffba2d3ULL, 0xfffffffffffbca8eULL, 0xfffffffffffbf0e5ULL,
+	0xfffffffffffc15e4ULL, 0xfffffffffffc3997ULL, 0xfffffffffffc5c0aULL, 0xfffffffffffc7d47ULL,
+	0xfffffffffffc9d59ULL, 0xfffffffffffcbc4bULL, 0xfffffffffffcda26ULL, 0xfffffffffffcf6f4ULL,
+	0xfffffffffffd12bfULL, 0xfffffffffffd2d90ULL, 0xfffffffffffd476eULL, 0xfffffffffffd6063ULL,
+	0xfffffffffffd7877ULL, 0xfffffffffffd8fb1ULL, 0xfffffffffffda618ULL, 0xfffffffffffdbbb6ULL,
+	0xfffffffffffdd08fULL, 0xfffffffffffde4acULL, 0xfffffffffffdf812ULL, 0xfffffffffffe0ac9ULL,
+	0xfffffffffffe1cd6ULL, 0xfffffffffffe2e3eULL, 0xfffffffffffe3f09ULL, 0xfffffffffffe4f3bULL,
+	0xfffffffffffe5edaULL, 0xfffffffffffe6debULL, 0xfffffffffffe7c72ULL, 0xfffffffffffe8a75ULL,
+	0xfffffffffffe97f8ULL, 0xfffffffffffea500ULL, 0xfffffffffffeb191ULL, 0xfffffffffffebdb0ULL,
+	0xfffffffffffec95fULL, 0xfffffffffffed4a4ULL, 0xfffffffffffedf82ULL, 0xfffffffffffee9fcULL,
+	0xfffffffffffef416ULL, 0xfffffffffffefdd4ULL, 0xffffffffffff0738ULL, 0xffffffffffff1046ULL,
+	0xffffffffffff1901ULL, 0xffffffffffff216cULL, 0xffffffffffff298aULL, 0xffffffffffff315dULL,
+	0xffffffffffff38e8ULL, 0xffffffffffff402dULL, 0xffffffffffff4730ULL, 0xffffffffffff4df1ULL,
+	0xffffffffffff5475ULL, 0xffffffffffff5abcULL, 0xffffffffffff60caULL, 0xffffffffffff669fULL,
+	0xffffffffffff6c3fULL, 0xffffffffffff71abULL, 0xffffffffffff76e4ULL, 0xffffffffffff7bedULL,
+	0xffffffffffff80c7ULL, 0xffffffffffff8575ULL, 0xffffffffffff89f7ULL, 0xffffffffffff8e4fULL,
+	0xffffffffffff927fULL, 0xffffffffffff9688ULL, 0xffffffffffff9a6bULL, 0xffffffffffff9e2bULL,
+	0xffffffffffffa1c7ULL, 0xffffffffffffa542ULL, 0xffffffffffffa89cULL, 0xffffffffffffabd7ULL,
+	0xffffffffffffaef4ULL, 0xffffffffffffb1f4ULL, 0xffffffffffffb4d8ULL, 0xffffffffffffb7a1ULL,
+	0xffffffffffffba50ULL, 0xffffffffffffbce5ULL, 0xffffffffffffbf63ULL, 0xffffffffffffc1c9ULL,
+	0xffffffffffffc419ULL, 0xffffffffffffc653ULL, 0xffffffffffffc878ULL, 0xffffffffffffca89ULL,
+	0xffffffffffffcc87ULL, 0xffffffffffffce72ULL, 0xffffffffffffd04bULL, 0xffffffffffffd212ULL,
+	0xffffffffffffd3c9ULL, 0xffffffffffffd56fULL, 0xffffffffffffd706ULL, 0xffffffffffffd88fULL,
+	0xffffffffffffda08ULL, 0xffffffffffffdb74ULL, 0xffffffffffffdcd2ULL, 0xffffffffffffde23ULL,
+	0xffffffffffffdf68ULL, 0xffffffffffffe0a1ULL, 0xffffffffffffe1cfULL, 0xffffffffffffe2f1ULL,
+	0xffffffffffffe408ULL, 0xffffffffffffe515ULL, 0xffffffffffffe618ULL, 0xffffffffffffe712ULL,
+	0xffffffffffffe802ULL, 0xffffffffffffe8e9ULL, 0xffffffffffffe9c8ULL, 0xffffffffffffea9eULL,
+	0xffffffffffffeb6dULL, 0xffffffffffffec34ULL, 0xffffffffffffecf3ULL, 0xffffffffffffedabULL,
+	0xffffffffffffee5dULL, 0xffffffffffffef08ULL, 0xffffffffffffefacULL, 0xfffffffffffff04aULL,
+	0xfffffffffffff0e3ULL, 0xfffffffffffff175ULL, 0xfffffffffffff202ULL, 0xfffffffffffff28aULL,
+	0xfffffffffffff30dULL, 0xfffffffffffff38bULL, 0xfffffffffffff404ULL, 0xfffffffffffff479ULL,
+	0xfffffffffffff4e9ULL, 0xfffffffffffff555ULL, 0xfffffffffffff5bdULL, 0xfffffffffffff621ULL,
+	0xfffffffffffff682ULL, 0xfffffffffffff6deULL, 0xfffffffffffff738ULL, 0xfffffffffffff78dULL,
+	0xfffffffffffff7e0ULL, 0xfffffffffffff830ULL, 0xfffffffffffff87cULL, 0xfffffffffffff8c6ULL,
+	0xfffffffffffff90dULL, 0xfffffffffffff951ULL, 0xfffffffffffff992ULL, 0xfffffffffffff9d1ULL,
+	0xfffffffffffffa0eULL, 0xfffffffffffffa49ULL, 0xfffffffffffffa81ULL, 0xfffffffffffffab7ULL,
+	0xfffffffffffffaebULL, 0xfffffffffffffb1dULL, 0xfffffffffffffb4dULL, 0xfffffffffffffb7bULL,
+	0xfffffffffffffba8ULL, 0xfffffffffffffbd3ULL, 0xfffffffffffffbfcULL, 0xfffffffffffffc24ULL,
+	0xfffffffffffffc4aULL, 0xfffffffffffffc6fULL, 0xfffffffffffffc92ULL, 0xfffffffffffffcb4ULL,
+	0xfffffffffffffcd4ULL, 0xfffffffffffffcf4ULL, 0xfffffffffffffd12ULL, 0xfffffffffffffd2fULL,
+	0xfffffffffffffd4bULL, 0xfffffffffffffd66ULL, 0xfffffffffffffd80ULL, 0xfffffffffffffd99ULL,
+	0xfffffffffffffdb1ULL, 0xfffffffffffffdc7ULL, 0xfffffffffffffddeULL, 0xfffffffffffffdf3ULL,
+	0xfffffffffffffe07ULL, 0xfffffffffffffe1bULL, 0xfffffffffffffe2eULL, 0xfffffffffffffe40ULL,
+	0xfffffffffffffe51ULL, 0xfffffffffffffe62ULL, 0xfffffffffffffe72ULL, 0xfffffffffffffe82ULL,
+	0xfffffffffffffe91ULL, 0xfffffffffffffe9fULL, 0xfffffffffffffeadULL, 0xfffffffffffffebaULL,
+	0xfffffffffffffec7ULL, 0xfffffffffffffed3ULL, 0xfffffffffffffedfULL, 0xfffffffffffffeeaULL,
+	0xfffffffffffffef5ULL, 0xffffffffffffff00ULL, 0xffffffffffffff0aULL, 0xffffffffffffff13ULL,
+	0xffffffffffffff1dULL, 0xffffffffffffff26ULL, 0xffffffffffffff2eULL, 0xffffffffffffff36ULL,
+	0xffffffffffffff3eULL, 0xffffffffffffff46ULL, 0xffffffffffffff4dULL, 0xffffffffffffff54ULL,
+	0xffffffffffffff5bULL, 0xffffffffffffff62ULL, 0xffffffffffffff68ULL, 0xffffffffffffff6eULL,
+	0xffffffffffffff74ULL, 0xffffffffffffff79ULL, 0xffffffffffffff7fULL, 0xffffffffffffff84ULL,
+	0xffffffffffffff89ULL, 0xffffffffffffff8dULL, 0xffffffffffffff92ULL, 0xffffffffffffff96ULL,
+	0xffffffffffffff9aULL, 0xffffffffffffff9eULL, 0xffffffffffffffa2ULL, 0xffffffffffffffa6ULL,
+	0xffffffffffffffaaULL, 0xffffffffffffffadULL, 0xffffffffffffffb0ULL, 0xffffffffffffffb3ULL,
+	0xffffffffffffffb6ULL, 0xffffffffffffffb9ULL, 0xffffffffffffffbcULL, 0xffffffffffffffbfULL,
+	0xffffffffffffffc1ULL, 0xffffffffffffffc4ULL, 0xffffffffffffffc6ULL, 0xffffffffffffffc9ULL,
+	0xffffffffffffffcbULL, 0xffffffffffffffcdULL, 0xffffffffffffffcfULL, 0xffffffffffffffd1ULL,
+	0xffffffffffffffd3ULL, 0xffffffffffffffd5ULL, 0xffffffffffffffd6ULL, 0xffffffffffffffd8ULL,
+	0xffffffffffffffdaULL, 0xffffffffffffffdbULL, 0xffffffffffffffddULL, 0xffffffffffffffdeULL,
+	0xffffffffffffffdfULL, 0xffffffffffffffe1ULL, 0xffffffffffffffe2ULL, 0xffffffffffffffe3ULL,
+	0xffffffffffffffe4ULL, 0xffffffffffffffe5ULL, 0xffffffffffffffe6ULL, 0xffffffffffffffe7ULL,
+	0xffffffffffffffe8ULL, 0xffffffffffffffe9ULL, 0xffffffffffffffeaULL, 0xffffffffffffffebULL,
+	0xffffffffffffffecULL, 0xffffffffffffffedULL, 0xffffffffffffffedULL, 0xffffffffffffffeeULL,
+	0xffffffffffffffefULL, 0xfffffffffffffff0ULL, 0xfffffffffffffff0ULL, 0xfffffffffffffff1ULL,
+	0xfffffffffffffff1ULL, 0xfffffffffffffff2ULL, 0xfffffffffffffff3ULL, 0xfffffffffffffff3ULL,
+	0xfffffffffffffff4ULL, 0xfffffffffffffff4ULL, 0xfffffffffffffff5ULL, 0xfffffffffffffff5ULL,
+	0xfffffffffffffff5ULL, 0xfffffffffffffff6ULL, 0xfffffffffffffff6ULL, 0xfffffffffffffff7ULL,
+	0xfffffffffffffff7ULL, 0xfffffffffffffff7ULL, 0xfffffffffffffff8ULL, 0xfffffffffffffff8ULL,
+	0xfffffffffffffff8ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL,
+	0xfffffffffffffff9ULL, 0xfffffffffffffffaULL, 0xfffffffffffffffaULL, 0xfffffffffffffffaULL,
+	0xfffffffffffffffaULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL,
+	0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL,
+	0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL,
+	0xfffffffffffffffcULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+};
+
+static const uint16_t cdt_guide_bliss_215[257] = {
+	   0,    1,    2,    3,    4,    5,    6,    7,    8,   10,   11,   12,   13,   14,   15,   16,
+	  17,   18,   19,   20,   21,   22,   23,   24,   25,   26,   28,   29,   30,   31,   32,   33,
+	  34,   35,   36,   37,   38,   39,   40,   41,   43,   44,   45,   46,   47,   48,   49,   50,
+	  51,   52,   53,   54,   56,   57,   58,   59,   60,   61,   62,   63,   64,   65,   67,   68,
+	  69,   70,   71,   72,   73,   74,   75,   77,   78,   79,   80,   81,   82,   83,   84,   86,
+	  87,   88,   89,   90,   91,   93,   94,   95,   96,   97,   98,  100,  101,  102,  103,  104,
+	 105,  107,  108,  109,  110,  111,  113,  114,  115,  116,  118,  119,  120,  121,  122,  124,
+	 125,  126,  127,  129,  130,  131,  133,  134,  135,  136,  138,  139,  140,  142,  143,  144,
+	 146,  147,  148,  150,  151,  152,  154,  155,  156,  158,  159,  160,  162,  163,  165,  166,
+	 167,  169,  170,  172,  173,  175,  176,  178,  179,  181,  182,  184,  185,  187,  188,  190,
+	 191,  193,  195,  196,  198,  199,  201,  203,  204,  206,  208,  209,  211,  213,  214,  216,
+	 218,  220,  221,  223,  225,  227,  229,  231,  232,  234,  236,  238,  240,  242,  244,  246,
+	 248,  250,  252,  254,  257,  259,  261,  263,  265,  268,  270,  272,  275,  277,  279,  282,
+	 284,  287,  289,  292,  295,  297,  300,  303,  306,  309,  312,  315,  318,  321,  324,  328,
+	 331,  334,  338,  342,  345,  349,  353,  357,  362,  366,  370,  375,  380,  385,  390,  396,
+	 402,  408,  414,  421,  429,  437,  445,  454,  465,  476,  489,  504,  522,  544,  574,  623,
+	1975,
+};
+
+#define CDT_107_SIZE 980
+
+static const uint64_t cdt_bliss_107[CDT_107_SIZE] = {
+	0x00f4503700ab2f25ULL, 0x02dceb2eed8c57d2ULL, 0x04c575c4facea857ULL, 0x06ade50e76805dd7ULL,
+	0x08962e22833f3ec5ULL, 0x0a7e461ad35be8efULL, 0x0c66221463b3de18ULL, 0x0e4db730362d748fULL,
+	0x1034fa940bc0e007ULL, 0x121be16b1df998e5ULL, 0x140260e6d7db7d51ULL, 0x15e86e3f8e171ff7ULL,
+	0x17cdfeb53678d3b7ULL, 0x19b307901e7e229aULL, 0x1b977e21a0fd800bULL, 0x1d7b57c4dacc2b92ULL,
+	0x1f5e89df5e4e6166ULL, 0x214109e1e5de2150ULL, 0x2322cd4904f502c7ULL, 0x2503c99dd805be33ULL,
+	0x26e3f476b2f247a1ULL, 0x28c34377ce0b8e41ULL, 0x2aa1ac53f1882df8ULL, 0x2c7f24cd1f5f9d36ULL,
+	0x2e5ba2b53b77a0c5ULL, 0x30371beeb212119eULL, 0x3211866d1c6945d4ULL, 0x33ead835e369b542ULL,
+	0x35c30760e077bcdaULL, 0x379a0a18fc30b035ULL, 0x396fd69ccb16b80bULL, 0x3b44633f28174e01ULL,
+	0x3d17a667ccdc79ddULL, 0x3ee99693e7d94a94ULL, 0x40ba2a56b0025dc9ULL, 0x42895859f623a300ULL,
+	0x4457175eb3c4e42cULL, 0x46235e3d978efbf0ULL, 0x47ee23e78f240236ULL, 0x49b75f664e5d1a3dULL,
+	0x4b7f07dcd3e0f12fULL, 0x4d451487eb066228ULL, 0x4f097cbeaaf71c0dULL, 0x50cc37f2f3068e64ULL,
+	0x528d3db1e431cce3ULL, 0x544c85a457bd853cULL, 0x560a078f52e78fafULL, 0x57c5bb5477a21154ULL,
+	0x597f98f2724e968eULL, 0x5b379885646ffc97ULL, 0x5cedb2474c4a7293ULL, 0x5ea1de9069694d1cULL,
+	0x605415d79e02da62ULL, 0x620450b2cd32d8edULL, 0x63b287d73604a7afULL, 0x655eb419cb46bb4bULL,
+	0x6708ce6f882159f8ULL, 0x68b0cfedc16b159cULL, 0x6a56b1ca73b5f1e9ULL, 0x6bfa6d5c8e109aefULL,
+	0x6d9bfc1c3977874dULL, 0x6f3b57a31cf257dbULL, 0x70d879ac9e5a3d7cULL, 0x72735c161fc6a44eULL,
+	0x740bf8df399dda04ULL, 0x75a24a29f147db30ULL, 0x77364a3aec81e94aULL, 0x78c7f379a152006dULL,
+	0x7a5740708299b8dbULL, 0x7be42bcd29489460ULL, 0x7d6eb0607a2e2b91ULL, 0x7ef6c91ec86d217dULL,
+	0x807c711ff49036a3ULL, 0x81ffa39f8843450fULL, 0x83805bfcceb25fbeULL, 0x84fe95bae991be70ULL,
+	0x867a4c80e2d18d48ULL, 0x87f37c19bb01243cULL, 0x896a207474659620ULL, 0x8ade35a41ac7f13cULL,
+	0x8c4fb7dfc7fff464ULL, 0x8dbea382a54062d8ULL, 0x8f2af50be92a874fULL, 0x9094a91ed2aedacfULL,
+	0x91fbbc82a0c126d0ULL, 0x93602c2286e6db17ULL, 0x94c1f50d9ea6af3cULL, 0x96211476d5e10524ULL,
+	0x977d87b4da18dd85ULL, 0x98d74c4200b5895aULL, 0x9a2e5fbc2c459ae8ULL, 0x9b82bfe4aecbeeedULL,
+	0x9cd46aa0291ffa5bULL, 0x9e235df6676adab9ULL, 0x9f6f98123acaf6e9ULL, 0xa0b9174150284b80ULL,
+	0xa1ffd9f40443c93bULL, 0xa343debd350c7505ULL, 0xa485245210453fd4ULL, 0xa5c3a989df86d140ULL,
+	0xa6ff6d5dd1a8c19dULL, 0xa8386ee8c19e0082ULL, 0xa96ead66fad061caULL, 0xaaa22835fb078673ULL,
+	0xabd2ded431e78f23ULL, 0xad00d0e0be143c70ULL, 0xae2bfe1b280554cdULL, 0xaf5466631a995922ULL,
+	0xb07a09b81973c01cULL, 0xb19ce83935341c5dULL, 0xb2bd0224bd93bbb3ULL, 0xb3da57d7f17774c1ULL,
+	0xb4f4e9cead037d49ULL, 0xb60cb8a315bf45c8ULL, 0xb721c50d44d776a9ULL, 0xb8340fe2ef8c48ceULL,
+	0xb9439a170dda8dfaULL, 0xba5064b97f6dd5dfULL, 0xbb5a70f6aeea3284ULL, 0xbc61c017339c31fdULL,
+	0xbd66537f719db46cULL, 0xbe682caf387e5384ULL, 0xbf674d41607e1d06ULL, 0xc063b6eb66696afeULL,
+	0xc15d6b7d0624abefULL, 0xc2546cdfd3f6f1caULL, 0xc348bd16d4a220f0ULL, 0xc43a5e3e145798baULL,
+	0xc529528a3c982cb2ULL, 0xc6159c48290e4129ULL, 0xc6ff3ddc7b70d717ULL, 0xc7e639c32e7e4a46ULL,
+	0xc8ca928f281d7979ULL, 0xc9ac4ae9cab40300ULL, 0xca8b659285c030afULL, 0xcb67e55e65c51c8aULL,
+	0xcc41cd37a39783ebULL, 0xcd19201d3319a924ULL, 0xcdede12251748c20ULL, 0xcec0136e12dca8c6ULL,
+	0xcf8fba3aeff04e8aULL, 0xd05cd8d652bd871dULL, 0xd12772a0237d631aULL, 0xd1ef8b0a55126291ULL,
+	0xd2b5259871578c9dULL, 0xd37845df254da4e1ULL, 0xd438ef83cd33c7beULL, 0xd4f7263c00988e80ULL,
+	0xd5b2edcd1e70b38bULL, 0xd66c4a0bd9400405ULL, 0xd7233edbc361404bULL, 0xd7d7d02edb795f0bULL,
+	0xd88a020519227801ULL, 0xd939d86bf9da6b28ULL, 0xd9e7577e0e4127d8ULL, 0xda92836287b244a4ULL,
+	0xdb3b604cc6456506ULL, 0xdbe1f27be740b521ULL, 0xdc863e3a54088de0ULL, 0xdd2847dd51971ce7ULL,
+	0xddc813c49086b3faULL, 0xde65a659bdb92aa0ULL, 0xdf01041013a6835dULL, 0xdf9a3163ec5ccb72ULL,
+	0xe03132da543af0e6ULL, 0xe0c60d009d700eecULL, 0xe158c46bf4487447ULL, 0xe1e95db8f4516a2fULL,
+	0xe277dd8b3e5c84dfULL, 0xe304488d0f6b08baULL, 0xe38ea36ed889b0a3ULL, 0xe416f2e6d7a4e337ULL,
+	0xe49d3bb0b15d2574ULL, 0xe521828d0be359c8ULL, 0xe5a3cc412ae41b00ULL, 0xe6241d968c89425aULL,
+	0xe6a27b5a8798684eULL, 0xe71eea5deab4ef1eULL, 0xe7996f749ccbe665ULL, 0xe8120f753eafd65fULL,
+	0xe888cf38cdea41aeULL, 0xe8fdb39a48c86c2eULL, 0xe970c17653a8b582ULL, 0xe9e1fdaadf8d9645ULL,
+	0xea516d16d1fb0f0fULL, 0xeabf1499ae231962ULL, 0xeb2af9133f656b5eULL, 0xeb951f634526a072ULL,
+	0xebfd8c6920029af9ULL, 0xec644503805db4aeULL, 0xecc94e1016581664ULL, 0xed2cac6b43265284ULL,
+	0xed8e64efcbd22134ULL, 0xedee7c768d65e11dULL, 0xee4cf7d632854470ULL, 0xeea9dbe2ea7556f6ULL,
+	0xef052d6e2195cfd9ULL, 0xef5ef1463b4d6859ULL, 0xefb72c364d6ab7eeULL, 0xf00de305dcfade26ULL,
+	0xf0631a789c970b78ULL, 0xf0b6d74e2c29c390ULL, 0xf1091e41da2c7e04ULL, 0xf159f40a665e1570ULL,
+	0xf1a95d59c5f240f4ULL, 0xf1f75edce93a20d5ULL, 0xf243fd3b82c5b4d6ULL, 0xf28f3d17cffde168ULL,
+	0xf2d9230e63367859ULL, 0xf321b3b5ef378a51ULL, 0xf368f39f143d17a9ULL, 0xf3aee7542e6c09c9ULL,
+	0xf3f3935925bb3188ULL, 0xf436fc2b3f4edb87ULL, 0xf4792640f04560deULL, 0xf4ba1609b1f2f100ULL,
+	0xf4f9cfedd78aa92bULL, 0xf538584e6532e63eULL, 0xf575b384e8829789ULL, 0xf5b1e5e35265339bULL,
+	0xf5ecf3b3d262cc06ULL, 0xf626e138b34999afULL, 0xf65fb2ac39363934ULL, 0xf6976c4080f7add9ULL,
+	0xf6ce121f60cc2178ULL, 0xf703a86a4a73390bULL, 0xf738333a2e92b793ULL, 0xf76bb69f616a0c5dULL,
+	0xf79e36a180d14e21ULL, 0xf7cfb73f5b8009a8ULL, 0xf8003c6ed9983171ULL, 0xf82fca1ce6716321ULL,
+	0xf85e642d5ba0a058ULL, 0xf88c0e7aed388227ULL, 0xf8b8ccd7173dd93cULL, 0xf8e4a30a0c4c9890ULL,
+	0xf90f94d2a568d559ULL, 0xf939a5e652f794e5ULL, 0xf962d9f10edb0fe1ULL, 0xf98b34954fae029cULL,
+	0xf9b2b96bfd1992bbULL, 0xf9d96c04654144cdULL, 0xf9ff4fe433406f28ULL, 0xfa24688766b48b5cULL,
+	0xfa48b9604c4fbc77ULL, 0xfa6c45d7776ed627ULL, 0xfa8f114bbcae2793ULL, 0xfab11f122d784480ULL,
+	0xfad272761489ffefULL, 0xfaf30eb8f366c4efULL, 0xfb12f71280b874c3ULL, 0xfb322eb0a795eccaULL,
+	0xfb50b8b787ab52afULL, 0xfb6e9841763f426dULL, 0xfb8bd05f000ff77aULL, 0xfba86416ec0388faULL,
+	0xfbc456663ea6505eULL, 0xfbdfaa403e7291d3ULL, 0xfbfa628e78dc7efeULL, 0xfc148230c81dae06ULL,
+	0xfc2e0bfd59bb2161ULL, 0xfc4702c0b5c0fff2ULL, 0xfc5f693dc6af20b7ULL, 0xfc77422de21191d2ULL,
+	0xfc8e9040d1c047b7ULL, 0xfca5561cddc1270aULL, 0xfcbb965ed6c7a214ULL, 0xfcd1539a214d299bULL,
+	0xfce69058c13db865ULL, 0xfcfb4f1b6633c8d9ULL, 0xfd0f9259783f0c9fULL, 0xfd235c8125314777ULL,
+	0xfd36aff76e6cb7eaULL, 0xfd498f18372f82bfULL, 0xfd5bfc365357a09fULL, 0xfd6df99b969ad85bULL,
+	0xfd7f8988e42e5bc7ULL, 0xfd90ae363ed9a8e9ULL, 0xfda169d2d9705da5ULL, 0xfdb1be8527aeb882ULL,
+	0xfdc1ae6aef748e4eULL, 0xfdd13b995a5a89abULL, 0xfde0681d079d9749ULL, 0xfdef35fa1e5c6f71ULL,
+	0xfdfda72c60233beeULL, 0xfe0bbda73bc167c2ULL, 0xfe197b55e065b50fULL, 0xfe26e21b50fcc476ULL,
+	0xfe33f3d277ce4898ULL, 0xfe40b24e3a552fbaULL, 0xfe4d1f598d4f1d5eULL, 0xfe593cb788ff9d4fULL,
+	0xfe650c237da389baULL, 0xfe708f5108112e04ULL, 0xfe7bc7ec2681c064ULL, 0xfe86b7994d80dc8fULL,
+	0xfe915ff57cfeba62ULL, 0xfe9bc2965581ebf8ULL, 0xfea5e10a2d757f41ULL, 0xfeafbcd826906ffdULL,
+	0xfeb9578043536797ULL, 0xfec2b27b7c99d96aULL, 0xfecbcf3bd73b9a7bULL, 0xfed4af2c79bc24deULL,
+	0xfedd53b1c204c793ULL, 0xfee5be295b271492ULL, 0xfeedefea5324ef93ULL, 0xfef5ea4530bbb0cfULL,
+	0xfefdae84092fdfbcULL, 0xff053dea96171a6bULL, 0xff0c99b64b1dcec4ULL, 0xff13c31e6bc67b74ULL,
+	0xff1abb5421203eb1ULL, 0xff2183828f72896aULL, 0xff281cceebdbddb3ULL, 0xff2e885891e18f4fULL,
+	0xff34c73918ee8d49ULL, 0xff3ada8469bf4b79ULL, 0xff40c348d3b8f268ULL, 0xff46828f222a0be1ULL,
+	0xff4c195ab172f1b1ULL, 0xff5188a984145392ULL, 0xff56d17457a23857ULL, 0xff5bf4aeb999ed4dULL,
+	0xff60f3471c1965c3ULL, 0xff65ce26ea769b18ULL, 0xff6a86329db58c43ULL, 0xff6f1c49d0db89f5ULL,
+	0xff739147551e8a7eULL, 0xff77e60145ef4e9eULL, 0xff7c1b491cdd2dd2ULL, 0xff8031ebc5526e6eULL,
+	0xff842ab1b0281ad1ULL, 0xff88065ee7105227ULL, 0xff8bc5b31fd62005ULL, 0xff8f6969cf71f2a8ULL,
+	0xff92f23a3cf1d41cULL, 0xff9660d7943496a2ULL, 0xff99b5f0f87730b2ULL, 0xff9cf23196b39088ULL,
+	0xffa01640b7d03ad5ULL, 0xffa322c1d2a01336ULL, 0xffa618549db1b844ULL, 0xffa8f79520ede7c4ULL,
+	0xffabc11bc7046a0eULL, 0xffae757d6ea70e1dULL, 0xffb1154b7b9249c3ULL, 0xffb3a113e7631b6eULL,
+	0xffb619615239d470ULL, 0xffb87ebb13297c37ULL, 0xffbad1a548738607ULL, 0xffbd12a0e78f9ba6ULL,
+	0xffbf422bccff483dULL, 0xffc160c0cbed5708ULL, 0xffc36ed7bd98c1c6ULL, 0xffc56ce5908b12d5ULL,
+	0xffc75b5c579a26a7ULL, 0xffc93aab58b53feeULL, 0xffcb0b3f1b7d6901ULL, 0xffcccd8177a92457ULL,
+	0xffce81d9a33374a8ULL, 0xffd028ac40564c1dULL, 0xffd1c25b6b50784dULL, 0xffd34f46c7f72728ULL,
+	0xffd4cfcb8f1326ecULL, 0xffd644449b8a090dULL, 0xffd7ad0a775355b6ULL, 0xffd90a73683a02e8ULL,
+	0xffda5cd37c6a6770ULL, 0xffdba47c96cce703ULL, 0xffdce1be7b2d99a2ULL, 0xffde14e6da31350cULL,
+	0xffdf3e415d178371ULL, 0xffe05e17b14bb6edULL, 0xffe174b193c2ed5bULL, 0xffe28254dc293c03ULL,
+	0xffe3874587dd9e52ULL, 0xffe483c5c4bd2665ULL, 0xffe57815fbbdd194ULL, 0xffe66474db59664dULL,
+	0xffe7491f61c8c3b2ULL, 0xffe82650e7100e4eULL, 0xffe8fc4326dc27daULL, 0xffe9cb2e4a31e2b9ULL,
+	0xffea9348f0ef6431ULL, 0xffeb54c83b202ab1ULL, 0xffec0fdfd2242f89ULL, 0xffecc4c1f1aa9d91ULL,
+	0xffed739f708097fcULL, 0xffee1ca7c9348e4bULL, 0xffeec009228e9c0aULL, 0xffef5df057de743dULL,
+	0xffeff689011f59f3ULL, 0xfff089fd7af2a87cULL, 0xfff11876ee716eefULL, 0xfff1a21d58d5a39bULL,
+	0xfff2271792fb74d6ULL, 0xfff2a78b58bb3d73ULL, 0xfff3239d501ca3aeULL, 0xfff39b7110636a00ULL,
+	0xfff40f2928f679acULL, 0xfff47ee72821af48ULL, 0xfff4eacba1b2f19aULL, 0xfff552f635731b84ULL,
+	0xfff5b785957b4192ULL, 0xfff618978c66dbe4ULL, 0xfff6764903635d08ULL, 0xfff6d0b6081dbe1cULL,
+	0xfff727f9d28e887eULL, 0xfff77c2ecaa4e4baULL, 0xfff7cd6e8dd13646ULL, 0xfff81bd1f46fcafcULL,
+	0xfff86771171424c8ULL, 0xfff8b06353b56363ULL, 0xfff8f6bf52bc536dULL, 0xfff93a9b0bf3a749ULL,
+	0xfff97c0bcb5adda2ULL, 0xfff9bb2635dc5876ULL, 0xfff9f7fe4de726c4ULL, 0xfffa32a777ed021bULL,
+	0xfffa6b347ec50032ULL, 0xfffaa1b797f377d6ULL, 0xfffad64267d79754ULL, 0xfffb08e605bf2996ULL,
+	0xfffb39b2ffe105d7ULL, 0xfffb68b95f3ea4f0ULL, 0xfffb9608ab6d55d0ULL, 0xfffbc1afee4789b5ULL,
+	0xfffbebbdb786af56ULL, 0xfffc1440204612f9ULL, 0xfffc3b44ce6f383cULL, 0xfffc60d8f81020d4ULL,
+	0xfffc8509669bf26eULL, 0xfffca7e27a166c55ULL, 0xfffcc9702c2a9c3aULL, 0xfffce9be132d400aULL,
+	0xfffd08d7650b4169ULL, 0xfffd26c6fa24b5eeULL, 0xfffd43975014cdd8ULL, 0xfffd5f528c671980ULL,
+	0xfffd7a027f3a8c65ULL, 0xfffd93b0a5d2a32cULL, 0xfffdac662d171081ULL, 0xfffdc42bf4025359ULL,
+	0xfffddb0a8dff9780ULL, 0xfffdf10a45384010ULL, 0xfffe06331cd179c8ULL, 0xfffe1a8cd31a31edULL,
+	0xfffe2e1ee3a9ccbcULL, 0xfffe40f0896ff528ULL, 0xfffe5308c0b5ddf5ULL, 0xfffe646e49114afeULL,
+	0xfffe7527a749b7d9ULL, 0xfffe853b272fef9eULL, 0xfffe94aedd68683cULL, 0xfffea388a928b232ULL,
+	0xfffeb1ce35e84c25ULL, 0xfffebf84fd052868ULL, 0xfffeccb2475c3107ULL, 0xfffed95b2ed61597ULL,
+	0xfffee5849fe8ac92ULL, 0xfffef1335b0d30afULL, 0xfffefc6bf62ba141ULL, 0xffff0732ddfb8b51ULL,
+	0xffff118c575a7fbaULL, 0xffff1b7c8098794cULL, 0xffff250752ba74a1ULL, 0xffff2e30a2b379f0ULL,
+	0xffff36fc229457f1ULL, 0xffff3f6d62b24d8fULL, 0xffff4787d2c4dee1ULL, 0xffff4f4ec2fb10aaULL,
+	0xffff56c56508444aULL, 0xffff5deecd28ecf7ULL, 0xffff64cdf31f55a9ULL, 0xffff6b65b328ae2dULL,
+	0xffff71b8ceea9472ULL, 0xffff77c9ee594e17ULL, 0xffff7d9ba096e50eULL, 0xffff83305ccb590bULL,
+	0xffff888a82f61652ULL, 0xffff8dac5cb8e168ULL, 0xffff92981e1c6608ULL, 0xffff974fe64e96bbULL,
+	0xffff9bd5c05b0950ULL, 0xffffa02ba3dd7b84ULL, 0xffffa45375aeaa0eULL, 0xffffa84f088ba34aULL,
+	0xffffac201db7bdcfULL, 0xffffafc865995a26ULL, 0xffffb34980519612ULL, 0xffffb6a4fe4f16b3ULL,
+	0xffffb9dc60dc0e1cULL, 0xffffbcf11aa79fddULL, 0xffffbfe4904ac73bULL, 0xffffc2b818c8e0f3ULL,
+	0xffffc56cfe0bf976ULL, 0xffffc8047d5cffcbULL, 0xffffca7fc7d7fc6dULL, 0xffffcce002dc6a9eULL,
+	0xffffcf264879d201ULL, 0xffffd153a7d8bd57ULL, 0xffffd36925a02aacULL, 0xffffd567bc57905dULL,
+	0xffffd7505cc591b3ULL, 0xffffd923ee4b7d2cULL, 0xffffdae34f3dadacULL, 0xffffdc8f5538e759ULL,
+	0xffffde28cd74c807ULL, 0xffffdfb07d136298ULL, 0xffffe127216e1bfcULL, 0xffffe28d705fdfe8ULL,
+	0xffffe3e4188cc2b1ULL, 0xffffe52bc1a72531ULL, 0xffffe6650cb26efdULL, 0xffffe790944372a1ULL,
+	0xffffe8aeecbe8f0aULL, 0xffffe9c0a493a0b7ULL, 0xffffeac64477d4d2ULL, 0xffffebc04f9d6fb6ULL,
+	0xffffecaf43e997f7ULL, 0xffffed939a283675ULL, 0xffffee6dc63dfb9dULL, 0xffffef3e37589969ULL,
+	0xfffff005581d4148ULL, 0xfffff0c38ed574adULL, 0xfffff1793d9a3679ULL, 0xfffff226c27dab2aULL,
+	0xfffff2cc77b33536ULL, 0xfffff36ab3b61a96ULL, 0xfffff401c96ec02aULL, 0xfffff4920856872fULL,
+	0xfffff51bbc9a58b4ULL, 0xfffff59f2f3bea7fULL, 0xfffff61ca631c89fULL, 0xfffff69464862e72ULL,
+	0xfffff706aa74b98eULL, 0xfffff773b58700d6ULL, 0xfffff7dbc0b01967ULL, 0xfffff83f04671307ULL,
+	0xfffff89db6c0753cULL, 0xfffff8f80b86c5feULL, 0xfffff94e345222b0ULL, 0xfffff9a0609ef3bdULL,
+	0xfffff9eebde3c2eaULL, 0xfffffa3977a63c49ULL, 0xfffffa80b78f614eULL, 0xfffffac4a57ef572ULL,
+	0xfffffb05679e2b6cULL, 0xfffffb43227199f0ULL, 0xfffffb7df8ea7e8aULL, 0xfffffbb60c775514ULL,
+	0xfffffbeb7d13c9e8ULL, 0xfffffc1e69580ce3ULL, 0xfffffc4eee878afbULL, 0xfffffc7d289f140fULL,
+	0xfffffca932627254ULL, 0xfffffcd32569789dULL, 0xfffffcfb1a2c8c99ULL, 0xfffffd212810b1ddULL,
+	0xfffffd4565731a7fULL, 0xfffffd67e7b441c7ULL, 0xfffffd88c3429564ULL, 0xfffffda80ba4b16aULL,
+	0xfffffdc5d383332cULL, 0xfffffde22cb226e4ULL, 0xfffffdfd283a1413ULL, 0xfffffe16d660ac2aULL,
+	0xfffffe2f46b11f28ULL, 0xfffffe468804198fULL, 0xfffffe5ca8876ef7ULL, 0xfffffe71b5c5748eULL,
+	0xfffffe85bcac0e7aULL, 0xfffffe98c993732fULL, 0xfffffeaae844a780ULL, 0xfffffebc23ffb649ULL,
+	0xfffffecc8781a645ULL, 0xfffffedc1d0a30a7ULL, 0xfffffeeaee613af9ULL, 0xfffffef904dc1697ULL,
+	0xffffff0669628818ULL, 0xffffff13247398d6ULL, 0xffffff1f3e2a34c4ULL, 0xffffff2abe419687ULL,
+	0xffffff35ac1983e6ULL, 0xffffff400eba5c69ULL, 0xffffff49ecd8fbfbULL, 0xffffff534cda7356ULL,
+	0xffffff5c34d797f7ULL, 0xffffff64aaa06d1eULL, 0xffffff6cb3bf6790ULL, 0xffffff74557c8d7fULL,
+	0xffffff7b94e07423ULL, 0xffffff8276b71c5fULL, 0xffffff88ff92afc8ULL, 0xffffff8f33ce1f62ULL,
+	0xffffff95178fa54dULL, 0xffffff9aaecb2a90ULL, 0xffffff9ffd449233ULL, 0xffffffa50691eab7ULL,
+	0xffffffa9ce1d8700ULL, 0xffffffae5727ffc0ULL, 0xffffffb2a4ca1e4cULL, 0xffffffb6b9f6b1dcULL,
+	0xffffffba997c5013ULL, 0xffffffbe460701b6ULL, 0xffffffc1c221dc63ULL, 0xffffffc510388a12ULL,
+	0xffffffc83298bf2eULL, 0xffffffcb2b739ffbULL, 0xffffffcdfcdf1606ULL, 0xffffffd0a8d71640ULL,
+	0xffffffd3313ed882ULL, 0xffffffd597e200feULL, 0xffffffd7de75bc55ULL, 0xffffffda0699cecaULL,
+	0xffffffdc11d99732ULL, 0xffffffde01ad0627ULL, 0xffffffdfd77989f6ULL, 0xffffffe19492efd0ULL,
+	0xffffffe33a3c3ab1ULL, 0xffffffe4c9a87071ULL, 0xffffffe643fb5d6dULL, 0xffffffe7aa4a4f31ULL,
+	0xffffffe8fd9cc689ULL, 0xffffffea3eed2157ULL, 0xffffffeb6f293c99ULL, 0xffffffec8f330edaULL,
+	0xffffffed9fe13b87ULL, 0xffffffeea1ff9f61ULL, 0xffffffef964fd662ULL, 0xfffffff07d89bb60ULL,
+	0xfffffff1585be1baULL, 0xfffffff2276c0949ULL, 0xfffffff2eb578ce1ULL, 0xfffffff3a4b3cb9cULL,
+	0xfffffff4540e8d2cULL, 0xfffffff4f9ee616dULL, 0xfffffff596d2fb74ULL, 0xfffffff62b358842ULL,
+	0xfffffff6b789015dULL, 0xfffffff73c3a7b79ULL, 0xfffffff7b9b17157ULL, 0xfffffff830500b19ULL,
+	0xfffffff8a0736220ULL, 0xfffffff90a73c1afULL, 0xfffffff96ea4e467ULL, 0xfffffff9cd562ed5ULL,
+	0xfffffffa26d2e729ULL, 0xfffffffa7b626a33ULL, 0xfffffffacb485dd2ULL, 0xfffffffb16c4e0f5ULL,
+	0xfffffffb5e14b939ULL, 0xfffffffba1717e56ULL, 0xfffffffbe111c366ULL, 0xfffffffc1d293e2cULL,
+	0xfffffffc55e8ec67ULL, 0xfffffffc8b7f3750ULL, 0xfffffffcbe18155fULL, 0xfffffffceddd2a5aULL,
+	0xfffffffd1af5e5d3ULL, 0xfffffffd4587a026ULL, 0xfffffffd6db5b601ULL, 0xfffffffd93a1a28dULL,
+	0xfffffffdb76b1851ULL, 0xfffffffdd93018c9ULL, 0xfffffffdf90d0adcULL, 0xfffffffe171cd029ULL,
+	0xfffffffe3378d946ULL, 0xfffffffe4e3938faULL, 0xfffffffe6774b679ULL, 0xfffffffe7f40debeULL,
+	0xfffffffe95b214fbULL, 0xfffffffeaadba239ULL, 0xfffffffebecfc42aULL, 0xfffffffed19fbb3eULL,
+	0xfffffffee35bd7f6ULL, 0xfffffffef4138797ULL, 0xffffffff03d5602cULL, 0xffffffff12af2becULL,
+	0xffffffff20adf410ULL, 0xffffffff2dde0b0fULL, 0xffffffff3a4b1662ULL, 0xffffffff460017b8ULL,
+	0xffffffff510775baULL, 0xffffffff5b6b0457ULL, 0xffffffff65340c9fULL, 0xffffffff6e6b543cULL,
+	0xffffffff77192483ULL, 0xffffffff7f455124ULL, 0xffffffff86f73e8aULL, 0xffffffff8e35e7d6ULL,
+	0xffffffff9507e49cULL, 0xffffffff9b736e42ULL, 0xffffffffa17e6523ULL, 0xffffffffa72e5564ULL,
+	0xffffffffac887b8fULL, 0xffffffffb191c8e7ULL, 0xffffffffb64ee78bULL, 0xffffffffbac43e58ULL,
+	0xffffffffbef5f49bULL, 0xffffffffc2e7f58eULL, 0xffffffffc69df3abULL, 0xffffffffca1b6bc6ULL,
+	0xffffffffcd63a80bULL, 0xffffffffd079c2c5ULL, 0xffffffffd360a908ULL, 0xffffffffd61b1d36ULL,
+	0xffffffffd8abb958ULL, 0xffffffffdb14f163ULL, 0xffffffffdd591554ULL, 0xffffffffdf7a5334ULL,
+	0xffffffffe17ab8feULL, 0xffffffffe35c366aULL, 0xffffffffe5209ea0ULL, 0xffffffffe6c9a9d6ULL,
+	0xffffffffe858f6ccULL, 0xffffffffe9d00c47ULL, 0xffffffffeb305a62ULL, 0xffffffffec7b3bdbULL,
+	0xffffffffedb1f748ULL, 0xffffffffeed5c03aULL, 0xffffffffefe7b856ULL, 0xfffffffff0e8f054ULL,
+	0xfffffffff1da68fcULL, 0xfffffffff2bd140bULL, 0xfffffffff391d510ULL, 0xfffffffff459823eULL,
+	0xfffffffff514e52cULL, 0xfffffffff5c4bb92ULL, 0xfffffffff669b7f9ULL, 0xfffffffff704825bULL,
+	0xfffffffff795b8c2ULL, 0xfffffffff81defdcULL, 0xfffffffff89db383ULL, 0xfffffffff9158743ULL,
+	0xfffffffff985e6d4ULL, 0xfffffffff9ef468cULL, 0xfffffffffa5213d4ULL, 0xfffffffffaaeb585ULL,
+	0xfffffffffb058c57ULL, 0xfffffffffb56f330ULL, 0xfffffffffba33f85ULL, 0xfffffffffbeac1a5ULL,
+	0xfffffffffc2dc50dULL, 0xfffffffffc6c90abULL, 0xfffffffffca76724ULL, 0xfffffffffcde8717ULL,
+	0xfffffffffd122b58ULL, 0xfffffffffd428b2aULL, 0xfffffffffd6fda77ULL, 0xfffffffffd9a49fdULL,
+	0xfffffffffdc20786ULL, 0xfffffffffde73e0fULL, 0xfffffffffe0a15f8ULL, 0xfffffffffe2ab525ULL,
+	0xfffffffffe493f2cULL, 0xfffffffffe65d572ULL, 0xfffffffffe809751ULL, 0xfffffffffe99a233ULL,
+	0xfffffffffeb111b5ULL, 0xfffffffffec6ffbfULL, 0xfffffffffedb84a0ULL, 0xfffffffffeeeb726ULL,
+	0xffffffffff00acb6ULL, 0xffffffffff117960ULL, 0xffffffffff212ff7ULL, 0xffffffffff2fe222ULL,
+	0xffffffffff3da06eULL, 0xffffffffff4a7a60ULL, 0xffffffffff567e86ULL, 0xffffffffff61ba85ULL,
+	0xffffffffff6c3b26ULL, 0xffffffffff760c65ULL, 0xffffffffff7f3980ULL, 0xffffffffff87ccfdULL,
+	0xffffffffff8fd0baULL, 0xffffffffff974df6ULL, 0xffffffffff9e4d5aULL, 0xffffffffffa4d704ULL,
+	0xffffffffffaaf28cULL, 0xffffffffffb0a712ULL, 0xffffffffffb5fb40ULL, 0xffffffffffbaf555ULL,
+	0xffffffffffbf9b29ULL, 0xffffffffffc3f236ULL, 0xffffffffffc7ff9dULL, 0xffffffffffcbc829ULL,
+	0xffffffffffcf5057ULL, 0xffffffffffd29c5dULL, 0xffffffffffd5b029ULL, 0xffffffffffd88f69ULL,
+	0xffffffffffdb3d90ULL, 0xffffffffffddbdd7ULL, 0xffffffffffe01341ULL, 0xffffffffffe240a0ULL,
+	0xffffffffffe44898ULL, 0xffffffffffe62da1ULL, 0xffffffffffe7f209ULL, 0xffffffffffe997f9ULL,
+	0xffffffffffeb2176ULL, 0xffffffffffec9061ULL, 0xffffffffffede680ULL, 0xffffffffffef2577ULL,
+	0xfffffffffff04ed2ULL, 0xfffffffffff16400ULL, 0xfffffffffff2665bULL, 0xfffffffffff35725ULL,
+	0xfffffffffff43789ULL, 0xfffffffffff508a2ULL, 0xfffffffffff5cb76ULL, 0xfffffffffff680fbULL,
+	0xfffffffffff72a14ULL, 0xfffffffffff7c798ULL, 0xfffffffffff85a50ULL, 0xfffffffffff8e2f5ULL,
+	0xfffffffffff96235ULL, 0xfffffffffff9d8b4ULL, 0xfffffffffffa4709ULL, 0xfffffffffffaadc2ULL,
+	0xfffffffffffb0d62ULL, 0xfffffffffffb6666ULL, 0xfffffffffffbb941ULL, 0xfffffffffffc065dULL,
+	0xfffffffffffc4e20ULL, 0xfffffffffffc90e7ULL, 0xfffffffffffccf09ULL, 0xfffffffffffd08d8ULL,
+	0xfffffffffffd3e9fULL, 0xfffffffffffd70a5ULL, 0xfffffffffffd9f2cULL, 0xfffffffffffdca72ULL,
+	0xfffffffffffdf2b0ULL, 0xfffffffffffe181cULL, 0xfffffffffffe3ae8ULL, 0xfffffffffffe5b41ULL,
+	0xfffffffffffe7954ULL, 0xfffffffffffe9549ULL, 0xfffffffffffeaf44ULL, 0xfffffffffffec76bULL,
+	0xfffffffffffedddcULL, 0xfffffffffffef2b6ULL, 0xffffffffffff0617ULL, 0xffffffffffff1817ULL,
+	0xffffffffffff28d1ULL, 0xffffffffffff385aULL, 0xffffffffffff46c8ULL, 0xffffffffffff542fULL,
+	0xffffffffffff60a1ULL, 0xffffffffffff6c2fULL, 0xffffffffffff76eaULL, 0xffffffffffff80e1ULL,
+	0xffffffffffff8a20ULL, 0xffffffffffff92b6ULL, 0xffffffffffff9aaeULL, 0xffffffffffffa213ULL,
+	0xffffffffffffa8f0ULL, 0xffffffffffffaf4fULL, 0xffffffffffffb537ULL, 0xffffffffffffbab3ULL,
+	0xffffffffffffbfc9ULL, 0xffffffffffffc481ULL, 0xffffffffffffc8e1ULL, 0xffffffffffffccf0ULL,
+	0xffffffffffffd0b3ULL, 0xffffffffffffd431ULL, 0xffffffffffffd76dULL, 0xffffffffffffda6dULL,
+	0xffffffffffffdd35ULL, 0xffffffffffffdfc9ULL, 0xffffffffffffe22dULL, 0xffffffffffffe464ULL,
+	0xffffffffffffe672ULL, 0xffffffffffffe859ULL, 0xffffffffffffea1cULL, 0xffffffffffffebbeULL,
+	0xffffffffffffed41ULL, 0xffffffffffffeea8ULL, 0xffffffffffffeff4ULL, 0xfffffffffffff128ULL,
+	0xfffffffffffff244ULL, 0xfffffffffffff34cULL, 0xfffffffffffff441ULL, 0xfffffffffffff523ULL,
+	0xfffffffffffff5f4ULL, 0xfffffffffffff6b6ULL, 0xfffffffffffff769ULL, 0xfffffffffffff810ULL,
+	0xfffffffffffff8a9ULL, 0xfffffffffffff937ULL, 0xfffffffffffff9bbULL, 0xfffffffffffffa35ULL,
+	0xfffffffffffffaa5ULL, 0xfffffffffffffb0dULL, 0xfffffffffffffb6eULL, 0xfffffffffffffbc7ULL,
+	0xfffffffffffffc19ULL, 0xfffffffffffffc66ULL, 0xfffffffffffffcacULL, 0xfffffffffffffcedULL,
+	0xfffffffffffffd29ULL, 0xfffffffffffffd61ULL, 0xfffffffffffffd94ULL, 0xfffffffffffffdc4ULL,
+	0xfffffffffffffdf0ULL, 0xfffffffffffffe19ULL, 0xfffffffffffffe3eULL, 0xfffffffffffffe61ULL,
+	0xfffffffffffffe81ULL, 0xfffffffffffffe9eULL, 0xfffffffffffffebaULL, 0xfffffffffffffed3ULL,
+	0xfffffffffffffeeaULL, 0xffffffffffffff00ULL, 0xffffffffffffff14ULL, 0xffffffffffffff26ULL,
+	0xffffffffffffff37ULL, 0xffffffffffffff47ULL, 0xffffffffffffff55ULL, 0xffffffffffffff62ULL,
+	0xffffffffffffff6fULL, 0xffffffffffffff7aULL, 0xffffffffffffff84ULL, 0xffffffffffffff8eULL,
+	0xffffffffffffff97ULL, 0xffffffffffffff9fULL, 0xffffffffffffffa7ULL, 0xffffffffffffffaeULL,
+	0xffffffffffffffb4ULL, 0xffffffffffffffbaULL, 0xffffffffffffffc0ULL, 0xffffffffffffffc5ULL,
+	0xffffffffffffffc9ULL, 0xffffffffffffffceULL, 0xffffffffffffffd2ULL, 0xffffffffffffffd5ULL,
+	0xffffffffffffffd9ULL, 0xffffffffffffffdcULL, 0xffffffffffffffdfULL, 0xffffffffffffffe1ULL,
+	0xffffffffffffffe4ULL, 0xffffffffffffffe6ULL, 0xffffffffffffffe8ULL, 0xffffffffffffffeaULL,
+	0xffffffffffffffebULL, 0xffffffffffffffedULL, 0xffffffffffffffefULL, 0xfffffffffffffff0ULL,
+	0xfffffffffffffff1ULL, 0xfffffffffffffff2ULL, 0xfffffffffffffff3ULL, 0xfffffffffffffff4ULL,
+	0xfffffffffffffff5ULL, 0xfffffffffffffff6ULL, 0xfffffffffffffff7ULL, 0xfffffffffffffff8ULL,
+	0xfffffffffffffff8ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffffaULL,
+	0xfffffffffffffffaULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL,
+	0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+};
+
+static const uint16_t cdt_guide_bliss_107[257] = {
+	   0,    1,    1,    2,    2,    3,    3,    4,    4,    5,    5,    6,    6,    7,    7,    8,
+	   8,    9,    9,   10,   10,   11,   12,   12,   13,   13,   14,   14,   15,   15,   16,   16,
+	  17,   17,   18,   18,   19,   19,   20,   21,   21,   22,   22,   23,   23,   24,   24,   25,
+	  25,   26,   26,   27,   28,   28,   29,   29,   30,   30,   31,   31,   32,   32,   33,   34,
+	  34,   35,   35,   36,   36,   37,   37,   38,   39,   39,   40,   40,   41,   41,   42,   42,
+	  43,   44,   44,   45,   45,   46,   46,   47,   48,   48,   49,   49,   50,   51,   51,   52,
+	  52,   53,   53,   54,   55,   55,   56,   56,   57,   58,   58,   59,   60,   60,   61,   61,
+	  62,   63,   63,   64,   64,   65,   66,   66,   67,   68,   68,   69,   70,   70,   71,   72,
+	  72,   73,   74,   74,   75,   76,   76,   77,   78,   78,   79,   80,   80,   81,   82,   82,
+	  83,   84,   85,   85,   86,   87,   87,   88,   89,   90,   90,   91,   92,   93,   93,   94,
+	  95,   96,   97,   97,   98,   99,  100,  101,  101,  102,  103,  104,  105,  105,  106,  107,
+	 108,  109,  110,  111,  112,  113,  113,  114,  115,  116,  117,  118,  119,  120,  121,  122,
+	 123,  124,  125,  126,  127,  128,  129,  131,  132,  133,  134,  135,  136,  137,  139,  140,
+	 141,  142,  144,  145,  146,  148,  149,  150,  152,  153,  155,  156,  158,  159,  161,  162,
+	 164,  166,  168,  169,  171,  173,  175,  177,  179,  182,  184,  186,  189,  191,  194,  196,
+	 199,  202,  206,  209,  213,  217,  221,  225,  230,  236,  243,  250,  259,  270,  285,  309,
+	 980,
+};
+
+#define CDT_250_SIZE 2294
+
+static const uint64_t cdt_bliss_250[CDT_250_SIZE] = {
+	0x006859ccdcb4b904ULL, 0x01390cf9a59bcdacULL, 0x0209bedf9e50fa56ULL, 0x02da6ea4eb243defULL,
+	0x03ab1b6fb70f6567ULL, 0x047bc46636602d6aULL, 0x054c68aea9623366ULL, 0x061d076f5f08a7fdULL,
+	0x06ed9fceb797b4faULL, 0x07be30f3274d88e5ULL, 0x088eba03390afa63ULL, 0x095f3a2590fbb569ULL,
+	0x0a2fb080ef3de48fULL, 0x0b001c3c32894882ULL, 0x0bd07c7e5ad5afedULL, 0x0ca0d06e8c00c1e9ULL,
+	0x0d71173410730d3dULL, 0x0e414ff65bc44eb0ULL, 0x0f1179dd0d5ee09fULL, 0x0fe1940ff322462aULL,
+	0x10b19db70c04c449ULL, 0x118195fa8ab3fb19ULL, 0x12517c02d83471c5ULL, 0x13214ef896800769ULL,
+	0x13f10e04a3233b63ULL, 0x14c0b85019d93f82ULL, 0x15904d045726c695ULL, 0x165fcb4afaf381e3ULL,
+	0x172f324deb22401bULL, 0x17fe81375627a053ULL, 0x18cdb731b59f4bc5ULL, 0x199cd367d0dfa8f4ULL,
+	0x1a6bd504bf8bfaf7ULL, 0x1b3abb33ec24dfadULL, 0x1c09852116971fb2ULL, 0x1cd831f856c8c2f2ULL,
+	0x1da6c0e61f245cc6ULL, 0x1e7531173f22828fULL, 0x1f4381b8e5d15fdcULL, 0x2011b1f8a45a5b2cULL,
+	0x20dfc1047085be6aULL, 0x21adae0aa73c5658ULL, 0x227b783a0f06fc24ULL, 0x23491ec1da8bfc79ULL,
+	0x2416a0d1ab0a4f62ULL, 0x24e3fd9992d29476ULL, 0x25b1344a17bdc6c4ULL, 0x267e441435a19c09ULL,
+	0x274b2c2960c282dcULL, 0x2817ebbb8843336eULL, 0x28e481fd1891c6b2ULL, 0x29b0ee20fdd247b2ULL,
+	0x2a7d2f5aa646b2faULL, 0x2b4944de04b45816ULL, 0x2c152ddf92c6912aULL, 0x2ce0e994536ec4c1ULL,
+	0x2dac7731d541a603ULL, 0x2e77d5ee34d1a7a5ULL, 0x2f4305001f0695d1ULL, 0x300e039ed3724b98ULL,
+	0x30d8d10226a2784bULL, 0x31a36c62846f6974ULL, 0x326dd4f8f247ce04ULL, 0x333809ff11796789ULL,
+	0x34020aaf21769e3aULL, 0x34cbd6440218ecd0ULL, 0x35956bf935e0192bULL, 0x365ecb0ae42e2ee7ULL,
+	0x3727f2b5db80310fULL, 0x37f0e23793a37839ULL, 0x38b998ce2fe7b278ULL, 0x398215b8814d7a8dULL,
+	0x3a4a583608b17bfaULL, 0x3b125f86f8f419a2ULL, 0x3bda2aec391d8caeULL, 0x3ca1b9a7667e719eULL,
+	0x3d690afad6ccb982ULL, 0x3e301e299a3cf562ULL, 0x3ef6f2777d97f1ffULL, 0x3fbd87290c4c9a3eULL,
+	0x4083db83927e168cULL, 0x4149eecd1f0e1fc3ULL, 0x420fc04c85a37c18ULL, 0x42d54f4960ac9cccULL,
+	0x439a9b0c135e5362ULL, 0x445fa2ddcbae9546ULL, 0x45246608844b44e9ULL, 0x45e8e3d7068cf760ULL,
+	0x46ad1b94ec65addeULL, 0x47710c8ea24b7a3fULL, 0x4834b611691f062fULL, 0x48f8176b580df46dULL,
+	0x49bb2feb5e7113e9ULL, 0x4a7dfee145a65c6bULL, 0x4b40839db2e6acd1ULL, 0x4c02bd72291742c0ULL,
+	0x4cc4abb10a96e40eULL, 0x4d864dad9b06b20dULL, 0x4e47a2bc010e9f25ULL, 0x4f08aa31481d7f31ULL,
+	0x4fc963636224ab46ULL, 0x5089cda9294f318dULL, 0x5149e85a61b48a1bULL, 0x5209b2cfbb06c9b5ULL,
+	0x52c92c62d23c4b98ULL, 0x5388546e3334cb84ULL, 0x54472a4d5a59e94cULL, 0x5505ad5cb63b0f79ULL,
+	0x55c3dcf9a924b688ULL, 0x5681b8828ab2fe70ULL, 0x573f3f56a95f9859ULL, 0x57fc70d64c0afa66ULL,
+	0x58b94c62b380d7b3ULL, 0x5975d15e1bf7d6b4ULL, 0x5a31ff2bbe8c8052ULL, 0x5aedd52fd2b76230ULL,
+	0x5ba952cf8fbe5ec7ULL, 0x5c6477712e2125ebULL, 0x5d1f427be900d0b7ULL, 0x5dd9b357ff829bc0ULL,
+	0x5e93c96eb62dbab3ULL, 0x5f4d842a58444095ULL, 0x6006e2f639171802ULL, 0x60bfe53eb55506eeULL,
+	0x61788a713454b97aULL, 0x6230d1fc2959cfa7ULL, 0x62e8bb4f14d4e9c4ULL, 0x63a045da859eaf9aULL,
+	0x645771101a2dce77ULL, 0x650e3c6281c7ea64ULL, 0x65c4a7457dad7ee6ULL, 0x667ab12de240abd1ULL,
+	0x673059919826eae5ULL, 0x67e59fe79d65aaecULL, 0x689a83a80679cd54ULL, 0x694f044bff6a0354ULL,
+	0x6a03214dccd407c0ULL, 0x6ab6da28ccf4b2f1ULL, 0x6b6a2e5978aae625ULL, 0x6c1d1d5d64754bf0ULL,
+	0x6ccfa6b3416aeb80ULL, 0x6d81c9dade2e8c78ULL, 0x6e33865527dce977ULL, 0x6ee4dba42af5af4eULL,
+	0x6f95c94b143f4732ULL, 0x70464ece31a56a45ULL, 0x70f66bb2f3127cf6ULL, 0x71a61f7feb43b0e0ULL,
+	0x725569bcd097ebe2ULL, 0x730449f27dd9735aULL, 0x73b2bfaaf3025a96ULL, 0x7460ca7155fbb387ULL,
+	0x750e69d1f3578120ULL, 0x75bb9d5a3f056ab2ULL, 0x76686498d5022fe1ULL, 0x7714bf1d7a01dcd5ULL,
+	0x77c0ac791c14be7bULL, 0x786c2c3dd34716c7ULL, 0x79173dfee23b90f7ULL, 0x79c1e150b6c07622ULL,
+	0x7a6c15c8ea5fa250ULL, 0x7b15dafe42e93a8eULL, 0x7bbf3088b2f924a0ULL, 0x7c6816015a7740f2ULL,
+	0x7d108b02871267a5ULL, 0x7db88f27b4b629abULL, 0x7e60220d8dfb5703ULL, 0x7f074351ec934b4cULL,
+	0x7fadf293d9ae01fdULL, 0x80542f738e5af3baULL, 0x80f9f99273e4be5cULL, 0x819f509324279953ULL,
+	0x8244341969e29841ULL, 0x82e8a3ca4103bdb6ULL, 0x838c9f4bd6eee022ULL, 0x843026458abf6328ULL,
+	0x84d3385fed84c7a7ULL, 0x8575d544c27a14d8ULL, 0x8617fc9eff381d22ULL, 0x86b9ae1acbe2a134ULL,
+	0x875ae96583505441ULL, 0x87fbae2db32dc435ULL, 0x889bfc231c1b28f7ULL, 0x893bd2f6b1c51dc5ULL,
+	0x89db325a9af847f6ULL, 0x8a7a1a0231afee82ULL, 0x8b1889a2031f85b6ULL, 0x8bb680efcfb732c2ULL,
+	0x8c53ffa28b234abeULL, 0x8cf105725c46d108ULL, 0x8d8d92189d30f8dbULL, 0x8e29a54fdb0dae26ULL,
+	0x8ec53ed3d61129d6ULL, 0x8f605e61815e95c1ULL, 0x8ffb03b702e9c494ULL, 0x90952e93b3540243ULL,
+	0x912edeb81dc4017eULL, 0x91c813e5ffb8eae6ULL, 0x9260cde048d892c0ULL, 0x92f90c6b1ab8da0fULL,
+	0x9390cf4bc8a44009ULL, 0x94281648d759a90aULL, 0x94bee129fcc7602aULL, 0x95552fb81fc158c4ULL,
+	0x95eb01bd57b2b558ULL, 0x96805704ec4a9939ULL, 0x97152f5b55244aa3ULL, 0x97a98a8e396aaaebULL,
+	0x983d686c6f770a83ULL, 0x98d0c8c5fc6b5ec7ULL, 0x9963ab6c13c7df6cULL, 0x99f6103116fc11b9ULL,
+	0x9a87f6e894f347a8ULL, 0x9b195f67499c9923ULL, 0x9baa49831d6e5dbfULL, 0x9c3ab51324e52d57ULL,
+	0x9ccaa1ef9ffe6e0aULL, 0x9d5a0ff1f9ae7639ULL, 0x9de8fef4c7524924ULL, 0x9e776ed3c81cf4fcULL,
+	0x9f055f6be4809931ULL, 0x9f92d09b2d931bf4ULL, 0xa01fc240dc6e95edULL, 0xa0ac343d518d7b37ULL,
+	0xa1382672142288d3ULL, 0xa1c398c1d16c7dccULL, 0xa24e8b105c05a769ULL, 0xa2d8fd42ab2f47bcULL,
+	0xa362ef3eda18de27ULL, 0xa3ec60ec2723594bULL, 0xa4755232f3203a05ULL, 0xa4fdc2fcc08caf32ULL,
+	0xa585b33432c8b1f8ULL, 0xa60d22c50d4a2a64ULL, 0xa694119c32cc244cULL, 0xa71a7fa7a47a1c69ULL,
+	0xa7a06cd681176dadULL, 0xa825d9190422e6f8ULL, 0xa8aac46084f6914cULL, 0xa92f2e9f75e3aebaULL,
+	0xa9b317c9634afa59ULL, 0xaa367fd2f2b13197ULL, 0xaab966b1e1cfef50ULL, 0xab3bcc5d05a2e11bULL,
+	0xabbdb0cc49715f62ULL, 0xac3f13f8add470bcULL, 0xacbff5dc47b9414fULL, 0xad4056723f6016bdULL,
+	0xadc035b6cf57c989ULL, 0xae3f93a74375cc8cULL, 0xaebe7041f7cacb76ULL, 0xaf3ccb865793e928ULL,
+	0xafbaa574dc28a6dcULL, 0xb037fe0f0be57d18ULL, 0xb0b4d55779132f65ULL, 0xb1312b51c0cae3efULL,
+	0xb1ad000289d70815ULL, 0xb228536f83910b1eULL, 0xb2a3259f64bbf83aULL, 0xb31d7699ea5bf914ULL,
+	0xb3974667d68aca2aULL, 0xb4109512ef492a4aULL, 0xb48962a5fd4d4e7eULL, 0xb501af2ccace63c9ULL,
+	0xb5797ab4224d2826ULL, 0xb5f0c549cd59a428ULL, 0xb6678efc93560ec6ULL, 0xb6ddd7dc3836e4c4ULL,
+	0xb7539ff97b403d47ULL, 0xb7c8e76615c06523ULL, 0xb83dae34b9c7ca6cULL, 0xb8b1f47910de41fdULL,
+	0xb925ba47bab5b074ULL, 0xb998ffb64bda206dULL, 0xba0bc4db4c5f4f8aULL, 0xba7e09ce368bbc12ULL,
+	0xbaefcea775813ccaULL, 0xbb61138063e32ccaULL, 0xbbd1d8734a7a3516ULL, 0xbc421d9b5ed5bdafULL,
+	0xbcb1e314c1eb0fe7ULL, 0xbd2128fc7eb233ccULL, 0xbd8fef7088c09268ULL, 0xbdfe368fbae166b5ULL,
+	0xbe6bfe79d5ac0704ULL, 0xbed9474f7e1810c6ULL, 0xbf4611323c0f8074ULL, 0xbfb25c4478febf80ULL,
+	0xc01e28a97e62b218ULL, 0xc08976857454ceafULL, 0xc0f445fd60154909ULL, 0xc15e973722935abdULL,
+	0xc1c86a5976f3b2fcULL, 0xc231bf8bf1151782ULL, 0xc29a96f6fc134088ULL, 0xc302f0c3d8c7f98cULL,
+	0xc36acd1c9c4a90dbULL, 0xc3d22c2c2e6d9f9eULL, 0xc4390e1e483b3457ULL, 0xc49f731f726f6998ULL,
+	0xc5055b5d03f172c9ULL, 0xc56ac705204b28d0ULL, 0xc5cfb646b61f206fULL, 0xc63429517d9d5415ULL,
+	0xc6982055f6f66affULL, 0xc6fb9b8568cda75cULL, 0xc75e9b11dea98545ULL, 0xc7c11f2e27631440ULL,
+	0xc823280dd3941503ULL, 0xc884b5e53403e539ULL, 0xc8e5c8e9581342f2ULL, 0xc94661500c26f167ULL,
+	0xc9a67f4fd81148c8ULL, 0xca06231ffd7aba9eULL, 0xca654cf876495477ULL, 0xcac3fd11f3074a5cULL,
+	0xcb2233a5d94892b1ULL, 0xcb7ff0ee420f9cfaULL, 0xcbdd3525f8312d1cULL, 0xcc3a008876b7647dULL,
+	0xcc965351e7440291ULL, 0xccf22dbf2071e629ULL, 0xcd4d900da435d905ULL, 0xcda87a7b9e3eaef0ULL,
+	0xce02ed47e254c1c5ULL, 0xce5ce8b1eab8d3b7ULL, 0xceb66cf9d682610bULL, 0xcf0f7a6067fd6a8eULL,
+	0xcf6811270307c206ULL, 0xcfc0318fab6de1abULL, 0xd017dbdd034757ecULL, 0xd06f10524952d07aULL,
+	0xd0c5cf335751c3c3ULL, 0xd11c18c4a063d5c9ULL, 0xd171ed4b2f61ed5eULL, 0xd1c74d0ca5390cb3ULL,
+	0xd21c384f3744f41bULL, 0xd270af59adaa97e0ULL, 0xd2c4b27361b271faULL, 0xd31841e43c22b869ULL,
+	0xd36b5df4b39980f2ULL, 0xd3be06edcae6dae1ULL, 0xd4103d190f66e785ULL, 0xd46200c0975bf9e6ULL,
+	0xd4b3522f0048c64eULL, 0xd50431af6d4aaa20ULL, 0xd5549f8d85741469ULL, 0xd5a49c1572271798ULL,
+	0xd5f42793dd702cafULL, 0xd6434255f0613038ULL, 0xd691eca9516ca143ULL, 0xd6e026dc22c12a90ULL,
+	0xd72df13d00a57e1bULL, 0xd77b4c1affd48b11ULL, 0xd7c837c5abda1636ULL, 0xd814b48d056fbcc6ULL,
+	0xd860c2c180da69a9ULL, 0xd8ac62b4044844e3ULL, 0xd8f794b5e62f2510ULL, 0xd9425918ebab8aabULL,
+	0xd98cb02f46e02ccaULL, 0xd9d69a4b95561f0aULL, 0xda2017c0de5d9824ULL, 0xda6928e2916f60c4ULL,
+	0xdab1ce04848ef20eULL, 0xdafa077af2ad4b49ULL, 0xdb41d59a7a0c85eaULL, 0xdb8938b81aa42f6dULL,
+	0xdbd0312934867014ULL, 0xdc16bf43864605cbULL, 0xdc5ce35d2b5d1a41ULL, 0xdca29dcc9a94fb42ULL,
+	0xdce7eee8a46ebc46ULL, 0xdd2cd708718cc82cULL, 0xdd715683811d69eaULL, 0xddb56db1a7465305ULL,
+	0xddf91ceb0b912682ULL, 0xde3c648827590f02ULL, 0xde7f44e1c4396692ULL, 0xdec1be50fa7d76c4ULL,
+	0xdf03d12f2f91577aULL, 0xdf457dd61473f2cbULL, 0xdf86c49fa42a345fULL, 0xdfc7a5e622336a74ULL,
+	0xe008220418fedec8ULL, 0xe04839545862ad8bULL, 0xe087ec31f413e05aULL, 0xe0c73af8421fd353ULL,
+	0xe1062602d966ea16ULL, 0xe144adad90189aadULL, 0xe182d2547a30d405ULL, 0xe1c09453e7f6c5c3ULL,
+	0xe1fdf408647d0f14ULL, 0xe23af1ceb4235a0bULL, 0xe2778e03d3196918ULL, 0xe2b3c904f3e39bf4ULL,
+	0xe2efa32f7de0f17fULL, 0xe32b1ce10bd28bc2ULL, 0xe36636776a64bb5aULL, 0xe3a0f05096b9977cULL,
+	0xe3db4acabcf5279aULL, 0xe415464436cb23beULL, 0xe44ee31b8a0e507bULL, 0xe48821af67417b70ULL,
+	0xe4c1025ea82a1d07ULL, 0xe4f985884e64a456ULL, 0xe531ab8b81fa71a6ULL, 0xe56974c78ff98452ULL,
+	0xe5a0e19be90de07eULL, 0xe5d7f268201cb112ULL, 0xe60ea78be8e12a62ULL, 0xe6450167168b31d3ULL,
+	0xe67b00599a5fceb9ULL, 0xe6b0a4c3825b6891ULL, 0xe6e5ef04f7d5d6c3ULL, 0xe71adf7e3e2845e0ULL,
+	0xe74f768fb154f653ULL, 0xe783b499c4b0d87aULL, 0xe7b799fd018f09d8ULL, 0xe7eb271a05ee373fULL,
+	0xe81e5c518327e780ULL, 0xe8513a043ca1b253ULL, 0xe883c093068066ebULL, 0xe8b5f05ec45d25bdULL,
+	0xe8e7c9c867fc70d1ULL, 0xe9194d30f00735ebULL, 0xe94a7af966c5d5e0ULL, 0xe97b5382e0dd2c2aULL,
+	0xe9abd72e7c0d99ecULL, 0xe9dc065d5df4175dULL, 0xea0be170b2cd4ea3ULL, 0xea3b68c9ac3ac2f4ULL,
+	0xea6a9cc9800a06deULL, 0xea997dd166fe046dULL, 0xeac80c429b9a59e4ULL, 0xeaf6487e58f0cdacULL,
+	0xeb2432e5d970dbf8ULL, 0xeb51cbda55b960aeULL, 0xeb7f13bd036c5fecULL, 0xebac0aef1404ef85ULL,
+	0xebd8b1d1b3af43caULL, 0xec0508c60822e1c0ULL, 0xec31102d2f7ef8f8ULL, 0xec5cc8683f28e715ULL,
+	0xec8831d842ace6faULL, 0xecb34cde3aa0eda2ULL, 0xecde19db1b89b671ULL, 0xed08992fccc200d2ULL,
+	0xed32cb3d276400e5ULL, 0xed5cb063f53504dfULL, 0xed864904ef9350bfULL, 0xedaf9580be6631e0ULL,
+	0xedd89637f7104be8ULL, 0xee014b8b1b64206cULL, 0xee29b5da989ad2c0ULL, 0xee51d586c64d291dULL,
+	0xee79aaefe56ecc6aULL, 0xeea136761f4bc7c6ULL, 0xeec87879848848efULL, 0xeeef715a0c22a292ULL,
+	0xef1621779277916dULL, 0xef3c8931d848c53dULL, 0xef62a8e881c5ae47ULL, 0xef8880fb15969043ULL,
+	0xefae11c8fbe9db65ULL, 0xefd35bb17d83cc2fULL, 0xeff85f13c2d052a1ULL, 0xf01d1c4ed2f74154ULL,
+	0xf04193c192f2c4fdULL, 0xf065c5cac4a824bfULL, 0xf089b2c90602cbb0ULL, 0xf0ad5b1ad0119bd7ULL,
+	0xf0d0bf1e76268ae9ULL, 0xf0f3df3224f888f1ULL, 0xf116bbb3e1c7b10aULL, 0xf13955018983c433ULL,
+	0xf15bab78cff4ee56ULL, 0xf17dbf773ee6d55bULL, 0xf19f915a3555f253ULL, 0xf1c1217ee69f3471ULL,
+	0xf1e2704259b1edbfULL, 0xf2037e016844092cULL, 0xf2244b18be0889c5ULL, 0xf244d7e4d7e8529dULL,
+	0xf26524c2033d3712ULL, 0xf285320c5d0f52e5ULL, 0xf2a5001fd154a9afULL, 0xf2c48f581a330d0cULL,
+	0xf2e3e010bf4448f9ULL, 0xf302f2a514dc959bULL, 0xf321c7703b534dc5ULL, 0xf3405ecd1e4de97cULL,
+	0xf35eb916740d3b95ULL, 0xf37cd6a6bcbcf19aULL, 0xf39ab7d841c5550fULL, 0xf3b85d05151f4d09ULL,
+	0xf3d5c68710aa9f34ULL, 0xf3f2f4b7d5866f12ULL, 0xf40fe7f0cb6bfa7dULL, 0xf42ca08b200b9227ULL,
+	0xf4491edfc66bccf3ULL, 0xf4656347764af4e8ULL, 0xf4816e1aab82ac70ULL, 0xf49d3fb1a56dca8aULL,
+	0xf4b8d86466506c9fULL, 0xf4d4388ab2c23c79ULL, 0xf4ef607c111ae8f6ULL, 0xf50a508fc8e0cfedULL,
+	0xf525091ce239d7c0ULL, 0xf53f8a7a255e76ffULL, 0xf559d4fe1a0ee883ULL, 0xf573e8ff070a8a48ULL,
+	0xf58dc6d2f1896569ULL, 0xf5a76ecf9cb7dd64ULL, 0xf5c0e14a893484faULL, 0xf5da1e98f49016bbULL,
+	0xf5f3270fd8cf8f7bULL, 0xf60bfb03ebf068c2ULL, 0xf6249ac99f6ef142ULL, 0xf63d06b51fcec16aULL,
+	0xf6553f1a54254a03ULL, 0xf66d444cdda67ae3ULL, 0xf68516a017337f8eULL, 0xf69cb66714eb8fbdULL,
+	0xf6b423f4a3bed198ULL, 0xf6cb5f9b49034b85ULL, 0xf6e269ad420be34eULL, 0xf6f9427c83c16865ULL,
+	0xf70fea5aba3da701ULL, 0xf7266199486881d2ULL, 0xf73ca88947970fdfULL, 0xf752bf7b872cbc55ULL,
+	0xf768a6c08c3e65c7ULL, 0xf77e5ea891377a83ULL, 0xf793e78385810f8eULL, 0xf7a941a10d2aefbbULL,
+	0xf7be6d508096a07eULL, 0xf7d36ae0ec2459d3ULL, 0xf7e83aa10fe1eec2ULL, 0xf7fcdcdf5f3ba3e6ULL,
+	0xf81151ea00aef15eULL, 0xf8259a0ecd7f2d83ULL, 0xf839b59b516c1dcaULL, 0xf84da4dcca6a6b12ULL,
+	0xf8616820285df6bfULL, 0xf874ffb20cd60ddfULL, 0xf8886bdecacb779bULL, 0xf89bacf266605c3aULL,
+	0xf8aec33894a201e4ULL, 0xf8c1aefcbb4c5c58ULL, 0xf8d47089f08f6ccbULL, 0xf8e7082afad66f09ULL,
+	0xf8f9762a5090d10eULL, 0xf90bbad217fcf21fULL, 0xf91dd66c26f4a694ULL, 0xf92fc94202bb7d54ULL,
+	0xf941939cdfcec41fULL, 0xf95335c5a1b747b2ULL, 0xf964b004dadcccc9ULL, 0xf97602a2cc5b3f03ULL,
+	0xf9872de765d992acULL, 0xf998321a4562566cULL, 0xf9a90f82b73df1c8ULL, 0xf9b9c667b5ce8d76ULL,
+	0xf9ca570fe96da271ULL, 0xf9dac1c1a84b2cbdULL, 0xf9eb06c2f64e7ec2ULL, 0xf9fb265984f8b22cULL,
+	0xfa0b20cab348b332ULL, 0xfa1af65b8da0e324ULL, 0xfa2aa750cdae4f27ULL, 0xfa3a33eeda5177f1ULL,
+	0xfa499c79c788a76aULL, 0xfa58e135565bd103ULL, 0xfa680264f4c9f99dULL, 0xfa77004bbdb823caULL,
+	0xfa85db2c78e1bd4dULL, 0xfa9493499aca8a91ULL, 0xfaa328e544b20cf3ULL, 0xfab19c41448860a9ULL,
+	0xfabfed9f14e48f0dULL, 0xface1d3fdcfc5214ULL, 0xfadc2b64709d45baULL, 0xfaea184d5027842fULL,
+	0xfaf7e43aa889a979ULL, 0xfb058f6c533e3b62ULL, 0xfb131a21d64a7264ULL, 0xfb20849a643e605eULL,
+	0xfb2dcf14dc3671d6ULL, 0xfb3af9cfc9de4674ULL, 0xfb4805096574dd95ULL, 0xfb54f0ff93d21393ULL,
+	0xfb61bdefe66d6c9bULL, 0xfb6e6c179b6629c4ULL, 0xfb7afbb39d8ca51dULL, 0xfb876d00846cf182ULL,
+	0xfb93c03a945abae6ULL, 0xfb9ff59dbe7e63d6ULL, 0xfbac0d65a0e35cf4ULL, 0xfbb807cd8687b325ULL,
+	0xfbc3e510676cd12eULL, 0xfbcfa568e8a9718bULL, 0xfbdb49115c7cbd2cULL, 0xfbe6d043c26293e8ULL,
+	0xfbf23b39c728fb64ULL, 0xfbfd8a2cc506b122ULL, 0xfc08bd55c3b2dc8eULL, 0xfc13d4ed787dddbeULL,
+	0xfc1ed12c466b35acULL, 0xfc29b24a3e4c84b5ULL, 0xfc34787f1edd9c19ULL, 0xfc3f240254e19f4dULL,
+	0xfc49b50afb4131e5ULL, 0xfc542bcfdb29aedeULL, 0xfc5e88876c2d6610ULL, 0xfc68cb67d464dca9ULL,
+	0xfc72f4a6e8910d61ULL, 0xfc7d047a2c3ea558ULL, 0xfc86fb16d1ea3a50ULL, 0xfc90d8b1bb25773cULL,
+	0xfc9a9d7f78bd3bd6ULL, 0xfca449b44ae0ac2fULL, 0xfcaddd8421492d04ULL, 0xfcb759229b6349c1ULL,
+	0xfcc0bcc308788101ULL, 0xfcca089867d9f47bULL, 0xfcd33cd5690bf939ULL, 0xfcdc59ac6bf284fbULL,
+	0xfce55f4f80fe75b8ULL, 0xfcee4df0695bb020ULL, 0xfcf725c09720120cULL, 0xfcffe6f12d7b35d2ULL,
+	0xfd0891b300e7036dULL, 0xfd11263697590c6aULL, 0xfd19a4ac2874af9dULL, 0xfd220d439dbe0190ULL,
+	0xfd2a602c92cd76a8ULL, 0xfd329d9655844c11ULL, 0xfd3ac5afe641ac63ULL, 0xfd42d8a7f8188d12ULL,
+	0xfd4ad6acf10641b4ULL, 0xfd52bfecea29c221ULL, 0xfd5a9495affba08cULL, 0xfd6254d4c286aca3ULL,
+	0xfd6a00d755a140c5ULL, 0xfd7198ca5127367dULL, 0xfd791cda51347f4fULL, 0xfd808d33a6605f03ULL,
+	0xfd87ea0255f9448aULL, 0xfd8f33721a413ebbULL, 0xfd9669ae62ab09f9ULL, 0xfd9d8ce25417b40cULL,
+	0xfda49d38c914d34fULL, 0xfdab9adc521b4e75ULL, 0xfdb285f735ceb228ULL, 0xfdb95eb3713d11aaULL,
+	0xfdc0253ab81f6fd6ULL, 0xfdc6d9b6751aadbdULL, 0xfdcd7c4fca00fc26ULL, 0xfdd40d2f9013cd4eULL,
+	0xfdda8c7e5846442dULL, 0xfde0fa646b801ea7ULL, 0xfde75709cae117f5ULL, 0xfdeda2963004c0b6ULL,
+	0xfdf3dd310d46ca01ULL, 0xfdfa07018e07c0e1ULL, 0xfe00202e96f237b4ULL, 0xfe0628dec6405aceULL,
+	0xfe0c21387401eddcULL, 0xfe120961b262af85ULL, 0xfe17e1804df120c0ULL, 0xfe1da9b9cde5ad68ULL,
+	0xfe236233746a3387ULL, 0xfe290b123ee1e6fdULL, 0xfe2ea47ae6318ef0ULL, 0xfe342e91df081abdULL,
+	0xfe39a97b5a278be3ULL, 0xfe3f155b44ae329cULL, 0xfe44725548603ab6ULL, 0xfe49c08ccbf18661ULL,
+	0xfe4f0024f34fd48aULL, 0xfe5431409fed3081ULL, 0xfe595402710aa89cULL, 0xfe5e688cc4034987ULL,
+	0xfe636f01b4975c06ULL, 0xfe6867831d37e2e6ULL, 0xfe6d5232975256ecULL, 0xfe722f317b9c9e77ULL,
+	0xfe76fea0e2613ec8ULL, 0xfe7bc0a1a3cbc49eULL, 0xfe8075545835621cULL, 0xfe851cd95871bfc4ULL,
+	0xfe89b750be1bfe7bULL, 0xfe8e44da63e3e868ULL, 0xfe92c595e5db4eacULL, 0xfe9739a2a1c391daULL,
+	0xfe9ba11fb75b5329ULL, 0xfe9ffc2c08ac4c57ULL, 0xfea44ae63a594c39ULL, 0xfea88d6cb3ec5608ULL,
+	0xfeacc3dda024e162ULL, 0xfeb0ee56ed46391aULL, 0xfeb50cf64d65f6e6ULL, 0xfeb91fd936ba99f7ULL,
+	0xfebd271ce3ea36a7ULL, 0xfec122de54593d56ULL, 0xfec5133a4c795690ULL, 0xfec8f84d561852c0ULL,
+	0xfeccd233c0af2b7dULL, 0xfed0a109a1b114c4ULL, 0xfed464ead4da9c44ULL, 0xfed81df2fc80d4faULL,
+	0xfedbcc3d81e08d6cULL, 0xfedf6fe5956d8eb3ULL, 0xfee309062f21e2bcULL, 0xfee697ba0ecd1fefULL,
+	0xfeea1c1bbc63b8afULL, 0xfeed9645884e4cf8ULL, 0xfef106518bb8fc84ULL, 0xfef46c59a8e2b7d1ULL,
+	0xfef7c8778b6c8e78ULL, 0xfefb1ac4a8a8f941ULL, 0xfefe635a3feb1e58ULL, 0xff01a2515ad60e29ULL,
+	0xff04d7c2cdabf75bULL, 0xff0803c7379d5058ULL, 0xff0b26770317f4feULL, 0xff0e3fea661636eeULL,
+	0xff115039626ddf13ULL, 0xff14577bc61f1ee9ULL, 0xff1755c92ba3701fULL, 0xff1a4b38fa3c6130ULL,
+	0xff1d37e266424d8cULL, 0xff201bdc71730000ULL, 0xff22f73deb403df7ULL, 0xff25ca1d711e3a4dULL,
+	0xff2894916ed1ee63ULL, 0xff2b56b01ebf5823ULL, 0xff2e108f8a379bb7ULL, 0xff30c24589c707b0ULL,
+	0xff336be7c582fa5eULL, 0xff360d8bb557a71fULL, 0xff38a746a155ba7dULL, 0xff3b392da1ffdbd9ULL,
+	0xff3dc355a0980b8cULL, 0xff4045d3576cdc49ULL, 0xff42c0bb522686a4ULL, 0xff453421ee13d59fULL,
+	0xff47a01b5a76eb26ULL, 0xff4a04bb98d1db60ULL, 0xff4c62167d331dc8ULL, 0xff4eb83fae81d301ULL,
+	0xff51074aa6c9de5bULL, 0xff534f4ab387d206ULL, 0xff559052f5f4acf2ULL, 0xff57ca7663516962ULL,
+	0xff59fdc7c5325b39ULL, 0xff5c2a59b9ca5d0eULL, 0xff5e503eb435cb15ULL, 0xff606f88fcc54afaULL,
+	0xff62884ab1485fb8ULL, 0xff649a95c557c89cULL, 0xff66a67c029faa80ULL, 0xff68ac0f09298274ULL,
+	0xff6aab604fa5e0f6ULL, 0xff6ca48123b5ece2ULL, 0xff6e9782aa34ad56ULL, 0xff708475df8019b5ULL,
+	0xff726b6b97c1eefdULL, 0xff744c747f3849c4ULL, 0xff7627a11a7e03f6ULL, 0xff77fd01c6d2d5c0ULL,
+	0xff79cca6ba6338d2ULL, 0xff7b96a004900d52ULL, 0xff7d5afd8e35ffc8ULL, 0xff7f19cf19f4af61ULL,
+	0xff80d324447593c9ULL, 0xff82870c84b2a217ULL, 0xff8435972c3cb004ULL, 0xff85ded3678194edULL,
+	0xff8782d03e1207f6ULL, 0xff89219c92e73ab3ULL, 0xff8abb4724a82fccULL, 0xff8c4fde8deecd0eULL,
+	0xff8ddf71458ca849ULL, 0xff8f6a0d9ecf8e8bULL, 0xff90efc1c9c5c51cULL, 0xff92709bd38203c2ULL,
+	0xff93eca9a65f27d2ULL, 0xff9563f90a439f84ULL, 0xff96d697a4e48d1dULL, 0xff984492fa08a172ULL,
+	0xff99adf86bcaad5cULL, 0xff9b12d53adbe99bULL, 0xff9c733686c5f4d0ULL, 0xff9dcf294e2c8717ULL,
+	0xff9f26ba6f0edae3ULL, 0xffa079f6a708cab7ULL, 0xffa1c8ea9393a356ULL, 0xffa313a2b246aa1bULL,
+	0xffa45a2b61175714ULL, 0xffa59c90de99428bULL, 0xffa6dadf4a3dc5adULL, 0xffa81522a4934dfcULL,
+	0xffa94b66cf846340ULL, 0xffaa7db78e965facULL, 0xffabac208727d9e2ULL, 0xffacd6ad40aec0afULL,
+	0xffadfd6924f6281aULL, 0xffaf205f805bc79aULL, 0xffb03f9b820d2937ULL, 0xffb15b283c44894fULL,
+	0xffb27310a48566d4ULL, 0xffb3875f93d8c3c3ULL, 0xffb4981fc70915b0ULL, 0xffb5a55bdedde624ULL,
+	0xffb6af1e605722b3ULL, 0xffb7b571b4e81c91ULL, 0xffb8b8602ab23787ULL, 0xffb9b7f3f4bf4819ULL,
+	0xffbab4372b3ba0c8ULL, 0xffbbad33cbafce3cULL, 0xffbca2f3b93a024cULL, 0xffbd9580bcc72db5ULL,
+	0xffbe84e4854bc877ULL, 0xffbf7128a7fc48b2ULL, 0xffc05a56a08547f8ULL, 0xffc14077d14356feULL,
+	0xffc22395837a7f9aULL, 0xffc303b8e78d74feULL, 0xffc3e0eb1534722cULL, 0xffc4bb350bb3c68dULL,
+	0xffc5929fb21210aeULL, 0xffc66733d74e2714ULL, 0xffc738fa3294af2cULL, 0xffc807fb6375624aULL,
+	0xffc8d43ff21800c4ULL, 0xffc99dd04f70f324ULL, 0xffca64b4d5759970ULL, 0xffcb28f5c750489bULL,
+	0xffcbea9b5193f61fULL, 0xffcca9ad8a6f91caULL, 0xffcd663471e10dc6ULL, 0xffce2037f1e814f8ULL,
+	0xffced7bfdeb86fb6ULL, 0xffcf8cd3f6ec16e9ULL, 0xffd03f7be3b4f5b5ULL, 0xffd0efbf390e59b4ULL,
+	0xffd19da575ee11daULL, 0xffd2493604753c23ULL, 0xffd2f2783a20c218ULL, 0xffd3997357f98453ULL,
+	0xffd43e2e8ac43513ULL, 0xffd4e0b0eb30e208ULL, 0xffd581017e0a2d70ULL, 0xffd61f27346436b0ULL,
+	0xffd6bb28ebcb327dULL, 0xffd7550d6e71b2c9ULL, 0xffd7ecdb735e9e93ULL, 0xffd882999e9ad9beULL,
+	0xffd9164e815e9d1cULL, 0xffd9a8009a3e7ee0ULL, 0xffda37b655582b8aULL, 0xffdac5760c7ecf99ULL,
+	0xffdb514607673213ULL, 0xffdbdb2c7bd38033ULL, 0xffdc632f8dbeca47ULL, 0xffdce9554f883217ULL,
+	0xffdd6da3c21dcaedULL, 0xffddf020d5272b7eULL, 0xffde70d2672fb1eaULL, 0xffdeefbe45d07a00ULL,
+	0xffdf6cea2dda0611ULL, 0xffdfe85bcb7d9a71ULL, 0xffe06218ba764bffULL, 0xffe0da268631c1ceULL,
+	0xffe1508aa9f8aa47ULL, 0xffe1c54a9116e3f6ULL, 0xffe2386b97035a38ULL, 0xffe2a9f30787961dULL,
+	0xffe319e61ee703abULL, 0xffe3884a0a05ebceULL, 0xffe3f523e6902338ULL, 0xffe46078c31f6e69ULL,
+	0xffe4ca4d9f619b32ULL, 0xffe532a76c3e4febULL, 0xffe5998b0bfc90aaULL, 0xffe5fefd5267fabeULL,
+	0xffe6630304f5b6b1ULL, 0xffe6c5a0dae92126ULL, 0xffe726db7d782accULL, 0xffe786b787ef6fb9ULL,
+	0xffe7e53987d6067bULL, 0xffe84265fd110716ULL, 0xffe89e415a06ca5dULL, 0xffe8f8d003c1e1ccULL,
+	0xffe952165213c84dULL, 0xffe9aa188fb74c25ULL, 0xffea00dafa72b267ULL, 0xffea5661c3399423ULL,
+	0xffeaaab10e4e75bfULL, 0xffeafdccf36418aeULL, 0xffeb4fb97dbe87efULL, 0xffeba07aac53df8bULL,
+	0xffebf01471eccf7eULL, 0xffec3e8ab544da44ULL, 0xffec8be1512a4f74ULL, 0xffecd81c149e02a9ULL,
+	0xffed233ec2f2bf1cULL, 0xffed6d4d13ec7831ULL, 0xffedb64ab3df3762ULL, 0xffedfe3b43cdc7c9ULL,
+	0xffee452259881fa8ULL, 0xffee8b037fc98847ULL, 0xffeecfe236568470ULL, 0xffef13c1f21a75f6ULL,
+	0xffef56a61d450283ULL, 0xffef98921767381eULL, 0xffefd989359071adULL, 0xfff0198ec26afbd1ULL,
+	0xfff058a5fe587a7aULL, 0xfff096d21f8e0f7dULL, 0xfff0d41652304299ULL, 0xfff11075b86eab2aULL,
+	0xfff14bf36a9f5bf9ULL, 0xfff18692775a1177ULL, 0xfff1c055e39322c0ULL, 0xfff1f940aab635b8ULL,
+	0xfff23155bec0b6abULL, 0xfff26898085c13b9ULL, 0xfff29f0a66f7bc71ULL, 0xfff2d4afb0e2e5f3ULL,
+	0xfff3098ab36613f6ULL, 0xfff33d9e32dc6707ULL, 0xfff370eceaccb05dULL, 0xfff3a3798e024ba1ULL,
+	0xfff3d546c6a5befbULL, 0xfff40657365521cdULL, 0xfff436ad763c4a66ULL, 0xfff4664c172cc314ULL,
+	0xfff49535a1b586ebULL, 0xfff4c36c963a869bULL, 0xfff4f0f36d0bf5b4ULL, 0xfff51dcc967d60abULL,
+	0xfff549fa7afc8c04ULL, 0xfff5757f7b281cf5ULL, 0xfff5a05defe60bdeULL, 0xfff5ca982a79e0f7ULL,
+	0xfff5f430749abb80ULL, 0xfff61d29108923deULL, 0xfff645843924a8f8ULL, 0xfff66d442201492cULL,
+	0xfff6946af77ca736ULL, 0xfff6bafaded30b70ULL, 0xfff6e0f5f63431b2ULL, 0xfff7065e54d7e438ULL,
+	0xfff72b360b1263eaULL, 0xfff74f7f22689e54ULL, 0xfff7733b9da431b2ULL, 0xfff7966d78e73f69ULL,
+	0xfff7b916a9c00d3eULL, 0xfff7db391f3c75b1ULL, 0xfff7fcd6c1fd27c2ULL, 0xfff81df17448b697ULL,
+	0xfff83e8b121e7935ULL, 0xfff85ea571493ac9ULL, 0xfff87e426171bbc0ULL, 0xfff89d63ac310416ULL,
+	0xfff8bc0b15228726ULL, 0xfff8da3a59f6195dULL, 0xfff8f7f33281b82aULL, 0xfff9153750d32475ULL,
+	0xfff9320861414ffdULL, 0xfff94e680a7d9df5ULL, 0xfff96a57eda4f734ULL, 0xfff985d9a650b24dULL,
+	0xfff9a0eecaa74fe4ULL, 0xfff9bb98eb6d0b9fULL, 0xfff9d5d9941441f6ULL, 0xfff9efb24acdab52ULL,
+	0xfffa092490986cb2ULL, 0xfffa2231e151fe44ULL, 0xfffa3adbb3c5e835ULL, 0xfffa532379bd5616ULL,
+	0xfffa6b0aa00e8126ULL, 0xfffa82928eabf1d7ULL, 0xfffa99bca8b398dbULL, 0xfffab08a4c7dc011ULL,
+	0xfffac6fcd3abd3acULL, 0xfffadd15933703cdULL, 0xfffaf2d5db7ebf08ULL, 0xfffb083ef85705fbULL,
+	0xfffb1d523116986eULL, 0xfffb3210c8a4fc37ULL, 0xfffb467bfd885e34ULL, 0xfffb5a9509f34db5ULL,
+	0xfffb6e5d23d2529fULL, 0xfffb81d57cd95e94ULL, 0xfffb94ff4291197fULL, 0xfffba7db9e6409bbULL,
+	0xfffbba6bb5ab9837ULL, 0xfffbccb0a9bcf0dfULL, 0xfffbdeab97f5bf97ULL, 0xfffbf05d99c8ca0fULL,
+	0xfffc01c7c4ca66cbULL, 0xfffc12eb2abcd1a5ULL, 0xfffc23c8d99c5e0bULL, 0xfffc3461dbab8759ULL,
+	0xfffc44b7377edf87ULL, 0xfffc54c9f008dc86ULL, 0xfffc649b04a5848bULL, 0xfffc742b7125f999ULL,
+	0xfffc837c2ddbe48dULL, 0xfffc928e2fa4c006ULL, 0xfffca16267f50359ULL, 0xfffcaff9c4e32dedULL,
+	0xfffcbe553132b348ULL, 0xfffccc75945ec802ULL, 0xfffcda5bd2a50ffeULL, 0xfffce808cd102e1bULL,
+	0xfffcf57d618235b7ULL, 0xfffd02ba6abefe35ULL, 0xfffd0fc0c07658e3ULL, 0xfffd1c91374e2970ULL,
+	0xfffd292ca0ec614cULL, 0xfffd3593cc00de1fULL, 0xfffd41c7844f2bb4ULL, 0xfffd4dc892b82989ULL,
+	0xfffd5997bd439451ULL, 0xfffd6535c72973abULL, 0xfffd70a370db6c49ULL, 0xfffd7be1780df6d5ULL,
+	0xfffd86f097c17bc8ULL, 0xfffd91d1884b5486ULL, 0xfffd9c84ff5eb1ecULL, 0xfffda70bb01568a0ULL,
+	0xfffdb1664af8a35eULL, 0xfffdbb957e097b7fULL, 0xfffdc599f4c977ffULL, 0xfffdcf745842f338ULL,
+	0xfffdd9254f11679eULL, 0xfffde2ad7d69a3adULL, 0xfffdec0d8521e550ULL, 0xfffdf54605b9dcf5ULL,
+	0xfffdfe579c629895ULL, 0xfffe0742e40656e7ULL, 0xfffe1008755042f7ULL, 0xfffe18a8e6b41866ULL,
+	0xfffe2124cc75b085ULL, 0xfffe297cb8b07886ULL, 0xfffe31b13b5ed108ULL, 0xfffe39c2e261572eULL,
+	0xfffe41b239861773ULL, 0xfffe497fca8faa93ULL, 0xfffe512c1d3c3c95ULL, 0xfffe58b7b74c7e59ULL,
+	0xfffe60231c8a81c3ULL, 0xfffe676eced080cfULL, 0xfffe6e9b4e0f8fb2ULL, 0xfffe75a918563a55ULL,
+	0xfffe7c98a9d70d4bULL, 0xfffe836a7cef0a86ULL, 0xfffe8a1f0a2c09faULL, 0xfffe90b6c8530660ULL,
+	0xfffe97322c66565eULL, 0xfffe9d91a9abd22dULL, 0xfffea3d5b1b2e60eULL, 0xfffea9feb45a91a7ULL,
+	0xfffeb00d1fd75493ULL, 0xfffeb60160b90840ULL, 0xfffebbdbe1f0a766ULL, 0xfffec19d0cd6032fULL,
+	0xfffec745492d665bULL, 0xfffeccd4fd2d2675ULL, 0xfffed24c8d83236cULL, 0xfffed7ac5d5a3599ULL,
+	0xfffedcf4ce5f8a87ULL, 0xfffee22640c7f08cULL, 0xfffee74113551183ULL, 0xfffeec45a35a9caeULL,
+	0xfffef1344cc3601bULL, 0xfffef60d6a165190ULL, 0xfffefad1547b874bULL, 0xfffeff8063c120b2ULL,
+	0xffff041aee601f20ULL, 0xffff08a149812f0aULL, 0xffff0d13c9016196ULL, 0xffff1172bf76d6d6ULL,
+	0xffff15be7e3558daULL, 0xffff19f75552e7b8ULL, 0xffff1e1d93ac36bdULL, 0xffff223186e91aeaULL,
+	0xffff26337b80eaeeULL, 0xffff2a23bcbed0c3ULL, 0xffff2e0294c60d14ULL, 0xffff31d04c962c9bULL,
+	0xffff358d2c0f2f99ULL, 0xffff393979f5a393ULL, 0xffff3cd57bf6af80ULL, 0xffff406176ac1283ULL,
+	0xffff43ddada01569ULL, 0xffff474a63516efaULL, 0xffff4aa7d9371b61ULL, 0xffff4df64fc426b6ULL,
+	0xffff5136066b6adeULL, 0xffff54673ba340e2ULL, 0xffff578a2ce925e5ULL, 0xffff5a9f16c553d4ULL,
+	0xffff5da634ce4e02ULL, 0xffff609fc1ac61c9ULL, 0xffff638bf71d1b55ULL, 0xffff666b0df6aec6ULL,
+	0xffff693d3e2b55b9ULL, 0xffff6c02becca16bULL, 0xffff6ebbc60ec198ULL, 0xffff7168894bc024ULL,
+	0xffff74093d06b1ccULL, 0xffff769e14eedbe9ULL, 0xffff792743e2cf6fULL, 0xffff7ba4fbf3794fULL,
+	0xffff7e176e67284eULL, 0xffff807ecbbc887bULL, 0xffff82db43ad945dULL, 0xffff852d05327c06ULL,
+	0xffff87743e848214ULL, 0xffff89b11d20ced0ULL, 0xffff8be3cdcb3986ULL, 0xffff8e0c7c91082eULL,
+	0xffff902b54cba58aULL, 0xffff924081234dd4ULL, 0xffff944c2b91b214ULL, 0xffff964e7d64924bULL,
+	0xffff98479f404e7cULL, 0xffff9a37b9226eb8ULL, 0xffff9c1ef264224fULL, 0xffff9dfd71bcb636ULL,
+	0xffff9fd35d4402c4ULL, 0xffffa1a0da74d0e3ULL, 0xffffa3660e2f36ceULL, 0xffffa5231cbaec6dULL,
+	0xffffa6d829c9977aULL, 0xffffa88558790f84ULL, 0xffffaa2acb5599dbULL, 0xffffabc8a45c1d96ULL,
+	0xffffad5f04fc4fb7ULL, 0xffffaeee0e1ad799ULL, 0xffffb075e0136bb1ULL, 0xffffb1f69abae6c0ULL,
+	0xffffb3705d615591ULL, 0xffffb4e346d3fd5dULL, 0xffffb64f755f5adfULL, 0xffffb7b506d11a3eULL,
+	0xffffb914187a07e5ULL, 0xffffba6cc72ffa4cULL, 0xffffbbbf2f4fb4e5ULL, 0xffffbd0b6cbec42cULL,
+	0xffffbe519aed52faULL, 0xffffbf91d4d7f938ULL, 0xffffc0cc350983f3ULL, 0xffffc200d59cb701ULL,
+	0xffffc32fd03e0835ULL, 0xffffc4593e2d5444ULL, 0xffffc57d383f8d6dULL, 0xffffc69bd6e063f7ULL,
+	0xffffc7b53213e89eULL, 0xffffc8c9617828f5ULL, 0xffffc9d87c46c5e9ULL, 0xffffcae299568463ULL,
+	0xffffcbe7cf1cd822ULL, 0xffffcce833af68ecULL, 0xffffcde3dcc59217ULL, 0xffffcedadfb9dc86ULL,
+	0xffffcfcd518b7334ULL, 0xffffd0bb46df924cULL, 0xffffd1a4d402f0f6ULL, 0xffffd28a0ceb25d5ULL,
+	0xffffd36b05380661ULL, 0xffffd447d0350116ULL, 0xffffd52080da7296ULL, 0xffffd5f529cef5d0ULL,
+	0xffffd6c5dd68af3aULL, 0xffffd792adae932aULL, 0xffffd85bac59a76cULL, 0xffffd920ead64015ULL,
+	0xffffd9e27a4537acULL, 0xffffdaa06b7d22beULL, 0xffffdb5acf0b7edfULL, 0xffffdc11b535dd36ULL,
+	0xffffdcc52dfb0897ULL, 0xffffdd7549142743ULL, 0xffffde2215f5d85eULL, 0xffffdecba3d14d1bULL,
+	0xffffdf7201955dc5ULL, 0xffffe0153def9a9cULL, 0xffffe0b5674d58a4ULL, 0xffffe1528bdcba6eULL,
+	0xffffe1ecb98db4e7ULL, 0xffffe283fe131044ULL, 0xffffe31866e36509ULL, 0xffffe3aa013a154aULL,
+	0xffffe438da18422bULL, 0xffffe4c4fe45bda7ULL, 0xffffe54e7a51f8b2ULL, 0xffffe5d55a94edc7ULL,
+	0xffffe659ab3007e4ULL, 0xffffe6db780f0607ULL, 0xffffe75acce8db33ULL, 0xffffe7d7b5408b18ULL,
+	0xffffe8523c660356ULL, 0xffffe8ca6d76f171ULL, 0xffffe940535f9588ULL, 0xffffe9b3f8db91ceULL,
+	0xffffea256876b6d6ULL, 0xffffea94ac8dccc5ULL, 0xffffeb01cf4f5964ULL, 0xffffeb6cdabc6330ULL,
+	0xffffebd5d8a93166ULL, 0xffffec3cd2be091aULL, 0xffffeca1d277e766ULL, 0xffffed04e12938b5ULL,
+	0xffffed6607fa8d3eULL, 0xffffedc54feb4ab0ULL, 0xffffee22c1d25b1fULL, 0xffffee7e665ed93cULL,
+	0xffffeed84618b9d8ULL, 0xffffef30696172d1ULL, 0xffffef86d8749f5aULL, 0xffffefdb9b68a1b5ULL,
+	0xfffff02eba2f4272ULL, 0xfffff0803c964d1bULL, 0xfffff0d02a482a85ULL, 0xfffff11e8acc789fULL,
+	0xfffff16b65889ff2ULL, 0xfffff1b6c1c066b7ULL, 0xfffff200a69681adULL, 0xfffff2491b0d2298ULL,
+	0xfffff2902606848aULL, 0xfffff2d5ce4575f2ULL, 0xfffff31a1a6de07cULL, 0xfffff35d11054ecaULL,
+	0xfffff39eb8737011ULL, 0xfffff3df17029999ULL, 0xfffff41e32e04636ULL, 0xfffff45c121d93b5ULL,
+	0xfffff498baafbe49ULL, 0xfffff4d432709a04ULL, 0xfffff50e7f1f0a5cULL, 0xfffff547a65f77c7ULL,
+	0xfffff57fadbc4378ULL, 0xfffff5b69aa6393dULL, 0xfffff5ec7274ff8aULL, 0xfffff6213a6785bcULL,
+	0xfffff654f7a4708fULL, 0xfffff687af3a84dbULL, 0xfffff6b966211090ULL, 0xfffff6ea2138520cULL,
+	0xfffff719e549ddbaULL, 0xfffff748b7090213ULL, 0xfffff7769b1329fdULL, 0xfffff7a395f03d94ULL,
+	0xfffff7cfac13015dULL, 0xfffff7fae1d973eeULL, 0xfffff8253b8d2a12ULL, 0xfffff84ebd63a96dULL,
+	0xfffff8776b7ec19cULL, 0xfffff89f49ece3eeULL, 0xfffff8c65ca979a4ULL, 0xfffff8eca79d38caULL,
+	0xfffff9122e9e77adULL, 0xfffff936f5717eefULL, 0xfffff95affc8da48ULL, 0xfffff97e5145a7ebULL,
+	0xfffff9a0ed77e69fULL, 0xfffff9c2d7dec294ULL, 0xfffff9e413e8e0e9ULL, 0xfffffa04a4f4a9fbULL,
+	0xfffffa248e509272ULL, 0xfffffa43d33b6320ULL, 0xfffffa6276e47fa6ULL, 0xfffffa807c6c2bf6ULL,
+	0xfffffa9de6e3d0a3ULL, 0xfffffabab94e3e16ULL, 0xfffffad6f69feea2ULL, 0xfffffaf2a1bf4778ULL,
+	0xfffffb0dbd84d88fULL, 0xfffffb284cbb9b75ULL, 0xfffffb425221310fULL, 0xfffffb5bd0661e5aULL,
+	0xfffffb74ca2e081bULL, 0xfffffb8d420fed98ULL, 0xfffffba53a966250ULL, 0xfffffbbcb63fc6baULL,
+	0xfffffbd3b77e8010ULL, 0xfffffbea40b92f27ULL, 0xfffffc00544ae65dULL, 0xfffffc15f4835e9aULL,
+	0xfffffc2b23a72b70ULL, 0xfffffc3fe3efee52ULL, 0xfffffc54378c88f1ULL, 0xfffffc6820a14ebdULL,
+	0xfffffc7ba148358fULL, 0xfffffc8ebb91057eULL, 0xfffffca1718187e1ULL, 0xfffffcb3c515b589ULL,
+	0xfffffcc5b83fe42bULL, 0xfffffcd74ce8f307ULL, 0xfffffce884f076c9ULL, 0xfffffcf9622ce4abULL,
+	0xfffffd09e66bbcd9ULL, 0xfffffd1a1371b418ULL, 0xfffffd29eafadcbaULL, 0xfffffd396ebaced8ULL,
+	0xfffffd48a05ccfe4ULL, 0xfffffd578183f97eULL, 0xfffffd6613cb5fa9ULL, 0xfffffd7458c63653ULL,
+	0xfffffd8251fff634ULL, 0xfffffd9000fc810dULL, 0xfffffd9d67384545ULL, 0xfffffdaa862860e6ULL,
+	0xfffffdb75f3ac402ULL, 0xfffffdc3f3d65276ULL, 0xfffffdd0455b0524ULL, 0xfffffddc55220a8bULL,
+	0xfffffde8247de6d7ULL, 0xfffffdf3b4ba935aULL, 0xfffffdff071d9d7eULL, 0xfffffe0a1ce6452bULL,
+	0xfffffe14f74d9a9eULL, 0xfffffe1f97869bc3ULL, 0xfffffe29febe5108ULL, 0xfffffe342e1be9a9ULL,
+	0xfffffe3e26c0d781ULL, 0xfffffe47e9c8ea60ULL, 0xfffffe51784a6adeULL, 0xfffffe5ad35634bbULL,
+	0xfffffe63fbf7d0c5ULL, 0xfffffe6cf3358e48ULL, 0xfffffe75ba109c0bULL, 0xfffffe7e518520dbULL,
+	0xfffffe86ba8a53abULL, 0xfffffe8ef612933dULL, 0xfffffe97050b7d68ULL, 0xfffffe9ee85e05ecULL,
+	0xfffffea6a0ee8ce6ULL, 0xfffffeae2f9cf4d7ULL, 0xfffffeb59544b849ULL, 0xfffffebcd2bcff0cULL,
+	0xfffffec3e8d8b31cULL, 0xfffffecad866951cULL, 0xfffffed1a2315079ULL, 0xfffffed846ff8f2dULL,
+	0xfffffedec7940d2cULL, 0xfffffee524adab6fULL, 0xfffffeeb5f0782b1ULL, 0xfffffef17758f5ceULL,
+	0xfffffef76e55c3d0ULL, 0xfffffefd44ae19a7ULL, 0xffffff02fb0ea391ULL, 0xffffff0892209e30ULL,
+	0xffffff0e0a89e750ULL, 0xffffff1364ed0e5eULL, 0xffffff18a1e96498ULL, 0xffffff1dc21b0ce9ULL,
+	0xffffff22c61b0b84ULL, 0xffffff27ae7f552dULL, 0xffffff2c7bdade43ULL, 0xffffff312ebda97cULL,
+	0xffffff35c7b4d666ULL, 0xffffff3a474aaf96ULL, 0xffffff3eae06b8a2ULL, 0xffffff42fc6dbbd2ULL,
+	0xffffff473301d791ULL, 0xffffff4b52428ba1ULL, 0xffffff4f5aacc60fULL, 0xffffff534cbaefeeULL,
+	0xffffff5728e4f9cbULL, 0xffffff5aefa067f5ULL, 0xffffff5ea1605e81ULL, 0xffffff623e95ad15ULL,
+	0xffffff65c7aeda81ULL, 0xffffff693d18301eULL, 0xffffff6c9f3bc4f3ULL, 0xffffff6fee8188acULL,
+	0xffffff732b4f4e58ULL, 0xffffff765608d6f5ULL, 0xffffff796f0fdbcaULL, 0xffffff7c76c41893ULL,
+	0xffffff7f6d835571ULL, 0xffffff8253a970bbULL, 0xffffff8529906892ULL, 0xffffff87ef906450ULL,
+	0xffffff8aa5ffbdc0ULL, 0xffffff8d4d330a39ULL, 0xffffff8fe57d237dULL, 0xffffff926f2f3077ULL,
+	0xffffff94ea98adccULL, 0xffffff9758077643ULL, 0xffffff99b7c7cb07ULL, 0xffffff9c0a245bb9ULL,
+	0xffffff9e4f664e66ULL, 0xffffffa087d5474fULL, 0xffffffa2b3b7708cULL, 0xffffffa4d351818dULL,
+	0xffffffa6e6e6c675ULL, 0xffffffa8eeb92750ULL, 0xffffffaaeb092f28ULL, 0xffffffacdc1612f6ULL,
+	0xffffffaec21db872ULL, 0xffffffb09d5cbcc1ULL, 0xffffffb26e0e7b03ULL, 0xffffffb4346d12c4ULL,
+	0xffffffb5f0b16e43ULL, 0xffffffb7a31348aaULL, 0xffffffb94bc93419ULL, 0xffffffbaeb089f9eULL,
+	0xffffffbc8105dd07ULL, 0xffffffbe0df4269eULL, 0xffffffbf9205a4c6ULL, 0xffffffc10d6b737dULL,
+	0xffffffc28055a7c2ULL, 0xffffffc3eaf354e0ULL, 0xffffffc54d7291a2ULL, 0xffffffc6a8007d6aULL,
+	0xffffffc7fac9452eULL, 0xffffffc945f82861ULL, 0xffffffca89b77dc1ULL, 0xffffffcbc630b80aULL,
+	0xffffffccfb8c6a95ULL, 0xffffffce29f24de5ULL, 0xffffffcf5189440fULL, 0xffffffd072775d1fULL,
+	0xffffffd18ce1db53ULL, 0xffffffd2a0ed3754ULL, 0xffffffd3aebd244cULL, 0xffffffd4b67493ecULL,
+	0xffffffd5b835ba63ULL, 0xffffffd6b4221237ULL, 0xffffffd7aa5a6013ULL, 0xffffffd89afeb680ULL,
+	0xffffffd9862e7989ULL, 0xffffffda6c08624eULL, 0xffffffdb4caa8285ULL, 0xffffffdc283247ebULL,
+	0xffffffdcfebc7fa0ULL, 0xffffffddd0655977ULL, 0xffffffde9d486b30ULL, 0xffffffdf6580b3a5ULL,
+	0xffffffe029289de4ULL, 0xffffffe0e85a0442ULL, 0xffffffe1a32e334eULL, 0xffffffe259bdecc8ULL,
+	0xffffffe30c216a7aULL, 0xffffffe3ba706108ULL, 0xffffffe464c202b9ULL, 0xffffffe50b2d0220ULL,
+	0xffffffe5adc794cdULL, 0xffffffe64ca775dcULL, 0xffffffe6e7e1e888ULL, 0xffffffe77f8bbaa6ULL,
+	0xffffffe813b94714ULL, 0xffffffe8a47e7824ULL, 0xffffffe931eec9efULL, 0xffffffe9bc1d4ca7ULL,
+	0xffffffea431ca6d2ULL, 0xffffffeac6ff1785ULL, 0xffffffeb47d6788bULL, 0xffffffebc5b44083ULL,
+	0xffffffec40a984f9ULL, 0xffffffecb8c6fc67ULL, 0xffffffed2e1d003bULL, 0xffffffeda0bb8ec9ULL,
+	0xffffffee10b24d34ULL, 0xffffffee7e10894eULL, 0xffffffeee8e53b72ULL, 0xffffffef513f084fULL,
+	0xffffffefb72c42aaULL, 0xfffffff01abaed1dULL, 0xfffffff07bf8bbc3ULL, 0xfffffff0daf315e7ULL,
+	0xfffffff137b7179fULL, 0xfffffff192519365ULL, 0xfffffff1eacf13aaULL, 0xfffffff2413bdc57ULL,
+	0xfffffff295a3ec52ULL, 0xfffffff2e812fef0ULL, 0xfffffff338948d6bULL, 0xfffffff38733d044ULL,
+	0xfffffff3d3fbc0a9ULL, 0xfffffff41ef719caULL, 0xfffffff468305a2fULL, 0xfffffff4afb1c501ULL,
+	0xfffffff4f5856352ULL, 0xfffffff539b50556ULL, 0xfffffff57c4a43a1ULL, 0xfffffff5bd4e8052ULL,
+	0xfffffff5fccae841ULL, 0xfffffff63ac87423ULL, 0xfffffff6774fe9a7ULL, 0xfffffff6b269dc92ULL,
+	0xfffffff6ec1eafd0ULL, 0xfffffff72476967eULL, 0xfffffff75b7994f9ULL, 0xfffffff7912f81d7ULL,
+	0xfffffff7c5a006ebULL, 0xfffffff7f8d2a23aULL, 0xfffffff82acea6eaULL, 0xfffffff85b9b3e37ULL,
+	0xfffffff88b3f6852ULL, 0xfffffff8b9c1fd4cULL, 0xfffffff8e729adf0ULL, 0xfffffff9137d049fULL,
+	0xfffffff93ec26626ULL, 0xfffffff96900128fULL, 0xfffffff9923c25ebULL, 0xfffffff9ba7c991cULL,
+	0xfffffff9e1c7429dULL, 0xfffffffa0821d73aULL, 0xfffffffa2d91ead4ULL, 0xfffffffa521cf113ULL,
+	0xfffffffa75c83e1dULL, 0xfffffffa98990747ULL, 0xfffffffaba9463c0ULL, 0xfffffffadbbf4d3aULL,
+	0xfffffffafc1ea092ULL, 0xfffffffb1bb71e6dULL, 0xfffffffb3a8d6bdcULL, 0xfffffffb58a612f3ULL,
+	0xfffffffb76058362ULL, 0xfffffffb92b0130cULL, 0xfffffffbaea9fe94ULL, 0xfffffffbc9f769f1ULL,
+	0xfffffffbe49c60f2ULL, 0xfffffffbfe9cd7ceULL, 0xfffffffc17fcaba4ULL, 0xfffffffc30bfa302ULL,
+	0xfffffffc48e96e5fULL, 0xfffffffc607da89fULL, 0xfffffffc777fd788ULL, 0xfffffffc8df36c3cULL,
+	0xfffffffca3dbc3aeULL, 0xfffffffcb93c2715ULL, 0xfffffffcce17cc5eULL, 0xfffffffce271d694ULL,
+	0xfffffffcf64d5652ULL, 0xfffffffd09ad4a29ULL, 0xfffffffd1c949f07ULL, 0xfffffffd2f06309eULL,
+	0xfffffffd4104c9c3ULL, 0xfffffffd529324cfULL, 0xfffffffd63b3ec02ULL, 0xfffffffd7469b9d8ULL,
+	0xfffffffd84b7196bULL, 0xfffffffd949e86c2ULL, 0xfffffffda4226f33ULL, 0xfffffffdb34531acULL,
+	0xfffffffdc2091f0eULL, 0xfffffffdd0707a7bULL, 0xfffffffdde7d79a2ULL, 0xfffffffdec324515ULL,
+	0xfffffffdf990f88aULL, 0xfffffffe069ba32cULL, 0xfffffffe135447e5ULL, 0xfffffffe1fbcdd9cULL,
+	0xfffffffe2bd74f86ULL, 0xfffffffe37a57d60ULL, 0xfffffffe43293bb6ULL, 0xfffffffe4e645424ULL,
+	0xfffffffe59588595ULL, 0xfffffffe6407847fULL, 0xfffffffe6e72fb24ULL, 0xfffffffe789c89c9ULL,
+	0xfffffffe8285c6f2ULL, 0xfffffffe8c303f9bULL, 0xfffffffe959d7770ULL, 0xfffffffe9ecee903ULL,
+	0xfffffffea7c605feULL, 0xfffffffeb084375cULL, 0xfffffffeb90add9aULL, 0xfffffffec15b50e7ULL,
+	0xfffffffec976e156ULL, 0xfffffffed15ed70eULL, 0xfffffffed9147276ULL, 0xfffffffee098ec66ULL,
+	0xfffffffee7ed7651ULL, 0xfffffffeef133a72ULL, 0xfffffffef60b5bf3ULL, 0xfffffffefcd6f71bULL,
+	0xffffffff03772176ULL, 0xffffffff09ece9f7ULL, 0xffffffff10395928ULL, 0xffffffff165d7147ULL,
+	0xffffffff1c5a2e73ULL, 0xffffffff223086c9ULL, 0xffffffff27e16a8cULL, 0xffffffff2d6dc448ULL,
+	0xffffffff32d678f2ULL, 0xffffffff381c6807ULL, 0xffffffff3d406bb2ULL, 0xffffffff424358e8ULL,
+	0xffffffff4725ff86ULL, 0xffffffff4be92a72ULL, 0xffffffff508d9fb7ULL, 0xffffffff551420a3ULL,
+	0xffffffff597d69e2ULL, 0xffffffff5dca3399ULL, 0xffffffff61fb3184ULL, 0xffffffff6611130eULL,
+	0xffffffff6a0c836aULL, 0xffffffff6dee29aeULL, 0xffffffff71b6a8edULL, 0xffffffff7566a04aULL,
+	0xffffffff78feab14ULL, 0xffffffff7c7f60ddULL, 0xffffffff7fe9558eULL, 0xffffffff833d197cULL,
+	0xffffffff867b3984ULL, 0xffffffff89a43f18ULL, 0xffffffff8cb8b058ULL, 0xffffffff8fb91026ULL,
+	0xffffffff92a5de36ULL, 0xffffffff957f9726ULL, 0xffffffff9846b48dULL, 0xffffffff9afbad11ULL,
+	0xffffffff9d9ef473ULL, 0xffffffffa030fba7ULL, 0xffffffffa2b230dfULL, 0xffffffffa522ffa1ULL,
+	0xffffffffa783d0d3ULL, 0xffffffffa9d50acfULL, 0xffffffffac17116eULL, 0xffffffffae4a4619ULL,
+	0xffffffffb06f07dbULL, 0xffffffffb285b369ULL, 0xffffffffb48ea337ULL, 0xffffffffb68a2f81ULL,
+	0xffffffffb878ae59ULL, 0xffffffffba5a73b8ULL, 0xffffffffbc2fd185ULL, 0xffffffffbdf917a7ULL,
+	0xffffffffbfb6940eULL, 0xffffffffc16892c1ULL, 0xffffffffc30f5de6ULL, 0xffffffffc4ab3dd4ULL,
+	0xffffffffc63c7916ULL, 0xffffffffc7c3547eULL, 0xffffffffc9401329ULL, 0xffffffffcab2f68fULL,
+	0xffffffffcc1c3e88ULL, 0xffffffffcd7c295aULL, 0xffffffffced2f3c1ULL, 0xffffffffd020d8f7ULL,
+	0xffffffffd16612c1ULL, 0xffffffffd2a2d974ULL, 0xffffffffd3d76401ULL, 0xffffffffd503e7fdULL,
+	0xffffffffd62899a7ULL, 0xffffffffd745abf2ULL, 0xffffffffd85b508fULL, 0xffffffffd969b7f1ULL,
+	0xffffffffda711158ULL, 0xffffffffdb718ad5ULL, 0xffffffffdc6b5154ULL, 0xffffffffdd5e90a4ULL,
+	0xffffffffde4b737bULL, 0xffffffffdf32237eULL, 0xffffffffe012c949ULL, 0xffffffffe0ed8c71ULL,
+	0xffffffffe1c29393ULL, 0xffffffffe2920450ULL, 0xffffffffe35c035bULL, 0xffffffffe420b478ULL,
+	0xffffffffe4e03a8aULL, 0xffffffffe59ab791ULL, 0xffffffffe6504cb3ULL, 0xffffffffe7011a41ULL,
+	0xffffffffe7ad3fbdULL, 0xffffffffe854dbddULL, 0xffffffffe8f80c91ULL, 0xffffffffe996ef0aULL,
+	0xffffffffea319fbaULL, 0xffffffffeac83a5dULL, 0xffffffffeb5ad9fcULL, 0xffffffffebe998f0ULL,
+	0xffffffffec7490e9ULL, 0xffffffffecfbdaf0ULL, 0xffffffffed7f8f6dULL, 0xffffffffedffc628ULL,
+	0xffffffffee7c9650ULL, 0xffffffffeef6167dULL, 0xffffffffef6c5cb6ULL, 0xffffffffefdf7e70ULL,
+	0xfffffffff04f9097ULL, 0xfffffffff0bca78eULL, 0xfffffffff126d733ULL, 0xfffffffff18e32e3ULL,
+	0xfffffffff1f2cd7eULL, 0xfffffffff254b966ULL, 0xfffffffff2b40887ULL, 0xfffffffff310cc58ULL,
+	0xfffffffff36b15deULL, 0xfffffffff3c2f5aeULL, 0xfffffffff4187bf1ULL, 0xfffffffff46bb866ULL,
+	0xfffffffff4bcba64ULL, 0xfffffffff50b90e0ULL, 0xfffffffff5584a6bULL, 0xfffffffff5a2f536ULL,
+	0xfffffffff5eb9f15ULL, 0xfffffffff6325583ULL, 0xfffffffff67725a0ULL, 0xfffffffff6ba1c38ULL,
+	0xfffffffff6fb45c0ULL, 0xfffffffff73aae5dULL, 0xfffffffff77861e2ULL, 0xfffffffff7b46bd8ULL,
+	0xfffffffff7eed777ULL, 0xfffffffff827afafULL, 0xfffffffff85eff29ULL, 0xfffffffff894d046ULL,
+	0xfffffffff8c92d22ULL, 0xfffffffff8fc1f97ULL, 0xfffffffff92db13eULL, 0xfffffffff95deb6fULL,
+	0xfffffffff98cd745ULL, 0xfffffffff9ba7d9fULL, 0xfffffffff9e6e720ULL, 0xfffffffffa121c32ULL,
+	0xfffffffffa3c2507ULL, 0xfffffffffa65099cULL, 0xfffffffffa8cd1b5ULL, 0xfffffffffab384e6ULL,
+	0xfffffffffad92a8fULL, 0xfffffffffafdc9e0ULL, 0xfffffffffb2169d6ULL, 0xfffffffffb441143ULL,
+	0xfffffffffb65c6c8ULL, 0xfffffffffb8690ddULL, 0xfffffffffba675cdULL, 0xfffffffffbc57bb8ULL,
+	0xfffffffffbe3a896ULL, 0xfffffffffc010238ULL, 0xfffffffffc1d8e46ULL, 0xfffffffffc395243ULL,
+	0xfffffffffc54538eULL, 0xfffffffffc6e975fULL, 0xfffffffffc8822ceULL, 0xfffffffffca0facfULL,
+	0xfffffffffcb92436ULL, 0xfffffffffcd0a3b4ULL, 0xfffffffffce77dddULL, 0xfffffffffcfdb725ULL,
+	0xfffffffffd1353e2ULL, 0xfffffffffd28584dULL, 0xfffffffffd3cc881ULL, 0xfffffffffd50a880ULL,
+	0xfffffffffd63fc2fULL, 0xfffffffffd76c758ULL, 0xfffffffffd890dadULL, 0xfffffffffd9ad2c6ULL,
+	0xfffffffffdac1a23ULL, 0xfffffffffdbce72cULL, 0xfffffffffdcd3d32ULL, 0xfffffffffddd1f70ULL,
+	0xfffffffffdec910aULL, 0xfffffffffdfb950fULL, 0xfffffffffe0a2e7aULL, 0xfffffffffe186030ULL,
+	0xfffffffffe262d04ULL, 0xfffffffffe3397b5ULL, 0xfffffffffe40a2eeULL, 0xfffffffffe4d514bULL,
+	0xfffffffffe59a553ULL, 0xfffffffffe65a17dULL, 0xfffffffffe71482fULL, 0xfffffffffe7c9bc0ULL,
+	0xfffffffffe879e74ULL, 0xfffffffffe925282ULL, 0xfffffffffe9cba11ULL, 0xfffffffffea6d738ULL,
+	0xfffffffffeb0ac02ULL, 0xfffffffffeba3a6bULL, 0xfffffffffec38460ULL, 0xfffffffffecc8bc3ULL,
+	0xfffffffffed55267ULL, 0xfffffffffeddda14ULL, 0xfffffffffee62484ULL, 0xfffffffffeee3368ULL,
+	0xfffffffffef60863ULL, 0xfffffffffefda50cULL, 0xffffffffff050af2ULL, 0xffffffffff0c3b96ULL,
+	0xffffffffff133871ULL, 0xffffffffff1a02f0ULL, 0xffffffffff209c78ULL, 0xffffffffff270663ULL,
+	0xffffffffff2d4202ULL, 0xffffffffff33509dULL, 0xffffffffff393373ULL, 0xffffffffff3eebbaULL,
+	0xffffffffff447aa0ULL, 0xffffffffff49e14bULL, 0xffffffffff4f20d8ULL, 0xffffffffff543a5eULL,
+	0xffffffffff592eeaULL, 0xffffffffff5dff84ULL, 0xffffffffff62ad2cULL, 0xffffffffff6738dbULL,
+	0xffffffffff6ba383ULL, 0xffffffffff6fee0eULL, 0xffffffffff741963ULL, 0xffffffffff782660ULL,
+	0xffffffffff7c15deULL, 0xffffffffff7fe8b0ULL, 0xffffffffff839fa2ULL, 0xffffffffff873b7dULL,
+	0xffffffffff8abd01ULL, 0xffffffffff8e24edULL, 0xffffffffff9173f6ULL, 0xffffffffff94aad0ULL,
+	0xffffffffff97ca28ULL, 0xffffffffff9ad2a7ULL, 0xffffffffff9dc4f0ULL, 0xffffffffffa0a1a5ULL,
+	0xffffffffffa3695fULL, 0xffffffffffa61cb5ULL, 0xffffffffffa8bc3cULL, 0xffffffffffab4880ULL,
+	0xffffffffffadc20dULL, 0xffffffffffb0296bULL, 0xffffffffffb27f1bULL, 0xffffffffffb4c39fULL,
+	0xffffffffffb6f771ULL, 0xffffffffffb91b0aULL, 0xffffffffffbb2ee0ULL, 0xffffffffffbd3366ULL,
+	0xffffffffffbf2908ULL, 0xffffffffffc11035ULL, 0xffffffffffc2e953ULL, 0xffffffffffc4b4caULL,
+	0xffffffffffc672fdULL, 0xffffffffffc8244aULL, 0xffffffffffc9c912ULL, 0xffffffffffcb61adULL,
+	0xffffffffffccee75ULL, 0xffffffffffce6fc0ULL, 0xffffffffffcfe5e2ULL, 0xffffffffffd1512bULL,
+	0xffffffffffd2b1ecULL, 0xffffffffffd4086fULL, 0xffffffffffd55502ULL, 0xffffffffffd697ebULL,
+	0xffffffffffd7d171ULL, 0xffffffffffd901daULL, 0xffffffffffda2967ULL, 0xffffffffffdb485aULL,
+	0xffffffffffdc5ef1ULL, 0xffffffffffdd6d6aULL, 0xffffffffffde7400ULL, 0xffffffffffdf72eeULL,
+	0xffffffffffe06a6aULL, 0xffffffffffe15aacULL, 0xffffffffffe243eaULL, 0xffffffffffe32655ULL,
+	0xffffffffffe40222ULL, 0xffffffffffe4d77fULL, 0xffffffffffe5a69eULL, 0xffffffffffe66fabULL,
+	0xffffffffffe732d3ULL, 0xffffffffffe7f042ULL, 0xffffffffffe8a823ULL, 0xffffffffffe95a9dULL,
+	0xffffffffffea07d9ULL, 0xffffffffffeaaffeULL, 0xffffffffffeb5332ULL, 0xffffffffffebf198ULL,
+	0xffffffffffec8b55ULL, 0xffffffffffed208aULL, 0xffffffffffedb15aULL, 0xffffffffffee3de6ULL,
+	0xffffffffffeec64cULL, 0xffffffffffef4aabULL, 0xffffffffffefcb22ULL, 0xfffffffffff047cdULL,
+	0xfffffffffff0c0c9ULL, 0xfffffffffff13631ULL, 0xfffffffffff1a820ULL, 0xfffffffffff216afULL,
+	0xfffffffffff281f8ULL, 0xfffffffffff2ea13ULL, 0xfffffffffff34f17ULL, 0xfffffffffff3b11dULL,
+	0xfffffffffff41039ULL, 0xfffffffffff46c83ULL, 0xfffffffffff4c60fULL, 0xfffffffffff51cf1ULL,
+	0xfffffffffff5713dULL, 0xfffffffffff5c307ULL, 0xfffffffffff61262ULL, 0xfffffffffff65f60ULL,
+	0xfffffffffff6aa12ULL, 0xfffffffffff6f28aULL, 0xfffffffffff738d9ULL, 0xfffffffffff77d0eULL,
+	0xfffffffffff7bf3aULL, 0xfffffffffff7ff6bULL, 0xfffffffffff83db1ULL, 0xfffffffffff87a1bULL,
+	0xfffffffffff8b4b5ULL, 0xfffffffffff8ed8eULL, 0xfffffffffff924b3ULL, 0xfffffffffff95a31ULL,
+	0xfffffffffff98e14ULL, 0xfffffffffff9c069ULL, 0xfffffffffff9f13bULL, 0xfffffffffffa2095ULL,
+	0xfffffffffffa4e84ULL, 0xfffffffffffa7b10ULL, 0xfffffffffffaa646ULL, 0xfffffffffffad02eULL,
+	0xfffffffffffaf8d4ULL, 0xfffffffffffb2040ULL, 0xfffffffffffb467cULL, 0xfffffffffffb6b90ULL,
+	0xfffffffffffb8f86ULL, 0xfffffffffffbb266ULL, 0xfffffffffffbd439ULL, 0xfffffffffffbf505ULL,
+	0xfffffffffffc14d4ULL, 0xfffffffffffc33adULL, 0xfffffffffffc5196ULL, 0xfffffffffffc6e98ULL,
+	0xfffffffffffc8ab8ULL, 0xfffffffffffca5ffULL, 0xfffffffffffcc071ULL, 0xfffffffffffcda16ULL,
+	0xfffffffffffcf2f4ULL, 0xfffffffffffd0b10ULL, 0xfffffffffffd2271ULL, 0xfffffffffffd391cULL,
+	0xfffffffffffd4f16ULL, 0xfffffffffffd6465ULL, 0xfffffffffffd790eULL, 0xfffffffffffd8d16ULL,
+	0xfffffffffffda081ULL, 0xfffffffffffdb355ULL, 0xfffffffffffdc596ULL, 0xfffffffffffdd748ULL,
+	0xfffffffffffde86fULL, 0xfffffffffffdf911ULL, 0xfffffffffffe0930ULL, 0xfffffffffffe18d1ULL,
+	0xfffffffffffe27f7ULL, 0xfffffffffffe36a7ULL, 0xfffffffffffe44e4ULL, 0xfffffffffffe52b0ULL,
+	0xfffffffffffe6011ULL, 0xfffffffffffe6d08ULL, 0xfffffffffffe799aULL, 0xfffffffffffe85c8ULL,
+	0xfffffffffffe9197ULL, 0xfffffffffffe9d09ULL, 0xfffffffffffea821ULL, 0xfffffffffffeb2e1ULL,
+	0xfffffffffffebd4cULL, 0xfffffffffffec766ULL, 0xfffffffffffed12fULL, 0xfffffffffffedaacULL,
+	0xfffffffffffee3ddULL, 0xfffffffffffeecc6ULL, 0xfffffffffffef568ULL, 0xfffffffffffefdc6ULL,
+	0xffffffffffff05e2ULL, 0xffffffffffff0dbeULL, 0xffffffffffff155bULL, 0xffffffffffff1cbcULL,
+	0xffffffffffff23e3ULL, 0xffffffffffff2ad1ULL, 0xffffffffffff3187ULL, 0xffffffffffff3809ULL,
+	0xffffffffffff3e56ULL, 0xffffffffffff4472ULL, 0xffffffffffff4a5dULL, 0xffffffffffff5019ULL,
+	0xffffffffffff55a7ULL, 0xffffffffffff5b09ULL, 0xffffffffffff6040ULL, 0xffffffffffff654eULL,
+	0xffffffffffff6a33ULL, 0xffffffffffff6ef1ULL, 0xffffffffffff7389ULL, 0xffffffffffff77fdULL,
+	0xffffffffffff7c4dULL, 0xffffffffffff807aULL, 0xffffffffffff8486ULL, 0xffffffffffff8872ULL,
+	0xffffffffffff8c3eULL, 0xffffffffffff8fecULL, 0xffffffffffff937cULL, 0xffffffffffff96f0ULL,
+	0xffffffffffff9a48ULL, 0xffffffffffff9d85ULL, 0xffffffffffffa0a8ULL, 0xffffffffffffa3b2ULL,
+	0xffffffffffffa6a4ULL, 0xffffffffffffa97eULL, 0xffffffffffffac41ULL, 0xffffffffffffaeedULL,
+	0xffffffffffffb184ULL, 0xffffffffffffb406ULL, 0xffffffffffffb674ULL, 0xffffffffffffb8cfULL,
+	0xffffffffffffbb16ULL, 0xffffffffffffbd4bULL, 0xffffffffffffbf6eULL, 0xffffffffffffc180ULL,
+	0xffffffffffffc381ULL, 0xffffffffffffc572ULL, 0xffffffffffffc753ULL, 0xffffffffffffc925ULL,
+	0xffffffffffffcae8ULL, 0xffffffffffffcc9dULL, 0xffffffffffffce44ULL, 0xffffffffffffcfdeULL,
+	0xffffffffffffd16bULL, 0xffffffffffffd2ebULL, 0xffffffffffffd45fULL, 0xffffffffffffd5c7ULL,
+	0xffffffffffffd723ULL, 0xffffffffffffd875ULL, 0xffffffffffffd9bcULL, 0xffffffffffffdaf8ULL,
+	0xffffffffffffdc2aULL, 0xffffffffffffdd53ULL, 0xffffffffffffde72ULL, 0xffffffffffffdf88ULL,
+	0xffffffffffffe095ULL, 0xffffffffffffe19aULL, 0xffffffffffffe296ULL, 0xffffffffffffe38aULL,
+	0xffffffffffffe476ULL, 0xffffffffffffe55bULL, 0xffffffffffffe638ULL, 0xffffffffffffe70fULL,
+	0xffffffffffffe7deULL, 0xffffffffffffe8a7ULL, 0xffffffffffffe969ULL, 0xffffffffffffea26ULL,
+	0xffffffffffffeadcULL, 0xffffffffffffeb8cULL, 0xffffffffffffec37ULL, 0xffffffffffffecdcULL,
+	0xffffffffffffed7cULL, 0xffffffffffffee16ULL, 0xffffffffffffeeacULL, 0xffffffffffffef3dULL,
+	0xffffffffffffefc9ULL, 0xfffffffffffff051ULL, 0xfffffffffffff0d4ULL, 0xfffffffffffff153ULL,
+	0xfffffffffffff1ceULL, 0xfffffffffffff245ULL, 0xfffffffffffff2b8ULL, 0xfffffffffffff328ULL,
+	0xfffffffffffff394ULL, 0xfffffffffffff3fcULL, 0xfffffffffffff461ULL, 0xfffffffffffff4c3ULL,
+	0xfffffffffffff521ULL, 0xfffffffffffff57dULL, 0xfffffffffffff5d5ULL, 0xfffffffffffff62bULL,
+	0xfffffffffffff67eULL, 0xfffffffffffff6ceULL, 0xfffffffffffff71bULL, 0xfffffffffffff766ULL,
+	0xfffffffffffff7afULL, 0xfffffffffffff7f5ULL, 0xfffffffffffff839ULL, 0xfffffffffffff87bULL,
+	0xfffffffffffff8bbULL, 0xfffffffffffff8f8ULL, 0xfffffffffffff934ULL, 0xfffffffffffff96dULL,
+	0xfffffffffffff9a5ULL, 0xfffffffffffff9dbULL, 0xfffffffffffffa0fULL, 0xfffffffffffffa41ULL,
+	0xfffffffffffffa72ULL, 0xfffffffffffffaa1ULL, 0xfffffffffffffacfULL, 0xfffffffffffffafbULL,
+	0xfffffffffffffb26ULL, 0xfffffffffffffb4fULL, 0xfffffffffffffb77ULL, 0xfffffffffffffb9dULL,
+	0xfffffffffffffbc3ULL, 0xfffffffffffffbe7ULL, 0xfffffffffffffc0aULL, 0xfffffffffffffc2cULL,
+	0xfffffffffffffc4cULL, 0xfffffffffffffc6cULL, 0xfffffffffffffc8aULL, 0xfffffffffffffca8ULL,
+	0xfffffffffffffcc5ULL, 0xfffffffffffffce0ULL, 0xfffffffffffffcfbULL, 0xfffffffffffffd15ULL,
+	0xfffffffffffffd2eULL, 0xfffffffffffffd46ULL, 0xfffffffffffffd5dULL, 0xfffffffffffffd74ULL,
+	0xfffffffffffffd8aULL, 0xfffffffffffffd9fULL, 0xfffffffffffffdb3ULL, 0xfffffffffffffdc7ULL,
+	0xfffffffffffffddaULL, 0xfffffffffffffdedULL, 0xfffffffffffffdfeULL, 0xfffffffffffffe10ULL,
+	0xfffffffffffffe20ULL, 0xfffffffffffffe31ULL, 0xfffffffffffffe40ULL, 0xfffffffffffffe4fULL,
+	0xfffffffffffffe5eULL, 0xfffffffffffffe6cULL, 0xfffffffffffffe79ULL, 0xfffffffffffffe87ULL,
+	0xfffffffffffffe93ULL, 0xfffffffffffffea0ULL, 0xfffffffffffffeacULL, 0xfffffffffffffeb7ULL,
+	0xfffffffffffffec2ULL, 0xfffffffffffffecdULL, 0xfffffffffffffed7ULL, 0xfffffffffffffee1ULL,
+	0xfffffffffffffeebULL, 0xfffffffffffffef4ULL, 0xfffffffffffffefdULL, 0xffffffffffffff06ULL,
+	0xffffffffffffff0fULL, 0xffffffffffffff17ULL, 0xffffffffffffff1fULL, 0xffffffffffffff26ULL,
+	0xffffffffffffff2eULL, 0xffffffffffffff35ULL, 0xffffffffffffff3cULL, 0xffffffffffffff43ULL,
+	0xffffffffffffff49ULL, 0xffffffffffffff4fULL, 0xffffffffffffff55ULL, 0xffffffffffffff5bULL,
+	0xffffffffffffff61ULL, 0xffffffffffffff66ULL, 0xffffffffffffff6bULL, 0xffffffffffffff70ULL,
+	0xffffffffffffff75ULL, 0xffffffffffffff7aULL, 0xffffffffffffff7fULL, 0xffffffffffffff83ULL,
+	0xffffffffffffff87ULL, 0xffffffffffffff8bULL, 0xffffffffffffff8fULL, 0xffffffffffffff93ULL,
+	0xffffffffffffff97ULL, 0xffffffffffffff9aULL, 0xffffffffffffff9eULL, 0xffffffffffffffa1ULL,
+	0xffffffffffffffa5ULL, 0xffffffffffffffa8ULL, 0xffffffffffffffabULL, 0xffffffffffffffaeULL,
+	0xffffffffffffffb0ULL, 0xffffffffffffffb3ULL, 0xffffffffffffffb6ULL, 0xffffffffffffffb8ULL,
+	0xffffffffffffffbbULL, 0xffffffffffffffbdULL, 0xffffffffffffffbfULL, 0xffffffffffffffc2ULL,
+	0xffffffffffffffc4ULL, 0xffffffffffffffc6ULL, 0xffffffffffffffc8ULL, 0xffffffffffffffcaULL,
+	0xffffffffffffffccULL, 0xffffffffffffffcdULL, 0xffffffffffffffcfULL, 0xffffffffffffffd1ULL,
+	0xffffffffffffffd2ULL, 0xffffffffffffffd4ULL, 0xffffffffffffffd6ULL, 0xffffffffffffffd7ULL,
+	0xffffffffffffffd8ULL, 0xffffffffffffffdaULL, 0xffffffffffffffdbULL, 0xffffffffffffffdcULL,
+	0xffffffffffffffdeULL, 0xffffffffffffffdfULL, 0xffffffffffffffe0ULL, 0xffffffffffffffe1ULL,
+	0xffffffffffffffe2ULL, 0xffffffffffffffe3ULL, 0xffffffffffffffe4ULL, 0xffffffffffffffe5ULL,
+	0xffffffffffffffe6ULL, 0xffffffffffffffe7ULL, 0xffffffffffffffe8ULL, 0xffffffffffffffe9ULL,
+	0xffffffffffffffe9ULL, 0xffffffffffffffeaULL, 0xffffffffffffffebULL, 0xffffffffffffffecULL,
+	0xffffffffffffffecULL, 0xffffffffffffffedULL, 0xffffffffffffffeeULL, 0xffffffffffffffeeULL,
+	0xffffffffffffffefULL, 0xffffffffffffffefULL, 0xfffffffffffffff0ULL, 0xfffffffffffffff1ULL,
+	0xfffffffffffffff1ULL, 0xfffffffffffffff2ULL, 0xfffffffffffffff2ULL, 0xfffffffffffffff3ULL,
+	0xfffffffffffffff3ULL, 0xfffffffffffffff3ULL, 0xfffffffffffffff4ULL, 0xfffffffffffffff4ULL,
+	0xfffffffffffffff5ULL, 0xfffffffffffffff5ULL, 0xfffffffffffffff5ULL, 0xfffffffffffffff6ULL,
+	0xfffffffffffffff6ULL, 0xfffffffffffffff6ULL, 0xfffffffffffffff7ULL, 0xfffffffffffffff7ULL,
+	0xfffffffffffffff7ULL, 0xfffffffffffffff8ULL, 0xfffffffffffffff8ULL, 0xfffffffffffffff8ULL,
+	0xfffffffffffffff8ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL,
+	0xfffffffffffffff9ULL, 0xfffffffffffffffaULL, 0xfffffffffffffffaULL, 0xfffffffffffffffaULL,
+	0xfffffffffffffffaULL, 0xfffffffffffffffaULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL,
+	0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL,
+	0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL,
+	0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+};
+
+static const uint16_t cdt_guide_bliss_250[257] = {
+	   0,    1,    2,    4,    5,    6,    7,    9,   10,   11,   12,   13,   15,   16,   17,   18,
+	  20,   21,   22,   23,   25,   26,   27,   28,   30,   31,   32,   33,   34,   36,   37,   38,
+	  39,   41,   42,   43,   44,   46,   47,   48,   49,   51,   52,   53,   54,   56,   57,   58,
+	  59,   61,   62,   63,   64,   66,   67,   68,   70,   71,   72,   73,   75,   76,   77,   79,
+	  80,   81,   82,   84,   85,   86,   88,   89,   90,   92,   93,   94,   95,   97,   98,   99,
+	 101,  102,  103,  105,  106,  107,  109,  110,  112,  113,  114,  116,  117,  118,  120,  121,
+	 122,  124,  125,  127,  128,  129,  131,  132,  134,  135,  136,  138,  139,  141,  142,  144,
+	 145,  147,  148,  149,  151,  152,  154,  155,  157,  158,  160,  161,  163,  164,  166,  167,
+	 169,  171,  172,  174,  175,  177,  178,  180,  182,  183,  185,  186,  188,  190,  191,  193,
+	 195,  196,  198,  200,  201,  203,  205,  206,  208,  210,  212,  213,  215,  217,  219,  220,
+	 222,  224,  226,  228,  230,  232,  233,  235,  237,  239,  241,  243,  245,  247,  249,  251,
+	 253,  255,  257,  259,  261,  263,  266,  268,  270,  272,  274,  277,  279,  281,  284,  286,
+	 288,  291,  293,  295,  298,  300,  303,  306,  308,  311,  313,  316,  319,  322,  324,  327,
+	 330,  333,  336,  339,  342,  345,  349,  352,  355,  359,  362,  366,  369,  373,  377,  380,
+	 384,  388,  393,  397,  401,  406,  410,  415,  420,  425,  430,  436,  441,  447,  453,  460,
+	 467,  474,  481,  489,  498,  507,  517,  528,  540,  553,  568,  585,  606,  632,  666,  723,
+	2294,
+};
+
+#define CDT_271_SIZE 2488
+
+static const uint64_t cdt_bliss_271[CDT_271_SIZE] = {
+	0x006032c8db769a90ULL, 0x0120980538e1a0ccULL, 0x01e0fc418aa9466aULL, 0x02a15ed32155d9e7ULL,
+	0x0361bf0f51df7258ULL, 0x04221c4b77742416ULL, 0x04e275dcf53e19e0ULL, 0x05a2cb1938298a90ULL,
+	0x06631b55b8aa838aULL, 0x072365e7fc828005ULL, 0x07e3aa259885c55cULL, 0x08a3e76432607c77ULL,
+	0x09641cf9825b8096ULL, 0x0a244a3b5520db8bULL, 0x0ae46e7f8d7fe79aULL, 0x0ba4891c26310f34ULL,
+	0x0c649967339922afULL, 0x0d249eb6e58c3c3bULL, 0x0de4986189102a40ULL, 0x0ea485bd8a1e586eULL,
+	0x0f64662175652f9cULL, 0x102438e3fa08e4deULL, 0x10e3fd5beb63aff3ULL, 0x11a3b2e042c56162ULL,
+	0x126358c82132508bULL, 0x1322ee6ad1219a02ULL, 0x13e2731fc83aa67bULL, 0x14a1e63ea911f2a6ULL,
+	0x1561471f44e51056ULL, 0x162095199d55d953ULL, 0x16dfcf85e624cc3aULL, 0x179ef5bc86ea8bdaULL,
+	0x185e07161cd0797bULL, 0x191d02eb7c486289ULL, 0x19dbe895b2c33a13ULL, 0x1a9ab76e0866d6b4ULL,
+	0x1b596ece01c2ad53ULL, 0x1c180e0f61838161ULL, 0x1cd6948c2a260317ULL, 0x1d95019e9fa85454ULL,
+	0x1e5354a1493a6cc5ULL, 0x1f118ceef2ed55f0ULL, 0x1fcfa9e2af6137dbULL, 0x208daad7d9722f0aULL,
+	0x214b8f2a15e3e483ULL, 0x22095635550be0b1ULL, 0x22c6ff55d47a91e3ULL, 0x238489e820a2ff47ULL,
+	0x2441f54916812140ULL, 0x24ff40d5e53ed7efULL, 0x25bc6bec0fd778f1ULL, 0x267975e96eb9ed40ULL,
+	0x27365e2c31695832ULL, 0x27f32412e01c40abULL, 0x28afc6fc5d5a3589ULL, 0x296c4647e797e671ULL,
+	0x2a28a1551ad1aa16ULL, 0x2ae4d783f2246b36ULL, 0x2ba0e834c964f57aULL, 0x2c5cd2c85eb59b7fULL,
+	0x2d18969fd41a2f5eULL, 0x2dd4331cb10a46f7ULL, 0x2e8fa7a0e401c576ULL, 0x2f4af38ec40fa36cULL,
+	0x300616491262eeffULL, 0x30c10f32fbd5fdaaULL, 0x317bddb01a77c91bULL, 0x32368124771370d4ULL,
+	0x32f0f8f48ab5da19ULL, 0x33ab4485403167f0ULL, 0x3465633bf59fc4e2ULL, 0x351f547e7de1b843ULL,
+	0x35d917b3221d00ddULL, 0x3692ac40a3382ec7ULL, 0x374c118e3b54766bULL, 0x380547039f45769cULL,
+	0x38be4c090006ebccULL, 0x397720070c304a6cULL, 0x3a2fc266f1663a90ULL, 0x3ae832925dc9ef02ULL,
+	0x3ba06ff381665200ULL, 0x3c5879f50f9b01d7ULL, 0x3d105002408517bcULL, 0x3dc7f186d265b33bULL,
+	0x3e7f5def0b06449dULL, 0x3f3694a7b91a90ceULL, 0x3fed951e35a06937ULL, 0x40a45ec0653d1238ULL,
+	0x415af0fcb99852beULL, 0x42114b4232b527d3ULL, 0x42c76d00604816bdULL, 0x437d55a7630b1891ULL,
+	0x443304a7ee0f1a08ULL, 0x44e87973480b0a8cULL, 0x459db37b4ca8755eULL, 0x4652b2326dcd9ff9ULL,
+	0x4707750bb4e528aaULL, 0x47bbfb7ac4232096ULL, 0x487044f3d7c79c54ULL, 0x492450ebc75eb667ULL,
+	0x49d81ed806fdfedbULL, 0x4a8bae2ea87f537cULL, 0x4b3efe665cb91bfaULL, 0x4bf20ef674b3e593ULL,
+	0x4ca4df56e2dd59bfULL, 0x4d576f003c388b8eULL, 0x4e09bd6bb98b9750ULL, 0x4ebbca13388a905dULL,
+	0x4f6d94713cffb8b8ULL, 0x501f1c00f1f0fe70ULL, 0x50d0603e2ac2bab8ULL, 0x518160a56457ae9fULL,
+	0x52321cb3c62e3989ULL, 0x52e293e7237ac57bULL, 0x5392c5bdfc3f6572ULL, 0x5442b1b77e60a1f8ULL,
+	0x54f2575386b77056ULL, 0x55a1b612a22050b7ULL, 0x5650cd760e878faaULL, 0x56ff9cffbbf2a799ULL,
+	0x57ae24324d86bea9ULL, 0x585c62911a8c3dbdULL, 0x590a57a02f6f7d4aULL, 0x59b802e44ebe84b7ULL,
+	0x5a6563e2f223d929ULL, 0x5b127a224b5e589fULL, 0x5bbf452945361e4eULL, 0x5c6bc47f846e6d54ULL,
+	0x5d17f7ad68b49ec8ULL, 0x5dc3de3c0d8c1067ULL, 0x5e6f77b54b371105ULL, 0x5f1ac3a3b79cc821ULL,
+	0x5fc5c192a72c15ebULL, 0x6070710e2dbb693bULL, 0x611ad1a31f6588e8ULL, 0x61c4e2df11634e22ULL,
+	0x626ea4505ae24d6aULL, 0x6318158615d86bddULL, 0x63c136101fd45e97ULL, 0x646a057f1acb1213ULL,
+	0x651283646de1f75aULL, 0x65baaf5246363513ULL, 0x666288db97a0ba71ULL, 0x670a0f941d773226ULL,
+	0x67b143105b49d383ULL, 0x685822e59d9e100bULL, 0x68feaea9faa61bcfULL, 0x69a4e5f452f54ee9ULL,
+	0x6a4ac85c52315e9eULL, 0x6af0557a6fc06c9dULL, 0x6b958ce7ef73eb07ULL, 0x6c3a6e3ee23053d2ULL,
+	0x6cdef91a2691b25eULL, 0x6d832d15698cfdefULL, 0x6e2709cd270e4402ULL, 0x6eca8edeaa93a15dULL,
+	0x6f6dbbe80fc508e8ULL, 0x701090884308d759ULL, 0x70b30c5f021532deULL, 0x71552f0cdc7e35faULL,
+	0x71f6f8333440e4dcULL, 0x729867743e4aec93ULL, 0x73397c7302ff2b70ULL, 0x73da36d35eb7023cULL,
+	0x747a963a02406da3ULL, 0x751a9a4c7358e793ULL, 0x75ba42b10d251035ULL, 0x76598f0f00a51e41ULL,
+	0x76f87f0e5526167aULL, 0x77971257e8afca49ULL, 0x78354895706f9d56ULL, 0x78d3217179201236ULL,
+	0x79709c97676d1e3fULL, 0x7a0db9b3785544acULL, 0x7aaa7872c1877949ULL, 0x7b46d88331bdcaf7ULL,
+	0x7be2d9939114d65cULL, 0x7c7e7b5381600138ULL, 0x7d19bd737e7a7ecaULL, 0x7db49fa4de951deaULL,
+	0x7e4f2199d280e161ULL, 0x7ee9430565f66340ULL, 0x7f83039b7fda03efULL, 0x801c6310e27ce5bfULL,
+	0x80b5611b2bdab5f3ULL, 0x814dfd70d5d44417ULL, 0x81e637c93666e8c5ULL, 0x827e0fdc7fe0bcd3ULL,
+	0x83158563c111a218ULL, 0x83ac9818e5791ef8ULL, 0x844347b6b5710dffULL, 0x84d993f8d65522d8ULL,
+	0x856f7c9bcaa74602ULL, 0x8605015cf230c8bfULL, 0x869a21fa8a2072bdULL, 0x872ede33ad256affULL,
+	0x87c335c85386fdbbULL, 0x88572879533940d7ULL, 0x88eab6085fee98c1ULL, 0x897dde380b261f7cULL,
+	0x8a10a0cbc436efbbULL, 0x8aa2fd87d85855feULL, 0x8b34f43172a6e9b1ULL, 0x8bc6848e9c269050ULL,
+	0x8c57ae663bc16cbdULL, 0x8ce871801643bce2ULL, 0x8d78cda4ce54a7eeULL, 0x8e08c29de46bff5bULL,
+	0x8e985035b6c4f531ULL, 0x8f277637814dc9d8ULL, 0x8fb6346f5d9473f5ULL, 0x90448aaa42b044d5ULL,
+	0x90d278b605288bf9ULL, 0x915ffe6156d83c58ULL, 0x91ed1b7bc6ce9616ULL, 0x9279cfd5c12cd754ULL,
+	0x93061b408f00f6fbULL, 0x9391fd8e561d6c41ULL, 0x941d769218ee05e1ULL, 0x94a8861fb649d3e5ULL,
+	0x95332c0be942270eULL, 0x95bd682c48eea8deULL, 0x96473a5748368f6aULL, 0x96d0a2643596f003ULL,
+	0x9759a02b3ae63405ULL, 0x97e233855d14b2f4ULL, 0x986a5c4c7bea7544ULL, 0x98f21a5b51c22320ULL,
+	0x99796d8d7341228eULL, 0x9a0055bf4f0ce871ULL, 0x9a86d2ce2d7d7fd8ULL, 0x9b0ce498304d4b31ULL,
+	0x9b928afc524602eeULL, 0x9c17c5da66eaf53cULL, 0x9c9c95131a208a86ULL, 0x9d20f887efd1126fULL,
+	0x9da4f01b438edd0fULL, 0x9e287bb04833a444ULL, 0x9eab9b2b077d48f0ULL, 0x9f2e4e7061a7e806ULL,
+	0x9fb095660d054b5dULL, 0xa0326ff29591ba4bULL, 0xa0b3ddfd5c862dfcULL, 0xa134df6e97e7eda4ULL,
+	0xa1b5742f521596adULL, 0xa2359c29695194f4ULL, 0xa2b557478f4a0f56ULL, 0xa334a575489e4cbcULL,
+	0xa3b3869eec6195f5ULL, 0xa431fab1a39b989fULL, 0xa4b0019b68c64f7fULL, 0xa52d9b4b074974a7ULL,
+	0xa5aac7b01af381cfULL, 0xa62786bb0f70435aULL, 0xa6a3d85d1fbd0285ULL, 0xa71fbc88559a4b3cULL,
+	0xa79b332f88fb5227ULL, 0xa8163c465f72ff8dULL, 0xa890d7c14b9ea3a2ULL, 0xa90b05958c8e58e8ULL,
+	0xa984c5b92d2b195bULL, 0xa9fe1823039a8b12ULL, 0xaa76fccab0a08928ULL, 0xaaef73a89efe6d9cULL,
+	0xab677cb602d0210bULL, 0xabdf17ecd8e6f510ULL, 0xac564547e6224e2dULL, 0xaccd04c2b6c62218ULL,
+	0xad4356599dcf4f6eULL, 0xadb93a09b445d39bULL, 0xae2eafd0d88ce41bULL, 0xaea3b7adadb0eff0ULL,
+	0xaf18519f9ab38e68ULL, 0xaf8c7da6c9d5603eULL, 0xb0003bc427dde81dULL, 0xb0738bf963615fb2ULL,
+	0xb0e66e48ec048e56ULL, 0xb158e2b5f1bea68bULL, 0xb1cae94464192f64ULL, 0xb23c81f8f16dff12ULL,
+	0xb2adacd906234bcbULL, 0xb31e69eacbe5d840ULL, 0xb38eb93528e140e6ULL, 0xb3fe9abfbef66f56ULL,
+	0xb46e0e92eaf0390bULL, 0xb4dd14b7c3b62ed1ULL, 0xb54bad38197da227ULL, 0xb5b9d81e74f8e606ULL,
+	0xb62795761684d04cULL, 0xb694e54af554813cULL, 0xb701c7a9be9b7666ULL, 0xb76e3c9fd4b5ee71ULL,
+	0xb7da443b4e4fa31eULL, 0xb845de8af588def4ULL, 0xb8b10b9e4719f418ULL, 0xb91bcb85717519a3ULL,
+	0xb9861e5153e6b511ULL, 0xb9f004137db41520ULL, 0xba597cde2d38a3beULL, 0xbac288c44f01945cULL,
+	0xbb2b27d97ce81453ULL, 0xbb935a31fd2a02b5ULL, 0xbbfb1fe2c1813530ULL, 0xbc62790166394f74ULL,
+	0xbcc965a4314432b3ULL, 0xbd2fe5e2114d0abaULL, 0xbd95f9d29cc9fe3eULL, 0xbdfba18e110c87dbULL,
+	0xbe60dd2d51507d60ULL, 0xbec5acc9e5c9caf0ULL, 0xbf2a107dfab0e792ULL, 0xbf8e08645f4e08bbULL,
+	0xbff1949885031a5eULL, 0xc054b5367e54812dULL, 0xc0b76a5afdf0ac87ULL, 0xc119b42355b67dacULL,
+	0xc17b92ad75ba89d8ULL, 0xc1dd0617eb4b3ccdULL, 0xc23e0e81dff3e15eULL, 0xc29eac0b187e959bULL,
+	0xc2feded3f3f5302cULL, 0xc35ea6fd6aa11c62ULL, 0xc3be04a90d0a32adULL, 0xc41cf7f902f492e3ULL,
+	0xc47b81100a5d860fULL, 0xc4d9a01176776d3bULL, 0xc53755212ea4c2cdULL, 0xc594a063ad723410ULL,
+	0xc5f181fdff8fd85dULL, 0xc64dfa15c2c98b85ULL, 0xc6aa08d124fe70f8ULL, 0xc705ae56e317a532ULL,
+	0xc760eace47fe22f5ULL, 0xc7bbbe5f2b8fe1d2ULL, 0xc8162931f1943383ULL, 0xc8702b6f88af658fULL,
+	0xc8c9c5416955acb7ULL, 0xc922f6d194bd5fb0ULL, 0xc97bc04a93d0868aULL, 0xc9d421d7761dc44eULL,
+	0xca2c1ba3d0c8a036ULL, 0xca83addbbd7933f6ULL, 0xcadad8abd94b4476ULL, 0xcb319c4143bcca76ULL,
+	0xcb87f8c99d9bf06fULL, 0xcbddee7307f48b14ULL, 0xcc337d6c22fd11e2ULL, 0xcc88a5e40d031cffULL,
+	0xccdd680a61576dceULL, 0xcd31c40f37398788ULL, 0xcd85ba2320c2dd23ULL, 0xcdd94a7729d199d0ULL,
+	0xce2c753cd6f3095fULL, 0xce7f3aa6244da5b7ULL, 0xced19ae5848acebbULL, 0xcf23962ddfc031aeULL,
+	0xcf752cb29258e574ULL, 0xcfc65ea76bfe40b4ULL, 0xd0172c40ae806f26ULL, 0xd06795b30cbecb20ULL,
+	0xd0b79b33a9900084ULL, 0xd1073cf816a9fe2aULL, 0xd1567b365389bae0ULL, 0xd1a55624cc5ad301ULL,
+	0xd1f3cdfa58df03c3ULL, 0xd241e2ee3b55892aULL, 0xd28f95381f6263adULL, 0xd2dce51018f58a7dULL,
+	0xd329d2aea3320f6dULL, 0xd3765e4c9f553958ULL, 0xd3c28823539d99faULL, 0xd40e506c6a322416ULL,
+	0xd459b761f00946c5ULL, 0xd4a4bd3e53d012beULL, 0xd4ef623c64d16e71ULL, 0xd539a69751dd5db1ULL,
+	0xd5838a8aa83061aeULL, 0xd5cd0e52525af604ULL, 0xd616322a97292f87ULL, 0xd65ef650188a817cULL,
+	0xd6a75affd279adedULL, 0xd6ef607719e4e5a5ULL, 0xd73706f39b961c85ULL, 0xd77e4eb35b1b96a6ULL,
+	0xd7c537f4b1b0b2edULL, 0xd80bc2f64d26f77aULL, 0xd851eff72ecf648aULL, 0xd897bf36aa64121cULL,
+	0xd8dd30f464f21ce8ULL, 0xd922457053c3e6f6ULL, 0xd966fceabb4bb036ULL, 0xd9ab57a42e0e8b7cULL,
+	0xd9ef55dd8b8fb414ULL, 0xda32f7d7ff3c4850ULL, 0xda763dd4ff576d39ULL, 0xdab928164be6dfa1ULL,
+	0xdafbb6dded9ff6c7ULL, 0xdb3dea6e34d51cadULL, 0xdb7fc309b863c040ULL, 0xdbc140f354a2c569ULL,
+	0xdc02646e2a517715ULL, 0xdc432dbd9d86ff35ULL, 0xdc839d2554a268b6ULL, 0xdcc3b2e9373b2f6cULL,
+	0xdd036f4d6d1261ccULL, 0xdd42d2965d045866ULL, 0xdd81dd08abfb06faULL, 0xddc08ee93be0eaf4ULL,
+	0xddfee87d2a949b19ULL, 0xde3cea09d0dcfc31ULL, 0xde7a93d4c15e1e55ULL, 0xdeb7e623c78ec6a8ULL,
+	0xdef4e13ce6aea906ULL, 0xdf31856658bd5565ULL, 0xdf6dd2e68d71dc61ULL, 0xdfa9ca0429332e9bULL,
+	0xdfe56b0604113a56ULL, 0xe020b63328becaddULL, 0xe05babd2d38c2d20ULL, 0xe0964c2c71629ce7ULL,
+	0xe0d097879ec07e0fULL, 0xe10a8e2c26b6650cULL, 0xe144306201e4f21bULL, 0xe17d7e71557b8250ULL,
+	0xe1b678a27237b9c5ULL, 0xe1ef1f3dd365ea21ULL, 0xe227728c1de25896ULL, 0xe25f72d61f1b6675ULL,
+	0xe2972064cc149f7cULL, 0xe2ce7b81406ab0d9ULL, 0xe3058474bd584befULL, 0xe33c3b88a8bbf7d5ULL,
+	0xe372a1068c1ed485ULL, 0xe3a8b53813bc5295ULL, 0xe3de78670d8ae267ULL, 0xe413eadd68459d9bULL,
+	0xe4490ce53276ed8fULL, 0xe47ddec8998431b6ULL, 0xe4b260d1e8ba6874ULL, 0xe4e6934b885bdd35ULL,
+	0xe51a767ffcaede62ULL, 0xe54e0ab9e50d7dcaULL, 0xe5815043faf65e26ULL, 0xe5b44769111e901cULL,
+	0xe5e6f07412848170ULL, 0xe6194bb0018400a5ULL, 0xe64b5967f6eb57aeULL, 0xe67d19e721117fe2ULL,
+	0xe6ae8d78c2ed71b5ULL, 0xe6dfb468332e926aULL, 0xe7108f00db564213ULL, 0xe7411d8e36d28c12ULL,
+	0xe771605bd219fc5cULL, 0xe7a157b549c89b96ULL, 0xe7d103e649be1442ULL, 0xe800653a8c3d02fbULL,
+	0xe82f7bfdd90b73e5ULL, 0xe85e487c04948f3dULL, 0xe88ccb00ef0b7721ULL, 0xe8bb03d8838f5860ULL,
+	0xe8e8f34eb750b055ULL, 0xe91699af88b7c9a0ULL, 0xe943f746fe8c718cULL, 0xe9710c61271ee7faULL,
+	0xe99dd94a17720b8fULL, 0xe9ca5e4dea66c3d2ULL, 0xe9f69bb8bfe8ab04ULL, 0xea2291d6bc1bf936ULL,
+	0xea4e40f4068cb25aULL, 0xea79a95cc95f18c8ULL, 0xeaa4cb5d308165dbULL, 0xeacfa74168deca0bULL,
+	0xeafa3d559f93b614ULL, 0xeb248de601236e8eULL, 0xeb4e993eb8aeeb57ULL, 0xeb785fabef2d0433ULL,
+	0xeba1e179caa3ebf8ULL, 0xebcb1ef46d63fb7fULL, 0xebf41867f543cdb7ULL, 0xec1cce207addadefULL,
+	0xec45406a10ce59a8ULL, 0xec6d6f90c2f516fcULL, 0xec955be095b520c5ULL, 0xecbd05a585386994ULL,
+	0xece46d2b84b3b67cULL, 0xed0b92be7dac12c1ULL, 0xed3276aa4f3d9d5eULL, 0xed59193acd63b149ULL,
+	0xed7f7abbc042696eULL, 0xeda59b78e3718137ULL, 0xedcb7bbde5489276ULL, 0xedf11bd6662cb17fULL,
+	0xee167c0df7df6844ULL, 0xee3b9cb01ccf1117ULL, 0xee607e08476891e0ULL, 0xee852061d96a785fULL,
+	0xeea9840823397829ULL, 0xeecda94663364af8ULL, 0xeef19067c514f3d8ULL, 0xef1539b7613565ccULL,
+	0xef38a5803bfd8e5bULL, 0xef5bd40d4534c488ULL, 0xef7ec5a957609ca9ULL, 0xefa17a9f3723217aULL,
+	0xefc3f339929a72dcULL, 0xefe62fc300c1ca8dULL, 0xf008308600d3e72fULL, 0xf029f5ccf9aeddebULL,
+	0xf04b7fe2393952e3ULL, 0xf06ccf0ff3c918c2ULL, 0xf08de3a0438b3782ULL, 0xf0aebddd27ed5aa9ULL,
+	0xf0cf5e108508a70dULL, 0xf0efc484230df846ULL, 0xf10ff181adb385d5ULL, 0xf12fe552b3a3f014ULL,
+	0xf14fa040a5eeb4f1ULL, 0xf16f2294d77a0c68ULL, 0xf18e6c987c762cb9ULL, 0xf1ad7e94a9d1f64aULL,
+	0xf1cc58d254b10709ULL, 0xf1eafb9a51e33547ULL, 0xf2096735555d71c8ULL, 0xf2279bebf1b410ebULL,
+	0xf2459a0697967ab0ULL, 0xf26361cd954c4156ULL, 0xf280f38916339e4fULL, 0xf29e4f8122415549ULL,
+	0xf2bb75fd9d81fce7ULL, 0xf2d86746479cacdeULL, 0xf2f523a2bb571111ULL, 0xf311ab5a6e1ae140ULL,
+	0xf32dfeb4af7cbcebULL, 0xf34a1df8a8c46ae0ULL, 0xf366096d5c767c0aULL, 0xf381c159a5df50f6ULL,
+	0xf39d4604389f818eULL, 0xf3b897b3a039a672ULL, 0xf3d3b6ae3fa18360ULL, 0xf3eea33a50cc9218ULL,
+	0xf4095d9de443ed09ULL, 0xf423e61ee0b7992cULL, 0xf43e3d0302932e65ULL, 0xf458628fdb93dda8ULL,
+	0xf472570ad25fd435ULL, 0xf48c1ab9221efb23ULL, 0xf4a5addfda151284ULL, 0xf4bf10c3dd3d273eULL,
+	0xf4d843a9e1e662ecULL, 0xf4f146d6715234c8ULL, 0xf50a1a8de753d2ecULL, 0xf522bf1471f112e8ULL,
+	0xf53b34ae110498d5ULL, 0xf5537b9e95e15c02ULL, 0xf56b9429a2f78033ULL, 0xf5837e92ab7a828fULL,
+	0xf59b3b1cf308b93eULL, 0xf5b2ca0b8d5424acULL, 0xf5ca2ba15dcc9176ULL, 0xf5e16021174b09f7ULL,
+	0xf5f867cd3bbe9656ULL, 0xf60f42e81bda4a1bULL, 0xf625f1b3d6c49e11ULL, 0xf63c747259c81575ULL,
+	0xf652cb6560052d3bULL, 0xf668f6ce7225944aULL, 0xf67ef6eee610ab83ULL, 0xf694cc07dea14c5eULL,
+	0xf6aa765a4b5cd4e7ULL, 0xf6bff626e82b77f2ULL, 0xf6d54bae3d11d02aULL, 0xf6ea77309debb4daULL,
+	0xf6ff78ee2a284f0dULL, 0xf7145126cc876dd1ULL, 0xf729001a3ad81840ULL, 0xf73d8607f5b85c06ULL,
+	0xf751e32f48565703ULL, 0xf76617cf48327abcULL, 0xf77a2426d4e30835ULL, 0xf78e087497d8c2cbULL,
+	0xf7a1c4f70424d8c0ULL, 0xf7b559ec563ffff0ULL, 0xf7c8c79293d2c560ULL, 0xf7dc0e278b7f0e23ULL,
+	0xf7ef2de8d4aac829ULL, 0xf8022713cf4bc983ULL, 0xf814f9e5a3b4dc99ULL, 0xf827a69b4263f7dfULL,
+	0xf83a2d7163d19f83ULL, 0xf84c8ea488416f8eULL, 0xf85eca70f793ccf3ULL, 0xf870e112c118bc04ULL,
+	0xf882d2c5bb63dabfULL, 0xf8949fc584217d60ULL, 0xf8a6484d7fecebaaULL, 0xf8b7cc98da27bd4dULL,
+	0xf8c92ce284d253d6ULL, 0xf8da696538657087ULL, 0xf8eb825b73ace483ULL, 0xf8fc77ff7ba359a7ULL,
+	0xf90d4a8b5b4f326bULL, 0xf91dfa38e3a07f34ULL, 0xf92e8741ab50075eULL, 0xf93ef1df0ebf6462ULL,
+	0xf94f3a4a2fda2d65ULL, 0xf95f60bbf5f83189ULL, 0xf96f656d0dc0bf44ULL, 0xf97f4895e90ef71bULL,
+	0xf98f0a6ebed727fdULL, 0xf99eab2f8b0d3399ULL, 0xf9ae2b100e8bf8e3ULL, 0xf9bd8a47cefdc320ULL,
+	0xf9ccc90e16c5bbb8ULL, 0xf9dbe799f4ea5d08ULL, 0xf9eae6223d00e486ULL, 0xf9f9c4dd8719c266ULL,
+	0xfa0884022fae050bULL, 0xfa1723c6578dbe72ULL, 0xfa25a45fe3cf61eaULL, 0xfa3406047dc01832ULL,
+	0xfa4248e992d50857ULL, 0xfa506d44549d936eULL, 0xfa5e7349b8b6816fULL, 0xfa6c5b2e78be1d65ULL,
+	0xfa7a252712493f1cULL, 0xfa87d167c6d94092ULL, 0xfa9560249bd2dd44ULL, 0xfaa2d1915a75f9a1ULL,
+	0xfab025e18fd650c0ULL, 0xfabd5d488cd50692ULL, 0xfaca77f9661b1cb8ULL, 0xfad77626f414c831ULL,
+	0xfae45803d2eda601ULL, 0xfaf11dc2628dcd10ULL, 0xfafdc794c697bb54ULL, 0xfb0a55ace6671c8aULL,
+	0xfb16c83c6d10688fULL, 0xfb231f74c961579dULL, 0xfb2f5b872de22a7eULL, 0xfb3b7ca490d7c4e9ULL,
+	0xfb4782fdac46983bULL, 0xfb536ec2fdf65c9cULL, 0xfb5f4024c77696d1ULL, 0xfb6af7530e23e8d3ULL,
+	0xfb76947d9b2e2b5dULL, 0xfb8217d3fb9f4e91ULL, 0xfb8d81858062ffe3ULL, 0xfb98d1c13e4f1369ULL,
+	0xfba408b60e2caec2ULL, 0xfbaf26928cc233b7ULL, 0xfbba2b851adde8bbULL, 0xfbc517bbdd615d76ULL,
+	0xfbcfeb64bd4d898cULL, 0xfbdaa6ad67cfa3b2ULL, 0xfbe549c34e4eaf52ULL, 0xfbefd4d3a679beddULL,
+	0xfbfa480b6a56e8f3ULL, 0xfc04a3975852ee8fULL, 0xfc0ee7a3f3519063ULL, 0xfc19145d82be918aULL,
+	0xfc2329f0129f65c3ULL, 0xfc2d288773a58959ULL, 0xfc37104f3b4180efULL, 0xfc40e172c3b67f58ULL,
+	0xfc4a9c1d2c2eafa2ULL, 0xfc54407958d0219cULL, 0xfc5dceb1f2d256e4ULL, 0xfc6746f168946eceULL,
+	0xfc70a961edb3ef44ULL, 0xfc79f62d7b2428d4ULL, 0xfc832d7dcf463421ULL, 0xfc8c4f7c6e0186f4ULL,
+	0xfc955c52a0dd1f11ULL, 0xfc9e542977194111ULL, 0xfca73729c5c9c983ULL, 0xfcb0057c27f10e71ULL,
+	0xfcb8bf48fe9b4f9fULL, 0xfcc164b870fab3b5ULL, 0xfcc9f5f26c83d081ULL, 0xfcd2731ea50abcafULL,
+	0xfcdadc6494e0a911ULL, 0xfce331eb7cf1ffd9ULL, 0xfceb73da64e507ebULL, 0xfcf3a2581b390a9cULL,
+	0xfcfbbd8b3565fa16ULL, 0xfd03c59a0ffc96b0ULL, 0xfd0bbaaacec7117cULL, 0xfd139ce35cea2a55ULL,
+	0xfd1b6c696d06c7b1ULL, 0xfd232962795c0690ULL, 0xfd2ad3f3c3e9c0c4ULL, 0xfd326c42569387f2ULL,
+	0xfd39f2730344138eULL, 0xfd4166aa64112028ULL, 0xfd48c90cdb5fbe64ULL, 0xfd5019be94090fe8ULL,
+	0xfd5758e3817f70a1ULL, 0xfd5e869f5ff40aadULL, 0xfd65a315b47cd350ULL, 0xfd6cae69cd3aef41ULL,
+	0xfd73a8bec1817cc0ULL, 0xfd7a923771fcc1c5ULL, 0xfd816af688d9bcb0ULL, 0xfd88331e79ee15ddULL,
+	0xfd8eead182e07082ULL, 0xfd959231ab51193dULL, 0xfd9c2960c50310baULL, 0xfda2b0806c0570e1ULL,
+	0xfda927b206dd2af5ULL, 0xfdaf8f16c6af1d0eULL, 0xfdb5e6cfa76a7d72ULL, 0xfdbc2efd6ff39a25ULL,
+	0xfdc267c0b24eeb3fULL, 0xfdc89139cbcc766dULL, 0xfdceab88e533821cULL, 0xfdd4b6cdf2ee96d5ULL,
+	0xfddab328b537cd2dULL, 0xfde0a0b8b84566eaULL, 0xfde67f9d5476b1bcULL, 0xfdec4ff5ae813231ULL,
+	0xfdf211e0b79e1549ULL, 0xfdf7c57d2db7e74eULL, 0xfdfd6ae99b988e67ULL, 0xfe0302445917877eULL,
+	0xfe088bab8b486406ULL, 0xfe0e073d24a98727ULL, 0xfe137516e55320fcULL, 0xfe18d5565b26665cULL,
+	0xfe1e2818e1fd03ddULL, 0xfe236d7ba3d8ca9eULL, 0xfe28a59b99139579ULL, 0xfe2dd095888f653dULL,
+	0xfe32ee8607e6b291ULL, 0xfe37ff897b9cf41fULL, 0xfe3d03bc174f57b7ULL, 0xfe41fb39dde5ad03ULL,
+	0xfe46e61ea1c38089ULL, 0xfe4bc48604f9659bULL, 0xfe50968b79766de2ULL, 0xfe555c4a4139cd4bULL,
+	0xfe5a15dd6e84a8eaULL, 0xfe5ec35fe40c0fa9ULL, 0xfe6364ec552b1b65ULL, 0xfe67fa9d46153942ULL,
+	0xfe6c848d0c0897ecULL, 0xfe7102d5cd80ba90ULL, 0xfe75759182692f3dULL, 0xfe79dcd9f4506785ULL,
+	0xfe7e38c8be9ab223ULL, 0xfe8289774eb5545eULL, 0xfe86cefee449c20eULL, 0xfe8b09789170f306ULL,
+	0xfe8f38fd3ae6d4b0ULL, 0xfe935da5983dd6b7ULL, 0xfe97778a34129199ULL, 0xfe9b86c36c3f85eaULL,
+	0xfe9f8b697210f332ULL, 0xfea385944a78c543ULL, 0xfea7755bce4296ddULL, 0xfeab5ad7aa47c88cULL,
+	0xfeaf361f5fa3aaa4ULL, 0xfeb3074a43e7b940ULL, 0xfeb6ce6f814fe931ULL, 0xfeba8ba616f704c7ULL,
+	0xfebe3f04d90b1766ULL, 0xfec1e8a27101e6daULL, 0xfec588955dcd7959ULL, 0xfec91ef3f410a72aULL,
+	0xfeccabd45e53b6f8ULL, 0xfed02f4c9d3903b5ULL, 0xfed3a97287b1ab1eULL, 0xfed71a5bcb3243e0ULL,
+	0xfeda821debe79a50ULL, 0xfedde0ce44eb72d1ULL, 0xfee13682087950e6ULL, 0xfee4834e402341f7ULL,
+	0xfee7c747cd06aadeULL, 0xfeeb028368011748ULL, 0xfeee3515a1e509feULL, 0xfef15f12e3aecd21ULL,
+	0xfef4808f6eb94185ULL, 0xfef7999f5cf2ac27ULL, 0xfefaaa56a11180ffULL, 0xfefdb2c906c92a1eULL,
+	0xff00b30a32feca6cULL, 0xff03ab2da3fdfafcULL, 0xff069b46b1ad823bULL, 0xff0983688dc4040fULL,
+	0xff0c63a643fcaa20ULL, 0xff0f3c12ba4bc367ULL, 0xff120cc0b1135a43ULL, 0xff14d5c2c357c036ULL,
+	0xff17972b66f40e91ULL, 0xff1a510cecce9b31ULL, 0xff1d0379810d6095ULL, 0xff1fae832b4a5882ULL,
+	0xff22523bcec7c873ULL, 0xff24eeb52aa47f19ULL, 0xff278400da100224ULL, 0xff2a1230547eabacULL,
+	0xff2c9954edddb667ULL, 0xff2f197fd6c73812ULL, 0xff3192c21cb6093dULL, 0xff34052caa3999e5ULL,
+	0xff3670d04729b210ULL, 0xff38d5bd98da1dd4ULL, 0xff3b3405224e440fULL, 0xff3d8bb7446ca737ULL,
+	0xff3fdce43e324f89ULL, 0xff42279c2ce61dfeULL, 0xff446bef0c4c0768ULL, 0xff46a9ecb6d8370dULL,
+	0xff48e1a4e5e2182aULL, 0xff4b132731d745bcULL, 0xff4d3e83126e6004ULL, 0xff4f63c7ded9c71cULL,
+	0xff518304cdfa3a17ULL, 0xff539c48f6915a18ULL, 0xff55afa34f7410c8ULL, 0xff57bd22afbcd9a6ULL,
+	0xff59c4d5cefdeda1ULL, 0xff5bc6cb45735073ULL, 0xff5dc3118c34bf32ULL, 0xff5fb9b6fd677f9fULL,
+	0xff61aac9d4700f9aULL, 0xff6396582e23b450ULL, 0xff657c7008f9e893ULL, 0xff675d1f453da9edULL,
+	0xff693873a53ea3e6ULL, 0xff6b0e7acd823910ULL, 0xff6cdf4244f46956ULL, 0xff6eaad77518952cULL,
+	0xff707147aa3a1d13ULL, 0xff7232a0139cdd1bULL, 0xff73eeedc3ad83e5ULL, 0xff75a63db031c4b5ULL,
+	0xff77589cb278643cULL, 0xff79061787891f9eULL, 0xff7aaebad0546d54ULL, 0xff7c529311e3178bULL,
+	0xff7df1acb585af95ULL, 0xff7f8c140903da0cULL, 0xff8121d53ecb7354ULL, 0xff82b2fc6e1f8c05ULL,
+	0xff843f9593473d03ULL, 0xff85c7ac8fbc52cfULL, 0xff874b4d2a59cfc6ULL, 0xff88ca830f8a44f5ULL,
+	0xff8a4559d1760139ULL, 0xff8bbbdce8311640ULL, 0xff8d2e17b1e93337ULL, 0xff8e9c15731354c2ULL,
+	0xff9005e156994a00ULL, 0xff916b866e070e46ULL, 0xff92cd0fb1b7f744ULL, 0xff942a880103b763ULL,
+	0xff9583fa226b33fbULL, 0xff96d970c3c52f2cULL, 0xff982af67a6ac519ULL, 0xff997895c363bc3aULL,
+	0xff9ac2590392a890ULL, 0xff9c084a87e0e17dULL, 0xff9d4a74856a49fbULL, 0xff9e88e119a8eb02ULL,
+	0xff9fc39a4aa05fe4ULL, 0xffa0faaa0709145fULL, 0xffa22e1a267b5440ULL, 0xffa35df4699a2c4cULL,
+	0xffa48a427a3e1c5aULL, 0xffa5b30deb9f9a56ULL, 0xffa6d8603a816604ULL, 0xffa7fa42cd5aad5eULL,
+	0xffa918bef481015cULL, 0xffaa33ddea521af3ULL, 0xffab4ba8d35d7031ULL, 0xffac6028be8d9947ULL,
+	0xffad7166a5518555ULL, 0xffae7f6b6bc57ee4ULL, 0xffaf8a3fe0dbffd9ULL, 0xffb091ecbe8654c9ULL,
+	0xffb1967aa9dd0f90ULL, 0xffb297f233484901ULL, 0xffb3965bd6a7b19eULL, 0xffb491bffb7a7138ULL,
+	0xffb58a26f506d54fULL, 0xffb67f990281ce37ULL, 0xffb7721e4f363ac4ULL, 0xffb861bef2ac0284ULL,
+	0xffb94e82f0cefe65ULL, 0xffba38723a15afb3ULL, 0xffbb1f94aba7c55bULL, 0xffbc03f20f846f68ULL,
+	0xffbce5921ca8809cULL, 0xffbdc47c77345e21ULL, 0xffbea0b8b091bd49ULL, 0xffbf7a4e47992f39ULL,
+	0xffc05144a8b77a8eULL, 0xffc125a32e12c2dfULL, 0xffc1f7711faf7e1fULL, 0xffc2c6b5b39537cbULL,
+	0xffc393780df321e9ULL, 0xffc45dbf414473c7ULL, 0xffc525924e74967fULL, 0xffc5eaf825031f35ULL,
+	0xffc6adf7a327970fULL, 0xffc76e9795f510e7ULL, 0xffc82cdeb97d8cb5ULL, 0xffc8e8d3b8f528b0ULL,
+	0xffc9a27d2ed52029ULL, 0xffca59e1a4fe9826ULL, 0xffcb0f0794dd39baULL, 0xffcbc1f567899a21ULL,
+	0xffcc72b175eb70abULL, 0xffcd214208db9a78ULL, 0xffcdcdad5945ec01ULL, 0xffce77f9904ad096ULL,
+	0xffcf202cc760b7b4ULL, 0xffcfc64d08755059ULL, 0xffd06a604e0e9259ULL, 0xffd10c6c836b95b8ULL,
+	0xffd1ac7784a53823ULL, 0xffd24a871ece908dULL, 0xffd2e6a110153104ULL, 0xffd380cb07e136c8ULL,
+	0xffd4190aa6f528baULL, 0xffd4af657f8da430ULL, 0xffd543e11580d843ULL, 0xffd5d682de5dcfa8ULL,
+	0xffd66750418b892aULL, 0xffd6f64e9867ded3ULL, 0xffd783832e663be3ULL, 0xffd80ef3412e21a5ULL,
+	0xffd898a400b97b32ULL, 0xffd9209a8f72c04fULL, 0xffd9a6dc0252e75fULL, 0xffda2b6d60ff26a1ULL,
+	0xffdaae53a5e684beULL, 0xffdb2f93be5f38c8ULL, 0xffdbaf328ac3d9c6ULL, 0xffdc2d34de905deeULL,
+	0xffdca99f807ee997ULL, 0xffdd24772aa46e15ULL, 0xffdd9dc08a8d1892ULL, 0xffde158041589100ULL,
+	0xffde8bbae3d60946ULL, 0xffdf0074faa01ccdULL, 0xffdf73b30238807eULL, 0xffdfe5796b238367ULL,
+	0xffe055cc9a03600aULL, 0xffe0c4b0e7b35e9cULL, 0xffe1322aa162c837ULL, 0xffe19e3e08afab31ULL,
+	0xffe208ef53c170b9ULL, 0xffe27242ad6343dfULL, 0xffe2da3c351e4a20ULL, 0xffe340dfff53adb0ULL,
+	0xffe3a63215567993ULL, 0xffe40a36758547b2ULL, 0xffe46cf11363c119ULL, 0xffe4ce65d7b3f076ULL,
+	0xffe52e98a08f6710ULL, 0xffe58d8d41803452ULL, 0xffe5eb478399b011ULL, 0xffe647cb259117c6ULL,
+	0xffe6a31bdbd5feccULL, 0xffe6fd3d50aa91e1ULL, 0xffe75633243bae04ULL, 0xffe7ae00ecb8cae3ULL,
+	0xffe804aa366bb906ULL, 0xffe85a3283d033ccULL, 0xffe8ae9d4dab478dULL, 0xffe901ee03228bdbULL,
+	0xffe9542809d3323dULL, 0xffe9a54ebde8e96cULL, 0xffe9f56572349555ULL, 0xffea446f7042dbfdULL,
+	0xffea926ff8728782ULL, 0xffeadf6a420abd5eULL, 0xffeb2b617b510b16ULL, 0xffeb7658c99f488eULL,
+	0xffebc05349795027ULL, 0xffec09540ea28cdcULL, 0xffec515e24335e81ULL, 0xffec98748cae5465ULL,
+	0xffecde9a42153e75ULL, 0xffed23d235fe1518ULL, 0xffed681f51a7b7f5ULL, 0xffedab84760e83cbULL,
+	0xffedee047c00bf93ULL, 0xffee2fa23432e119ULL, 0xffee70606753a93dULL, 0xffeeb041d6201807ULL,
+	0xffeeef49397738caULL, 0xffef2d79426dc681ULL, 0xffef6ad49a61a891ULL, 0xffefa75de30d482bULL,
+	0xffefe317b69abe7fULL, 0xfff01e04a7b6dbe7ULL, 0xfff0582741a4084bULL, 0xfff09182084cfce1ULL,
+	0xfff0ca1778575788ULL, 0xfff101ea073607e3ULL, 0xfff138fc233b9676ULL, 0xfff16f5033ac45eaULL,
+	0xfff1a4e898d00eadULL, 0xfff1d9c7ac047529ULL, 0xfff20defbfce3ab6ULL, 0xfff241631feae98eULL,
+	0xfff2742411623bddULL, 0xfff2a634d2975e37ULL, 0xfff2d7979b5a0d98ULL, 0xfff3084e9cf79125ULL,
+	0xfff3385c024b8fe6ULL, 0xfff367c1efd0c2a6ULL, 0xfff3968283b1822dULL, 0xfff3c49fd5d8320bULL,
+	0xfff3f21bf7ff8822ULL, 0xfff41ef8f5c2b12aULL, 0xfff44b38d4ad5254ULL, 0xfff476dd944b6856ULL,
+	0xfff4a1e92e3903f9ULL, 0xfff4cc5d9631e470ULL, 0xfff4f63cba20efa6ULL, 0xfff51f88822f88b3ULL,
+	0xfff54842d0d4c4a9ULL, 0xfff5706d82e47df9ULL, 0xfff5980a6f9e4698ULL, 0xfff5bf1b68bc3913ULL,
+	0xfff5e5a23a81a8dcULL, 0xfff60ba0abc9b1e3ULL, 0xfff631187e15a7cfULL, 0xfff6560b6d9b64e9ULL,
+	0xfff67a7b3153790fULL, 0xfff69e697b0738c6ULL, 0xfff6c1d7f75eaca8ULL, 0xfff6e4c84dee6169ULL,
+	0xfff7073c21451896ULL, 0xfff729350ef95a50ULL, 0xfff74ab4afb6e82aULL, 0xfff76bbc974c1167ULL,
+	0xfff78c4e54b6e8c0ULL, 0xfff7ac6b72325beeULL, 0xfff7cc1575432d26ULL, 0xfff7eb4ddec4ceb9ULL,
+	0xfff80a162af6210aULL, 0xfff8286fd1861310ULL, 0xfff8465c45a02595ULL, 0xfff863dcf5f8d15cULL,
+	0xfff880f34cd9d070ULL, 0xfff89da0b02e4abbULL, 0xfff8b9e6818ee628ULL, 0xfff8d5c61e4dba75ULL,
+	0xfff8f140df8228edULL, 0xfff90c581a149837ULL, 0xfff9270d1eca1474ULL, 0xfff941613a4fd3d2ULL,
+	0xfff95b55b5469fc9ULL, 0xfff974ebd44e2337ULL, 0xfff98e24d8101d88ULL, 0xfff9a701fd4b7b1eULL,
+	0xfff9bf847cdf531bULL, 0xfff9d7ad8bd5cadaULL, 0xfff9ef7e5b6edf2bULL, 0xfffa06f8192b138bULL,
+	0xfffa1e1beed60798ULL, 0xfffa34eb0290f2d1ULL, 0xfffa4b6676dd06f3ULL, 0xfffa618f6aa5b907ULL,
+	0xfffa7766f94af163ULL, 0xfffa8cee3aab22c7ULL, 0xfffaa226432d48beULL, 0xfffab71023cacd7dULL,
+	0xfffacbacea195768ULL, 0xfffadffda0547e6fULL, 0xfffaf4034d676969ULL, 0xfffb07bef4f653acULL,
+	0xfffb1b319767fafeULL, 0xfffb2e5c31eef610ULL, 0xfffb413fbe92f3c5ULL, 0xfffb53dd3439e34cULL,
+	0xfffb663586b10566ULL, 0xfffb7849a6b5e6e0ULL, 0xfffb8a1a81ff4483ULL, 0xfffb9ba90345d8a5ULL,
+	0xfffbacf6124d127aULL, 0xfffbbe0293ebb765ULL, 0xfffbcecf6a146e61ULL, 0xfffbdf5d73de35c2ULL,
+	0xfffbefad8d8cc368ULL, 0xfffbffc09098cf9aULL, 0xfffc0f9753b84ab1ULL, 0xfffc1f32aae67dbeULL,
+	0xfffc2e93676c165aULL, 0xfffc3dba57e71dc2ULL, 0xfffc4ca84852db70ULL, 0xfffc5b5e020fa362ULL,
+	0xfffc69dc4bea9024ULL, 0xfffc7823ea2528deULL, 0xfffc86359e7cf385ULL, 0xfffc94122832f358ULL,
+	0xfffca1ba441313ceULL, 0xfffcaf2eac7b8034ULL, 0xfffcbc701963e801ULL, 0xfffcc97f4064b029ULL,
+	0xfffcd65cd4be1186ULL, 0xfffce309875f2480ULL, 0xfffcef8606ecda27ULL, 0xfffcfbd2ffc8e2daULL,
+	0xfffd07f11c1882a8ULL, 0xfffd13e103cb5394ULL, 0xfffd1fa35ca1f5e4ULL, 0xfffd2b38ca34ae9bULL,
+	0xfffd36a1edf9f44fULL, 0xfffd41df674cea76ULL, 0xfffd4cf1d373cb5eULL, 0xfffd57d9cda640e6ULL,
+	0xfffd6297ef13ac2eULL, 0xfffd6d2ccee95c5cULL, 0xfffd77990258b497ULL, 0xfffd81dd1c9d4165ULL,
+	0xfffd8bf9af02bd90ULL, 0xfffd95ef48eb06b3ULL, 0xfffd9fbe77d40197ULL, 0xfffda967c75d6e83ULL,
+	0xfffdb2ebc14eada2ULL, 0xfffdbc4aed9c73a9ULL, 0xfffdc585d26e6ed6ULL, 0xfffdce9cf424dc77ULL,
+	0xfffdd790d55e0f17ULL, 0xfffde061f6fbe56fULL, 0xfffde910d829324aULL, 0xfffdf19df65f1575ULL,
+	0xfffdfa09cd6a45deULL, 0xfffe0254d7704d0cULL, 0xfffe0a7f8cf4b409ULL, 0xfffe128a64de21e6ULL,
+	0xfffe1a75d47b6bf3ULL, 0xfffe22424f8897d8ULL, 0xfffe29f04833cfa8ULL, 0xfffe31802f22480eULL,
+	0xfffe38f2737518b9ULL, 0xfffe404782ce0728ULL, 0xfffe477fc95443f1ULL, 0xfffe4e9bb1b91aa8ULL,
+	0xfffe559ba53c9484ULL, 0xfffe5c800bb20de3ULL, 0xfffe63494b84becaULL, 0xfffe69f7c9bc367fULL,
+	0xfffe708bea00ca67ULL, 0xfffe77060e9ff834ULL, 0xfffe7d669890bb94ULL, 0xfffe83ade777d773ULL,
+	0xfffe89dc59ac12f1ULL, 0xfffe8ff24c3a6a34ULL, 0xfffe95f01aea3323ULL, 0xfffe9bd62041362fULL,
+	0xfffea1a4b587bb51ULL, 0xfffea75c32cc8b45ULL, 0xfffeacfceee8e538ULL, 0xfffeb2873f8468efULL,
+	0xfffeb7fb7918f590ULL, 0xfffebd59eef67d28ULL, 0xfffec2a2f346cd07ULL, 0xfffec7d6d7114b13ULL,
+	0xfffeccf5ea3ea823ULL, 0xfffed2007b9c8789ULL, 0xfffed6f6d8e11be7ULL, 0xfffedbd94eaeb958ULL,
+	0xfffee0a828975d21ULL, 0xfffee563b1202aefULL, 0xfffeea0c31c4dfcfULL, 0xfffeeea1f2fb3ae7ULL,
+	0xfffef3253c365c1cULL, 0xfffef79653ea18b2ULL, 0xfffefbf57f8e4607ULL, 0xffff004303a1fa7dULL,
+	0xffff047f23aec4b3ULL, 0xffff08aa224bd91dULL, 0xffff0cc441213620ULL, 0xffff10cdc0eabebbULL,
+	0xffff14c6e17b4be7ULL, 0xffff18afe1bfb4b2ULL, 0xffff1c88ffc1cd45ULL, 0xffff205278ab5cdaULL,
+	0xffff240c88c90abbULL, 0xffff27b76b8d426fULL, 0xffff2b535b930f1eULL, 0xffff2ee092a0ee4dULL,
+	0xffff325f49ab9a00ULL, 0xffff35cfb8d8ca5fULL, 0xffff39321781eef5ULL, 0xffff3c869c36df9cULL,
+	0xffff3fcd7cc0852bULL, 0xffff4306ee2379ffULL, 0xffff463324a2a27bULL, 0xffff495253c1bd82ULL,
+	0xffff4c64ae47ed19ULL, 0xffff4f6a6642372aULL, 0xffff5263ad05fea0ULL, 0xffff5550b33374caULL,
+	0xffff5831a8b8033bULL, 0xffff5b06bcd0ae29ULL, 0xffff5dd01e0c6f5fULL, 0xffff608dfa4e89e7ULL,
+	0xffff63407ed0d667ULL, 0xffff65e7d826085cULL, 0xffff6884323bec39ULL, 0xffff6b15b85d9e7fULL,
+	0xffff6d9c9535bbe9ULL, 0xffff7018f2d08ab5ULL, 0xffff728afa9e1d25ULL, 0xffff74f2d5746d44ULL,
+	0xffff7750ab917208ULL, 0xffff79a4a49d2de0ULL, 0xffff7beee7abb6c2ULL, 0xffff7e2f9b3f37c8ULL,
+	0xffff8066e549ec71ULL, 0xffff8294eb301597ULL, 0xffff84b9d1c9e82fULL, 0xffff86d5bd6575daULL,
+	0xffff88e8d1c88f65ULL, 0xffff8af33232a144ULL, 0xffff8cf5015e8a14ULL, 0xffff8eee61846b41ULL,
+	0xffff90df745b73d1ULL, 0xffff92c85b1ba573ULL, 0xffff94a9367f93ddULL, 0xffff968226c61e7fULL,
+	0xffff98534bb424b3ULL, 0xffff9a1cc4963463ULL, 0xffff9bdeb042333aULL, 0xffff9d992d190281ULL,
+	0xffff9f4c59081d98ULL, 0xffffa0f8518b333bULL, 0xffffa29d33adb98cULL, 0xffffa43b1c0c7cfaULL,
+	0xffffa5d226d72a0eULL, 0xffffa7626fd1d23eULL, 0xffffa8ec12566bb5ULL, 0xffffaa6f29564c44ULL,
+	0xffffabebcf5b9f68ULL, 0xffffad621e8ad78fULL, 0xffffaed230a41a98ULL, 0xffffb03c1f04a99fULL,
+	0xffffb1a002a84430ULL, 0xffffb2fdf42a86d9ULL, 0xffffb4560bc8453dULL, 0xffffb5a86160dfa4ULL,
+	0xffffb6f50c77942aULL, 0xffffb83c2434cb7fULL, 0xffffb97dbf67615fULL, 0xffffbab9f485e8c2ULL,
+	0xffffbbf0d9afebcbULL, 0xffffbd2284af2798ULL, 0xffffbe4f0af8c3e4ULL, 0xffffbf7681ae869fULL,
+	0xffffc098fda00376ULL, 0xffffc1b6934bc76cULL, 0xffffc2cf56e08074ULL, 0xffffc3e35c3e2135ULL,
+	0xffffc4f2b6f700eeULL, 0xffffc5fd7a50f793ULL, 0xffffc703b9467626ULL, 0xffffc80586879b5eULL,
+	0xffffc902f47b44a0ULL, 0xffffc9fc15401b5eULL, 0xffffcaf0faad9ee3ULL, 0xffffcbe1b6552a90ULL,
+	0xffffccce5982f8a2ULL, 0xffffcdb6f53f2184ULL, 0xffffce9b9a4e97b4ULL, 0xffffcf7c59342053ULL,
+	0xffffd05942314856ULL, 0xffffd1326547567aULL, 0xffffd207d23839f1ULL, 0xffffd2d9988775dfULL,
+	0xffffd3a7c77b09a6ULL, 0xffffd4726e1c561aULL, 0xffffd5399b38ff96ULL, 0xffffd5fd5d63cd07ULL,
+	0xffffd6bdc2f583f5ULL, 0xffffd77ada0dc18aULL, 0xffffd834b093d0b4ULL, 0xffffd8eb54377d53ULL,
+	0xffffd99ed271e491ULL, 0xffffda4f3886425eULL, 0xffffdafc9382bc25ULL, 0xffffdba6f04128b9ULL,
+	0xffffdc4e5b67d58aULL, 0xffffdcf2e16a4925ULL, 0xffffdd948e8a030dULL, 0xffffde336ed738efULL,
+	0xffffdecf8e319143ULL, 0xffffdf68f848db55ULL, 0xffffdfffb89dc4cbULL, 0xffffe093da828cacULL,
+	0xffffe125691bb3e8ULL, 0xffffe1b46f60ab77ULL, 0xffffe240f81c8008ULL, 0xffffe2cb0dee835dULL,
+	0xffffe352bb4af339ULL, 0xffffe3d80a7b9e14ULL, 0xffffe45b05a08571ULL, 0xffffe4dbb6b07e01ULL,
+	0xffffe55a2779cd80ULL, 0xffffe5d661a2c664ULL, 0xffffe6506eaa6160ULL, 0xffffe6c857e8d4beULL,
+	0xffffe73e2690299aULL, 0xffffe7b1e3accf0dULL, 0xffffe82398262b3cULL, 0xffffe8934cbf2a69ULL,
+	0xffffe9010a16cbf4ULL, 0xffffe96cd8a8ad70ULL, 0xffffe9d6c0cd93adULL, 0xffffea3ecabbf1e8ULL,
+	0xffffeaa4fe886f02ULL, 0xffffeb09642668deULL, 0xffffeb6c036875daULL, 0xffffebcce400e47cULL,
+	0xffffec2c0d823945ULL, 0xffffec89875faac1ULL, 0xffffece558ed9bccULL, 0xffffed3f89621423ULL,
+	0xffffed981fd53731ULL, 0xffffedef2341b930ULL, 0xffffee449a85529fULL, 0xffffee988c613209ULL,
+	0xffffeeeaff7a6c30ULL, 0xffffef3bfa5a6a9fULL, 0xffffef8b836f589aULL, 0xffffefd9a10c8e88ULL,
+	0xfffff026596afbccULL, 0xfffff071b2a98f16ULL, 0xfffff0bbb2cd9d35ULL, 0xfffff1045fc3466bULL,
+	0xfffff14bbf5dda4aULL, 0xfffff191d7583a1fULL, 0xfffff1d6ad5539edULL, 0xfffff21a46e00007ULL,
+	0xfffff25ca96c6338ULL, 0xfffff29dda57479dULL, 0xfffff2dddee6fa15ULL, 0xfffff31cbc4b8a6aULL,
+	0xfffff35a779f241bULL, 0xfffff39715e665e3ULL, 0xfffff3d29c10b7f6ULL, 0xfffff40d0ef8a0f8ULL,
+	0xfffff446736419b7ULL, 0xfffff47ece04dfa8ULL, 0xfffff4b62378c630ULL, 0xfffff4ec784a06baULL,
+	0xfffff521d0ef8f9dULL, 0xfffff55631cd51d8ULL, 0xfffff5899f348dadULL, 0xfffff5bc1d641e12ULL,
+	0xfffff5edb088c308ULL, 0xfffff61e5cbd6adbULL, 0xfffff64e260b7a48ULL, 0xfffff67d106b138dULL,
+	0xfffff6ab1fc35c75ULL, 0xfffff6d857eac34bULL, 0xfffff704bca742d4ULL, 0xfffff73051aea53dULL,
+	0xfffff75b1aa6c608ULL, 0xfffff7851b25d301ULL, 0xfffff7ae56b28c39ULL, 0xfffff7d6d0c4830bULL,
+	0xfffff7fe8cc4582bULL, 0xfffff8258e0bf8cfULL, 0xfffff84bd7e6dae3ULL, 0xfffff8716d92385dULL,
+	0xfffff896523d49a6ULL, 0xfffff8ba89097f23ULL, 0xfffff8de150ab9e5ULL, 0xfffff900f9478374ULL,
+	0xfffff92338b944c8ULL, 0xfffff944d64c7c6cULL, 0xfffff965d4e0f3ceULL, 0xfffff9863749f3bfULL,
+	0xfffff9a6004e7828ULL, 0xfffff9c532a962f6ULL, 0xfffff9e3d109ae3aULL, 0xfffffa01de129d90ULL,
+	0xfffffa1f5c5beeb9ULL, 0xfffffa3c4e72097dULL, 0xfffffa58b6d62ed5ULL, 0xfffffa7497fea751ULL,
+	0xfffffa8ff456f0d4ULL, 0xfffffaaace3feb93ULL, 0xfffffac528100669ULL, 0xfffffadf04136a77ULL,
+	0xfffffaf8648c2620ULL, 0xfffffb114bb25752ULL, 0xfffffb29bbb4552eULL, 0xfffffb41b6b6d907ULL,
+	0xfffffb593ed526c8ULL, 0xfffffb70562134aaULL, 0xfffffb86fea3d25dULL, 0xfffffb9d3a5ccf88ULL,
+	0xfffffbb30b4321baULL, 0xfffffbc8734509bfULL, 0xfffffbdd74483860ULL, 0xfffffbf21029f290ULL,
+	0xfffffc0648bf350dULL, 0xfffffc1a1fd4d76eULL, 0xfffffc2d972faea8ULL, 0xfffffc40b08caf02ULL,
+	0xfffffc536da10d8cULL, 0xfffffc65d01a6106ULL, 0xfffffc77d99ec247ULL, 0xfffffc898bccec22ULL,
+	0xfffffc9ae83c5ac5ULL, 0xfffffcabf07d6aa6ULL, 0xfffffcbca61976e5ULL, 0xfffffccd0a92f73bULL,
+	0xfffffcdd1f659d6fULL, 0xfffffcece6067255ULL, 0xfffffcfc5fe3f254ULL, 0xfffffd0b8e662978ULL,
+	0xfffffd1a72eecf19ULL, 0xfffffd290ed9610bULL, 0xfffffd37637b3e5eULL, 0xfffffd457223c1baULL,
+	0xfffffd533c1c5b45ULL, 0xfffffd60c2a8aa27ULL, 0xfffffd6e070695a2ULL, 0xfffffd7b0a6e65c5ULL,
+	0xfffffd87ce12dbb7ULL, 0xfffffd94532149a3ULL, 0xfffffda09ac1aa42ULL, 0xfffffdaca616b7faULL,
+	0xfffffdb8763e03afULL, 0xfffffdc40c500b28ULL, 0xfffffdcf69604f1dULL, 0xfffffdda8e7d68eeULL,
+	0xfffffde57cb11ff5ULL, 0xfffffdf035007e91ULL, 0xfffffdfab86be6c6ULL, 0xfffffe0507ef269dULL,
+	0xfffffe0f24818c19ULL, 0xfffffe190f15f8eeULL, 0xfffffe22c89af5dbULL, 0xfffffe2c51fac5b0ULL,
+	0xfffffe35ac1b7813ULL, 0xfffffe3ed7defbe7ULL, 0xfffffe47d6233174ULL, 0xfffffe50a7c1fc37ULL,
+	0xfffffe594d915473ULL, 0xfffffe61c863586eULL, 0xfffffe6a19065d70ULL, 0xfffffe7240450071ULL,
+	0xfffffe7a3ee6368cULL, 0xfffffe8215ad5d1eULL, 0xfffffe89c55a49b6ULL, 0xfffffe914ea959abULL,
+	0xfffffe98b2538183ULL, 0xfffffe9ff10e5c0dULL, 0xfffffea70b8c3945ULL, 0xfffffeae027c2cf0ULL,
+	0xfffffeb4d68a1d00ULL, 0xfffffebb885ecfbbULL, 0xfffffec2189ff9a2ULL, 0xfffffec887f04b22ULL,
+	0xfffffeced6ef7e08ULL, 0xfffffed5063a62bfULL, 0xfffffedb166aed4dULL, 0xfffffee108184229ULL,
+	0xfffffee6dbd6c2c6ULL, 0xfffffeec923819fbULL, 0xfffffef22bcb482bULL, 0xfffffef7a91caf3eULL,
+	0xfffffefd0ab61e60ULL, 0xffffff02511edd9aULL, 0xffffff077cdbb92eULL, 0xffffff0c8e6f0cc8ULL,
+	0xffffff118658ce7bULL, 0xffffff1665169995ULL, 0xffffff1b2b23b93fULL, 0xffffff1fd8f932f2ULL,
+	0xffffff246f0dd0baULL, 0xffffff28edd62b58ULL, 0xffffff2d55c4b42cULL, 0xffffff31a749bef9ULL,
+	0xffffff35e2d38b83ULL, 0xffffff3a08ce4efcULL, 0xffffff3e19a43d4eULL, 0xffffff4215bd9237ULL,
+	0xffffff45fd809a45ULL, 0xffffff49d151bba5ULL, 0xffffff4d91937ecfULL, 0xffffff513ea69706ULL,
+	0xffffff54d8e9eac0ULL, 0xffffff5860ba9bd8ULL, 0xffffff5bd6740fafULL, 0xffffff5f3a6ff717ULL,
+	0xffffff628d06562aULL, 0xffffff65ce8d8bf9ULL, 0xffffff68ff5a5a16ULL, 0xffffff6c1fbfec04ULL,
+	0xffffff6f300fde7fULL, 0xffffff72309a46abULL, 0xffffff7521adb921ULL, 0xffffff78039750d6ULL,
+	0xffffff7ad6a2b5f3ULL, 0xffffff7d9b1a247cULL, 0xffffff80514672ecULL, 0xffffff82f96f18a4ULL,
+	0xffffff8593da3449ULL, 0xffffff8820cc9202ULL, 0xffffff8aa089b194ULL, 0xffffff8d1353cc72ULL,
+	0xffffff8f796bdba0ULL, 0xffffff91d3119d8aULL, 0xffffff9420839bbbULL, 0xffffff9661ff307aULL,
+	0xffffff9897c08c51ULL, 0xffffff9ac202bb79ULL, 0xffffff9ce0ffab2eULL, 0xffffff9ef4f02eedULL,
+	0xffffffa0fe0c059bULL, 0xffffffa2fc89de8eULL, 0xffffffa4f09f5e8aULL, 0xffffffa6da8124a2ULL,
+	0xffffffa8ba62cf00ULL, 0xffffffaa9076ff9fULL, 0xffffffac5cef60ebULL, 0xffffffae1ffcaa4aULL,
+	0xffffffafd9cea49aULL, 0xffffffb18a942e8fULL, 0xffffffb3327b4104ULL, 0xffffffb4d1b0f33bULL,
+	0xffffffb668617effULL, 0xffffffb7f6b844c3ULL, 0xffffffb97cdfcf9fULL, 0xffffffbafb01d946ULL,
+	0xffffffbc71474de2ULL, 0xffffffbddfd84fe8ULL, 0xffffffbf46dc3bcfULL, 0xffffffc0a679abbeULL,
+	0xffffffc1fed67b2bULL, 0xffffffc35017ca60ULL, 0xffffffc49a6201fbULL, 0xffffffc5ddd8d654ULL,
+	0xffffffc71a9f4addULL, 0xffffffc850d7b56aULL, 0xffffffc980a3c173ULL, 0xffffffcaaa24733bULL,
+	0xffffffcbcd7a2af6ULL, 0xffffffcceac4a7d7ULL, 0xffffffce02230b14ULL, 0xffffffcf13b3dadaULL,
+	0xffffffd01f950537ULL, 0xffffffd125e3e2f4ULL, 0xffffffd226bd3a60ULL, 0xffffffd3223d4212ULL,
+	0xffffffd4187fa39cULL, 0xffffffd5099f7e35ULL, 0xffffffd5f5b7694fULL, 0xffffffd6dce17729ULL,
+	0xffffffd7bf373753ULL, 0xffffffd89cd1b921ULL, 0xffffffd975c98e1cULL, 0xffffffda4a36cc60ULL,
+	0xffffffdb1a3110f3ULL, 0xffffffdbe5cf820dULL, 0xffffffdcad28d15cULL, 0xffffffdd70533e38ULL,
+	0xffffffde2f6497ceULL, 0xffffffdeea723f42ULL, 0xffffffdfa19129c4ULL, 0xffffffe054d5e2a4ULL,
+	0xffffffe104548d4dULL, 0xffffffe1b020e747ULL, 0xffffffe2584e4a25ULL, 0xffffffe2fcefad6eULL,
+	0xffffffe39e17a87bULL, 0xffffffe43bd8744eULL, 0xffffffe4d643ed62ULL, 0xffffffe56d6b956eULL,
+	0xffffffe601609522ULL, 0xffffffe69233bdddULL, 0xffffffe71ff58b59ULL, 0xffffffe7aab6254fULL,
+	0xffffffe832856117ULL, 0xffffffe8b772c33bULL, 0xffffffe9398d8105ULL, 0xffffffe9b8e48207ULL,
+	0xffffffea3586619aULL, 0xffffffeaaf817055ULL, 0xffffffeb26e3b580ULL, 0xffffffeb9bbaf07eULL,
+	0xffffffec0e149a30ULL, 0xffffffec7dfde653ULL, 0xffffffeceb83c4d5ULL, 0xffffffed56b2e32aULL,
+	0xffffffedbf97ad8fULL, 0xffffffee263e5054ULL, 0xffffffee8ab2b915ULL, 0xffffffeeed0097f5ULL,
+	0xffffffef4d3360d1ULL, 0xffffffefab564c67ULL, 0xfffffff007745983ULL, 0xfffffff061984e1cULL,
+	0xfffffff0b9ccb871ULL, 0xfffffff1101bf020ULL, 0xfffffff164901737ULL, 0xfffffff1b7331b3eULL,
+	0xfffffff2080eb641ULL, 0xfffffff2572c6fd2ULL, 0xfffffff2a4959e03ULL, 0xfffffff2f0536661ULL,
+	0xfffffff33a6ebee6ULL, 0xfffffff382f06eedULL, 0xfffffff3c9e11014ULL, 0xfffffff40f490f2aULL,
+	0xfffffff45330ad0eULL, 0xfffffff4959fff8cULL, 0xfffffff4d69ef234ULL, 0xfffffff516354737ULL,
+	0xfffffff5546a982eULL, 0xfffffff5914656f0ULL, 0xfffffff5cccfce55ULL, 0xfffffff6070e22ffULL,
+	0xfffffff64008541cULL, 0xfffffff677c53c20ULL, 0xfffffff6ae4b9184ULL, 0xfffffff6e3a1e778ULL,
+	0xfffffff717ceae9dULL, 0xfffffff74ad835aeULL, 0xfffffff77cc4aa30ULL, 0xfffffff7ad9a191cULL,
+	0xfffffff7dd5e6f82ULL, 0xfffffff80c177b2dULL, 0xfffffff839caeb44ULL, 0xfffffff8667e50e6ULL,
+	0xfffffff892371fc2ULL, 0xfffffff8bcfaaeafULL, 0xfffffff8e6ce3840ULL, 0xfffffff90fb6db53ULL,
+	0xfffffff937b99ba2ULL, 0xfffffff95edb624aULL, 0xfffffff98520fe59ULL, 0xfffffff9aa8f254fULL,
+	0xfffffff9cf2a73a6ULL, 0xfffffff9f2f76d4dULL, 0xfffffffa15fa7e2dULL, 0xfffffffa3837faa0ULL,
+	0xfffffffa59b41fecULL, 0xfffffffa7a7314baULL, 0xfffffffa9a78e98cULL, 0xfffffffab9c9992eULL,
+	0xfffffffad8690926ULL, 0xfffffffaf65b0a24ULL, 0xfffffffb13a3586dULL, 0xfffffffb30459c44ULL,
+	0xfffffffb4c456a52ULL, 0xfffffffb67a6440dULL, 0xfffffffb826b981aULL, 0xfffffffb9c98c2b3ULL,
+	0xfffffffbb6310dfeULL, 0xfffffffbcf37b276ULL, 0xfffffffbe7afd73fULL, 0xfffffffbff9c9284ULL,
+	0xfffffffc1700e9ceULL, 0xfffffffc2ddfd25cULL, 0xfffffffc443c3177ULL, 0xfffffffc5a18dcc8ULL,
+	0xfffffffc6f789aa6ULL, 0xfffffffc845e2269ULL, 0xfffffffc98cc1cb6ULL, 0xfffffffcacc523d0ULL,
+	0xfffffffcc04bc3e0ULL, 0xfffffffcd3627b40ULL, 0xfffffffce60bbac4ULL, 0xfffffffcf849e602ULL,
+	0xfffffffd0a1f5394ULL, 0xfffffffd1b8e4d61ULL, 0xfffffffd2c9910ddULL, 0xfffffffd3d41cf4cULL,
+	0xfffffffd4d8aae02ULL, 0xfffffffd5d75c6a0ULL, 0xfffffffd6d052755ULL, 0xfffffffd7c3ad31aULL,
+	0xfffffffd8b18c1ecULL, 0xfffffffd99a0e104ULL, 0xfffffffda7d51317ULL, 0xfffffffdb5b73086ULL,
+	0xfffffffdc349079aULL, 0xfffffffdd08c5cb7ULL, 0xfffffffddd82ea93ULL, 0xfffffffdea2e6265ULL,
+	0xfffffffdf6906c1dULL, 0xfffffffe02aaa692ULL, 0xfffffffe0e7ea7b3ULL, 0xfffffffe1a0dfcb7ULL,
+	0xfffffffe255a2a4cULL, 0xfffffffe3064acc2ULL, 0xfffffffe3b2ef83bULL, 0xfffffffe45ba78d6ULL,
+	0xfffffffe500892d7ULL, 0xfffffffe5a1aa2d6ULL, 0xfffffffe63f1fde3ULL, 0xfffffffe6d8ff1b2ULL,
+	0xfffffffe76f5c4c0ULL, 0xfffffffe8024b67eULL, 0xfffffffe891dff6fULL, 0xfffffffe91e2d157ULL,
+	0xfffffffe9a745756ULL, 0xfffffffea2d3b615ULL, 0xfffffffeab020bdfULL, 0xfffffffeb30070cbULL,
+	0xfffffffebacff6dbULL, 0xfffffffec271aa1cULL, 0xfffffffec9e690c6ULL, 0xfffffffed12fab5dULL,
+	0xfffffffed84df4d0ULL, 0xfffffffedf426295ULL, 0xfffffffee60de4c8ULL, 0xfffffffeecb16649ULL,
+	0xfffffffef32dccd8ULL, 0xfffffffef983f92eULL, 0xfffffffeffb4c71cULL, 0xffffffff05c10da5ULL,
+	0xffffffff0ba99f15ULL, 0xffffffff116f4920ULL, 0xffffffff1712d4f5ULL, 0xffffffff1c95075dULL,
+	0xffffffff21f6a0ccULL, 0xffffffff27385d7fULL, 0xffffffff2c5af58fULL, 0xffffffff315f1d0bULL,
+	0xffffffff36458408ULL, 0xffffffff3b0ed6c0ULL, 0xffffffff3fbbbd9dULL, 0xffffffff444cdd56ULL,
+	0xffffffff48c2d6ffULL, 0xffffffff4d1e481fULL, 0xffffffff515fcac0ULL, 0xffffffff5587f588ULL,
+	0xffffffff59975bc7ULL, 0xffffffff5d8e8d89ULL, 0xffffffff616e17adULL, 0xffffffff653683f0ULL,
+	0xffffffff68e85904ULL, 0xffffffff6c841a9dULL, 0xffffffff700a4982ULL, 0xffffffff737b63a0ULL,
+	0xffffffff76d7e417ULL, 0xffffffff7a204348ULL, 0xffffffff7d54f6e9ULL, 0xffffffff80767210ULL,
+	0xffffffff83852544ULL, 0xffffffff86817e88ULL, 0xffffffff896be96dULL, 0xffffffff8c44cf1aULL,
+	0xffffffff8f0c9662ULL, 0xffffffff91c3a3c6ULL, 0xffffffff946a598dULL, 0xffffffff970117c7ULL,
+	0xffffffff99883c61ULL, 0xffffffff9c00232aULL, 0xffffffff9e6925e4ULL, 0xffffffffa0c39c4eULL,
+	0xffffffffa30fdc2eULL, 0xffffffffa54e395dULL, 0xffffffffa77f05d2ULL, 0xffffffffa9a291acULL,
+	0xffffffffabb92b3cULL, 0xffffffffadc31f11ULL, 0xffffffffafc0b800ULL, 0xffffffffb1b23f2eULL,
+	0xffffffffb397fc18ULL, 0xffffffffb57234a1ULL, 0xffffffffb7412d17ULL, 0xffffffffb905283bULL,
+	0xffffffffbabe674eULL, 0xffffffffbc6d2a17ULL, 0xffffffffbe11aee9ULL, 0xffffffffbfac32afULL,
+	0xffffffffc13cf0f5ULL, 0xffffffffc2c423e9ULL, 0xffffffffc442046aULL, 0xffffffffc5b6ca0bULL,
+	0xffffffffc722ab1cULL, 0xffffffffc885dcb2ULL, 0xffffffffc9e092abULL, 0xffffffffcb32ffb8ULL,
+	0xffffffffcc7d5562ULL, 0xffffffffcdbfc412ULL, 0xffffffffcefa7b14ULL, 0xffffffffd02da8a3ULL,
+	0xffffffffd15979e9ULL, 0xffffffffd27e1b09ULL, 0xffffffffd39bb723ULL, 0xffffffffd4b2785dULL,
+	0xffffffffd5c287e3ULL, 0xffffffffd6cc0df0ULL, 0xffffffffd7cf31d5ULL, 0xffffffffd8cc19fbULL,
+	0xffffffffd9c2ebe8ULL, 0xffffffffdab3cc48ULL, 0xffffffffdb9edeeeULL, 0xffffffffdc8446daULL,
+	0xffffffffdd642640ULL, 0xffffffffde3e9e87ULL, 0xffffffffdf13d053ULL, 0xffffffffdfe3db89ULL,
+	0xffffffffe0aedf4fULL, 0xffffffffe174fa14ULL, 0xffffffffe2364994ULL, 0xffffffffe2f2eadcULL,
+	0xffffffffe3aafa49ULL, 0xffffffffe45e9395ULL, 0xffffffffe50dd1d3ULL, 0xffffffffe5b8cf76ULL,
+	0xffffffffe65fa655ULL, 0xffffffffe7026facULL, 0xffffffffe7a14423ULL, 0xffffffffe83c3bceULL,
+	0xffffffffe8d36e34ULL, 0xffffffffe966f24dULL, 0xffffffffe9f6de8cULL, 0xffffffffea8348daULL,
+	0xffffffffeb0c46a1ULL, 0xffffffffeb91eccaULL, 0xffffffffec144fc1ULL, 0xffffffffec938378ULL,
+	0xffffffffed0f9b6cULL, 0xffffffffed88aaa2ULL, 0xffffffffedfec3b0ULL, 0xffffffffee71f8bbULL,
+	0xffffffffeee25b7dULL, 0xffffffffef4ffd45ULL, 0xffffffffefbaeefbULL, 0xfffffffff023411fULL,
+	0xfffffffff08903d2ULL, 0xfffffffff0ec46d1ULL, 0xfffffffff14d197bULL, 0xfffffffff1ab8ad4ULL,
+	0xfffffffff207a985ULL, 0xfffffffff26183deULL, 0xfffffffff2b927d8ULL, 0xfffffffff30ea31cULL,
+	0xfffffffff36202fbULL, 0xfffffffff3b3547bULL, 0xfffffffff402a44fULL, 0xfffffffff44ffedfULL,
+	0xfffffffff49b7049ULL, 0xfffffffff4e50461ULL, 0xfffffffff52cc6b3ULL, 0xfffffffff572c285ULL,
+	0xfffffffff5b702d9ULL, 0xfffffffff5f99270ULL, 0xfffffffff63a7bc6ULL, 0xfffffffff679c91bULL,
+	0xfffffffff6b7846eULL, 0xfffffffff6f3b784ULL, 0xfffffffff72e6be5ULL, 0xfffffffff767aadeULL,
+	0xfffffffff79f7d86ULL, 0xfffffffff7d5ecbaULL, 0xfffffffff80b0123ULL, 0xfffffffff83ec335ULL,
+	0xfffffffff8713b2eULL, 0xfffffffff8a2711eULL, 0xfffffffff8d26cdfULL, 0xfffffffff901361fULL,
+	0xfffffffff92ed45bULL, 0xfffffffff95b4ee2ULL, 0xfffffffff986acd7ULL, 0xfffffffff9b0f532ULL,
+	0xfffffffff9da2ebeULL, 0xfffffffffa026020ULL, 0xfffffffffa298fcfULL, 0xfffffffffa4fc420ULL,
+	0xfffffffffa75033dULL, 0xfffffffffa99532cULL, 0xfffffffffabcb9ceULL, 0xfffffffffadf3cdeULL,
+	0xfffffffffb00e1f5ULL, 0xfffffffffb21ae8bULL, 0xfffffffffb41a7f4ULL, 0xfffffffffb60d365ULL,
+	0xfffffffffb7f35f0ULL, 0xfffffffffb9cd48bULL, 0xfffffffffbb9b40bULL, 0xfffffffffbd5d928ULL,
+	0xfffffffffbf1487eULL, 0xfffffffffc0c068bULL, 0xfffffffffc2617b1ULL, 0xfffffffffc3f8037ULL,
+	0xfffffffffc58444aULL, 0xfffffffffc7067feULL, 0xfffffffffc87ef4bULL, 0xfffffffffc9ede14ULL,
+	0xfffffffffcb53820ULL, 0xfffffffffccb0121ULL, 0xfffffffffce03cb1ULL, 0xfffffffffcf4ee55ULL,
+	0xfffffffffd09197aULL, 0xfffffffffd1cc179ULL, 0xfffffffffd2fe996ULL, 0xfffffffffd429501ULL,
+	0xfffffffffd54c6d4ULL, 0xfffffffffd668218ULL, 0xfffffffffd77c9c2ULL, 0xfffffffffd88a0b6ULL,
+	0xfffffffffd9909c3ULL, 0xfffffffffda907a8ULL, 0xfffffffffdb89d14ULL, 0xfffffffffdc7cca4ULL,
+	0xfffffffffdd698e4ULL, 0xfffffffffde50451ULL, 0xfffffffffdf31157ULL, 0xfffffffffe00c256ULL,
+	0xfffffffffe0e199bULL, 0xfffffffffe1b1968ULL, 0xfffffffffe27c3eeULL, 0xfffffffffe341b52ULL,
+	0xfffffffffe4021abULL, 0xfffffffffe4bd903ULL, 0xfffffffffe574357ULL, 0xfffffffffe626297ULL,
+	0xfffffffffe6d38a6ULL, 0xfffffffffe77c75fULL, 0xfffffffffe82108cULL, 0xfffffffffe8c15f0ULL,
+	0xfffffffffe95d940ULL, 0xfffffffffe9f5c28ULL, 0xfffffffffea8a048ULL, 0xfffffffffeb1a736ULL,
+	0xfffffffffeba7280ULL, 0xfffffffffec303a7ULL, 0xfffffffffecb5c24ULL, 0xfffffffffed37d67ULL,
+	0xfffffffffedb68d7ULL, 0xfffffffffee31fd0ULL, 0xfffffffffeeaa3a9ULL, 0xfffffffffef1f5acULL,
+	0xfffffffffef9171eULL, 0xffffffffff00093cULL, 0xffffffffff06cd39ULL, 0xffffffffff0d6442ULL,
+	0xffffffffff13cf7cULL, 0xffffffffff1a1005ULL, 0xffffffffff2026f3ULL, 0xffffffffff261555ULL,
+	0xffffffffff2bdc35ULL, 0xffffffffff317c95ULL, 0xffffffffff36f770ULL, 0xffffffffff3c4dbcULL,
+	0xffffffffff418069ULL, 0xffffffffff46905fULL, 0xffffffffff4b7e81ULL, 0xffffffffff504bafULL,
+	0xffffffffff54f8bfULL, 0xffffffffff598685ULL, 0xffffffffff5df5ceULL, 0xffffffffff624763ULL,
+	0xffffffffff667c05ULL, 0xffffffffff6a9475ULL, 0xffffffffff6e916cULL, 0xffffffffff72739eULL,
+	0xffffffffff763bbbULL, 0xffffffffff79ea70ULL, 0xffffffffff7d8064ULL, 0xffffffffff80fe3aULL,
+	0xffffffffff846492ULL, 0xffffffffff87b407ULL, 0xffffffffff8aed2fULL, 0xffffffffff8e109fULL,
+	0xffffffffff911ee6ULL, 0xffffffffff94188fULL, 0xffffffffff96fe24ULL, 0xffffffffff99d02aULL,
+	0xffffffffff9c8f22ULL, 0xffffffffff9f3b8aULL, 0xffffffffffa1d5deULL, 0xffffffffffa45e96ULL,
+	0xffffffffffa6d626ULL, 0xffffffffffa93d01ULL, 0xffffffffffab9396ULL, 0xffffffffffadda51ULL,
+	0xffffffffffb0119bULL, 0xffffffffffb239dbULL, 0xffffffffffb45376ULL, 0xffffffffffb65ecdULL,
+	0xffffffffffb85c3fULL, 0xffffffffffba4c29ULL, 0xffffffffffbc2ee5ULL, 0xffffffffffbe04cbULL,
+	0xffffffffffbfce32ULL, 0xffffffffffc18b6cULL, 0xffffffffffc33cccULL, 0xffffffffffc4e2a0ULL,
+	0xffffffffffc67d35ULL, 0xffffffffffc80cd8ULL, 0xffffffffffc991d1ULL, 0xffffffffffcb0c68ULL,
+	0xffffffffffcc7ce3ULL, 0xffffffffffcde385ULL, 0xffffffffffcf4091ULL, 0xffffffffffd09447ULL,
+	0xffffffffffd1dee6ULL, 0xffffffffffd320abULL, 0xffffffffffd459d2ULL, 0xffffffffffd58a94ULL,
+	0xffffffffffd6b32bULL, 0xffffffffffd7d3ccULL, 0xffffffffffd8ecafULL, 0xffffffffffd9fe07ULL,
+	0xffffffffffdb0807ULL, 0xffffffffffdc0ae1ULL, 0xffffffffffdd06c5ULL, 0xffffffffffddfbe2ULL,
+	0xffffffffffdeea66ULL, 0xffffffffffdfd27eULL, 0xffffffffffe0b454ULL, 0xffffffffffe19015ULL,
+	0xffffffffffe265e8ULL, 0xffffffffffe335f6ULL, 0xffffffffffe40066ULL, 0xffffffffffe4c55fULL,
+	0xffffffffffe58505ULL, 0xffffffffffe63f7cULL, 0xffffffffffe6f4e8ULL, 0xffffffffffe7a56cULL,
+	0xffffffffffe85128ULL, 0xffffffffffe8f83dULL, 0xffffffffffe99acbULL, 0xffffffffffea38f0ULL,
+	0xffffffffffead2cbULL, 0xffffffffffeb687aULL, 0xffffffffffebfa17ULL, 0xffffffffffec87c0ULL,
+	0xffffffffffed1190ULL, 0xffffffffffed97a0ULL, 0xffffffffffee1a0aULL, 0xffffffffffee98e7ULL,
+	0xffffffffffef1450ULL, 0xffffffffffef8c5cULL, 0xfffffffffff00123ULL, 0xfffffffffff072baULL,
+	0xfffffffffff0e138ULL, 0xfffffffffff14cb1ULL, 0xfffffffffff1b53bULL, 0xfffffffffff21aeaULL,
+	0xfffffffffff27dd1ULL, 0xfffffffffff2de04ULL, 0xfffffffffff33b94ULL, 0xfffffffffff39695ULL,
+	0xfffffffffff3ef18ULL, 0xfffffffffff4452eULL, 0xfffffffffff498e8ULL, 0xfffffffffff4ea55ULL,
+	0xfffffffffff53987ULL, 0xfffffffffff5868cULL, 0xfffffffffff5d173ULL, 0xfffffffffff61a4cULL,
+	0xfffffffffff66123ULL, 0xfffffffffff6a608ULL, 0xfffffffffff6e907ULL, 0xfffffffffff72a2eULL,
+	0xfffffffffff7698aULL, 0xfffffffffff7a726ULL, 0xfffffffffff7e310ULL, 0xfffffffffff81d52ULL,
+	0xfffffffffff855f9ULL, 0xfffffffffff88d0fULL, 0xfffffffffff8c29fULL, 0xfffffffffff8f6b5ULL,
+	0xfffffffffff9295aULL, 0xfffffffffff95a98ULL, 0xfffffffffff98a79ULL, 0xfffffffffff9b907ULL,
+	0xfffffffffff9e64aULL, 0xfffffffffffa124dULL, 0xfffffffffffa3d17ULL, 0xfffffffffffa66b1ULL,
+	0xfffffffffffa8f23ULL, 0xfffffffffffab676ULL, 0xfffffffffffadcb1ULL, 0xfffffffffffb01dbULL,
+	0xfffffffffffb25feULL, 0xfffffffffffb491fULL, 0xfffffffffffb6b45ULL, 0xfffffffffffb8c78ULL,
+	0xfffffffffffbacbeULL, 0xfffffffffffbcc1eULL, 0xfffffffffffbea9eULL, 0xfffffffffffc0844ULL,
+	0xfffffffffffc2516ULL, 0xfffffffffffc411aULL, 0xfffffffffffc5c56ULL, 0xfffffffffffc76cfULL,
+	0xfffffffffffc908aULL, 0xfffffffffffca98dULL, 0xfffffffffffcc1dcULL, 0xfffffffffffcd97eULL,
+	0xfffffffffffcf075ULL, 0xfffffffffffd06c8ULL, 0xfffffffffffd1c7bULL, 0xfffffffffffd3191ULL,
+	0xfffffffffffd4611ULL, 0xfffffffffffd59fcULL, 0xfffffffffffd6d59ULL, 0xfffffffffffd802aULL,
+	0xfffffffffffd9273ULL, 0xfffffffffffda439ULL, 0xfffffffffffdb57fULL, 0xfffffffffffdc648ULL,
+	0xfffffffffffdd698ULL, 0xfffffffffffde673ULL, 0xfffffffffffdf5dbULL, 0xfffffffffffe04d3ULL,
+	0xfffffffffffe1360ULL, 0xfffffffffffe2183ULL, 0xfffffffffffe2f40ULL, 0xfffffffffffe3c99ULL,
+	0xfffffffffffe4992ULL, 0xfffffffffffe562dULL, 0xfffffffffffe626cULL, 0xfffffffffffe6e53ULL,
+	0xfffffffffffe79e3ULL, 0xfffffffffffe8520ULL, 0xfffffffffffe900aULL, 0xfffffffffffe9aa6ULL,
+	0xfffffffffffea4f4ULL, 0xfffffffffffeaef8ULL, 0xfffffffffffeb8b2ULL, 0xfffffffffffec226ULL,
+	0xfffffffffffecb55ULL, 0xfffffffffffed441ULL, 0xfffffffffffedcecULL, 0xfffffffffffee558ULL,
+	0xfffffffffffeed86ULL, 0xfffffffffffef579ULL, 0xfffffffffffefd32ULL, 0xffffffffffff04b2ULL,
+	0xffffffffffff0bfbULL, 0xffffffffffff130fULL, 0xffffffffffff19f0ULL, 0xffffffffffff209eULL,
+	0xffffffffffff271bULL, 0xffffffffffff2d69ULL, 0xffffffffffff3388ULL, 0xffffffffffff397aULL,
+	0xffffffffffff3f41ULL, 0xffffffffffff44deULL, 0xffffffffffff4a51ULL, 0xffffffffffff4f9cULL,
+	0xffffffffffff54c1ULL, 0xffffffffffff59bfULL, 0xffffffffffff5e99ULL, 0xffffffffffff634fULL,
+	0xffffffffffff67e2ULL, 0xffffffffffff6c54ULL, 0xffffffffffff70a5ULL, 0xffffffffffff74d6ULL,
+	0xffffffffffff78e9ULL, 0xffffffffffff7cddULL, 0xffffffffffff80b4ULL, 0xffffffffffff846eULL,
+	0xffffffffffff880dULL, 0xffffffffffff8b92ULL, 0xffffffffffff8efcULL, 0xffffffffffff924dULL,
+	0xffffffffffff9585ULL, 0xffffffffffff98a6ULL, 0xffffffffffff9bafULL, 0xffffffffffff9ea2ULL,
+	0xffffffffffffa17fULL, 0xffffffffffffa447ULL, 0xffffffffffffa6faULL, 0xffffffffffffa99aULL,
+	0xffffffffffffac25ULL, 0xffffffffffffae9eULL, 0xffffffffffffb104ULL, 0xffffffffffffb359ULL,
+	0xffffffffffffb59cULL, 0xffffffffffffb7ceULL, 0xffffffffffffb9f0ULL, 0xffffffffffffbc02ULL,
+	0xffffffffffffbe05ULL, 0xffffffffffffbff8ULL, 0xffffffffffffc1ddULL, 0xffffffffffffc3b4ULL,
+	0xffffffffffffc57eULL, 0xffffffffffffc739ULL, 0xffffffffffffc8e8ULL, 0xffffffffffffca8aULL,
+	0xffffffffffffcc20ULL, 0xffffffffffffcdabULL, 0xffffffffffffcf29ULL, 0xffffffffffffd09dULL,
+	0xffffffffffffd205ULL, 0xffffffffffffd363ULL, 0xffffffffffffd4b7ULL, 0xffffffffffffd601ULL,
+	0xffffffffffffd741ULL, 0xffffffffffffd877ULL, 0xffffffffffffd9a5ULL, 0xffffffffffffdacaULL,
+	0xffffffffffffdbe6ULL, 0xffffffffffffdcfaULL, 0xffffffffffffde05ULL, 0xffffffffffffdf09ULL,
+	0xffffffffffffe005ULL, 0xffffffffffffe0faULL, 0xffffffffffffe1e7ULL, 0xffffffffffffe2ceULL,
+	0xffffffffffffe3adULL, 0xffffffffffffe486ULL, 0xffffffffffffe559ULL, 0xffffffffffffe626ULL,
+	0xffffffffffffe6ecULL, 0xffffffffffffe7adULL, 0xffffffffffffe867ULL, 0xffffffffffffe91dULL,
+	0xffffffffffffe9cdULL, 0xffffffffffffea77ULL, 0xffffffffffffeb1dULL, 0xffffffffffffebbeULL,
+	0xffffffffffffec5aULL, 0xffffffffffffecf1ULL, 0xffffffffffffed84ULL, 0xffffffffffffee13ULL,
+	0xffffffffffffee9dULL, 0xffffffffffffef23ULL, 0xffffffffffffefa5ULL, 0xfffffffffffff024ULL,
+	0xfffffffffffff09eULL, 0xfffffffffffff115ULL, 0xfffffffffffff188ULL, 0xfffffffffffff1f8ULL,
+	0xfffffffffffff265ULL, 0xfffffffffffff2ceULL, 0xfffffffffffff335ULL, 0xfffffffffffff398ULL,
+	0xfffffffffffff3f8ULL, 0xfffffffffffff455ULL, 0xfffffffffffff4b0ULL, 0xfffffffffffff508ULL,
+	0xfffffffffffff55dULL, 0xfffffffffffff5afULL, 0xfffffffffffff600ULL, 0xfffffffffffff64dULL,
+	0xfffffffffffff699ULL, 0xfffffffffffff6e2ULL, 0xfffffffffffff729ULL, 0xfffffffffffff76eULL,
+	0xfffffffffffff7b1ULL, 0xfffffffffffff7f1ULL, 0xfffffffffffff830ULL, 0xfffffffffffff86dULL,
+	0xfffffffffffff8a8ULL, 0xfffffffffffff8e2ULL, 0xfffffffffffff919ULL, 0xfffffffffffff94fULL,
+	0xfffffffffffff984ULL, 0xfffffffffffff9b6ULL, 0xfffffffffffff9e7ULL, 0xfffffffffffffa17ULL,
+	0xfffffffffffffa45ULL, 0xfffffffffffffa72ULL, 0xfffffffffffffa9eULL, 0xfffffffffffffac8ULL,
+	0xfffffffffffffaf1ULL, 0xfffffffffffffb19ULL, 0xfffffffffffffb3fULL, 0xfffffffffffffb65ULL,
+	0xfffffffffffffb89ULL, 0xfffffffffffffbacULL, 0xfffffffffffffbceULL, 0xfffffffffffffbefULL,
+	0xfffffffffffffc0fULL, 0xfffffffffffffc2eULL, 0xfffffffffffffc4cULL, 0xfffffffffffffc69ULL,
+	0xfffffffffffffc85ULL, 0xfffffffffffffca1ULL, 0xfffffffffffffcbcULL, 0xfffffffffffffcd5ULL,
+	0xfffffffffffffceeULL, 0xfffffffffffffd07ULL, 0xfffffffffffffd1eULL, 0xfffffffffffffd35ULL,
+	0xfffffffffffffd4bULL, 0xfffffffffffffd60ULL, 0xfffffffffffffd75ULL, 0xfffffffffffffd89ULL,
+	0xfffffffffffffd9dULL, 0xfffffffffffffdb0ULL, 0xfffffffffffffdc2ULL, 0xfffffffffffffdd4ULL,
+	0xfffffffffffffde5ULL, 0xfffffffffffffdf6ULL, 0xfffffffffffffe06ULL, 0xfffffffffffffe16ULL,
+	0xfffffffffffffe25ULL, 0xfffffffffffffe34ULL, 0xfffffffffffffe42ULL, 0xfffffffffffffe50ULL,
+	0xfffffffffffffe5dULL, 0xfffffffffffffe6aULL, 0xfffffffffffffe77ULL, 0xfffffffffffffe83ULL,
+	0xfffffffffffffe8fULL, 0xfffffffffffffe9aULL, 0xfffffffffffffea6ULL, 0xfffffffffffffeb0ULL,
+	0xfffffffffffffebbULL, 0xfffffffffffffec5ULL, 0xfffffffffffffecfULL, 0xfffffffffffffed8ULL,
+	0xfffffffffffffee2ULL, 0xfffffffffffffeebULL, 0xfffffffffffffef3ULL, 0xfffffffffffffefcULL,
+	0xffffffffffffff04ULL, 0xffffffffffffff0cULL, 0xffffffffffffff13ULL, 0xffffffffffffff1bULL,
+	0xffffffffffffff22ULL, 0xffffffffffffff29ULL, 0xffffffffffffff30ULL, 0xffffffffffffff36ULL,
+	0xffffffffffffff3cULL, 0xffffffffffffff43ULL, 0xffffffffffffff48ULL, 0xffffffffffffff4eULL,
+	0xffffffffffffff54ULL, 0xffffffffffffff59ULL, 0xffffffffffffff5eULL, 0xffffffffffffff64ULL,
+	0xffffffffffffff68ULL, 0xffffffffffffff6dULL, 0xffffffffffffff72ULL, 0xffffffffffffff76ULL,
+	0xffffffffffffff7bULL, 0xffffffffffffff7fULL, 0xffffffffffffff83ULL, 0xffffffffffffff87ULL,
+	0xffffffffffffff8bULL, 0xffffffffffffff8eULL, 0xffffffffffffff92ULL, 0xffffffffffffff95ULL,
+	0xffffffffffffff99ULL, 0xffffffffffffff9cULL, 0xffffffffffffff9fULL, 0xffffffffffffffa2ULL,
+	0xffffffffffffffa5ULL, 0xffffffffffffffa8ULL, 0xffffffffffffffabULL, 0xffffffffffffffaeULL,
+	0xffffffffffffffb0ULL, 0xffffffffffffffb3ULL, 0xffffffffffffffb5ULL, 0xffffffffffffffb7ULL,
+	0xffffffffffffffbaULL, 0xffffffffffffffbcULL, 0xffffffffffffffbeULL, 0xffffffffffffffc0ULL,
+	0xffffffffffffffc2ULL, 0xffffffffffffffc4ULL, 0xffffffffffffffc6ULL, 0xffffffffffffffc8ULL,
+	0xffffffffffffffcaULL, 0xffffffffffffffcbULL, 0xffffffffffffffcdULL, 0xffffffffffffffcfULL,
+	0xffffffffffffffd0ULL, 0xffffffffffffffd2ULL, 0xffffffffffffffd3ULL, 0xffffffffffffffd5ULL,
+	0xffffffffffffffd6ULL, 0xffffffffffffffd7ULL, 0xffffffffffffffd9ULL, 0xffffffffffffffdaULL,
+	0xffffffffffffffdbULL, 0xffffffffffffffdcULL, 0xffffffffffffffddULL, 0xffffffffffffffdfULL,
+	0xffffffffffffffe0ULL, 0xffffffffffffffe1ULL, 0xffffffffffffffe2ULL, 0xffffffffffffffe3ULL,
+	0xffffffffffffffe3ULL, 0xffffffffffffffe4ULL, 0xffffffffffffffe5ULL, 0xffffffffffffffe6ULL,
+	0xffffffffffffffe7ULL, 0xffffffffffffffe8ULL, 0xffffffffffffffe8ULL, 0xffffffffffffffe9ULL,
+	0xffffffffffffffeaULL, 0xffffffffffffffebULL, 0xffffffffffffffebULL, 0xffffffffffffffecULL,
+	0xffffffffffffffedULL, 0xffffffffffffffedULL, 0xffffffffffffffeeULL, 0xffffffffffffffeeULL,
+	0xffffffffffffffefULL, 0xffffffffffffffefULL, 0xfffffffffffffff0ULL, 0xfffffffffffffff0ULL,
+	0xfffffffffffffff1ULL, 0xfffffffffffffff1ULL, 0xfffffffffffffff2ULL, 0xfffffffffffffff2ULL,
+	0xfffffffffffffff3ULL, 0xfffffffffffffff3ULL, 0xfffffffffffffff4ULL, 0xfffffffffffffff4ULL,
+	0xfffffffffffffff4ULL, 0xfffffffffffffff5ULL, 0xfffffffffffffff5ULL, 0xfffffffffffffff5ULL,
+	0xfffffffffffffff6ULL, 0xfffffffffffffff6ULL, 0xfffffffffffffff6ULL, 0xfffffffffffffff7ULL,
+	0xfffffffffffffff7ULL, 0xfffffffffffffff7ULL, 0xfffffffffffffff8ULL, 0xfffffffffffffff8ULL,
+	0xfffffffffffffff8ULL, 0xfffffffffffffff8ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL,
+	0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffff9ULL, 0xfffffffffffffffaULL,
+	0xfffffffffffffffaULL, 0xfffffffffffffffaULL, 0xfffffffffffffffaULL, 0xfffffffffffffffaULL,
+	0xfffffffffffffffaULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL,
+	0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffbULL, 0xfffffffffffffffcULL,
+	0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL,
+	0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL, 0xfffffffffffffffcULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL, 0xfffffffffffffffdULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+	0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL, 0xfffffffffffffffeULL,
+};
+
+static const uint16_t cdt_guide_bliss_271[257] = {
+	   0,    1,    3,    4,    5,    7,    8,    9,   11,   12,   13,   15,   16,   17,   19,   20,
+	  21,   23,   24,   25,   27,   28,   29,   31,   32,   33,   35,   36,   37,   39,   40,   41,
+	  43,   44,   45,   47,   48,   50,   51,   52,   54,   55,   56,   58,   59,   60,   62,   63,
+	  64,   66,   67,   69,   70,   71,   73,   74,   75,   77,   78,   80,   81,   82,   84,   85,
+	  87,   88,   89,   91,   92,   94,   95,   96,   98,   99,  101,  102,  104,  105,  106,  108,
+	 109,  111,  112,  114,  115,  117,  118,  120,  121,  122,  124,  125,  127,  128,  130,  131,
+	 133,  134,  136,  137,  139,  140,  142,  143,  145,  147,  148,  150,  151,  153,  154,  156,
+	 157,  159,  161,  162,  164,  165,  167,  169,  170,  172,  173,  175,  177,  178,  180,  182,
+	 183,  185,  187,  188,  190,  192,  193,  195,  197,  199,  200,  202,  204,  206,  207,  209,
+	 211,  213,  215,  216,  218,  220,  222,  224,  226,  228,  229,  231,  233,  235,  237,  239,
+	 241,  243,  245,  247,  249,  251,  253,  255,  257,  259,  262,  264,  266,  268,  270,  272,
+	 274,  277,  279,  281,  284,  286,  288,  290,  293,  295,  298,  300,  303,  305,  308,  310,
+	 313,  315,  318,  321,  323,  326,  329,  331,  334,  337,  340,  343,  346,  349,  352,  355,
+	 358,  361,  365,  368,  371,  375,  378,  382,  385,  389,  393,  397,  400,  404,  409,  413,
+	 417,  421,  426,  430,  435,  440,  445,  450,  455,  461,  467,  473,  479,  485,  492,  499,
+	 506,  514,  522,  531,  540,  550,  561,  573,  585,  600,  616,  635,  657,  685,  723,  784,
+	2488,
+};
+
+
+/*
+ * Get the table for sigma
+ * - return NULL if we don't have it
+ * - store the table size in *size
+ */
+const uint64_t *get_cdt(uint32_t sigma, uint32_t *size){
+  switch(sigma) {
+  case 100:
+    *size = CDT_100_SIZE;
+    return cdt_bliss_100;
+  case 215:
+    *size = CDT_215_SIZE;
+    return cdt_bliss_215;
+  case 107:
+    *size = CDT_107_SIZE;
+    return cdt_bliss_107;
+  case 250:
+    *size = CDT_250_SIZE;
+    return cdt_bliss_250;
+  case 271:
+    *size = CDT_271_SIZE;
+    return cdt_bliss_271;
+  default:
+    *size = 0;
+    return NULL;
+  }
+}
+
+const uint16_t *get_cdt_guide(uint32_t sigma){
+  switch(sigma) {
+  case 100:
+    return cdt_guide_bliss_100;
+  case 215:
+    return cdt_guide_bliss_215;
+  case 107:
+    return cdt_guide_bliss_107;
+  case 250:
+    return cdt_guide_bliss_250;
+  case 271:
+    return cdt_guide_bliss_271;
+  default:
+    return NULL;
+  }
+}
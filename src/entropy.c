@@ -26,30 +26,93 @@ static void increment_seed(entropy_t *entropy) {
  *
  * - hash must be an array of n * SHA3_512_DIGEST_LENGTH bytes 
  *   (i.e., n * 64 bytes)
+ *
+ * The i-th block of 64 bytes is sha3_512 of the seed + i. We compute
+ * four blocks at a time with sha3_512x4 (the last batch may use fewer
+ * lanes: the extra outputs go to a scratch buffer).
  */
 static void refresh(entropy_t *entropy, uint8_t *hash, uint32_t n) {
+  uint8_t seeds[4][SHA3_512_DIGEST_LENGTH];
+  uint8_t scratch[SHA3_512_DIGEST_LENGTH];
+  const uint8_t *input[4] = { seeds[0], seeds[1], seeds[2], seeds[3] };
+  uint8_t *output[4];
+  uint32_t i, j;
+
   assert(n > 0);
 
   while (n > 0) {
-    sha3_512(hash, entropy->seed, SHA3_512_DIGEST_LENGTH);
-    increment_seed(entropy);
-    hash += SHA3_512_DIGEST_LENGTH;
-    n --;
+    for (j = 0; j < 4; j++) {
+      for (i = 0; i < SHA3_512_DIGEST_LENGTH; i++) {
+        seeds[j][i] = entropy->seed[i];
+      }
+      if (j < n) {
+        output[j] = hash + j * SHA3_512_DIGEST_LENGTH;
+        increment_seed(entropy);
+      } else {
+        output[j] = scratch;
+      }
+    }
+    sha3_512x4(output, input, SHA3_512_DIGEST_LENGTH);
+
+    j = n < 4 ? n : 4;
+    hash += j * SHA3_512_DIGEST_LENGTH;
+    n -= j;
+  }
+}
+
+/*
+ * Same thing for ENTROPY_SHAKE128: store the next n * SHA3_512_DIGEST_LENGTH
+ * bytes of the SHAKE128 output into hash. The unused part of the
+ * last squeezed block is kept in xof_block for the next call.
+ */
+static void xof_refresh(entropy_t *entropy, uint8_t *hash, uint32_t n) {
+  uint32_t len, nblocks;
+
+  assert(n > 0);
+
+  len = n * SHA3_512_DIGEST_LENGTH;
+  while (len > 0 && entropy->xof_index < SHAKE128_RATE) {
+    *hash++ = entropy->xof_block[entropy->xof_index++];
+    len --;
+  }
+
+  nblocks = len / SHAKE128_RATE;
+  if (nblocks > 0) {
+    shake128_squeezeblocks(hash, nblocks, entropy->xof_state);
+    hash += nblocks * SHAKE128_RATE;
+    len -= nblocks * SHAKE128_RATE;
+  }
+
+  if (len > 0) {
+    shake128_squeezeblocks(entropy->xof_block, 1, entropy->xof_state);
+    entropy->xof_index = 0;
+    while (len > 0) {
+      *hash++ = entropy->xof_block[entropy->xof_index++];
+      len --;
+    }
+  }
+}
+
+static void pool_refresh(entropy_t *entropy, uint8_t *hash, uint32_t n) {
+  if (entropy->generator == ENTROPY_SHAKE128) {
+    xof_refresh(entropy, hash, n);
+  } else {
+    refresh(entropy, hash, n);
   }
 }
 
 static void char_pool_refresh(entropy_t *entropy) {
-  refresh(entropy, entropy->char_pool, EPOOL_HASH_COUNT);
+  pool_refresh(entropy, entropy->char_pool, EPOOL_HASH_COUNT);
   entropy->char_index = 0;
 }
 
 static void int16_pool_refresh(entropy_t *entropy) {
-  refresh(entropy, (uint8_t *) entropy->int16_pool, EPOOL_HASH_COUNT);
+  pool_refresh(entropy, (uint8_t *) entropy->int16_pool, EPOOL_HASH_COUNT);
   entropy->int16_index = 0;
 }
 
 static void int64_pool_refresh(entropy_t *entropy) {
-  refresh(entropy, (uint8_t *) entropy->int64_pool, EPOOL_HASH_COUNT);
+  pool_refresh(entropy, (uint8_t *) entropy->int64_pool, EPOOL_HASH_COUNT);
   entropy->int64_index = 0;
 }
 
@@ -96,12 +159,54 @@ uint8_t entropy_random_uint8(entropy_t *entropy){
 }
 
 
+/*
+ * Bit reservoir: bit_pool stores bit_count random bits in its high-order
+ * bits. The next bit to return is the most significant one.
+ *
+ * The 64bit words from the int64 pool are stored in bit-reversed order,
+ * so we return the same bits in the same order as the original
+ * implementation (which took bits from the low-order end of the word
+ * and built the result of entropy_random_bits from the most significant
+ * bit down).
+ */
+static uint64_t reverse_bits64(uint64_t x) {
+  x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+  x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+  x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+  x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+  x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+  return (x >> 32) | (x << 32);
+}
+
+/*
+ * Remove the n most significant bits of bit_pool (n <= bit_count)
+ */
+static inline void consume_bits(entropy_t *entropy, uint32_t n) {
+  assert(n <= entropy->bit_count);
+  entropy->bit_pool = n == 64 ? 0 : entropy->bit_pool << n;
+  entropy->bit_count -= n;
+}
+
+/*
+ * Index of the most significant bit of x (x must be non-zero)
+ */
+#if defined(__GNUC__)
+#define highest_bit64(x) (63 - (uint32_t) __builtin_clzll(x))
+#else
+static inline uint32_t highest_bit64(uint64_t x) {
+  uint32_t i;
+
+  for (i = 0; x > 1; i++) x >>= 1;
+  return i;
+}
+#endif
+
 /*
  * Use previous function to refresh bit pool
  */
 static void bit_pool_refresh(entropy_t *entropy) {
-  entropy->bit_pool = entropy_random_uint64(entropy);
-  entropy->bit_index = 0;
+  entropy->bit_pool = reverse_bits64(entropy_random_uint64(entropy));
+  entropy->bit_count = 64;
 }
 
 /*
@@ -112,12 +217,12 @@ bool entropy_random_bit(entropy_t *entropy) {
 
   assert(entropy != NULL);
 
-  if (entropy->bit_index >= 64) {
+  if (entropy->bit_count == 0) {
     bit_pool_refresh(entropy);
   }
-  bit = entropy->bit_pool & 1;
-  entropy->bit_pool >>= 1;
-  entropy->bit_index ++;
+  bit = entropy->bit_pool >> 63;
+  entropy->bit_pool <<= 1;
+  entropy->bit_count --;
 
   return bit;
 }
@@ -129,18 +234,69 @@ bool entropy_random_bit(entropy_t *entropy) {
  * - the n bits are low-order bits of the returned integer.
  */
 uint32_t entropy_random_bits(entropy_t* entropy, uint32_t n) {
-  uint32_t retval;
+  uint64_t retval;
+  uint32_t k;
 
   assert(entropy != NULL && n <= 32);
 
-  retval = 0;
-  while (n  > 0) {
-    retval <<= 1;
-    retval |= entropy_random_bit(entropy);
-    n --;
+  if (n == 0) {
+    return 0;
+  }
+
+  if (n <= entropy->bit_count) {
+    retval = entropy->bit_pool >> (64 - n);
+    entropy->bit_pool <<= n;
+    entropy->bit_count -= n;
+  } else {
+    // use the bit_count remaining bits, then k bits from a fresh word
+    k = n - entropy->bit_count;
+    retval = entropy->bit_count == 0 ? 0 : entropy->bit_pool >> (64 - entropy->bit_count);
+    bit_pool_refresh(entropy);
+    retval = (retval << k) | (entropy->bit_pool >> (64 - k));
+    entropy->bit_pool <<= k;
+    entropy->bit_count -= k;
   }
 
-  return retval;
+  return (uint32_t) retval;
+}
+
+
+/*
+ * Compare a uniform random r in [0, 1) with p = 0.p[0]p[1]...p[words-1]
+ * (in binary, 64 bits per word, most significant word first).
+ *
+ * We compare the bits of r (from the reservoir) with the bits of p, 64 at
+ * a time: the first bit where they differ decides, and only the bits up
+ * to that one are consumed (two bits on average).
+ */
+bool entropy_random_below_slow(entropy_t *entropy, const uint64_t *p, uint32_t words) {
+  uint64_t v, d;
+  uint32_t w, k, pos, remaining;
+
+  assert(entropy != NULL && p != NULL);
+
+  for (w = 0; w < words; w++) {
+    v = p[w];
+    remaining = 64;
+    while (remaining > 0) {
+      if (entropy->bit_count == 0) {
+        bit_pool_refresh(entropy);
+      }
+      k = remaining < entropy->bit_count ? remaining : entropy->bit_count;
+      // compare the top k bits of v and bit_pool
+      d = (entropy->bit_pool ^ v) & (~((uint64_t) 0) << (64 - k));
+      if (d != 0) {
+        pos = highest_bit64(d);   // first bit that differs is 63 - pos
+        consume_bits(entropy, 64 - pos);
+        return (v >> pos) & 1;    // bit of p is 1: r < p
+      }
+      consume_bits(entropy, k);
+      v = k == 64 ? 0 : v << k;
+      remaining -= k;
+    }
+  }
+
+  return true; // r = p (up to the precision of p)
 }
 
 
@@ -148,15 +304,23 @@ uint32_t entropy_random_bits(entropy_t* entropy, uint32_t n) {
  * Initialize: with the given seed
  * - seed must be an array of SHA3_512_DIGEST_LENGTH bytes
  */
-void entropy_init(entropy_t *entropy, const uint8_t *seed) {
+void entropy_init_generator(entropy_t *entropy, const uint8_t *seed, entropy_generator_t generator) {
   uint32_t i;
 
   for (i=0; i<SHA3_512_DIGEST_LENGTH; i++) {
     entropy->seed[i] = seed[i];
   }
+  entropy->generator = generator;
+  entropy->xof_index = SHAKE128_RATE;
+  if (generator == ENTROPY_SHAKE128) {
+    shake128_absorb(entropy->xof_state, seed, SHA3_512_DIGEST_LENGTH);
+  }
   char_pool_refresh(entropy);
   int16_pool_refresh(entropy);
   int64_pool_refresh(entropy);
   bit_pool_refresh(entropy);
 }
 
+void entropy_init(entropy_t *entropy, const uint8_t *seed) {
+  entropy_init_generator(entropy, seed, ENTROPY_SHAKE128);
+}
@@ -0,0 +1,277 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "greedy_sc.h"
+
+/*
+ * GreedySC (derived from blzzd version)
+ *
+ * For each index k of c, we compute sign = <v, x^k * s> where
+ * v = (v1, v2) and s = (s1, s2), then v := v - s if sign > 0 or
+ * v := v + s otherwise.
+ *
+ * With the extensions s1x, s2x, the rotated s is the window
+ * t = sx + n - k, and the update is applied branch-free:
+ * m = -(sign > 0) is 0 or all ones, and v[j] += (t[j] ^ m) - m.
+ *
+ * v is stored as int16. Each pass over v applies the update of the
+ * previous index and computes the dot product for the next one.
+ * For the first index, v is zero so sign = 0 and the update is v := s.
+ */
+
+#define MAX_N 512
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define GREEDY_SC_SIMD 1
+#define ALIGNED32 __attribute__((aligned(32)))
+#include <immintrin.h>
+#else
+#define GREEDY_SC_SIMD 0
+#define ALIGNED32
+#endif
+
+/*
+ * The passes take n as argument and are always inlined, so that the
+ * loops are fully unrolled when n is a constant. We instantiate them
+ * for n = 256 and n = 512 (all the BLISS-B kinds) and for any n.
+ */
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+void greedy_sc_extend(int8_t *sx, const int32_t *s, uint32_t n) {
+  uint32_t i;
+
+  for (i = 0; i < n; i++) {
+    assert(-128 <= s[i] && s[i] <= 127);
+    sx[i] = (int8_t) (- s[i]);
+    sx[n + i] = (int8_t) s[i];
+  }
+}
+
+static inline int16_t sign_mask(int32_t sign) {
+  return (int16_t) - (int16_t) (sign > 0);
+}
+
+#if ! GREEDY_SC_SIMD
+
+static ALWAYS_INLINE void greedy_sc_c(const int8_t *s1x, const int8_t *s2x, uint32_t n, const uint32_t *c_indices,
+                                      uint32_t kappa, int16_t *w1, int16_t *w2) {
+  const int8_t *t1, *t2, *u1, *u2;
+  uint32_t j, k;
+  int32_t sign;
+  int16_t m;
+
+  u1 = s1x + n - c_indices[0];
+  u2 = s2x + n - c_indices[0];
+  m = 0;
+  for (k = 1; k < kappa; k++) {
+    t1 = s1x + n - c_indices[k];
+    t2 = s2x + n - c_indices[k];
+    sign = 0;
+    for (j = 0; j < n; j++) {
+      w1[j] = (int16_t) (w1[j] + ((u1[j] ^ m) - m));
+      w2[j] = (int16_t) (w2[j] + ((u2[j] ^ m) - m));
+      sign += w1[j] * t1[j] + w2[j] * t2[j];
+    }
+    m = sign_mask(sign);
+    u1 = t1;
+    u2 = t2;
+  }
+  for (j = 0; j < n; j++) {
+    w1[j] = (int16_t) (w1[j] + ((u1[j] ^ m) - m));
+    w2[j] = (int16_t) (w2[j] + ((u2[j] ^ m) - m));
+  }
+}
+
+#else
+
+/*
+ * SSE2 and AVX2 versions: the int8 coefficients of s are sign-extended
+ * to int16, and the dot products are computed with pmaddwd (int16 x int16
+ * products added into int32 lanes).
+ */
+
+// sign-extend 8 bytes at p to int16 (SSE2 has no pmovsxbw)
+static inline __m128i load_s8x8(const int8_t *p) {
+  __m128i x;
+
+  x = _mm_loadl_epi64((const __m128i *) p);
+  return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+}
+
+static inline int32_t hsum_sse2(__m128i x) {
+  x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+  x = _mm_add_epi32(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(x);
+}
+
+static ALWAYS_INLINE void greedy_sc_sse2(const int8_t *s1x, const int8_t *s2x, uint32_t n, const uint32_t *c_indices,
+                                         uint32_t kappa, int16_t *w1, int16_t *w2) {
+  const int8_t *t1, *t2, *u1, *u2;
+  __m128i m, acc, a1, a2, x1, x2;
+  uint32_t j, k;
+
+  u1 = s1x + n - c_indices[0];
+  u2 = s2x + n - c_indices[0];
+  m = _mm_setzero_si128();
+  for (k = 1; k < kappa; k++) {
+    t1 = s1x + n - c_indices[k];
+    t2 = s2x + n - c_indices[k];
+    acc = _mm_setzero_si128();
+    for (j = 0; j < n; j += 8) {
+      x1 = _mm_sub_epi16(_mm_xor_si128(load_s8x8(u1 + j), m), m);
+      x2 = _mm_sub_epi16(_mm_xor_si128(load_s8x8(u2 + j), m), m);
+      a1 = _mm_add_epi16(_mm_load_si128((__m128i *) (w1 + j)), x1);
+      a2 = _mm_add_epi16(_mm_load_si128((__m128i *) (w2 + j)), x2);
+      _mm_store_si128((__m128i *) (w1 + j), a1);
+      _mm_store_si128((__m128i *) (w2 + j), a2);
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(a1, load_s8x8(t1 + j)));
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(a2, load_s8x8(t2 + j)));
+    }
+    m = _mm_set1_epi16(sign_mask(hsum_sse2(acc)));
+    u1 = t1;
+    u2 = t2;
+  }
+  for (j = 0; j < n; j += 8) {
+    x1 = _mm_sub_epi16(_mm_xor_si128(load_s8x8(u1 + j), m), m);
+    x2 = _mm_sub_epi16(_mm_xor_si128(load_s8x8(u2 + j), m), m);
+    _mm_store_si128((__m128i *) (w1 + j), _mm_add_epi16(_mm_load_si128((__m128i *) (w1 + j)), x1));
+    _mm_store_si128((__m128i *) (w2 + j), _mm_add_epi16(_mm_load_si128((__m128i *) (w2 + j)), x2));
+  }
+}
+
+#define BLISS_AVX2 __attribute__((target("avx2")))
+
+static BLISS_AVX2 inline __m256i load_s8x16(const int8_t *p) {
+  return _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *) p));
+}
+
+static BLISS_AVX2 ALWAYS_INLINE void greedy_sc_avx2(const int8_t *s1x, const int8_t *s2x, uint32_t n,
+                                                    const uint32_t *c_indices, uint32_t kappa, int16_t *w1, int16_t *w2) {
+  const int8_t *t1, *t2, *u1, *u2;
+  __m256i m, acc, a1, a2, x1, x2;
+  __m128i h;
+  uint32_t j, k;
+
+  u1 = s1x + n - c_indices[0];
+  u2 = s2x + n - c_indices[0];
+  m = _mm256_setzero_si256();
+  for (k = 1; k < kappa; k++) {
+    t1 = s1x + n - c_indices[k];
+    t2 = s2x + n - c_indices[k];
+    acc = _mm256_setzero_si256();
+    for (j = 0; j < n; j += 16) {
+      x1 = _mm256_sub_epi16(_mm256_xor_si256(load_s8x16(u1 + j), m), m);
+      x2 = _mm256_sub_epi16(_mm256_xor_si256(load_s8x16(u2 + j), m), m);
+      a1 = _mm256_add_epi16(_mm256_load_si256((__m256i *) (w1 + j)), x1);
+      a2 = _mm256_add_epi16(_mm256_load_si256((__m256i *) (w2 + j)), x2);
+      _mm256_store_si256((__m256i *) (w1 + j), a1);
+      _mm256_store_si256((__m256i *) (w2 + j), a2);
+      acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a1, load_s8x16(t1 + j)));
+      acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a2, load_s8x16(t2 + j)));
+    }
+    h = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    m = _mm256_set1_epi16(sign_mask(hsum_sse2(h)));
+    u1 = t1;
+    u2 = t2;
+  }
+  for (j = 0; j < n; j += 16) {
+    x1 = _mm256_sub_epi16(_mm256_xor_si256(load_s8x16(u1 + j), m), m);
+    x2 = _mm256_sub_epi16(_mm256_xor_si256(load_s8x16(u2 + j), m), m);
+    _mm256_store_si256((__m256i *) (w1 + j), _mm256_add_epi16(_mm256_load_si256((__m256i *) (w1 + j)), x1));
+    _mm256_store_si256((__m256i *) (w2 + j), _mm256_add_epi16(_mm256_load_si256((__m256i *) (w2 + j)), x2));
+  }
+}
+
+static bool greedy_sc_avx2_supported(void) {
+  return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+
+typedef void (*greedy_sc_passes_t)(const int8_t *s1x, const int8_t *s2x, uint32_t n, const uint32_t *c_indices,
+                                   uint32_t kappa, int16_t *w1, int16_t *w2);
+
+static ALWAYS_INLINE void greedy_sc_run(const int8_t *s1x, const int8_t *s2x, uint32_t n, const uint32_t *c_indices,
+                                        uint32_t kappa, int32_t *v1, int32_t *v2, greedy_sc_passes_t passes) {
+  int16_t w1[MAX_N] ALIGNED32;
+  int16_t w2[MAX_N] ALIGNED32;
+  uint32_t i;
+
+  assert(n <= MAX_N && (n & 15) == 0 && kappa > 0);
+
+  for (i = 0; i < n; i++) {
+    w1[i] = 0;
+    w2[i] = 0;
+  }
+
+  passes(s1x, s2x, n, c_indices, kappa, w1, w2);
+
+  for (i = 0; i < n; i++) {
+    v1[i] = w1[i];
+    v2[i] = w2[i];
+  }
+}
+
+
+/*
+ * Instances: name(s1x, s2x, n, c_indices, kappa, v1, v2) for n = N
+ */
+#if GREEDY_SC_SIMD
+
+#define GREEDY_SC_INSTANCE(name, N)                                     \
+  static BLISS_AVX2 void name##_avx2(const int8_t *s1x, const int8_t *s2x, uint32_t n, \
+                                     const uint32_t *c_indices, uint32_t kappa, int16_t *w1, int16_t *w2) { \
+    greedy_sc_avx2(s1x, s2x, N, c_indices, kappa, w1, w2);              \
+  }                                                                     \
+  static void name##_sse2(const int8_t *s1x, const int8_t *s2x, uint32_t n, \
+                          const uint32_t *c_indices, uint32_t kappa, int16_t *w1, int16_t *w2) { \
+    greedy_sc_sse2(s1x, s2x, N, c_indices, kappa, w1, w2);              \
+  }                                                                     \
+  static void name(const int8_t *s1x, const int8_t *s2x, uint32_t n,    \
+                   const uint32_t *c_indices, uint32_t kappa, int32_t *v1, int32_t *v2) { \
+    if (greedy_sc_avx2_supported()) {                                   \
+      greedy_sc_run(s1x, s2x, N, c_indices, kappa, v1, v2, name##_avx2); \
+    } else {                                                            \
+      greedy_sc_run(s1x, s2x, N, c_indices, kappa, v1, v2, name##_sse2); \
+    }                                                                   \
+  }
+
+#else
+
+#define GREEDY_SC_INSTANCE(name, N)                                     \
+  static void name##_c(const int8_t *s1x, const int8_t *s2x, uint32_t n, \
+                       const uint32_t *c_indices, uint32_t kappa, int16_t *w1, int16_t *w2) { \
+    greedy_sc_c(s1x, s2x, N, c_indices, kappa, w1, w2);                 \
+  }                                                                     \
+  static void name(const int8_t *s1x, const int8_t *s2x, uint32_t n,    \
+                   const uint32_t *c_indices, uint32_t kappa, int32_t *v1, int32_t *v2) { \
+    greedy_sc_run(s1x, s2x, N, c_indices, kappa, v1, v2, name##_c);     \
+  }
+
+#endif
+
+GREEDY_SC_INSTANCE(greedy_sc_n256, 256)
+GREEDY_SC_INSTANCE(greedy_sc_n512, 512)
+GREEDY_SC_INSTANCE(greedy_sc_any, n)
+
+
+void greedy_sc(const int8_t *s1x, const int8_t *s2x, uint32_t n, const uint32_t *c_indices, uint32_t kappa,
+               int32_t *v1, int32_t *v2) {
+  greedy_sc_any(s1x, s2x, n, c_indices, kappa, v1, v2);
+}
+
+void greedy_sc_256(const int8_t *s1x, const int8_t *s2x, const uint32_t *c_indices, uint32_t kappa,
+                   int32_t *v1, int32_t *v2) {
+  greedy_sc_n256(s1x, s2x, 256, c_indices, kappa, v1, v2);
+}
+
+void greedy_sc_512(const int8_t *s1x, const int8_t *s2x, const uint32_t *c_indices, uint32_t kappa,
+                   int32_t *v1, int32_t *v2) {
+  greedy_sc_n512(s1x, s2x, 512, c_indices, kappa, v1, v2);
+}
@@ -0,0 +1,372 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ntt_api.h"
+#include "ntt_backend.h"
+#include "bliss_b_params.h"
+#include "ntt_blzzd.h"
+#include "ntt_batch.h"
+
+/*
+ *
+ * Implementation of our NTT API: dispatch to one of the backends
+ *
+ *
+ *
+ * typedef int32_t* polynomial_t;
+ *
+ * typedef void* ntt_state_t;
+ *
+ * typedef void* ntt_t;
+ *
+ *
+ * The backend is selected when the state is created, depending on
+ * the kind, the processor, and the overrides (ntt_force_backend or
+ * the BLISS_NTT environment variable).
+ */
+
+
+/*
+ * Backends indexed by ntt_backend_t (NULL if not compiled in)
+ */
+static const ntt_ops_t *const ntt_backends[NUM_NTT_BACKENDS] = {
+  NULL,              /* NTT_BACKEND_AUTO */
+  &ntt_blzzd_ops,    /* NTT_BACKEND_BLZZD */
+  &ntt_red_ops,      /* NTT_BACKEND_RED */
+#if defined(BLISS_NTT_ASM)
+  &ntt_avx2_ops,     /* NTT_BACKEND_AVX2 */
+#else
+  NULL,
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+  &ntt_int16_ops,    /* NTT_BACKEND_INT16 */
+#else
+  NULL,
+#endif
+#if defined(BLISS_NTT_ASM)
+  &ntt_avx512_ops,   /* NTT_BACKEND_AVX512 */
+#else
+  NULL,
+#endif
+};
+
+/*
+ * Preference order for NTT_BACKEND_AUTO (fastest first)
+ */
+static const ntt_backend_t ntt_auto_order[NUM_NTT_BACKENDS - 1] = {
+  NTT_BACKEND_INT16, NTT_BACKEND_AVX512, NTT_BACKEND_AVX2, NTT_BACKEND_RED, NTT_BACKEND_BLZZD,
+};
+
+static const char *const ntt_backend_names[NUM_NTT_BACKENDS] = {
+  "auto", "blzzd", "red", "avx2", "int16", "avx512",
+};
+
+/*
+ * Override set by ntt_force_backend
+ */
+static bool ntt_forced = false;
+static ntt_backend_t ntt_forced_backend = NTT_BACKEND_AUTO;
+
+
+void ntt_force_backend(ntt_backend_t backend){
+  assert(backend < NUM_NTT_BACKENDS);
+  ntt_forced = backend != NTT_BACKEND_AUTO;
+  ntt_forced_backend = backend;
+}
+
+const char *ntt_backend_name(ntt_backend_t backend){
+  assert(backend < NUM_NTT_BACKENDS);
+  return ntt_backend_names[backend];
+}
+
+static bool backend_supported(ntt_backend_t backend, uint32_t n, int32_t q){
+  const ntt_ops_t *ops;
+
+  if (backend >= NUM_NTT_BACKENDS) return false;
+  ops = ntt_backends[backend];
+  return ops != NULL && ops->supported(n, q);
+}
+
+bool ntt_backend_supported(ntt_backend_t backend, bliss_kind_t kind){
+  bliss_param_t p;
+  uint32_t i;
+
+  if (! bliss_params_init(&p, kind)) {
+    return false;
+  }
+
+  if (backend == NTT_BACKEND_AUTO) {
+    for (i = 0; i < NUM_NTT_BACKENDS - 1; i++) {
+      if (backend_supported(ntt_auto_order[i], p.n, p.q)) return true;
+    }
+    return false;
+  }
+
+  return backend_supported(backend, p.n, p.q);
+}
+
+/*
+ * Backend requested by the user: ntt_force_backend or BLISS_NTT
+ */
+static ntt_backend_t requested_backend(void){
+  const char *name;
+  uint32_t i;
+
+  if (ntt_forced) {
+    return ntt_forced_backend;
+  }
+
+  name = getenv("BLISS_NTT");
+  if (name != NULL) {
+    for (i = 0; i < NUM_NTT_BACKENDS; i++) {
+      if (strcmp(name, ntt_backend_names[i]) == 0) return (ntt_backend_t) i;
+    }
+  }
+
+  return NTT_BACKEND_AUTO;
+}
+
+static const ntt_ops_t *select_backend(uint32_t n, int32_t q){
+  ntt_backend_t b;
+  uint32_t i;
+
+  b = requested_backend();
+  if (b != NTT_BACKEND_AUTO && backend_supported(b, n, q)) {
+    return ntt_backends[b];
+  }
+
+  for (i = 0; i < NUM_NTT_BACKENDS - 1; i++) {
+    b = ntt_auto_order[i];
+    if (backend_supported(b, n, q)) {
+      return ntt_backends[b];
+    }
+  }
+
+  return NULL;
+}
+
+
+/*
+ * Reverse the k low-order bits of j
+ */
+static uint32_t bitrev(uint32_t j, uint32_t k){
+  uint32_t r;
+
+  for (r = 0; k > 0; k--) {
+    r = (r << 1) | (j & 1);
+    j >>= 1;
+  }
+  return r;
+}
+
+/*
+ * Twiddle factors for ntt32_fwd and ntt32_inv, from the powers of psi
+ * w[i] = psi^i for i < n: for t = 1, 2, ..., n/2 and j < t, with e = (n/2t) * (2j + 1),
+ * - fwd[t + bitrev(j)] = psi^e
+ * - inv[t + bitrev(j)] = psi^-e = q - psi^(n-e)   (since psi^n = -1)
+ * fwd[0] and inv[0] are not used.
+ */
+static void build_twiddles(int32_t *fwd, int32_t *inv, uint32_t n, int32_t q, const int32_t *w){
+  uint32_t t, j, k, e, i;
+
+  fwd[0] = 0;
+  inv[0] = 0;
+  for (t = 1, k = 0; t < n; t <<= 1, k++) {
+    for (j = 0; j < t; j++) {
+      e = (n / (2 * t)) * (2 * j + 1);
+      i = t + bitrev(j, k);
+      fwd[i] = w[e];
+      inv[i] = q - w[n - e];
+    }
+  }
+}
+
+ntt_state_t init_ntt_state(bliss_kind_t kind){
+  ntt_state_simple_t *s;
+  const ntt_ops_t *ops;
+  bliss_param_t p;
+  int32_t *tables;
+
+  if (! bliss_params_init(&p, kind)) {
+    return NULL;
+  }
+
+  ops = select_backend(p.n, p.q);
+  if (ops == NULL) {
+    return NULL;
+  }
+
+  /* the state and the two twiddle tables in one block */
+  s = malloc(sizeof(ntt_state_simple_t) + 2 * p.n * sizeof(int32_t));
+
+  if (s != NULL) {
+    tables = (int32_t *) (s + 1);
+    build_twiddles(tables, tables + p.n, p.n, p.q, p.w);
+    s->ops = ops;
+    s->q = p.q;
+    s->barrett = ntt32_barrett(p.q);
+    s->n = p.n;
+    s->inv_n = ntt32_pwr((int32_t) p.n % p.q, p.q - 2, p.q, s->barrett);
+    s->psi_rev = tables;
+    s->inv_psi_rev = tables + p.n;
+    s->data = NULL;
+    if (ops->init != NULL && ! ops->init(s)) {
+      free(s);
+      s = NULL;
+    }
+  }
+
+  return (ntt_state_t)s;
+}
+
+void delete_ntt_state(ntt_state_t state){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL);
+  free(s->data);
+  free(s);
+}
+
+ntt_backend_t ntt_state_backend(const ntt_state_t state){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL);
+
+  return s->ops->backend;
+}
+
+
+ntt_t init_ntt(ntt_state_t state){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  int32_t* ntt;
+  assert(state != NULL);
+
+  ntt = calloc(s->n, sizeof(int32_t));
+
+  return (ntt_t)ntt;
+}
+
+void delete_ntt(ntt_state_t state, ntt_t input){
+  assert(state != NULL);
+  assert(input != NULL);
+  free(input);
+
+}
+
+void forward_ntt(const ntt_state_t state, ntt_t output, const polynomial_t input){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL);
+
+  s->ops->forward(s, output, input);
+}
+
+void inverse_ntt(const ntt_state_t state, polynomial_t output, const ntt_t input){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL);
+
+  s->ops->inverse(s, output, input);
+}
+
+void negate_ntt(const ntt_state_t state, ntt_t inplace){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  int32_t *result = (int32_t *)inplace;
+  assert(state != NULL);
+
+  ntt32_cmu(result, s->n, s->q, s->barrett, result, -1);
+}
+
+void product_ntt(const ntt_state_t state, ntt_t output, const ntt_t lhs,  const ntt_t rhs){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL);
+
+  s->ops->product(s, output, lhs, rhs);
+}
+
+void multiply_ntt_into(const ntt_state_t state, polynomial_t result, const polynomial_t lhs, const ntt_t rhs, ntt_t scratch){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL && scratch != NULL);
+
+  if (s->ops->multiply != NULL) {
+    s->ops->multiply(s, result, lhs, rhs, scratch);
+  } else {
+    s->ops->forward(s, scratch, lhs);
+    s->ops->product(s, scratch, scratch, rhs);
+    s->ops->inverse(s, result, scratch);
+  }
+}
+
+/*
+ * invert_polynomial: the NTT coefficients are inverted in blocks of
+ * INVERT_BLOCK with ntt32_xinv (one exponentiation per block).
+ */
+#define INVERT_BLOCK 512
+
+bool invert_polynomial(const ntt_state_t state, ntt_t output, const polynomial_t input){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  int32_t *a = output;
+  int32_t prefix[INVERT_BLOCK];
+  uint32_t i, k;
+
+  assert(state != NULL);
+
+  forward_ntt(state, output, input);
+  for (i = 0; i < s->n; i++) {
+    if (a[i] == 0) return false;           /* not invertible */
+  }
+
+  for (i = 0; i < s->n; i += k) {
+    k = s->n - i;
+    if (k > INVERT_BLOCK) k = INVERT_BLOCK;
+    ntt32_xinv(a + i, k, s->q, s->barrett, a + i, prefix);
+  }
+
+  return true;
+}
+
+void forward_ntt_batch(const ntt_state_t state, int32_t *output, const int32_t *input, uint32_t k){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL && k > 0);
+
+  ntt_batch_forward(s, output, input, k);
+}
+
+void inverse_ntt_batch(const ntt_state_t state, int32_t *output, const int32_t *input, uint32_t k){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL && k > 0);
+
+  ntt_batch_inverse(s, output, input, k);
+}
+
+void product_ntt_batch(const ntt_state_t state, int32_t *output, const int32_t *lhs, const ntt_t rhs, uint32_t k){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  assert(state != NULL && k > 0);
+
+  ntt_batch_product(s, output, lhs, rhs, k);
+}
+
+void interleave_polynomials(const ntt_state_t state, int32_t *output, const int32_t *const polys[], uint32_t k){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  uint32_t i, l;
+
+  assert(state != NULL);
+
+  for (l = 0; l < k; l++) {
+    for (i = 0; i < s->n; i++) {
+      output[i * k + l] = polys[l][i];
+    }
+  }
+}
+
+void deinterleave_polynomials(const ntt_state_t state, int32_t *const polys[], const int32_t *input, uint32_t k){
+  ntt_state_simple_t *s = (ntt_state_simple_t *)state;
+  uint32_t i, l;
+
+  assert(state != NULL);
+
+  for (l = 0; l < k; l++) {
+    for (i = 0; i < s->n; i++) {
+      polys[l][i] = input[i * k + l];
+    }
+  }
+}
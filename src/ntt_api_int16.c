@@ -0,0 +1,551 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "ntt_backend.h"
+
+/*
+ * NTT backend on packed 16-bit integers: 16 coefficients per AVX2
+ * register instead of 8 (x86_64 only). This works for q = 12289
+ * (Bliss-B1 to B4) and q = 7681 (Bliss-B0).
+ *
+ * Inputs and outputs are arrays of int32_t in the ntt_blzzd
+ * representation. They are converted to int16_t when they are loaded
+ * and back to int32_t when they are stored. The int16_t working copy is
+ * in the output array (forward, inverse) or in the scratch array (multiply).
+ *
+ * Arithmetic modulo q:
+ * - mont(a, w) = a * w / 2^16 (mod q), in [-0.75q, 0.75q] if |w| <= q/2.
+ *   The twiddle factors w are stored in Montgomery form (w * 2^16 mod q,
+ *   in [-q/2, q/2]), so mont(a, w) is the product by w. We also store
+ *   w * q^-1 mod 2^16 to save a multiplication.
+ * - barrett(a) = a mod q in [0, q], for any int16_t a (v = round(2^26/q)).
+ *
+ * Bounds (checked for both values of q):
+ * - forward: CT butterfly (a, b) := (barrett(a) + mont(b, w), barrett(a) - mont(b, w)).
+ *   All coefficients stay in [-0.75q - 1, 1.75q + 1].
+ * - inverse: GS butterfly (a, b) := (barrett(a + b), mont(a - b, w)).
+ *   If |a| and |b| are less than 2^14, a + b and a - b don't overflow,
+ *   and the results are in [0, q] and [-0.75q - 1, 0.75q + 1].
+ * - product: |a * b| / 2^16 < q/2 for a from the forward NTT and b in
+ *   [0, q-1], so the result of mont(a, b) is in [-q, q].
+ *
+ * Rounds with d >= 16 operate on whole registers. For the last four
+ * rounds of the forward NTT (d = 8, 4, 2, 1) and the first four of the
+ * inverse NTT, we load 32 coefficients into two registers x and y. Then
+ * shuffle_d(x, y) puts the a's of all butterflies in x and the b's in y,
+ * and shuffle_d again restores the order. The twiddle factors of these
+ * rounds are stored in the same shuffled order (see build_small).
+ */
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+#include <immintrin.h>
+
+#define BLISS_AVX2 __attribute__((target("avx2")))
+
+#define MAX_N 512
+
+/*
+ * A constant c in Montgomery form: w = c * 2^16 mod q and wq = w * q^-1 mod 2^16
+ */
+typedef struct mont_const_s {
+  int16_t w;
+  int16_t wq;
+} mont_const_t;
+
+/*
+ * Backend data (s->data)
+ * - q, qinv = q^-1 mod 2^16, v = Barrett constant
+ * - r: 2^16 (product_ntt multiplies by r to cancel the Montgomery factor)
+ * - inv_n, last: constants of the last inverse round (1/n and p[1]/n)
+ * - inv_n_r, last_r: same thing multiplied by 2^16 (for multiply)
+ * - fwd[0][i], fwd[1][i]: s->psi_rev[i] in Montgomery form (w and wq)
+ * - inv[0][i], inv[1][i]: s->inv_psi_rev[i] in Montgomery form
+ * - fwd_small[l]: twiddle factors of round d = 8 >> l, in shuffled order
+ * - inv_small[l]: same thing for the inverse NTT
+ */
+typedef struct int16_tables_s {
+  int16_t q, qinv, v;
+  mont_const_t r, inv_n, last, inv_n_r, last_r;
+  int16_t fwd[2][MAX_N];
+  int16_t inv[2][MAX_N];
+  int16_t fwd_small[4][2][MAX_N/2];
+  int16_t inv_small[4][2][MAX_N/2];
+} int16_tables_t;
+
+
+/*
+ * Registers
+ */
+static BLISS_AVX2 inline __m256i load16(const int16_t *p) {
+  return _mm256_loadu_si256((const __m256i *) p);
+}
+
+static BLISS_AVX2 inline void store16(int16_t *p, __m256i x) {
+  _mm256_storeu_si256((__m256i *) p, x);
+}
+
+// 16 coefficients in [-2^15, 2^15 - 1] from p[0 ... 15]
+static BLISS_AVX2 inline __m256i load32(const int32_t *p) {
+  __m256i x, y;
+
+  x = _mm256_loadu_si256((const __m256i *) p);
+  y = _mm256_loadu_si256((const __m256i *) (p + 8));
+  return _mm256_permute4x64_epi64(_mm256_packs_epi32(x, y), 0xD8);
+}
+
+// 16 coefficients with |p[i]| < 2^31/q, reduced to [-1.5q, 1.5q]
+static BLISS_AVX2 inline __m256i load32_reduce(const int32_t *p, __m256 inv_q, __m256i q) {
+  __m256i x, y;
+
+  x = _mm256_loadu_si256((const __m256i *) p);
+  y = _mm256_loadu_si256((const __m256i *) (p + 8));
+  // x - q * round(x/q): x is exact as a float since |x| < 2^18
+  x = _mm256_sub_epi32(x, _mm256_mullo_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(x), inv_q)), q));
+  y = _mm256_sub_epi32(y, _mm256_mullo_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(y), inv_q)), q));
+  return _mm256_permute4x64_epi64(_mm256_packs_epi32(x, y), 0xD8);
+}
+
+static BLISS_AVX2 inline void store32(int32_t *p, __m256i x) {
+  _mm256_storeu_si256((__m256i *) p, _mm256_cvtepi16_epi32(_mm256_castsi256_si128(x)));
+  _mm256_storeu_si256((__m256i *) (p + 8), _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1)));
+}
+
+
+/*
+ * Arithmetic
+ */
+static BLISS_AVX2 inline __m256i mont(__m256i a, __m256i w, __m256i wq, __m256i q) {
+  __m256i lo, hi;
+
+  lo = _mm256_mullo_epi16(a, wq);
+  hi = _mm256_mulhi_epi16(a, w);
+  return _mm256_sub_epi16(hi, _mm256_mulhi_epi16(lo, q));
+}
+
+// mont(a, b) for a variable b
+static BLISS_AVX2 inline __m256i mont_var(__m256i a, __m256i b, __m256i qinv, __m256i q) {
+  return mont(a, b, _mm256_mullo_epi16(b, qinv), q);
+}
+
+static BLISS_AVX2 inline __m256i barrett(__m256i a, __m256i v, __m256i q) {
+  __m256i t;
+
+  t = _mm256_srai_epi16(_mm256_mulhi_epi16(a, v), 10);
+  return _mm256_sub_epi16(a, _mm256_mullo_epi16(t, q));
+}
+
+// a in [-q, q-1] to [0, q-1]
+static BLISS_AVX2 inline __m256i fix_sign(__m256i a, __m256i q) {
+  return _mm256_add_epi16(a, _mm256_and_si256(_mm256_srai_epi16(a, 15), q));
+}
+
+// any a to [0, q-1]
+static BLISS_AVX2 inline __m256i freeze(__m256i a, __m256i v, __m256i q) {
+  a = barrett(a, v, q);
+  return _mm256_sub_epi16(a, _mm256_and_si256(_mm256_cmpgt_epi16(a, _mm256_sub_epi16(q, _mm256_set1_epi16(1))), q));
+}
+
+static BLISS_AVX2 inline void butterfly_ct(__m256i *a, __m256i *b, __m256i w, __m256i wq, __m256i v, __m256i q) {
+  __m256i x, y;
+
+  x = barrett(*a, v, q);
+  y = mont(*b, w, wq, q);
+  *a = _mm256_add_epi16(x, y);
+  *b = _mm256_sub_epi16(x, y);
+}
+
+static BLISS_AVX2 inline void butterfly_gs(__m256i *a, __m256i *b, __m256i w, __m256i wq, __m256i v, __m256i q) {
+  __m256i x;
+
+  x = *a;
+  *a = barrett(_mm256_add_epi16(x, *b), v, q);
+  *b = mont(_mm256_sub_epi16(x, *b), w, wq, q);
+}
+
+
+/*
+ * Shuffles for the rounds with d < 16: x = coefficients [0 ... 15]
+ * and y = coefficients [16 ... 31] of a block. Then shuffle_d(x, y)
+ * stores in x the coefficients i with (i & d) == 0 and in y the
+ * coefficients i + d, in matching positions.
+ */
+static BLISS_AVX2 inline void shuffle8(__m256i *x, __m256i *y) {
+  __m256i a;
+
+  a = _mm256_permute2x128_si256(*x, *y, 0x20);
+  *y = _mm256_permute2x128_si256(*x, *y, 0x31);
+  *x = a;
+}
+
+static BLISS_AVX2 inline void shuffle4(__m256i *x, __m256i *y) {
+  __m256i a;
+
+  a = _mm256_unpacklo_epi64(*x, *y);
+  *y = _mm256_unpackhi_epi64(*x, *y);
+  *x = a;
+}
+
+static BLISS_AVX2 inline void shuffle2(__m256i *x, __m256i *y) {
+  __m256i a;
+
+  a = _mm256_blend_epi32(*x, _mm256_slli_epi64(*y, 32), 0xAA);
+  *y = _mm256_blend_epi32(_mm256_srli_epi64(*x, 32), *y, 0xAA);
+  *x = a;
+}
+
+static BLISS_AVX2 inline void shuffle1(__m256i *x, __m256i *y) {
+  __m256i a;
+
+  a = _mm256_blend_epi16(*x, _mm256_slli_epi32(*y, 16), 0xAA);
+  *y = _mm256_blend_epi16(_mm256_srli_epi32(*x, 16), *y, 0xAA);
+  *x = a;
+}
+
+static BLISS_AVX2 inline void shuffle(uint32_t l, __m256i *x, __m256i *y) {
+  switch (l) {
+  case 0: shuffle8(x, y); break;
+  case 1: shuffle4(x, y); break;
+  case 2: shuffle2(x, y); break;
+  default: shuffle1(x, y); break;
+  }
+}
+
+
+/*
+ * Transforms on v (n int16_t)
+ */
+
+// forward rounds with d >= 16, starting with round k (1 or 2)
+static BLISS_AVX2 void forward_rounds(const int16_tables_t *t, int16_t *v, uint32_t n, uint32_t k) {
+  __m256i q, bv, w, wq, a, b;
+  uint32_t j, s, u, d;
+
+  q = _mm256_set1_epi16(t->q);
+  bv = _mm256_set1_epi16(t->v);
+  for (d = n / (2 * k); d >= 16; k <<= 1, d >>= 1) {
+    for (j = 0, u = 0; j < k; j++, u += 2 * d) {
+      w = _mm256_set1_epi16(t->fwd[0][k + j]);
+      wq = _mm256_set1_epi16(t->fwd[1][k + j]);
+      for (s = u; s < u + d; s += 16) {
+        a = load16(v + s);
+        b = load16(v + s + d);
+        butterfly_ct(&a, &b, w, wq, bv, q);
+        store16(v + s, a);
+        store16(v + s + d, b);
+      }
+    }
+  }
+}
+
+// forward rounds d = 8, 4, 2, 1 on block m of 32 coefficients
+static BLISS_AVX2 inline void forward_small(const int16_tables_t *t, __m256i *x, __m256i *y, uint32_t m) {
+  __m256i q, bv;
+  uint32_t l;
+
+  q = _mm256_set1_epi16(t->q);
+  bv = _mm256_set1_epi16(t->v);
+  for (l = 0; l < 4; l++) {
+    shuffle(l, x, y);
+    butterfly_ct(x, y, load16(t->fwd_small[l][0] + 16 * m), load16(t->fwd_small[l][1] + 16 * m), bv, q);
+    shuffle(l, x, y);
+  }
+}
+
+// inverse rounds d = 1, 2, 4, 8 on block m of 32 coefficients
+static BLISS_AVX2 inline void inverse_small(const int16_tables_t *t, __m256i *x, __m256i *y, uint32_t m) {
+  __m256i q, bv;
+  uint32_t l;
+
+  q = _mm256_set1_epi16(t->q);
+  bv = _mm256_set1_epi16(t->v);
+  for (l = 4; l > 0; l--) {
+    shuffle(l - 1, x, y);
+    butterfly_gs(x, y, load16(t->inv_small[l - 1][0] + 16 * m), load16(t->inv_small[l - 1][1] + 16 * m), bv, q);
+    shuffle(l - 1, x, y);
+  }
+}
+
+// inverse rounds with 16 <= d < n/2
+static BLISS_AVX2 void inverse_rounds(const int16_tables_t *t, int16_t *v, uint32_t n) {
+  __m256i q, bv, w, wq, a, b;
+  uint32_t j, s, k, u, d;
+
+  q = _mm256_set1_epi16(t->q);
+  bv = _mm256_set1_epi16(t->v);
+  for (d = 16, k = n >> 5; d < n >> 1; d <<= 1, k >>= 1) {
+    for (j = 0, u = 0; j < k; j++, u += 2 * d) {
+      w = _mm256_set1_epi16(t->inv[0][k + j]);
+      wq = _mm256_set1_epi16(t->inv[1][k + j]);
+      for (s = u; s < u + d; s += 16) {
+        a = load16(v + s);
+        b = load16(v + s + d);
+        butterfly_gs(&a, &b, w, wq, bv, q);
+        store16(v + s, a);
+        store16(v + s + d, b);
+      }
+    }
+  }
+}
+
+// last inverse round: (a, b) := ((a + b) * c, (a - b) * e), results in [-q, q-1]
+static BLISS_AVX2 inline void inverse_last(__m256i *a, __m256i *b, mont_const_t c, mont_const_t e, __m256i q) {
+  __m256i x;
+
+  x = *a;
+  *a = mont(_mm256_add_epi16(x, *b), _mm256_set1_epi16(c.w), _mm256_set1_epi16(c.wq), q);
+  *b = mont(_mm256_sub_epi16(x, *b), _mm256_set1_epi16(e.w), _mm256_set1_epi16(e.wq), q);
+}
+
+
+/*
+ * Backend functions
+ */
+static bool int16_supported(uint32_t n, int32_t q) {
+  return (q == 12289 || q == 7681) && 64 <= n && n <= MAX_N && (n & (n - 1)) == 0 &&
+    __builtin_cpu_supports("avx2");
+}
+
+/*
+ * The forward NTT works in place in output, viewed as an array of
+ * n int16_t: the conversion to int16_t goes up, the conversion back to
+ * int32_t goes down, so a coefficient is never overwritten before it's read.
+ */
+static BLISS_AVX2 void int16_forward(const ntt_state_simple_t *s, int32_t *output, const int32_t *input) {
+  const int16_tables_t *t;
+  int16_t *v;
+  __m256i q, bv, x, y;
+  __m256 inv_q;
+  uint32_t i, n;
+
+  t = s->data;
+  n = s->n;
+  v = (int16_t *) output;
+  q = _mm256_set1_epi16(t->q);
+  bv = _mm256_set1_epi16(t->v);
+  inv_q = _mm256_set1_ps(1.0f / (float) s->q);
+
+  for (i = 0; i < n; i += 16) {
+    store16(v + i, load32_reduce(input + i, inv_q, _mm256_set1_epi32(s->q)));
+  }
+  forward_rounds(t, v, n, 1);
+  for (i = 0; i < n; i += 32) {
+    x = load16(v + i);
+    y = load16(v + i + 16);
+    forward_small(t, &x, &y, i >> 5);
+    store16(v + i, freeze(x, bv, q));
+    store16(v + i + 16, freeze(y, bv, q));
+  }
+  for (i = n; i > 0; i -= 16) {
+    store32(output + i - 16, load16(v + i - 16));
+  }
+}
+
+static BLISS_AVX2 void int16_inverse(const ntt_state_simple_t *s, int32_t *output, const int32_t *input) {
+  const int16_tables_t *t;
+  int16_t *v;
+  __m256i q, x, y;
+  uint32_t i, n, d;
+
+  t = s->data;
+  n = s->n;
+  v = (int16_t *) output;
+  q = _mm256_set1_epi16(t->q);
+
+  for (i = 0; i < n; i += 32) {
+    x = load32(input + i);
+    y = load32(input + i + 16);
+    inverse_small(t, &x, &y, i >> 5);
+    store16(v + i, x);
+    store16(v + i + 16, y);
+  }
+  inverse_rounds(t, v, n);
+  d = n >> 1;
+  for (i = 0; i < d; i += 16) {
+    x = load16(v + i);
+    y = load16(v + i + d);
+    inverse_last(&x, &y, t->inv_n, t->last, q);
+    store16(v + i, fix_sign(x, q));
+    store16(v + i + d, fix_sign(y, q));
+  }
+  for (i = n; i > 0; i -= 16) {
+    store32(output + i - 16, load16(v + i - 16));
+  }
+}
+
+static BLISS_AVX2 void int16_product(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs) {
+  const int16_tables_t *t;
+  __m256i q, qinv, x;
+  uint32_t i;
+
+  t = s->data;
+  q = _mm256_set1_epi16(t->q);
+  qinv = _mm256_set1_epi16(t->qinv);
+  for (i = 0; i < s->n; i += 16) {
+    x = mont_var(load32(lhs + i), load32(rhs + i), qinv, q);
+    x = mont(x, _mm256_set1_epi16(t->r.w), _mm256_set1_epi16(t->r.wq), q);
+    store32(output + i, fix_sign(x, q));
+  }
+}
+
+/*
+ * Fused multiplication in scratch (viewed as n int16_t):
+ * - the first forward round reads lhs
+ * - the last four forward rounds, the product by rhs, and the first
+ *   four inverse rounds are done on 32 coefficients at a time
+ * - the last inverse round writes output, and cancels the 1/2^16 factor
+ *   of the product (inv_n_r and last_r)
+ */
+static BLISS_AVX2 void int16_multiply(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs,
+                                      const int32_t *rhs, int32_t *scratch) {
+  const int16_tables_t *t;
+  int16_t *v;
+  __m256i q, qi, bv, w, wq, x, y;
+  __m256 inv_q;
+  uint32_t i, n, d;
+
+  t = s->data;
+  n = s->n;
+  v = (int16_t *) scratch;
+  q = _mm256_set1_epi16(t->q);
+  qi = _mm256_set1_epi16(t->qinv);
+  bv = _mm256_set1_epi16(t->v);
+  inv_q = _mm256_set1_ps(1.0f / (float) s->q);
+
+  d = n >> 1;
+  w = _mm256_set1_epi16(t->fwd[0][1]);
+  wq = _mm256_set1_epi16(t->fwd[1][1]);
+  for (i = 0; i < d; i += 16) {
+    x = load32_reduce(lhs + i, inv_q, _mm256_set1_epi32(s->q));
+    y = load32_reduce(lhs + i + d, inv_q, _mm256_set1_epi32(s->q));
+    butterfly_ct(&x, &y, w, wq, bv, q);
+    store16(v + i, x);
+    store16(v + i + d, y);
+  }
+  forward_rounds(t, v, n, 2);
+
+  for (i = 0; i < n; i += 32) {
+    x = load16(v + i);
+    y = load16(v + i + 16);
+    forward_small(t, &x, &y, i >> 5);
+    x = mont_var(x, load32(rhs + i), qi, q);
+    y = mont_var(y, load32(rhs + i + 16), qi, q);
+    inverse_small(t, &x, &y, i >> 5);
+    store16(v + i, x);
+    store16(v + i + 16, y);
+  }
+
+  inverse_rounds(t, v, n);
+  for (i = 0; i < d; i += 16) {
+    x = load16(v + i);
+    y = load16(v + i + d);
+    inverse_last(&x, &y, t->inv_n_r, t->last_r, q);
+    store32(output + i, fix_sign(x, q));
+    store32(output + i + d, fix_sign(y, q));
+  }
+}
+
+
+/*
+ * Tables
+ */
+
+// c * 2^16 mod q in [-q/2, q/2]
+static int16_t to_mont(int64_t c, int32_t q) {
+  int32_t w;
+
+  w = (int32_t) ((c * 65536) % q);
+  if (w < 0) w += q;
+  if (w > q/2) w -= q;
+  return (int16_t) w;
+}
+
+// w * qinv mod 2^16
+static int16_t mul_qinv(int16_t w, int16_t qinv) {
+  return (int16_t) (uint16_t) ((uint32_t) (int32_t) w * (uint32_t) (int32_t) qinv);
+}
+
+static mont_const_t mont_const(int64_t c, int32_t q, int16_t qinv) {
+  mont_const_t r;
+
+  r.w = to_mont(c, q);
+  r.wq = mul_qinv(r.w, qinv);
+  return r;
+}
+
+/*
+ * Twiddle factors of the rounds d < 16 in the order of the shuffled
+ * registers: we apply the shuffles to registers that contain the
+ * indices of the coefficients, and look up the block of each b.
+ */
+static BLISS_AVX2 void build_small(int16_t small[4][2][MAX_N/2], const int16_t table[2][MAX_N], uint32_t n) {
+  int16_t b[16];
+  __m256i x, y, index;
+  uint32_t l, m, i, d, k, j;
+
+  index = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  for (l = 0; l < 4; l++) {
+    d = 8 >> l;
+    k = n / (2 * d);
+    for (m = 0; m < n >> 5; m++) {
+      x = _mm256_add_epi16(index, _mm256_set1_epi16((int16_t) (32 * m)));
+      y = _mm256_add_epi16(x, _mm256_set1_epi16(16));
+      shuffle(l, &x, &y);
+      store16(b, y);
+      for (i = 0; i < 16; i++) {
+        j = (uint32_t) b[i] / (2 * d);
+        small[l][0][16 * m + i] = table[0][k + j];
+        small[l][1][16 * m + i] = table[1][k + j];
+      }
+    }
+  }
+}
+
+static bool int16_init(ntt_state_simple_t *s) {
+  int16_tables_t *t;
+  int32_t q;
+  uint32_t i, qinv;
+
+  t = malloc(sizeof(int16_tables_t));
+  if (t == NULL) return false;
+
+  q = s->q;
+  qinv = (uint32_t) q;                   // q * qinv = 1 mod 2^3
+  for (i = 0; i < 4; i++) {
+    qinv *= 2 - (uint32_t) q * qinv;     // Newton iteration: doubles the number of correct bits
+  }
+  t->q = (int16_t) q;
+  t->qinv = (int16_t) (uint16_t) qinv;
+  t->v = (int16_t) (((1 << 26) + q/2) / q);
+  t->r = mont_const(65536, q, t->qinv);
+  t->inv_n = mont_const(s->inv_n, q, t->qinv);
+  t->last = mont_const((int64_t) s->inv_psi_rev[1] * s->inv_n % q, q, t->qinv);
+  t->inv_n_r = mont_const((int64_t) s->inv_n * 65536 % q, q, t->qinv);
+  t->last_r = mont_const((int64_t) s->inv_psi_rev[1] * s->inv_n % q * 65536 % q, q, t->qinv);
+  for (i = 0; i < s->n; i++) {
+    t->fwd[0][i] = to_mont(s->psi_rev[i], q);
+    t->fwd[1][i] = mul_qinv(t->fwd[0][i], t->qinv);
+    t->inv[0][i] = to_mont(s->inv_psi_rev[i], q);
+    t->inv[1][i] = mul_qinv(t->inv[0][i], t->qinv);
+  }
+  build_small(t->fwd_small, (const int16_t (*)[MAX_N]) t->fwd, s->n);
+  build_small(t->inv_small, (const int16_t (*)[MAX_N]) t->inv, s->n);
+
+  s->data = t;
+  return true;
+}
+
+const ntt_ops_t ntt_int16_ops = {
+  NTT_BACKEND_INT16,
+  "int16",
+  int16_supported,
+  int16_init,
+  int16_forward,
+  int16_inverse,
+  int16_product,
+  int16_multiply,
+};
+
+#endif
@@ -0,0 +1,339 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ntt_backend.h"
+#include "ntt_red.h"
+#include "ntt_red512_tables.h"
+#include "ntt_red_schedule.h"
+
+#if defined(BLISS_NTT_ASM)
+#include "ntt_asm.h"
+#endif
+
+/*
+ * NTT backends for n=512 and q=12289 (Bliss-B1 to B4), using the
+ * Longa-Naehrig reduction:
+ * - ntt_red_ops: portable C code from ntt_red.c
+ * - ntt_avx2_ops: AVX2 kernels from ntt_asm.S (x86_64 only)
+ * - ntt_avx512_ops: same as ntt_avx2_ops, with the AVX-512 versions of
+ *   the NTTs, the pointwise product, and the double reduction
+ *
+ * The AVX2 and AVX-512 kernels are translations of the C code, so all
+ * three backends compute the same thing. The red functions produce the NTT in bit-reverse
+ * order, and the tables use the same psi (10302), so this is the ntt_blzzd
+ * representation: no shuffle is needed.
+ */
+
+/*
+ * BD: the red functions don't fully reduce: each call to red(x)
+ * multiplies by k = 3 (modulo Q). We compensate with the constants below:
+ *
+ * - the forward NTT is exact but the final double reduction multiplies by 9,
+ *   so we multiply the input by INV9 = inverse(9)
+ * - the inverse NTT misses the 1/n factor, then scalar_mul_reduce and the
+ *   double reduction multiply by 27: we rescale by INV27N = inverse(27 * n)
+ * - in a product, mul_reduce multiplies by 3, scalar_mul_reduce by 3 and
+ *   the double reduction by 9: we rescale by INV81 = inverse(81)
+ *
+ * multiply_ntt_into doesn't convert to [0, Q-1] between the forward NTT,
+ * the product, and the inverse NTT: it runs ntt_red512_mul_schedule
+ * (see ntt_red_schedule.h), which reduces only where the coefficients
+ * could overflow, and folds all the constants into its first step.
+ */
+#define Q       12289
+#define INV9     2731
+#define INV27N   2730
+#define INV81   11227
+
+#ifndef NDEBUG
+static bool good_arg(const int32_t *v, uint32_t n){
+  uint32_t i;
+
+  for (i = 0; i < n; i++){
+    if (v[i] < 0 || v[i] >= Q) return false;
+  }
+
+  return true;
+}
+#endif
+
+static bool red512_supported(uint32_t n, int32_t q){
+  return n == 512 && q == Q;
+}
+
+/*
+ * output[i] = input[i] * c in [-(Q-1)/2, (Q-1)/2]
+ */
+static void scale_input(int32_t *output, const int32_t *input, int32_t c) {
+  uint32_t i;
+  int32_t x;
+
+  for (i = 0; i < 512; i++) {
+    x = (input[i] * c) % Q;
+    x += (x >> 31) & Q;
+    output[i] = x - (((Q/2 - x) >> 31) & Q);
+  }
+}
+
+static void copy_array(int32_t *output, const int32_t *input) {
+  uint32_t i;
+
+  for (i = 0; i < 512; i++) {
+    output[i] = input[i];
+  }
+}
+
+
+/*
+ * Kernels used by a schedule (C or AVX2 versions)
+ */
+typedef struct red512_kernels_s {
+  void (*forward)(int32_t *a, uint32_t n, const int16_t *p);
+  void (*inverse)(int32_t *a, uint32_t n, const int16_t *p);
+  void (*reduce)(int32_t *a, uint32_t n);
+  void (*reduce_twice)(int32_t *a, uint32_t n);
+  void (*product)(int32_t *c, uint32_t n, const int32_t *a, const int32_t *b);
+  void (*scale)(int32_t *a, uint32_t n, int32_t c);
+  void (*correct)(int32_t *a, uint32_t n);
+} red512_kernels_t;
+
+/*
+ * Run a schedule (see ntt_red_schedule.h): a = lhs * rhs
+ */
+static void run_schedule(const red512_kernels_t *k, const ntt_red_step_t *step, int32_t *a,
+                         const int32_t *lhs, const int32_t *rhs) {
+  for (; step->op != NTT_RED_END; step++) {
+    switch (step->op) {
+    case NTT_RED_CENTER:
+      scale_input(a, lhs, step->arg);
+      break;
+    case NTT_RED_FORWARD:
+      k->forward(a, 512, ntt_red512_mixed_powers_rev);
+      break;
+    case NTT_RED_REDUCE:
+      k->reduce(a, 512);
+      break;
+    case NTT_RED_REDUCE_TWICE:
+      k->reduce_twice(a, 512);
+      break;
+    case NTT_RED_PRODUCT:
+      k->product(a, 512, a, rhs);
+      break;
+    case NTT_RED_INVERSE:
+      k->inverse(a, 512, ntt_red512_inv_mixed_powers_rev);
+      break;
+    case NTT_RED_SCALE:
+      k->scale(a, 512, step->arg);
+      break;
+    case NTT_RED_CORRECT:
+      k->correct(a, 512);
+      break;
+    default:
+      assert(false);
+      break;
+    }
+  }
+
+  assert(good_arg(a, 512));
+}
+
+
+static void red512_forward(const ntt_state_simple_t *s, int32_t *output, const int32_t *input){
+  scale_input(output, input, INV9);
+  mulntt_red_ct_std2rev(output, 512, ntt_red512_mixed_powers_rev);
+  reduce_array_twice(output, 512);
+  correct(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+static void red512_inverse(const ntt_state_simple_t *s, int32_t *output, const int32_t *input){
+  assert(good_arg(input, 512));
+
+  copy_array(output, input);
+  nttmul_red_gs_rev2std(output, 512, ntt_red512_inv_mixed_powers_rev);
+  scalar_mul_reduce_array(output, 512, INV27N);
+  reduce_array_twice(output, 512);
+  correct(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+static void red512_product(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs){
+  assert(good_arg(lhs, 512) && good_arg(rhs, 512));
+
+  mul_reduce_array(output, 512, lhs, rhs);
+  scalar_mul_reduce_array(output, 512, INV81);
+  reduce_array_twice(output, 512);
+  correct(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+static const red512_kernels_t red512_kernels = {
+  mulntt_red_ct_std2rev,
+  nttmul_red_gs_rev2std,
+  reduce_array,
+  reduce_array_twice,
+  mul_reduce_array,
+  scalar_mul_reduce_array,
+  correct,
+};
+
+/*
+ * Lazy product: works in output (scratch is not used)
+ */
+static void red512_multiply(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs,
+                            int32_t *scratch){
+  assert(good_arg(rhs, 512));
+  run_schedule(&red512_kernels, ntt_red512_mul_schedule, output, lhs, rhs);
+}
+
+const ntt_ops_t ntt_red_ops = {
+  NTT_BACKEND_RED,
+  "red",
+  red512_supported,
+  NULL,
+  red512_forward,
+  red512_inverse,
+  red512_product,
+  red512_multiply,
+};
+
+
+#if defined(BLISS_NTT_ASM)
+
+static bool avx2_512_supported(uint32_t n, int32_t q){
+  return red512_supported(n, q) && avx2_supported();
+}
+
+static void avx2_512_forward(const ntt_state_simple_t *s, int32_t *output, const int32_t *input){
+  scale_input(output, input, INV9);
+  mulntt_red_ct_std2rev_asm(output, 512, ntt_red512_mixed_powers_rev);
+  reduce_array_twice_asm(output, 512);
+  correct_asm(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+static void avx2_512_inverse(const ntt_state_simple_t *s, int32_t *output, const int32_t *input){
+  assert(good_arg(input, 512));
+
+  copy_array(output, input);
+  nttmul_red_gs_rev2std_asm(output, 512, ntt_red512_inv_mixed_powers_rev);
+  scalar_mul_reduce_array_asm(output, 512, INV27N);
+  reduce_array_twice_asm(output, 512);
+  correct_asm(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+static void avx2_512_product(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs){
+  assert(good_arg(lhs, 512) && good_arg(rhs, 512));
+
+  mul_reduce_array_asm(output, 512, lhs, rhs);
+  scalar_mul_reduce_array_asm(output, 512, INV81);
+  reduce_array_twice_asm(output, 512);
+  correct_asm(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+static const red512_kernels_t avx2_512_kernels = {
+  mulntt_red_ct_std2rev_asm,
+  nttmul_red_gs_rev2std_asm,
+  reduce_array_asm,
+  reduce_array_twice_asm,
+  mul_reduce_array_asm,
+  scalar_mul_reduce_array_asm,
+  correct_asm,
+};
+
+static void avx2_512_multiply(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs,
+                              int32_t *scratch){
+  assert(good_arg(rhs, 512));
+  run_schedule(&avx2_512_kernels, ntt_red512_mul_schedule, output, lhs, rhs);
+}
+
+const ntt_ops_t ntt_avx2_ops = {
+  NTT_BACKEND_AVX2,
+  "avx2",
+  avx2_512_supported,
+  NULL,
+  avx2_512_forward,
+  avx2_512_inverse,
+  avx2_512_product,
+  avx2_512_multiply,
+};
+
+
+static bool avx512_512_supported(uint32_t n, int32_t q){
+  return red512_supported(n, q) && avx512_supported();
+}
+
+static void avx512_512_forward(const ntt_state_simple_t *s, int32_t *output, const int32_t *input){
+  scale_input(output, input, INV9);
+  mulntt_red_ct_std2rev_avx512(output, 512, ntt_red512_mixed_powers_rev);
+  reduce_array_twice_avx512(output, 512);
+  correct_asm(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+static void avx512_512_inverse(const ntt_state_simple_t *s, int32_t *output, const int32_t *input){
+  assert(good_arg(input, 512));
+
+  copy_array(output, input);
+  nttmul_red_gs_rev2std_avx512(output, 512, ntt_red512_inv_mixed_powers_rev);
+  scalar_mul_reduce_array_asm(output, 512, INV27N);
+  reduce_array_twice_avx512(output, 512);
+  correct_asm(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+static void avx512_512_product(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs){
+  assert(good_arg(lhs, 512) && good_arg(rhs, 512));
+
+  mul_reduce_array_avx512(output, 512, lhs, rhs);
+  scalar_mul_reduce_array_asm(output, 512, INV81);
+  reduce_array_twice_avx512(output, 512);
+  correct_asm(output, 512);
+
+  assert(good_arg(output, 512));
+}
+
+/*
+ * The AVX-512 kernels have the same bounds as the AVX2 ones, so
+ * ntt_red512_mul_schedule is safe for both.
+ */
+static const red512_kernels_t avx512_512_kernels = {
+  mulntt_red_ct_std2rev_avx512,
+  nttmul_red_gs_rev2std_avx512,
+  reduce_array_asm,
+  reduce_array_twice_avx512,
+  mul_reduce_array_avx512,
+  scalar_mul_reduce_array_asm,
+  correct_asm,
+};
+
+static void avx512_512_multiply(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs,
+                                int32_t *scratch){
+  assert(good_arg(rhs, 512));
+  run_schedule(&avx512_512_kernels, ntt_red512_mul_schedule, output, lhs, rhs);
+}
+
+const ntt_ops_t ntt_avx512_ops = {
+  NTT_BACKEND_AVX512,
+  "avx512",
+  avx512_512_supported,
+  NULL,
+  avx512_512_forward,
+  avx512_512_inverse,
+  avx512_512_product,
+  avx512_512_multiply,
+};
+
+#endif
@@ -0,0 +1,249 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ntt_batch.h"
+
+/*
+ * Batch NTT on k interleaved polynomials: coefficient i of polynomial l
+ * is v[i * k + l].
+ *
+ * This is the algorithm of ntt_blzzd (ntt32_fwd, ntt32_inv, ntt32_xmu),
+ * with the loop over the k lanes innermost. A butterfly on coefficients
+ * (s, s + d) becomes a butterfly on rows s and s + d, so the inner loop
+ * is a contiguous, full-width loop whatever the stride d is.
+ *
+ * The kernels take q as argument and are always inlined, so that the
+ * compiler can replace x % q by multiplications when q is a constant.
+ * We instantiate them for q = 12289 and q = 7681 (all the BLISS-B kinds)
+ * and for any q. On x86_64, there are SSE2 (baseline) and AVX2 versions
+ * of each, and we pick one at runtime.
+ */
+
+#if defined(__GNUC__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+static ALWAYS_INLINE int32_t sub_mod(int32_t x, int32_t y, int32_t q) {
+  x -= y;
+  return x + ((x >> 31) & q);
+}
+
+static ALWAYS_INLINE int32_t add_mod(int32_t x, int32_t y, int32_t q) {
+  x += y - q;
+  return x + ((x >> 31) & q);
+}
+
+/*
+ * Row operations on k lanes
+ */
+
+// CT butterfly: (a, b) := (a + y * b, a - y * b)
+static ALWAYS_INLINE void butterfly_ct(int32_t *a, int32_t *b, uint32_t k, int32_t q, int32_t y) {
+  uint32_t l;
+  int32_t x;
+
+  for (l = 0; l < k; l++) {
+    x = (b[l] * y) % q;
+    b[l] = sub_mod(a[l], x, q);
+    a[l] = add_mod(a[l], x, q);
+  }
+}
+
+// first CT round: (a, b) := (t + y * u, t - y * u) where t and u are not reduced
+static ALWAYS_INLINE void butterfly_ct0(int32_t *a, int32_t *b, const int32_t *t, const int32_t *u, uint32_t k,
+                                        int32_t q, int32_t y) {
+  uint32_t l;
+  int32_t x, z;
+
+  for (l = 0; l < k; l++) {
+    x = (u[l] * y) % q;
+    x += (x >> 31) & q;
+    z = t[l] % q;
+    z += (z >> 31) & q;
+    b[l] = sub_mod(z, x, q);
+    a[l] = add_mod(z, x, q);
+  }
+}
+
+// GS butterfly: (a, b) := (t + u, (t - u) * y)
+static ALWAYS_INLINE void butterfly_gs(int32_t *a, int32_t *b, const int32_t *t, const int32_t *u, uint32_t k,
+                                       int32_t q, int32_t y) {
+  uint32_t l;
+  int32_t x;
+
+  for (l = 0; l < k; l++) {
+    x = u[l];
+    b[l] = (sub_mod(t[l], x, q) * y) % q;
+    a[l] = add_mod(t[l], x, q);
+  }
+}
+
+// last GS round: (a, b) := ((a + b) * z, (a - b) * y)
+static ALWAYS_INLINE void butterfly_gs_last(int32_t *a, int32_t *b, uint32_t k, int32_t q, int32_t y, int32_t z) {
+  uint32_t l;
+  int32_t x;
+
+  for (l = 0; l < k; l++) {
+    x = b[l];
+    b[l] = (sub_mod(a[l], x, q) * y) % q;
+    a[l] = (add_mod(a[l], x, q) * z) % q;
+  }
+}
+
+// v = t * y in [0, q-1]
+static ALWAYS_INLINE void scale_row(int32_t *v, const int32_t *t, uint32_t k, int32_t q, int32_t y) {
+  uint32_t l;
+  int32_t x;
+
+  for (l = 0; l < k; l++) {
+    x = (t[l] * y) % q;
+    v[l] = x + ((x >> 31) & q);
+  }
+}
+
+
+/*
+ * Transforms
+ */
+
+// v[i] = t[i] * u[i] for all rows i (u is not interleaved)
+static ALWAYS_INLINE void batch_xmu(int32_t *v, uint32_t n, uint32_t k, int32_t q, const int32_t *t, const int32_t *u) {
+  uint32_t i;
+
+  for (i = 0; i < n; i++) {
+    scale_row(v + i * k, t + i * k, k, q, u[i]);
+  }
+}
+
+// same as ntt32_fwd
+static ALWAYS_INLINE void batch_forward(const ntt_state_simple_t *st, int32_t q, int32_t *v, const int32_t *t,
+                                        uint32_t k) {
+  const int32_t *p;
+  uint32_t n, j, s, m, u, d;
+
+  n = st->n;
+  p = st->psi_rev;
+
+  d = n >> 1;
+  for (s = 0; s < d; s++) {
+    butterfly_ct0(v + s * k, v + (s + d) * k, t + s * k, t + (s + d) * k, k, q, p[1]);
+  }
+  for (m = 2; m < n; m <<= 1) {
+    d >>= 1;
+    for (j = 0, u = 0; j < m; j++, u += 2 * d) {
+      for (s = u; s < u + d; s++) {
+        butterfly_ct(v + s * k, v + (s + d) * k, k, q, p[m + j]);
+      }
+    }
+  }
+}
+
+// same as ntt32_inv
+static ALWAYS_INLINE void batch_inverse(const ntt_state_simple_t *st, int32_t q, int32_t *v, const int32_t *t,
+                                        uint32_t k) {
+  const int32_t *p;
+  uint32_t n, j, s, m, u, d;
+
+  n = st->n;
+  p = st->inv_psi_rev;
+
+  m = n >> 1;
+  for (j = 0, u = 0; j < m; j++, u += 2) {
+    butterfly_gs(v + u * k, v + (u + 1) * k, t + u * k, t + (u + 1) * k, k, q, p[m + j]);
+  }
+  for (d = 2; d < n >> 1; d <<= 1) {
+    m >>= 1;
+    for (j = 0, u = 0; j < m; j++, u += 2 * d) {
+      for (s = u; s < u + d; s++) {
+        butterfly_gs(v + s * k, v + (s + d) * k, v + s * k, v + (s + d) * k, k, q, p[m + j]);
+      }
+    }
+  }
+  for (s = 0; s < d; s++) {
+    butterfly_gs_last(v + s * k, v + (s + d) * k, k, q, (p[1] * st->inv_n) % q, st->inv_n);
+  }
+}
+
+
+/*
+ * Instances
+ */
+#define BATCH_INSTANCE(name, attr, q)                                   \
+  static attr void name##_forward(const ntt_state_simple_t *s, int32_t *output, const int32_t *input, uint32_t k) { \
+    batch_forward(s, q, output, input, k);                              \
+  }                                                                     \
+  static attr void name##_inverse(const ntt_state_simple_t *s, int32_t *output, const int32_t *input, uint32_t k) { \
+    batch_inverse(s, q, output, input, k);                              \
+  }                                                                     \
+  static attr void name##_product(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, \
+                                  const int32_t *rhs, uint32_t k) {     \
+    batch_xmu(output, s->n, k, q, lhs, rhs);                            \
+  }
+
+typedef struct batch_ops_s {
+  void (*forward)(const ntt_state_simple_t *s, int32_t *output, const int32_t *input, uint32_t k);
+  void (*inverse)(const ntt_state_simple_t *s, int32_t *output, const int32_t *input, uint32_t k);
+  void (*product)(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs, uint32_t k);
+} batch_ops_t;
+
+#define BATCH_OPS(name) { name##_forward, name##_inverse, name##_product }
+
+#define NO_ATTR
+
+BATCH_INSTANCE(batch_12289, NO_ATTR, 12289)
+BATCH_INSTANCE(batch_7681, NO_ATTR, 7681)
+BATCH_INSTANCE(batch_any, NO_ATTR, s->q)
+
+static const batch_ops_t batch_ops[3] = {
+  BATCH_OPS(batch_12289), BATCH_OPS(batch_7681), BATCH_OPS(batch_any),
+};
+
+#if defined(__GNUC__) && defined(__x86_64__)
+
+#define BLISS_AVX2 __attribute__((target("avx2")))
+
+BATCH_INSTANCE(batch_12289_avx2, BLISS_AVX2, 12289)
+BATCH_INSTANCE(batch_7681_avx2, BLISS_AVX2, 7681)
+BATCH_INSTANCE(batch_any_avx2, BLISS_AVX2, s->q)
+
+static const batch_ops_t batch_ops_avx2[3] = {
+  BATCH_OPS(batch_12289_avx2), BATCH_OPS(batch_7681_avx2), BATCH_OPS(batch_any_avx2),
+};
+
+static bool batch_avx2_supported(void) {
+  return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+static const batch_ops_t *get_ops(const ntt_state_simple_t *s) {
+  const batch_ops_t *ops;
+
+  ops = batch_ops;
+#if defined(__GNUC__) && defined(__x86_64__)
+  if (batch_avx2_supported()) {
+    ops = batch_ops_avx2;
+  }
+#endif
+  switch (s->q) {
+  case 12289: return ops;
+  case 7681: return ops + 1;
+  default: return ops + 2;
+  }
+}
+
+void ntt_batch_forward(const ntt_state_simple_t *s, int32_t *output, const int32_t *input, uint32_t k) {
+  get_ops(s)->forward(s, output, input, k);
+}
+
+void ntt_batch_inverse(const ntt_state_simple_t *s, int32_t *output, const int32_t *input, uint32_t k) {
+  get_ops(s)->inverse(s, output, input, k);
+}
+
+void ntt_batch_product(const ntt_state_simple_t *s, int32_t *output, const int32_t *lhs, const int32_t *rhs,
+                       uint32_t k) {
+  get_ops(s)->product(s, output, lhs, rhs, k);
+}
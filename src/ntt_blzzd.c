@@ -21,8 +21,38 @@ static bool good_arg(int32_t v[], uint32_t n, int32_t q){
 #endif
 
 
-// Compute x^n (mod q).
-int32_t ntt32_pwr(int32_t x, int32_t n, int32_t q) {
+/*
+ * BD: Barrett reduction instead of the % operator (which compiles to
+ * a division since q is not a constant).
+ *
+ * With m = floor(2^NTT32_BARRETT_SHIFT / q), the estimate
+ * (x * m) >> NTT32_BARRETT_SHIFT of x/q is off by at most one
+ * as long as |x| < 2^31. We need m < 2^32 so that x * m fits in
+ * 64 bits, i.e., q > 2^(NTT32_BARRETT_SHIFT - 32).
+ */
+int64_t ntt32_barrett(int32_t q) {
+  assert((1 << (NTT32_BARRETT_SHIFT - 32)) < q && q < (1 << 16));
+  return ((int64_t) 1 << NTT32_BARRETT_SHIFT) / q;
+}
+
+// x mod q for 0 <= x < 2^31: result in [0, q-1]
+static inline int32_t reduce_pos(int32_t x, int32_t q, int64_t m) {
+  uint32_t r;
+
+  r = (uint32_t) x - (uint32_t) (((uint64_t) x * (uint64_t) m) >> NTT32_BARRETT_SHIFT) * (uint32_t) q;   // r in [0, 2q-1]
+  return (int32_t) (r >= (uint32_t) q ? r - (uint32_t) q : r);
+}
+
+// x mod q for -2^31 < x < 2^31: result in [0, q-1]
+static inline int32_t reduce(int32_t x, int32_t q, int64_t m) {
+  x -= (int32_t) ((x * m) >> NTT32_BARRETT_SHIFT) * q;   // x in [-q, 2q-1]
+  x += (x >> 31) & q;
+  x -= q;
+  return x + ((x >> 31) & q);
+}
+
+// Compute x^n (mod q) for 0 <= x < q.
+int32_t ntt32_pwr(int32_t x, int32_t n, int32_t q, int64_t m) {
   int32_t y;
 
   y = 1;
@@ -32,9 +62,9 @@ int32_t ntt32_pwr(int32_t x, int32_t n, int32_t q) {
   n >>= 1;
 
   while (n > 0) {
-    x = (x * x) % q;
+    x = reduce_pos(x * x, q, m);
     if (n & 1)
-      y = (x * y) % q;
+      y = reduce_pos(x * y, q, m);
     n >>= 1;
   }
 
@@ -62,48 +92,158 @@ static inline int32_t add_mod(int32_t x, int32_t y, int32_t q) {
   return x + ((x >> 31) & q);
 }
 
+/*
+ * BD: forward transform without bit-reverse shuffle: Cooley-Tukey,
+ * input in standard order, output in bit-reverse order, with the
+ * multiplication by the powers of psi folded into the twiddle factors
+ * (as mulntt_ct_std2rev in ntt_variants).
+ *
+ * Round t (t = 1, 2, ..., n/2) produces t blocks of size n/t. Block j
+ * uses the twiddle factor p[t + j] = psi^(n/2t) * omega^(n/2t)^bitrev(j).
+ *
+ * The first round reads from t and reduces its coefficients, so
+ * t can be any array with |t[i]| < 2^31/q (and v may be equal to t).
+ */
+void ntt32_fwd(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], const int32_t p[]) {
+  uint32_t j, s, k, u, d;
+  int32_t x, y, w;
+
+  d = n >> 1;
+  w = p[1];
+  for (s = 0; s < d; s++) {
+    x = reduce(t[s + d] * w, q, m);
+    y = reduce(t[s], q, m);
+    v[s + d] = sub_mod(y, x, q);
+    v[s] = add_mod(y, x, q);
+  }
 
-void ntt32_fft(int32_t v[], uint32_t n, int32_t q, const int32_t w[]) {
-  uint32_t i, j, k, l;
-  int32_t x, y;
+  for (k = 2; k < n; k <<= 1) {
+    d >>= 1;
+    for (j = 0, u = 0; j < k; j++, u += 2 * d) {
+      w = p[k + j];
+      for (s = u; s < u + d; s++) {
+        x = reduce_pos(v[s + d] * w, q, m);
+        v[s + d] = sub_mod(v[s], x, q);
+        v[s] = add_mod(v[s], x, q);
+      }
+    }
+  }
 
   assert(good_arg(v, n, q));
+}
 
-  // bit-inverse shuffle
-  j = n >> 1;
-  for (i = 1; i < n - 1; i++) {       // 00..0 and 11..1 remain same
-    if (i < j) {
-      x = v[i];
-      v[i] = v[j];
-      v[j] = x;
+/*
+ * BD: inverse transform without bit-reverse shuffle: Gentleman-Sande,
+ * input in bit-reverse order, output in standard order. The twiddle
+ * factors p[t + j] = psi^-(n/2t) * omega^-(n/2t)^bitrev(j) include the
+ * multiplication by the powers of psi^-1, and the division by n is
+ * folded into the last round (inv_n = 1/n modulo q).
+ *
+ * The first round reads from t (v may be equal to t).
+ */
+void ntt32_inv(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], const int32_t p[], int32_t inv_n) {
+  uint32_t j, s, k, u, d;
+  int32_t x, w;
+
+  assert(good_arg(t, n, q));
+
+  k = n >> 1;
+  for (j = 0, u = 0; j < k; j++, u += 2) {
+    w = p[k + j];
+    x = t[u + 1];
+    v[u + 1] = reduce_pos(sub_mod(t[u], x, q) * w, q, m);
+    v[u] = add_mod(t[u], x, q);
+  }
+
+  for (d = 2; d < n >> 1; d <<= 1) {
+    k >>= 1;
+    for (j = 0, u = 0; j < k; j++, u += 2 * d) {
+      w = p[k + j];
+      for (s = u; s < u + d; s++) {
+        x = v[s + d];
+        v[s + d] = reduce_pos(sub_mod(v[s], x, q) * w, q, m);
+        v[s] = add_mod(v[s], x, q);
+      }
     }
-    k = n;
-    do {
-      k >>= 1;
-      j ^= k;
-    } while ((j & k) == 0);
-  }
-
-  // main loops
-  l = n;         // BD: avoid division n/i in the loop
-  for (i = 1; i < n; i <<= 1) {
-    //    l = n / i;
-    for (k = 0; k < n; k += i + i) {
-      x = v[k + i];
-      v[k + i] = sub_mod(v[k], x, q);
-      v[k] = add_mod(v[k], x, q);
+  }
+
+  // last round: k = 1, d = n/2
+  w = reduce_pos(p[1] * inv_n, q, m);
+  for (s = 0; s < d; s++) {
+    x = v[s + d];
+    v[s + d] = reduce_pos(sub_mod(v[s], x, q) * w, q, m);
+    v[s] = reduce_pos(add_mod(v[s], x, q) * inv_n, q, m);
+  }
+
+  assert(good_arg(v, n, q));
+}
+
+/*
+ * BD: negacyclic product v = t * u, where u is an NTT:
+ * this is ntt32_fwd, ntt32_xmu, and ntt32_inv with two passes less.
+ *
+ * The last round of the forward transform, the pointwise product, and
+ * the first round of the inverse transform all work on the pairs
+ * (w[2j], w[2j+1]), so we do them in one pass. The transforms run
+ * in the scratch array w (n integers): t is read by the first round
+ * and v is written by the last one (v may be equal to t).
+ */
+void ntt32_mul(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], const int32_t u[], int32_t w[],
+               const int32_t pf[], const int32_t pi[], int32_t inv_n) {
+  uint32_t j, s, k, r, d;
+  int32_t x, y, z;
+
+  assert(good_arg((int32_t *) u, n, q));
+
+  // forward transform, except the last round
+  d = n >> 1;
+  z = pf[1];
+  for (s = 0; s < d; s++) {
+    x = reduce(t[s + d] * z, q, m);
+    y = reduce(t[s], q, m);
+    w[s + d] = sub_mod(y, x, q);
+    w[s] = add_mod(y, x, q);
+  }
+
+  for (k = 2; k < n >> 1; k <<= 1) {
+    d >>= 1;
+    for (j = 0, r = 0; j < k; j++, r += 2 * d) {
+      z = pf[k + j];
+      for (s = r; s < r + d; s++) {
+        x = reduce_pos(w[s + d] * z, q, m);
+        w[s + d] = sub_mod(w[s], x, q);
+        w[s] = add_mod(w[s], x, q);
+      }
     }
+  }
+
+  // last forward round, product by u, first inverse round (k = n/2, d = 1)
+  for (j = 0, r = 0; j < k; j++, r += 2) {
+    x = reduce_pos(w[r + 1] * pf[k + j], q, m);
+    y = reduce_pos(add_mod(w[r], x, q) * u[r], q, m);
+    x = reduce_pos(sub_mod(w[r], x, q) * u[r + 1], q, m);
+    w[r + 1] = reduce_pos(sub_mod(y, x, q) * pi[k + j], q, m);
+    w[r] = add_mod(y, x, q);
+  }
 
-    for (j = 1; j < i; j++) {
-      y = w[j * l];
-      for (k = j; k < n; k += i + i) {
-        x = (v[k + i] * y) % q;
-        v[k + i] = sub_mod(v[k], x, q);
-        v[k] = add_mod(v[k], x, q);
+  // inverse transform, except the first round
+  for (d = 2; d < n >> 1; d <<= 1) {
+    k >>= 1;
+    for (j = 0, r = 0; j < k; j++, r += 2 * d) {
+      z = pi[k + j];
+      for (s = r; s < r + d; s++) {
+        x = w[s + d];
+        w[s + d] = reduce_pos(sub_mod(w[s], x, q) * z, q, m);
+        w[s] = add_mod(w[s], x, q);
       }
     }
+  }
 
-    l >>= 1;
+  z = reduce_pos(pi[1] * inv_n, q, m);
+  for (s = 0; s < d; s++) {
+    x = w[s + d];
+    v[s + d] = reduce_pos(sub_mod(w[s], x, q) * z, q, m);
+    v[s] = reduce_pos(add_mod(w[s], x, q) * inv_n, q, m);
   }
 
   assert(good_arg(v, n, q));
@@ -111,51 +251,55 @@ void ntt32_fft(int32_t v[], uint32_t n, int32_t q, const int32_t w[]) {
 
 // Elementwise vector product  v = t (*) u.
 // BD: modified to use 32 bit arithmetic
-void ntt32_xmu(int32_t v[], uint32_t n, int32_t q, const int32_t t[], const int32_t u[]) {
+void ntt32_xmu(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], const int32_t u[]) {
   uint32_t i;
-  int32_t x;
 
   // multiply each element point-by-point
   for (i = 0; i < n; i++) {
-    x = (t[i] * u[i]) % q;
-    v[i] = x + ((x >> 31) & q); // v[i] = if x<0 then x+q else x
+    v[i] = reduce(t[i] * u[i], q, m);
   }
 
   assert(good_arg(v, n, q));
 }
 
-// Multiply with a scalar  v = t * c.
-// BD: modified to use 32 bit arithmetic
-void ntt32_cmu(int32_t v[], uint32_t n, int32_t q, const int32_t t[], int32_t c) {
+/*
+ * BD: elementwise inverse v[i] = 1/t[i] by Montgomery's trick: one
+ * exponentiation and 3(n-1) multiplications instead of n exponentiations.
+ * - w[i] = t[0] * ... * t[i] (prefix products)
+ * - x = 1/w[n-1]
+ * - for i = n-1 down to 1: 1/t[i] = x * w[i-1], then x := x * t[i] = 1/w[i-1]
+ * All t[i] must be non-zero (and q prime). v may be equal to t.
+ */
+void ntt32_xinv(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], int32_t w[]) {
   uint32_t i;
-  int32_t x;
+  int32_t x, y;
 
-  for (i = 0; i < n; i++) {
-    x = (t[i] * c) % q;
-    v[i] = x + ((x >> 31) & q); // v[i] = if x<0 then x+q else x
+  assert(n > 0 && good_arg((int32_t *) t, n, q));
+
+  w[0] = t[0];
+  for (i = 1; i < n; i++) {
+    w[i] = reduce_pos(w[i - 1] * t[i], q, m);
+  }
+
+  x = ntt32_pwr(w[n - 1], q - 2, q, m);
+  for (i = n - 1; i > 0; i--) {
+    y = reduce_pos(x * w[i - 1], q, m);
+    x = reduce_pos(x * t[i], q, m);
+    v[i] = y;
   }
+  v[0] = x;
 
   assert(good_arg(v, n, q));
 }
 
-// Flip the order.
-// BD: removed normalization modulo q, except for v[0] since we assume 0 <= v[i] < q.
-void ntt32_flp(int32_t v[], uint32_t n, int32_t q) {
-  uint32_t i, j;
-  int32_t x;
-
-  assert(good_arg(v, n, q));
+// Multiply with a scalar  v = t * c.
+// BD: modified to use 32 bit arithmetic
+void ntt32_cmu(int32_t v[], uint32_t n, int32_t q, int64_t m, const int32_t t[], int32_t c) {
+  uint32_t i;
 
-  for (i = 1, j = n - 1; i < j; i++, j--) {
-    x = v[i];
-    v[i] = v[j];
-    v[j] = x;
+  for (i = 0; i < n; i++) {
+    v[i] = reduce(t[i] * c, q, m);
   }
 
-  // replace v[0] by q - v[0] if v[0] > 0, keep v[0] = 0 otherwise
-  x = q & ((-v[0]) >> 31);
-  v[0] = x - v[0];
-
   assert(good_arg(v, n, q));
 }
-
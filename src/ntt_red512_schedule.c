@@ -0,0 +1,22 @@
+#include "ntt_red_schedule.h"
+
+/*
+ * Schedule of multiply_ntt_into for the red and avx2 backends
+ * (see ntt_red_schedule.h). The bounds are checked by make check_bounds:
+ * - the forward NTT of [-6144, 6144] is in [-6062281, 6048682]
+ * - the product is up to 2^25 and must be reduced once before the
+ *   inverse NTT (or the inverse NTT can overflow)
+ * - after the inverse NTT, a double reduction gives [-3, 12286]
+ *
+ * Factors: 3 * 3 * 512 * 9 * 910 = 1 modulo q.
+ */
+const ntt_red_step_t ntt_red512_mul_schedule[] = {
+  { NTT_RED_CENTER, 910 },
+  { NTT_RED_FORWARD, 0 },
+  { NTT_RED_PRODUCT, 0 },
+  { NTT_RED_REDUCE, 0 },
+  { NTT_RED_INVERSE, 0 },
+  { NTT_RED_REDUCE_TWICE, 0 },
+  { NTT_RED_CORRECT, 0 },
+  { NTT_RED_END, 0 },
+};
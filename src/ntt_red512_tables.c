@@ -0,0 +1,886 @@
+/*
+ * Parameters:
+ * - q = 12289
+ * - k = 3
+ * - n = 512
+ * - psi = 10302
+ * - omega = psi^2 = 3400
+ * - inverse of psi = 8974
+ * - inverse of omega = 2859
+ * - inverse of n = 12265
+ * - inverse of k = 8193
+ */
+
+#include "ntt_red512_tables.h"
+
+const int16_t ntt_red512_psi_powers[512] = {
+    -4096,  3434, -2963,  1050,  2780, -6099,  1759, -5057,
+    -4143, -1489, -3006,   468,  4048,  5919,  -480, -4782,
+     2437,  -453,  3014, -4075, -1426, -5297,  5755,  5874,
+     2912,  1975, -4134,  5206,  3016,  4240,  5374,  1003,
+    -2143, -6142,  1177, -3789, -4414, -3728, -2731, -5241,
+     5084,  -350, -5023,  2033,  3510,  5782,  1381, -3600,
+     1002,  -156,  2747, -1973,   160,  1594,  3284,   151,
+    -5101, -2738, -3621,  5862,  2178, -1958, -5067,  3438,
+     1378,  2361,  3091,  2683,  2305,  3762, -3382, -2049,
+     3704,  1263, -2625,  5339, -3186,  1747, -5791,  4213,
+    -2422, -4774, -1170,  2169,  3636,  1200,  -334,    52,
+    -5012,  4754,  4043,  3565, -5191,  4046, -2396,  5009,
+     1207, -1954,  -726,  4749,  1689, -1146,  3637,  -787,
+     3066,  3202,  3328, -1254, -2969,   683, -5331,  -421,
+      875, -5876,  1062,  3514, -2166,  2692, -3289, -2505,
+      390,  -723, -1212,  -400, -3985,  4079,  5767, -5681,
+    -5444,  2908, -2366, -5445,  4895, -5766,  3694, -3445,
+      242, -1583,  -563,   382,  2884, -3834, -1022,  3029,
+     2987,   418,  5086, -4324,  1777, -3956, -4388,  6055,
+     -354,  2925,   722,  3199, -3000,   835,  -130,   241,
+      404, -3963, -2768, -5456,  2174,  5990,  5911,  3127,
+     4885,  1815, -5728,  1922,  2865, -2948, -4177,  4624,
+     4284,  3969,  3135,  1278,  4437, -5106, -5092,  3957,
+     2401, -2655,  3504,  5415,  5559,  2078,   118,  -975,
+    -4337,  3030,  1000,  3818, -4053,  4016, -4231,  1321,
+     5019,  5915, -4821, -6093,  2126,  3054,  2468,  -605,
+    -2187, -4737,  -955,  5079, -2704,  2555, -1428, -1323,
+    -1045,  -426, -1479,  1702, -2399, -1319,  3296,   885,
+    -1168, -1805, -1853, -4789,  4057,   325,  5542, -1010,
+     3763, -5369,  1351, -5435, -2686,  3656, -1673, -6068,
+     1607,  2031, -4805, -1018, -4919,  4298,   729,  1579,
+    -3778, -1693, -3195, -4948,   476,   441, -3748,   142,
+      493,  3529,  4896,  4536, -5195,  -295, -3707,  4698,
+     4714, -2500,  2744,  3988,  2249,  4433,  2842,  5886,
+     3646,  5908, -3201, -5315,  4654,  6119, -4632,  -677,
+     5698, -3757,  5736, -5529,  -243,  3570, -2837, -3532,
+     1065, -2447, -4255,  -147, -2847,  4049,  3932,  2920,
+    -1632, -1512,  5828, -3998,  5332, -1566,  2525, -3263,
+    -5011,  2767, -4846, -5574,  3149, -1962,  2881,  2127,
+     1067,  5868,  2545, -6136,  1544,  4322,  2197, -2844,
+    -1912,  1843,    81, -1190,  5042, -2919,  -355,  4912,
+    -2678,    49,   949, -5446, -5407,  3123,   544,   504,
+    -6039,  5429,  2319,   522, -4938,  5184, -2426,  3174,
+    -2481,  1858, -5146,   654,  3136,  -709, -4452, -1956,
+     3248, -2051, -4611, -5537,  3364,   948, -3459,  3482,
+      -27,  4493, -5777,   973, -3978,  2459,  4989,  4080,
+     3780, -2281, -2294, -1041,  3915,  -168,  2013, -5906,
+     -773,  -174,  1646, -1728,  4905, -1058,   827,  3477,
+    -2381,  -218,  3051, -3860,  1484,   652, -5179,  4780,
+     1537,  5942,  2975,  -316,  1153, -5257,     9, -5594,
+     6022,  3772,  1326, -4916, -1663, -1360, -1260, -3336,
+     4861,   347, -1305,    56,  -671,  6065,  4354,    58,
+    -4645,   576, -1635,  4449, -4372, -1159,  4890,  4169,
+    -1017,  5383, -4591,  3879, -2370,  2503,  3584, -6077,
+    -5088, -3991,  3712, -2344,    -3,  5961,  2089,  2839,
+     -442,  5735, -3542, -3643,   420,  1112,  2476, -4212,
+      435, -4115,  4320, -6118,  2645,  4077, -2548,  -192,
+      545, -1483, -2639, -3710, -1630, -5486,   339,  2302,
+    -2566, -1293,   790,  3262, -5291,  6122,  1696, -2766,
+     2859, -3315,     1, -1987,  3400,  3150, -3949, -6008,
+     5277, -2882,  -140, -4467,  3271,  1404,  -145,  5468,
+    -1440, -2057, -4978, -1359, -3247,    64, -4278, -3602,
+     4976,  5333, -3553,  5925,  -113,  3329, -3241,   431,
+     3833,  3009,  5860, -6137,  3531,   922,  -953,  1105,
+};
+
+const int16_t ntt_red512_psi_powers_rev[512] = {
+        0, -4096, -4096, -5444, -4096, -5444,  1378, -4337,
+    -4096, -5444,  1378, -4337, -2143,   404,  1207, -1168,
+    -4096, -5444,  1378, -4337, -2143,   404,  1207, -1168,
+     2437,  2987, -2422, -2187,  1002,  4284,   875,  1607,
+    -4096, -5444,  1378, -4337, -2143,   404,  1207, -1168,
+     2437,  2987, -2422, -2187,  1002,  4284,   875,  1607,
+    -4143,   242,  3704,  5019,  5084,  4885,  3066,  3763,
+     2912,  -354, -5012, -1045, -5101,  2401,   390, -3778,
+    -4096, -5444,  1378, -4337, -2143,   404,  1207, -1168,
+     2437,  2987, -2422, -2187,  1002,  4284,   875,  1607,
+    -4143,   242,  3704,  5019,  5084,  4885,  3066,  3763,
+     2912,  -354, -5012, -1045, -5101,  2401,   390, -3778,
+     2780,  4895,  2305, -4053, -4414,  2174,  1689,  4057,
+    -1426,  1777,  3636, -2704,   160,  4437, -2166, -4919,
+     4048,  2884, -3186,  2126,  3510,  2865, -2969, -2686,
+     3016, -3000, -5191, -2399,  2178,  5559, -3985,   476,
+    -4096, -5444,  1378, -4337, -2143,   404,  1207, -1168,
+     2437,  2987, -2422, -2187,  1002,  4284,   875,  1607,
+    -4143,   242,  3704,  5019,  5084,  4885,  3066,  3763,
+     2912,  -354, -5012, -1045, -5101,  2401,   390, -3778,
+     2780,  4895,  2305, -4053, -4414,  2174,  1689,  4057,
+    -1426,  1777,  3636, -2704,   160,  4437, -2166, -4919,
+     4048,  2884, -3186,  2126,  3510,  2865, -2969, -2686,
+     3016, -3000, -5191, -2399,  2178,  5559, -3985,   476,
+    -2963, -2366,  3091,  1000,  1177, -2768,  -726, -1853,
+     3014,  5086, -1170,  -955,  2747,  3135,  1062, -4805,
+    -3006,  -563, -2625, -4821, -5023, -5728,  3328,  1351,
+    -4134,   722,  4043, -1479, -3621,  3504, -1212, -3195,
+     1759,  3694, -3382, -4231, -2731,  5911,  3637,  5542,
+     5755, -4388,  -334, -1428,  3284, -5092, -3289,   729,
+     -480, -1022, -5791,  2468,  1381, -4177, -5331, -1673,
+     5374,  -130, -2396,  3296, -5067,   118,  5767, -3748,
+    -4096, -5444,  1378, -4337, -2143,   404,  1207, -1168,
+     2437,  2987, -2422, -2187,  1002,  4284,   875,  1607,
+    -4143,   242,  3704,  5019,  5084,  4885,  3066,  3763,
+     2912,  -354, -5012, -1045, -5101,  2401,   390, -3778,
+     2780,  4895,  2305, -4053, -4414,  2174,  1689,  4057,
+    -1426,  1777,  3636, -2704,   160,  4437, -2166, -4919,
+     4048,  2884, -3186,  2126,  3510,  2865, -2969, -2686,
+     3016, -3000, -5191, -2399,  2178,  5559, -3985,   476,
+    -2963, -2366,  3091,  1000,  1177, -2768,  -726, -1853,
+     3014,  5086, -1170,  -955,  2747,  3135,  1062, -4805,
+    -3006,  -563, -2625, -4821, -5023, -5728,  3328,  1351,
+    -4134,   722,  4043, -1479, -3621,  3504, -1212, -3195,
+     1759,  3694, -3382, -4231, -2731,  5911,  3637,  5542,
+     5755, -4388,  -334, -1428,  3284, -5092, -3289,   729,
+     -480, -1022, -5791,  2468,  1381, -4177, -5331, -1673,
+     5374,  -130, -2396,  3296, -5067,   118,  5767, -3748,
+     3434,  2908,  2361,  3030, -6142, -3963, -1954, -1805,
+     -453,   418, -4774, -4737,  -156,  3969, -5876,  2031,
+    -1489, -1583,  1263,  5915,  -350,  1815,  3202, -5369,
+     1975,  2925,  4754,  -426, -2738, -2655,  -723, -1693,
+    -6099, -5766,  3762,  4016, -3728,  5990, -1146,   325,
+    -5297, -3956,  1200,  2555,  1594, -5106,  2692,  4298,
+     5919, -3834,  1747,  3054,  5782, -2948,   683,  3656,
+     4240,   835,  4046, -1319, -1958,  2078,  4079,   441,
+     1050, -5445,  2683,  3818, -3789, -5456,  4749, -4789,
+    -4075, -4324,  2169,  5079, -1973,  1278,  3514, -1018,
+      468,   382,  5339, -6093,  2033,  1922, -1254, -5435,
+     5206,  3199,  3565,  1702,  5862,  5415,  -400, -4948,
+    -5057, -3445, -2049,  1321, -5241,  3127,  -787, -1010,
+     5874,  6055,    52, -1323,   151,  3957, -2505,  1579,
+    -4782,  3029,  4213,  -605, -3600,  4624,  -421, -6068,
+     1003,   241,  5009,   885,  3438,  -975, -5681,   142,
+};
+
+const int16_t ntt_red512_inv_psi_powers[512] = {
+    -4096, -1105,   953,  -922, -3531,  6137, -5860, -3009,
+    -3833,  -431,  3241, -3329,   113, -5925,  3553, -5333,
+    -4976,  3602,  4278,   -64,  3247,  1359,  4978,  2057,
+     1440, -5468,   145, -1404, -3271,  4467,   140,  2882,
+    -5277,  6008,  3949, -3150, -3400,  1987,    -1,  3315,
+    -2859,  2766, -1696, -6122,  5291, -3262,  -790,  1293,
+     2566, -2302,  -339,  5486,  1630,  3710,  2639,  1483,
+     -545,   192,  2548, -4077, -2645,  6118, -4320,  4115,
+     -435,  4212, -2476, -1112,  -420,  3643,  3542, -5735,
+      442, -2839, -2089, -5961,     3,  2344, -3712,  3991,
+     5088,  6077, -3584, -2503,  2370, -3879,  4591, -5383,
+     1017, -4169, -4890,  1159,  4372, -4449,  1635,  -576,
+     4645,   -58, -4354, -6065,   671,   -56,  1305,  -347,
+    -4861,  3336,  1260,  1360,  1663,  4916, -1326, -3772,
+    -6022,  5594,    -9,  5257, -1153,   316, -2975, -5942,
+    -1537, -4780,  5179,  -652, -1484,  3860, -3051,   218,
+     2381, -3477,  -827,  1058, -4905,  1728, -1646,   174,
+      773,  5906, -2013,   168, -3915,  1041,  2294,  2281,
+    -3780, -4080, -4989, -2459,  3978,  -973,  5777, -4493,
+       27, -3482,  3459,  -948, -3364,  5537,  4611,  2051,
+    -3248,  1956,  4452,   709, -3136,  -654,  5146, -1858,
+     2481, -3174,  2426, -5184,  4938,  -522, -2319, -5429,
+     6039,  -504,  -544, -3123,  5407,  5446,  -949,   -49,
+     2678, -4912,   355,  2919, -5042,  1190,   -81, -1843,
+     1912,  2844, -2197, -4322, -1544,  6136, -2545, -5868,
+    -1067, -2127, -2881,  1962, -3149,  5574,  4846, -2767,
+     5011,  3263, -2525,  1566, -5332,  3998, -5828,  1512,
+     1632, -2920, -3932, -4049,  2847,   147,  4255,  2447,
+    -1065,  3532,  2837, -3570,   243,  5529, -5736,  3757,
+    -5698,   677,  4632, -6119, -4654,  5315,  3201, -5908,
+    -3646, -5886, -2842, -4433, -2249, -3988, -2744,  2500,
+    -4714, -4698,  3707,   295,  5195, -4536, -4896, -3529,
+     -493,  -142,  3748,  -441,  -476,  4948,  3195,  1693,
+     3778, -1579,  -729, -4298,  4919,  1018,  4805, -2031,
+    -1607,  6068,  1673, -3656,  2686,  5435, -1351,  5369,
+    -3763,  1010, -5542,  -325, -4057,  4789,  1853,  1805,
+     1168,  -885, -3296,  1319,  2399, -1702,  1479,   426,
+     1045,  1323,  1428, -2555,  2704, -5079,   955,  4737,
+     2187,   605, -2468, -3054, -2126,  6093,  4821, -5915,
+    -5019, -1321,  4231, -4016,  4053, -3818, -1000, -3030,
+     4337,   975,  -118, -2078, -5559, -5415, -3504,  2655,
+    -2401, -3957,  5092,  5106, -4437, -1278, -3135, -3969,
+    -4284, -4624,  4177,  2948, -2865, -1922,  5728, -1815,
+    -4885, -3127, -5911, -5990, -2174,  5456,  2768,  3963,
+     -404,  -241,   130,  -835,  3000, -3199,  -722, -2925,
+      354, -6055,  4388,  3956, -1777,  4324, -5086,  -418,
+    -2987, -3029,  1022,  3834, -2884,  -382,   563,  1583,
+     -242,  3445, -3694,  5766, -4895,  5445,  2366, -2908,
+     5444,  5681, -5767, -4079,  3985,   400,  1212,   723,
+     -390,  2505,  3289, -2692,  2166, -3514, -1062,  5876,
+     -875,   421,  5331,  -683,  2969,  1254, -3328, -3202,
+    -3066,   787, -3637,  1146, -1689, -4749,   726,  1954,
+    -1207, -5009,  2396, -4046,  5191, -3565, -4043, -4754,
+     5012,   -52,   334, -1200, -3636, -2169,  1170,  4774,
+     2422, -4213,  5791, -1747,  3186, -5339,  2625, -1263,
+    -3704,  2049,  3382, -3762, -2305, -2683, -3091, -2361,
+    -1378, -3438,  5067,  1958, -2178, -5862,  3621,  2738,
+     5101,  -151, -3284, -1594,  -160,  1973, -2747,   156,
+    -1002,  3600, -1381, -5782, -3510, -2033,  5023,   350,
+    -5084,  5241,  2731,  3728,  4414,  3789, -1177,  6142,
+     2143, -1003, -5374, -4240, -3016, -5206,  4134, -1975,
+    -2912, -5874, -5755,  5297,  1426,  4075, -3014,   453,
+    -2437,  4782,   480, -5919, -4048,  -468,  3006,  1489,
+     4143,  5057, -1759,  6099, -2780, -1050,  2963, -3434,
+};
+
+const int16_t ntt_red512_scaled_inv_psi_powers[512] = {
+     4411,  1445,  2535,  2151, -2945,  5209, -1790, -1737,
+    -5386, -1327,  -457,  3408, -3929, -1705,  -865,  4138,
+    -2946, -3765, -4649,  1029,  5207,  4840,  4834,   146,
+    -4719,  -412,  1701,  1836, -3285,  1721, -3019,  4739,
+    -4443, -5966,  4289,   338, -2171, -4489,  -944, -4335,
+     4684,  5836, -3454, -3338,  5370,  5211,  3869,  3981,
+     1371,  2065,  -502,  5115,  2595,  -125, -3451,  -994,
+     1658, -3087, -3332, -2231, -2213,  -438,  1868,  1236,
+    -5103, -5508, -2434, -5163, -3232, -1928,  1040,  5609,
+     -578, -1014, -5776,  1178,  2832,   716, -1763, -5219,
+    -1927, -2275, -3821, -3344,   682,   346, -4113,  6094,
+     1506, -3056,  4504,   375, -1936,  2982, -4974, -3028,
+    -2293, -5596, -5650,  1314, -5604, -3708,  3020,  4235,
+    -4987,  3200, -2593,  5784, -3120, -4538,  1734,  3042,
+     5039, -3534,  3793, -2148,  5289,  3368,  5781, -5464,
+     -826, -2257, -2046, -1038,    50, -5993, -4518, -3121,
+    -1223, -1125,  5808,  3343,  2633, -3205, -5410,  4499,
+     4661, -3942,  4523, -1165,  3229,  -416,  2672,  2689,
+    -4510, -5063, -2929,  1325, -5202,  3163, -2828, -1687,
+      910, -5845, -3578,  2185, -5054,  4103,  2478, -5518,
+     6138,  3114,  -150,  5690,  1265, -2926,  3669,  3375,
+    -5135,  2260,  4390, -2674,  3941, -1208, -1694,  -463,
+    -1280,  3495,  2602,  1248,  4273,  4222,  1241,  2900,
+    -3502, -3975,  3317,  2800, -3805,  5061, -2730,  5246,
+    -1555,  5734,  2873,   -20,  4855,  4265, -6125,  2947,
+      450, -4781, -3795, -3511,  1282,  2164,  3116,  5509,
+     -881, -4267,   466,  3624,  5082,  1389,  3840,  1804,
+     4483, -3744,  -530,  -377, -3723,  3589, -1783,  -364,
+     2338,  3889,  -874, -2894, -4099, -3449,  4665, -4913,
+     3670,    60, -2276,  -506,  6086,  3448, -1350,  2054,
+     -904, -1756, -3846,  5797,  2941, -4238,  2643,   512,
+    -1398,  1417, -2957, -4167,   769, -5412, -1160, -1057,
+     1590,  1131, -1120,  1522,  5349,  1092,  5275,   622,
+     2622, -3607,     8, -1942, -1706,  2450,  1279,  -180,
+    -5461,  1518, -5969,  1945,  4050,  6127,  2712,  5268,
+     -751, -5102,  3466,   425,  4360, -1536,  4194, -4251,
+    -3418,   212, -2307,  3947,  3480,  3171, -4770, -3393,
+     3360, -4566, -3758, -3276, -3536, -1866,  4423, -1468,
+      -24,  5826,  5118,  4939, -3837,   540,  4094, -4554,
+     5618, -5835,   139, -6092,  4153, -3515,  2253,  3017,
+     1891, -1275,  -791,  4608,  -293,   464, -2035,  -636,
+    -5368,   448,  1849,  2776,  2021, -2110,  2209,  1409,
+    -1015, -2461, -1681,  5598,  -980,  4404,    72, -5189,
+    -3065, -2528,  -778, -1620,     7,  1373, -4565,  5216,
+     -417,  5987,  -170, -1744,  5530,  3238, -5673,  3825,
+     2373, -1535,   879, -1392,  6105,  1908,  3815, -1344,
+    -5547,  3961, -6063, -5959,  5662, -4227,  3045, -4906,
+     5043, -4505,  2940,  -923,  -216,  3278, -3094, -4705,
+     2334,  4860,   -21, -4119,  1406, -3359,  1251, -5672,
+      510,  5232, -4301,  2575,  4730,   814,  5170,  4605,
+    -2637,  4176, -6026, -5724,   844,  4032,  4352,   406,
+     5900,  5588, -4697,   392,  3154,  2429, -2840,  1226,
+     3469,  2769,   648,  2455, -3007,  1826,  5287, -2291,
+       63,    68, -4218, -2212, -3753,  4727, -1530, -3407,
+      614,  4564, -1901, -2442, -3221, -1526, -4378,  -239,
+     5789,  4883, -2532,   193,  -767, -1218, -5411, -4475,
+     1802, -1176,  2827,  5002, -3769, -3678,  1882,  3982,
+    -1944,  4924, -3268, -5478, -3572, -5416,  -189,  -204,
+      365, -5653, -1030, -1892,  4590, -2068, -1842, -1403,
+     5703, -4963, -2626,  4578,   845,   717, -5078, -2360,
+    -4693,  -579,  2301,  3654,  3944,  1136, -5406,  3528,
+     3808, -2717,  -982, -1255, -5646,   343,  5832, -2483,
+    -2485,  4145, -1573,  3959,   567,   612, -1095,  4670,
+     3090,  5676, -1481, -6085,  5526,  4209, -4820,  2600,
+};
+
+const int16_t ntt_red512_scaled_inv_psi_powers_var[512] = {
+     2832,   716, -1763, -5219, -1927, -2275, -3821, -3344,
+      682,   346, -4113,  6094,  1506, -3056,  4504,   375,
+    -1936,  2982, -4974, -3028, -2293, -5596, -5650,  1314,
+    -5604, -3708,  3020,  4235, -4987,  3200, -2593,  5784,
+    -3120, -4538,  1734,  3042,  5039, -3534,  3793, -2148,
+     5289,  3368,  5781, -5464,  -826, -2257, -2046, -1038,
+       50, -5993, -4518, -3121, -1223, -1125,  5808,  3343,
+     2633, -3205, -5410,  4499,  4661, -3942,  4523, -1165,
+     3229,  -416,  2672,  2689, -4510, -5063, -2929,  1325,
+    -5202,  3163, -2828, -1687,   910, -5845, -3578,  2185,
+    -5054,  4103,  2478, -5518,  6138,  3114,  -150,  5690,
+     1265, -2926,  3669,  3375, -5135,  2260,  4390, -2674,
+     3941, -1208, -1694,  -463, -1280,  3495,  2602,  1248,
+     4273,  4222,  1241,  2900, -3502, -3975,  3317,  2800,
+    -3805,  5061, -2730,  5246, -1555,  5734,  2873,   -20,
+     4855,  4265, -6125,  2947,   450, -4781, -3795, -3511,
+     1282,  2164,  3116,  5509,  -881, -4267,   466,  3624,
+     5082,  1389,  3840,  1804,  4483, -3744,  -530,  -377,
+    -3723,  3589, -1783,  -364,  2338,  3889,  -874, -2894,
+    -4099, -3449,  4665, -4913,  3670,    60, -2276,  -506,
+     6086,  3448, -1350,  2054,  -904, -1756, -3846,  5797,
+     2941, -4238,  2643,   512, -1398,  1417, -2957, -4167,
+      769, -5412, -1160, -1057,  1590,  1131, -1120,  1522,
+     5349,  1092,  5275,   622,  2622, -3607,     8, -1942,
+    -1706,  2450,  1279,  -180, -5461,  1518, -5969,  1945,
+     4050,  6127,  2712,  5268,  -751, -5102,  3466,   425,
+     4360, -1536,  4194, -4251, -3418,   212, -2307,  3947,
+     3480,  3171, -4770, -3393,  3360, -4566, -3758, -3276,
+    -3536, -1866,  4423, -1468,   -24,  5826,  5118,  4939,
+    -3837,   540,  4094, -4554,  5618, -5835,   139, -6092,
+     4153, -3515,  2253,  3017,  1891, -1275,  -791,  4608,
+     -293,   464, -2035,  -636, -5368,   448,  1849,  2776,
+     2021, -2110,  2209,  1409, -1015, -2461, -1681,  5598,
+     -980,  4404,    72, -5189, -3065, -2528,  -778, -1620,
+        7,  1373, -4565,  5216,  -417,  5987,  -170, -1744,
+     5530,  3238, -5673,  3825,  2373, -1535,   879, -1392,
+     6105,  1908,  3815, -1344, -5547,  3961, -6063, -5959,
+     5662, -4227,  3045, -4906,  5043, -4505,  2940,  -923,
+     -216,  3278, -3094, -4705,  2334,  4860,   -21, -4119,
+     1406, -3359,  1251, -5672,   510,  5232, -4301,  2575,
+     4730,   814,  5170,  4605, -2637,  4176, -6026, -5724,
+      844,  4032,  4352,   406,  5900,  5588, -4697,   392,
+     3154,  2429, -2840,  1226,  3469,  2769,   648,  2455,
+    -3007,  1826,  5287, -2291,    63,    68, -4218, -2212,
+    -3753,  4727, -1530, -3407,   614,  4564, -1901, -2442,
+    -3221, -1526, -4378,  -239,  5789,  4883, -2532,   193,
+     -767, -1218, -5411, -4475,  1802, -1176,  2827,  5002,
+    -3769, -3678,  1882,  3982, -1944,  4924, -3268, -5478,
+    -3572, -5416,  -189,  -204,   365, -5653, -1030, -1892,
+     4590, -2068, -1842, -1403,  5703, -4963, -2626,  4578,
+      845,   717, -5078, -2360, -4693,  -579,  2301,  3654,
+     3944,  1136, -5406,  3528,  3808, -2717,  -982, -1255,
+    -5646,   343,  5832, -2483, -2485,  4145, -1573,  3959,
+      567,   612, -1095,  4670,  3090,  5676, -1481, -6085,
+     5526,  4209, -4820,  2600, -4411, -1445, -2535, -2151,
+     2945, -5209,  1790,  1737,  5386,  1327,   457, -3408,
+     3929,  1705,   865, -4138,  2946,  3765,  4649, -1029,
+    -5207, -4840, -4834,  -146,  4719,   412, -1701, -1836,
+     3285, -1721,  3019, -4739,  4443,  5966, -4289,  -338,
+     2171,  4489,   944,  4335, -4684, -5836,  3454,  3338,
+    -5370, -5211, -3869, -3981, -1371, -2065,   502, -5115,
+    -2595,   125,  3451,   994, -1658,  3087,  3332,  2231,
+     2213,   438, -1868, -1236,  5103,  5508,  2434,  5163,
+     3232,  1928, -1040, -5609,   578,  1014,  5776, -1178,
+};
+
+const int16_t ntt_red512_omega_powers[512] = {
+        0, -4096, -4096,   493, -4096, -5444,   493, -2381,
+    -4096,  1378, -5444, -4337,   493, -1912, -2381,   435,
+    -4096, -2143,  1378,  1207, -5444,   404, -4337, -1168,
+      493,  1065, -1912,  3248, -2381, -4645,   435,  5277,
+    -4096,  2437, -2143,  1002,  1378, -2422,  1207,   875,
+    -5444,  2987,   404,  4284, -4337, -2187, -1168,  1607,
+      493,  3646,  1065, -5011, -1912, -6039,  3248,  3780,
+    -2381,  6022, -4645, -5088,   435, -2566,  5277,  4976,
+    -4096, -4143,  2437,  2912, -2143,  5084,  1002, -5101,
+     1378,  3704, -2422, -5012,  1207,  3066,   875,   390,
+    -5444,   242,  2987,  -354,   404,  4885,  4284,  2401,
+    -4337,  5019, -2187, -1045, -1168,  3763,  1607, -3778,
+      493,  4714,  3646,  5698,  1065, -1632, -5011,  1067,
+    -1912, -2678, -6039, -2481,  3248,   -27,  3780,  -773,
+    -2381,  1537,  6022,  4861, -4645, -1017, -5088,  -442,
+      435,   545, -2566,  2859,  5277, -1440,  4976,  3833,
+    -4096,  2780, -4143,  4048,  2437, -1426,  2912,  3016,
+    -2143, -4414,  5084,  3510,  1002,   160, -5101,  2178,
+     1378,  2305,  3704, -3186, -2422,  3636, -5012, -5191,
+     1207,  1689,  3066, -2969,   875, -2166,   390, -3985,
+    -5444,  4895,   242,  2884,  2987,  1777,  -354, -3000,
+      404,  2174,  4885,  2865,  4284,  4437,  2401,  5559,
+    -4337, -4053,  5019,  2126, -2187, -2704, -1045, -2399,
+    -1168,  4057,  3763, -2686,  1607, -4919, -3778,   476,
+      493, -5195,  4714,  2249,  3646,  4654,  5698,  -243,
+     1065, -2847, -1632,  5332, -5011,  3149,  1067,  1544,
+    -1912,  5042, -2678, -5407, -6039, -4938, -2481,  3136,
+     3248,  3364,   -27, -3978,  3780,  3915,  -773,  4905,
+    -2381,  1484,  1537,  1153,  6022, -1663,  4861,  -671,
+    -4645, -4372, -1017, -2370, -5088,    -3,  -442,   420,
+      435,  2645,   545, -1630, -2566, -5291,  2859,  3400,
+     5277,  3271, -1440, -3247,  4976,  -113,  3833,  3531,
+    -4096, -2963,  2780,  1759, -4143, -3006,  4048,  -480,
+     2437,  3014, -1426,  5755,  2912, -4134,  3016,  5374,
+    -2143,  1177, -4414, -2731,  5084, -5023,  3510,  1381,
+     1002,  2747,   160,  3284, -5101, -3621,  2178, -5067,
+     1378,  3091,  2305, -3382,  3704, -2625, -3186, -5791,
+    -2422, -1170,  3636,  -334, -5012,  4043, -5191, -2396,
+     1207,  -726,  1689,  3637,  3066,  3328, -2969, -5331,
+      875,  1062, -2166, -3289,   390, -1212, -3985,  5767,
+    -5444, -2366,  4895,  3694,   242,  -563,  2884, -1022,
+     2987,  5086,  1777, -4388,  -354,   722, -3000,  -130,
+      404, -2768,  2174,  5911,  4885, -5728,  2865, -4177,
+     4284,  3135,  4437, -5092,  2401,  3504,  5559,   118,
+    -4337,  1000, -4053, -4231,  5019, -4821,  2126,  2468,
+    -2187,  -955, -2704, -1428, -1045, -1479, -2399,  3296,
+    -1168, -1853,  4057,  5542,  3763,  1351, -2686, -1673,
+     1607, -4805, -4919,   729, -3778, -3195,   476, -3748,
+      493,  4896, -5195, -3707,  4714,  2744,  2249,  2842,
+     3646, -3201,  4654, -4632,  5698,  5736,  -243, -2837,
+     1065, -4255, -2847,  3932, -1632,  5828,  5332,  2525,
+    -5011, -4846,  3149,  2881,  1067,  2545,  1544,  2197,
+    -1912,    81,  5042,  -355, -2678,   949, -5407,   544,
+    -6039,  2319, -4938, -2426, -2481, -5146,  3136, -4452,
+     3248, -4611,  3364, -3459,   -27, -5777, -3978,  4989,
+     3780, -2294,  3915,  2013,  -773,  1646,  4905,   827,
+    -2381,  3051,  1484, -5179,  1537,  2975,  1153,     9,
+     6022,  1326, -1663, -1260,  4861, -1305,  -671,  4354,
+    -4645, -1635, -4372,  4890, -1017, -4591, -2370,  3584,
+    -5088,  3712,    -3,  2089,  -442, -3542,   420,  2476,
+      435,  4320,  2645, -2548,   545, -2639, -1630,   339,
+    -2566,   790, -5291,  1696,  2859,     1,  3400, -3949,
+     5277,  -140,  3271,  -145, -1440, -4978, -3247, -4278,
+     4976, -3553,  -113, -3241,  3833,  5860,  3531,  -953,
+};
+
+const int16_t ntt_red512_omega_powers_rev[512] = {
+        0, -4096, -4096,   493, -4096,   493, -5444, -2381,
+    -4096,   493, -5444, -2381,  1378, -1912, -4337,   435,
+    -4096,   493, -5444, -2381,  1378, -1912, -4337,   435,
+    -2143,  1065,   404, -4645,  1207,  3248, -1168,  5277,
+    -4096,   493, -5444, -2381,  1378, -1912, -4337,   435,
+    -2143,  1065,   404, -4645,  1207,  3248, -1168,  5277,
+     2437,  3646,  2987,  6022, -2422, -6039, -2187, -2566,
+     1002, -5011,  4284, -5088,   875,  3780,  1607,  4976,
+    -4096,   493, -5444, -2381,  1378, -1912, -4337,   435,
+    -2143,  1065,   404, -4645,  1207,  3248, -1168,  5277,
+     2437,  3646,  2987,  6022, -2422, -6039, -2187, -2566,
+     1002, -5011,  4284, -5088,   875,  3780,  1607,  4976,
+    -4143,  4714,   242,  1537,  3704, -2678,  5019,   545,
+     5084, -1632,  4885, -1017,  3066,   -27,  3763, -1440,
+     2912,  5698,  -354,  4861, -5012, -2481, -1045,  2859,
+    -5101,  1067,  2401,  -442,   390,  -773, -3778,  3833,
+    -4096,   493, -5444, -2381,  1378, -1912, -4337,   435,
+    -2143,  1065,   404, -4645,  1207,  3248, -1168,  5277,
+     2437,  3646,  2987,  6022, -2422, -6039, -2187, -2566,
+     1002, -5011,  4284, -5088,   875,  3780,  1607,  4976,
+    -4143,  4714,   242,  1537,  3704, -2678,  5019,   545,
+     5084, -1632,  4885, -1017,  3066,   -27,  3763, -1440,
+     2912,  5698,  -354,  4861, -5012, -2481, -1045,  2859,
+    -5101,  1067,  2401,  -442,   390,  -773, -3778,  3833,
+     2780, -5195,  4895,  1484,  2305,  5042, -4053,  2645,
+    -4414, -2847,  2174, -4372,  1689,  3364,  4057,  3271,
+    -1426,  4654,  1777, -1663,  3636, -4938, -2704, -5291,
+      160,  3149,  4437,    -3, -2166,  3915, -4919,  -113,
+     4048,  2249,  2884,  1153, -3186, -5407,  2126, -1630,
+     3510,  5332,  2865, -2370, -2969, -3978, -2686, -3247,
+     3016,  -243, -3000,  -671, -5191,  3136, -2399,  3400,
+     2178,  1544,  5559,   420, -3985,  4905,   476,  3531,
+    -4096,   493, -5444, -2381,  1378, -1912, -4337,   435,
+    -2143,  1065,   404, -4645,  1207,  3248, -1168,  5277,
+     2437,  3646,  2987,  6022, -2422, -6039, -2187, -2566,
+     1002, -5011,  4284, -5088,   875,  3780,  1607,  4976,
+    -4143,  4714,   242,  1537,  3704, -2678,  5019,   545,
+     5084, -1632,  4885, -1017,  3066,   -27,  3763, -1440,
+     2912,  5698,  -354,  4861, -5012, -2481, -1045,  2859,
+    -5101,  1067,  2401,  -442,   390,  -773, -3778,  3833,
+     2780, -5195,  4895,  1484,  2305,  5042, -4053,  2645,
+    -4414, -2847,  2174, -4372,  1689,  3364,  4057,  3271,
+    -1426,  4654,  1777, -1663,  3636, -4938, -2704, -5291,
+      160,  3149,  4437,    -3, -2166,  3915, -4919,  -113,
+     4048,  2249,  2884,  1153, -3186, -5407,  2126, -1630,
+     3510,  5332,  2865, -2370, -2969, -3978, -2686, -3247,
+     3016,  -243, -3000,  -671, -5191,  3136, -2399,  3400,
+     2178,  1544,  5559,   420, -3985,  4905,   476,  3531,
+    -2963,  4896, -2366,  3051,  3091,    81,  1000,  4320,
+     1177, -4255, -2768, -1635,  -726, -4611, -1853,  -140,
+     3014, -3201,  5086,  1326, -1170,  2319,  -955,   790,
+     2747, -4846,  3135,  3712,  1062, -2294, -4805, -3553,
+    -3006,  2744,  -563,  2975, -2625,   949, -4821, -2639,
+    -5023,  5828, -5728, -4591,  3328, -5777,  1351, -4978,
+    -4134,  5736,   722, -1305,  4043, -5146, -1479,     1,
+    -3621,  2545,  3504, -3542, -1212,  1646, -3195,  5860,
+     1759, -3707,  3694, -5179, -3382,  -355, -4231, -2548,
+    -2731,  3932,  5911,  4890,  3637, -3459,  5542,  -145,
+     5755, -4632, -4388, -1260,  -334, -2426, -1428,  1696,
+     3284,  2881, -5092,  2089, -3289,  2013,   729, -3241,
+     -480,  2842, -1022,     9, -5791,   544,  2468,   339,
+     1381,  2525, -4177,  3584, -5331,  4989, -1673, -4278,
+     5374, -2837,  -130,  4354, -2396, -4452,  3296, -3949,
+    -5067,  2197,   118,  2476,  5767,   827, -3748,  -953,
+};
+
+const int16_t ntt_red512_inv_omega_powers[512] = {
+        0, -4096, -4096,  -493, -4096,  2381,  -493,  5444,
+    -4096,  -435,  2381,  1912,  -493,  4337,  5444, -1378,
+    -4096, -5277,  -435,  4645,  2381, -3248,  1912, -1065,
+     -493,  1168,  4337,  -404,  5444, -1207, -1378,  2143,
+    -4096, -4976, -5277,  2566,  -435,  5088,  4645, -6022,
+     2381, -3780, -3248,  6039,  1912,  5011, -1065, -3646,
+     -493, -1607,  1168,  2187,  4337, -4284,  -404, -2987,
+     5444,  -875, -1207,  2422, -1378, -1002,  2143, -2437,
+    -4096, -3833, -4976,  1440, -5277, -2859,  2566,  -545,
+     -435,   442,  5088,  1017,  4645, -4861, -6022, -1537,
+     2381,   773, -3780,    27, -3248,  2481,  6039,  2678,
+     1912, -1067,  5011,  1632, -1065, -5698, -3646, -4714,
+     -493,  3778, -1607, -3763,  1168,  1045,  2187, -5019,
+     4337, -2401, -4284, -4885,  -404,   354, -2987,  -242,
+     5444,  -390,  -875, -3066, -1207,  5012,  2422, -3704,
+    -1378,  5101, -1002, -5084,  2143, -2912, -2437,  4143,
+    -4096, -3531, -3833,   113, -4976,  3247,  1440, -3271,
+    -5277, -3400, -2859,  5291,  2566,  1630,  -545, -2645,
+     -435,  -420,   442,     3,  5088,  2370,  1017,  4372,
+     4645,   671, -4861,  1663, -6022, -1153, -1537, -1484,
+     2381, -4905,   773, -3915, -3780,  3978,    27, -3364,
+    -3248, -3136,  2481,  4938,  6039,  5407,  2678, -5042,
+     1912, -1544, -1067, -3149,  5011, -5332,  1632,  2847,
+    -1065,   243, -5698, -4654, -3646, -2249, -4714,  5195,
+     -493,  -476,  3778,  4919, -1607,  2686, -3763, -4057,
+     1168,  2399,  1045,  2704,  2187, -2126, -5019,  4053,
+     4337, -5559, -2401, -4437, -4284, -2865, -4885, -2174,
+     -404,  3000,   354, -1777, -2987, -2884,  -242, -4895,
+     5444,  3985,  -390,  2166,  -875,  2969, -3066, -1689,
+    -1207,  5191,  5012, -3636,  2422,  3186, -3704, -2305,
+    -1378, -2178,  5101,  -160, -1002, -3510, -5084,  4414,
+     2143, -3016, -2912,  1426, -2437, -4048,  4143, -2780,
+    -4096,   953, -3531, -5860, -3833,  3241,   113,  3553,
+    -4976,  4278,  3247,  4978,  1440,   145, -3271,   140,
+    -5277,  3949, -3400,    -1, -2859, -1696,  5291,  -790,
+     2566,  -339,  1630,  2639,  -545,  2548, -2645, -4320,
+     -435, -2476,  -420,  3542,   442, -2089,     3, -3712,
+     5088, -3584,  2370,  4591,  1017, -4890,  4372,  1635,
+     4645, -4354,   671,  1305, -4861,  1260,  1663, -1326,
+    -6022,    -9, -1153, -2975, -1537,  5179, -1484, -3051,
+     2381,  -827, -4905, -1646,   773, -2013, -3915,  2294,
+    -3780, -4989,  3978,  5777,    27,  3459, -3364,  4611,
+    -3248,  4452, -3136,  5146,  2481,  2426,  4938, -2319,
+     6039,  -544,  5407,  -949,  2678,   355, -5042,   -81,
+     1912, -2197, -1544, -2545, -1067, -2881, -3149,  4846,
+     5011, -2525, -5332, -5828,  1632, -3932,  2847,  4255,
+    -1065,  2837,   243, -5736, -5698,  4632, -4654,  3201,
+    -3646, -2842, -2249, -2744, -4714,  3707,  5195, -4896,
+     -493,  3748,  -476,  3195,  3778,  -729,  4919,  4805,
+    -1607,  1673,  2686, -1351, -3763, -5542, -4057,  1853,
+     1168, -3296,  2399,  1479,  1045,  1428,  2704,   955,
+     2187, -2468, -2126,  4821, -5019,  4231,  4053, -1000,
+     4337,  -118, -5559, -3504, -2401,  5092, -4437, -3135,
+    -4284,  4177, -2865,  5728, -4885, -5911, -2174,  2768,
+     -404,   130,  3000,  -722,   354,  4388, -1777, -5086,
+    -2987,  1022, -2884,   563,  -242, -3694, -4895,  2366,
+     5444, -5767,  3985,  1212,  -390,  3289,  2166, -1062,
+     -875,  5331,  2969, -3328, -3066, -3637, -1689,   726,
+    -1207,  2396,  5191, -4043,  5012,   334, -3636,  1170,
+     2422,  5791,  3186,  2625, -3704,  3382, -2305, -3091,
+    -1378,  5067, -2178,  3621,  5101, -3284,  -160, -2747,
+    -1002, -1381, -3510,  5023, -5084,  2731,  4414, -1177,
+     2143, -5374, -3016,  4134, -2912, -5755,  1426, -3014,
+    -2437,   480, -4048,  3006,  4143, -1759, -2780,  2963,
+};
+
+const int16_t ntt_red512_inv_omega_powers_rev[512] = {
+        0, -4096, -4096,  -493, -4096,  -493,  2381,  5444,
+    -4096,  -493,  2381,  5444,  -435,  4337,  1912, -1378,
+    -4096,  -493,  2381,  5444,  -435,  4337,  1912, -1378,
+    -5277,  1168, -3248, -1207,  4645,  -404, -1065,  2143,
+    -4096,  -493,  2381,  5444,  -435,  4337,  1912, -1378,
+    -5277,  1168, -3248, -1207,  4645,  -404, -1065,  2143,
+    -4976, -1607, -3780,  -875,  5088, -4284,  5011, -1002,
+     2566,  2187,  6039,  2422, -6022, -2987, -3646, -2437,
+    -4096,  -493,  2381,  5444,  -435,  4337,  1912, -1378,
+    -5277,  1168, -3248, -1207,  4645,  -404, -1065,  2143,
+    -4976, -1607, -3780,  -875,  5088, -4284,  5011, -1002,
+     2566,  2187,  6039,  2422, -6022, -2987, -3646, -2437,
+    -3833,  3778,   773,  -390,   442, -2401, -1067,  5101,
+    -2859,  1045,  2481,  5012, -4861,   354, -5698, -2912,
+     1440, -3763,    27, -3066,  1017, -4885,  1632, -5084,
+     -545, -5019,  2678, -3704, -1537,  -242, -4714,  4143,
+    -4096,  -493,  2381,  5444,  -435,  4337,  1912, -1378,
+    -5277,  1168, -3248, -1207,  4645,  -404, -1065,  2143,
+    -4976, -1607, -3780,  -875,  5088, -4284,  5011, -1002,
+     2566,  2187,  6039,  2422, -6022, -2987, -3646, -2437,
+    -3833,  3778,   773,  -390,   442, -2401, -1067,  5101,
+    -2859,  1045,  2481,  5012, -4861,   354, -5698, -2912,
+     1440, -3763,    27, -3066,  1017, -4885,  1632, -5084,
+     -545, -5019,  2678, -3704, -1537,  -242, -4714,  4143,
+    -3531,  -476, -4905,  3985,  -420, -5559, -1544, -2178,
+    -3400,  2399, -3136,  5191,   671,  3000,   243, -3016,
+     3247,  2686,  3978,  2969,  2370, -2865, -5332, -3510,
+     1630, -2126,  5407,  3186, -1153, -2884, -2249, -4048,
+      113,  4919, -3915,  2166,     3, -4437, -3149,  -160,
+     5291,  2704,  4938, -3636,  1663, -1777, -4654,  1426,
+    -3271, -4057, -3364, -1689,  4372, -2174,  2847,  4414,
+    -2645,  4053, -5042, -2305, -1484, -4895,  5195, -2780,
+    -4096,  -493,  2381,  5444,  -435,  4337,  1912, -1378,
+    -5277,  1168, -3248, -1207,  4645,  -404, -1065,  2143,
+    -4976, -1607, -3780,  -875,  5088, -4284,  5011, -1002,
+     2566,  2187,  6039,  2422, -6022, -2987, -3646, -2437,
+    -3833,  3778,   773,  -390,   442, -2401, -1067,  5101,
+    -2859,  1045,  2481,  5012, -4861,   354, -5698, -2912,
+     1440, -3763,    27, -3066,  1017, -4885,  1632, -5084,
+     -545, -5019,  2678, -3704, -1537,  -242, -4714,  4143,
+    -3531,  -476, -4905,  3985,  -420, -5559, -1544, -2178,
+    -3400,  2399, -3136,  5191,   671,  3000,   243, -3016,
+     3247,  2686,  3978,  2969,  2370, -2865, -5332, -3510,
+     1630, -2126,  5407,  3186, -1153, -2884, -2249, -4048,
+      113,  4919, -3915,  2166,     3, -4437, -3149,  -160,
+     5291,  2704,  4938, -3636,  1663, -1777, -4654,  1426,
+    -3271, -4057, -3364, -1689,  4372, -2174,  2847,  4414,
+    -2645,  4053, -5042, -2305, -1484, -4895,  5195, -2780,
+      953,  3748,  -827, -5767, -2476,  -118, -2197,  5067,
+     3949, -3296,  4452,  2396, -4354,   130,  2837, -5374,
+     4278,  1673, -4989,  5331, -3584,  4177, -2525, -1381,
+     -339, -2468,  -544,  5791,    -9,  1022, -2842,   480,
+     3241,  -729, -2013,  3289, -2089,  5092, -2881, -3284,
+    -1696,  1428,  2426,   334,  1260,  4388,  4632, -5755,
+      145, -5542,  3459, -3637, -4890, -5911, -3932,  2731,
+     2548,  4231,   355,  3382,  5179, -3694,  3707, -1759,
+    -5860,  3195, -1646,  1212,  3542, -3504, -2545,  3621,
+       -1,  1479,  5146, -4043,  1305,  -722, -5736,  4134,
+     4978, -1351,  5777, -3328,  4591,  5728, -5828,  5023,
+     2639,  4821,  -949,  2625, -2975,   563, -2744,  3006,
+     3553,  4805,  2294, -1062, -3712, -3135,  4846, -2747,
+     -790,   955, -2319,  1170, -1326, -5086,  3201, -3014,
+      140,  1853,  4611,   726,  1635,  2768,  4255, -1177,
+    -4320, -1000,   -81, -3091, -3051,  2366, -4896,  2963,
+};
+
+const int16_t ntt_red512_mixed_powers[512] = {
+        0,   493, -5444, -2381,  1378, -4337, -1912,   435,
+    -2143,  1207,   404, -1168,  1065,  3248, -4645,  5277,
+     2437,  1002, -2422,   875,  2987,  4284, -2187,  1607,
+     3646, -5011, -6039,  3780,  6022, -5088, -2566,  4976,
+    -4143,  2912,  5084, -5101,  3704, -5012,  3066,   390,
+      242,  -354,  4885,  2401,  5019, -1045,  3763, -3778,
+     4714,  5698, -1632,  1067, -2678, -2481,   -27,  -773,
+     1537,  4861, -1017,  -442,   545,  2859, -1440,  3833,
+     2780,  4048, -1426,  3016, -4414,  3510,   160,  2178,
+     2305, -3186,  3636, -5191,  1689, -2969, -2166, -3985,
+     4895,  2884,  1777, -3000,  2174,  2865,  4437,  5559,
+    -4053,  2126, -2704, -2399,  4057, -2686, -4919,   476,
+    -5195,  2249,  4654,  -243, -2847,  5332,  3149,  1544,
+     5042, -5407, -4938,  3136,  3364, -3978,  3915,  4905,
+     1484,  1153, -1663,  -671, -4372, -2370,    -3,   420,
+     2645, -1630, -5291,  3400,  3271, -3247,  -113,  3531,
+    -2963,  1759, -3006,  -480,  3014,  5755, -4134,  5374,
+     1177, -2731, -5023,  1381,  2747,  3284, -3621, -5067,
+     3091, -3382, -2625, -5791, -1170,  -334,  4043, -2396,
+     -726,  3637,  3328, -5331,  1062, -3289, -1212,  5767,
+    -2366,  3694,  -563, -1022,  5086, -4388,   722,  -130,
+    -2768,  5911, -5728, -4177,  3135, -5092,  3504,   118,
+     1000, -4231, -4821,  2468,  -955, -1428, -1479,  3296,
+    -1853,  5542,  1351, -1673, -4805,   729, -3195, -3748,
+     4896, -3707,  2744,  2842, -3201, -4632,  5736, -2837,
+    -4255,  3932,  5828,  2525, -4846,  2881,  2545,  2197,
+       81,  -355,   949,   544,  2319, -2426, -5146, -4452,
+    -4611, -3459, -5777,  4989, -2294,  2013,  1646,   827,
+     3051, -5179,  2975,     9,  1326, -1260, -1305,  4354,
+    -1635,  4890, -4591,  3584,  3712,  2089, -3542,  2476,
+     4320, -2548, -2639,   339,   790,  1696,     1, -3949,
+     -140,  -145, -4978, -4278, -3553, -3241,  5860,  -953,
+     3434,  1050, -6099, -5057, -1489,   468,  5919, -4782,
+     -453, -4075, -5297,  5874,  1975,  5206,  4240,  1003,
+    -6142, -3789, -3728, -5241,  -350,  2033,  5782, -3600,
+     -156, -1973,  1594,   151, -2738,  5862, -1958,  3438,
+     2361,  2683,  3762, -2049,  1263,  5339,  1747,  4213,
+    -4774,  2169,  1200,    52,  4754,  3565,  4046,  5009,
+    -1954,  4749, -1146,  -787,  3202, -1254,   683,  -421,
+    -5876,  3514,  2692, -2505,  -723,  -400,  4079, -5681,
+     2908, -5445, -5766, -3445, -1583,   382, -3834,  3029,
+      418, -4324, -3956,  6055,  2925,  3199,   835,   241,
+    -3963, -5456,  5990,  3127,  1815,  1922, -2948,  4624,
+     3969,  1278, -5106,  3957, -2655,  5415,  2078,  -975,
+     3030,  3818,  4016,  1321,  5915, -6093,  3054,  -605,
+    -4737,  5079,  2555, -1323,  -426,  1702, -1319,   885,
+    -1805, -4789,   325, -1010, -5369, -5435,  3656, -6068,
+     2031, -1018,  4298,  1579, -1693, -4948,   441,   142,
+     3529,  4536,  -295,  4698, -2500,  3988,  4433,  5886,
+     5908, -5315,  6119,  -677, -3757, -5529,  3570, -3532,
+    -2447,  -147,  4049,  2920, -1512, -3998, -1566, -3263,
+     2767, -5574, -1962,  2127,  5868, -6136,  4322, -2844,
+     1843, -1190, -2919,  4912,    49, -5446,  3123,   504,
+     5429,   522,  5184,  3174,  1858,   654,  -709, -1956,
+    -2051, -5537,   948,  3482,  4493,   973,  2459,  4080,
+    -2281, -1041,  -168, -5906,  -174, -1728, -1058,  3477,
+     -218, -3860,   652,  4780,  5942,  -316, -5257, -5594,
+     3772, -4916, -1360, -3336,   347,    56,  6065,    58,
+      576,  4449, -1159,  4169,  5383,  3879,  2503, -6077,
+    -3991, -2344,  5961,  2839,  5735, -3643,  1112, -4212,
+    -4115, -6118,  4077,  -192, -1483, -3710, -5486,  2302,
+    -1293,  3262,  6122, -2766, -3315, -1987,  3150, -6008,
+    -2882, -4467,  1404,  5468, -2057, -1359,    64, -3602,
+     5333,  5925,  3329,   431,  3009, -6137,   922,  1105,
+};
+
+const int16_t ntt_red512_mixed_powers_rev[512] = {
+        0,   493, -5444, -2381,  1378, -1912, -4337,   435,
+    -2143,  1065,   404, -4645,  1207,  3248, -1168,  5277,
+     2437,  3646,  2987,  6022, -2422, -6039, -2187, -2566,
+     1002, -5011,  4284, -5088,   875,  3780,  1607,  4976,
+    -4143,  4714,   242,  1537,  3704, -2678,  5019,   545,
+     5084, -1632,  4885, -1017,  3066,   -27,  3763, -1440,
+     2912,  5698,  -354,  4861, -5012, -2481, -1045,  2859,
+    -5101,  1067,  2401,  -442,   390,  -773, -3778,  3833,
+     2780, -5195,  4895,  1484,  2305,  5042, -4053,  2645,
+    -4414, -2847,  2174, -4372,  1689,  3364,  4057,  3271,
+    -1426,  4654,  1777, -1663,  3636, -4938, -2704, -5291,
+      160,  3149,  4437,    -3, -2166,  3915, -4919,  -113,
+     4048,  2249,  2884,  1153, -3186, -5407,  2126, -1630,
+     3510,  5332,  2865, -2370, -2969, -3978, -2686, -3247,
+     3016,  -243, -3000,  -671, -5191,  3136, -2399,  3400,
+     2178,  1544,  5559,   420, -3985,  4905,   476,  3531,
+    -2963,  4896, -2366,  3051,  3091,    81,  1000,  4320,
+     1177, -4255, -2768, -1635,  -726, -4611, -1853,  -140,
+     3014, -3201,  5086,  1326, -1170,  2319,  -955,   790,
+     2747, -4846,  3135,  3712,  1062, -2294, -4805, -3553,
+    -3006,  2744,  -563,  2975, -2625,   949, -4821, -2639,
+    -5023,  5828, -5728, -4591,  3328, -5777,  1351, -4978,
+    -4134,  5736,   722, -1305,  4043, -5146, -1479,     1,
+    -3621,  2545,  3504, -3542, -1212,  1646, -3195,  5860,
+     1759, -3707,  3694, -5179, -3382,  -355, -4231, -2548,
+    -2731,  3932,  5911,  4890,  3637, -3459,  5542,  -145,
+     5755, -4632, -4388, -1260,  -334, -2426, -1428,  1696,
+     3284,  2881, -5092,  2089, -3289,  2013,   729, -3241,
+     -480,  2842, -1022,     9, -5791,   544,  2468,   339,
+     1381,  2525, -4177,  3584, -5331,  4989, -1673, -4278,
+     5374, -2837,  -130,  4354, -2396, -4452,  3296, -3949,
+    -5067,  2197,   118,  2476,  5767,   827, -3748,  -953,
+     3434,  3529,  2908,  -218,  2361,  1843,  3030, -4115,
+    -6142, -2447, -3963,   576, -1954, -2051, -1805, -2882,
+     -453,  5908,   418,  3772, -4774,  5429, -4737, -1293,
+     -156,  2767,  3969, -3991, -5876, -2281,  2031,  5333,
+    -1489, -2500, -1583,  5942,  1263,    49,  5915, -1483,
+     -350, -1512,  1815,  5383,  3202,  4493, -5369, -2057,
+     1975, -3757,  2925,   347,  4754,  1858,  -426, -3315,
+    -2738,  5868, -2655,  5735,  -723,  -174, -1693,  3009,
+    -6099,  -295, -5766,   652,  3762, -2919,  4016,  4077,
+    -3728,  4049,  5990, -1159, -1146,   948,   325,  1404,
+    -5297,  6119, -3956, -1360,  1200,  5184,  2555,  6122,
+     1594, -1962, -5106,  5961,  2692,  -168,  4298,  3329,
+     5919,  4433, -3834, -5257,  1747,  3123,  3054, -5486,
+     5782, -1566, -2948,  2503,   683,  2459,  3656,    64,
+     4240,  3570,   835,  6065,  4046,  -709, -1319,  3150,
+    -1958,  4322,  2078,  1112,  4079, -1058,   441,   922,
+     1050,  4536, -5445, -3860,  2683, -1190,  3818, -6118,
+    -3789,  -147, -5456,  4449,  4749, -5537, -4789, -4467,
+    -4075, -5315, -4324, -4916,  2169,   522,  5079,  3262,
+    -1973, -5574,  1278, -2344,  3514, -1041, -1018,  5925,
+      468,  3988,   382,  -316,  5339, -5446, -6093, -3710,
+     2033, -3998,  1922,  3879, -1254,   973, -5435, -1359,
+     5206, -5529,  3199,    56,  3565,   654,  1702, -1987,
+     5862, -6136,  5415, -3643,  -400, -1728, -4948, -6137,
+    -5057,  4698, -3445,  4780, -2049,  4912,  1321,  -192,
+    -5241,  2920,  3127,  4169,  -787,  3482, -1010,  5468,
+     5874,  -677,  6055, -3336,    52,  3174, -1323, -2766,
+      151,  2127,  3957,  2839, -2505, -5906,  1579,   431,
+    -4782,  5886,  3029, -5594,  4213,   504,  -605,  2302,
+    -3600, -3263,  4624, -6077,  -421,  4080, -6068, -3602,
+     1003, -3532,   241,    58,  5009, -1956,   885, -6008,
+     3438, -2844,  -975, -4212, -5681,  3477,   142,  1105,
+};
+
+const int16_t ntt_red512_inv_mixed_powers[512] = {
+        0,  -493,  2381,  5444,  -435,  1912,  4337, -1378,
+    -5277,  4645, -3248, -1065,  1168,  -404, -1207,  2143,
+    -4976,  2566,  5088, -6022, -3780,  6039,  5011, -3646,
+    -1607,  2187, -4284, -2987,  -875,  2422, -1002, -2437,
+    -3833,  1440, -2859,  -545,   442,  1017, -4861, -1537,
+      773,    27,  2481,  2678, -1067,  1632, -5698, -4714,
+     3778, -3763,  1045, -5019, -2401, -4885,   354,  -242,
+     -390, -3066,  5012, -3704,  5101, -5084, -2912,  4143,
+    -3531,   113,  3247, -3271, -3400,  5291,  1630, -2645,
+     -420,     3,  2370,  4372,   671,  1663, -1153, -1484,
+    -4905, -3915,  3978, -3364, -3136,  4938,  5407, -5042,
+    -1544, -3149, -5332,  2847,   243, -4654, -2249,  5195,
+     -476,  4919,  2686, -4057,  2399,  2704, -2126,  4053,
+    -5559, -4437, -2865, -2174,  3000, -1777, -2884, -4895,
+     3985,  2166,  2969, -1689,  5191, -3636,  3186, -2305,
+    -2178,  -160, -3510,  4414, -3016,  1426, -4048, -2780,
+      953, -5860,  3241,  3553,  4278,  4978,   145,   140,
+     3949,    -1, -1696,  -790,  -339,  2639,  2548, -4320,
+    -2476,  3542, -2089, -3712, -3584,  4591, -4890,  1635,
+    -4354,  1305,  1260, -1326,    -9, -2975,  5179, -3051,
+     -827, -1646, -2013,  2294, -4989,  5777,  3459,  4611,
+     4452,  5146,  2426, -2319,  -544,  -949,   355,   -81,
+    -2197, -2545, -2881,  4846, -2525, -5828, -3932,  4255,
+     2837, -5736,  4632,  3201, -2842, -2744,  3707, -4896,
+     3748,  3195,  -729,  4805,  1673, -1351, -5542,  1853,
+    -3296,  1479,  1428,   955, -2468,  4821,  4231, -1000,
+     -118, -3504,  5092, -3135,  4177,  5728, -5911,  2768,
+      130,  -722,  4388, -5086,  1022,   563, -3694,  2366,
+    -5767,  1212,  3289, -1062,  5331, -3328, -3637,   726,
+     2396, -4043,   334,  1170,  5791,  2625,  3382, -3091,
+     5067,  3621, -3284, -2747, -1381,  5023,  2731, -1177,
+    -5374,  4134, -5755, -3014,   480,  3006, -1759,  2963,
+    -1105,  -922,  6137, -3009,  -431, -3329, -5925, -5333,
+     3602,   -64,  1359,  2057, -5468, -1404,  4467,  2882,
+     6008, -3150,  1987,  3315,  2766, -6122, -3262,  1293,
+    -2302,  5486,  3710,  1483,   192, -4077,  6118,  4115,
+     4212, -1112,  3643, -5735, -2839, -5961,  2344,  3991,
+     6077, -2503, -3879, -5383, -4169,  1159, -4449,  -576,
+      -58, -6065,   -56,  -347,  3336,  1360,  4916, -3772,
+     5594,  5257,   316, -5942, -4780,  -652,  3860,   218,
+    -3477,  1058,  1728,   174,  5906,   168,  1041,  2281,
+    -4080, -2459,  -973, -4493, -3482,  -948,  5537,  2051,
+     1956,   709,  -654, -1858, -3174, -5184,  -522, -5429,
+     -504, -3123,  5446,   -49, -4912,  2919,  1190, -1843,
+     2844, -4322,  6136, -5868, -2127,  1962,  5574, -2767,
+     3263,  1566,  3998,  1512, -2920, -4049,   147,  2447,
+     3532, -3570,  5529,  3757,   677, -6119,  5315, -5908,
+    -5886, -4433, -3988,  2500, -4698,   295, -4536, -3529,
+     -142,  -441,  4948,  1693, -1579, -4298,  1018, -2031,
+     6068, -3656,  5435,  5369,  1010,  -325,  4789,  1805,
+     -885,  1319, -1702,   426,  1323, -2555, -5079,  4737,
+      605, -3054,  6093, -5915, -1321, -4016, -3818, -3030,
+      975, -2078, -5415,  2655, -3957,  5106, -1278, -3969,
+    -4624,  2948, -1922, -1815, -3127, -5990,  5456,  3963,
+     -241,  -835, -3199, -2925, -6055,  3956,  4324,  -418,
+    -3029,  3834,  -382,  1583,  3445,  5766,  5445, -2908,
+     5681, -4079,   400,   723,  2505, -2692, -3514,  5876,
+      421,  -683,  1254, -3202,   787,  1146, -4749,  1954,
+    -5009, -4046, -3565, -4754,   -52, -1200, -2169,  4774,
+    -4213, -1747, -5339, -1263,  2049, -3762, -2683, -2361,
+    -3438,  1958, -5862,  2738,  -151, -1594,  1973,   156,
+     3600, -5782, -2033,   350,  5241,  3728,  3789,  6142,
+    -1003, -4240, -5206, -1975, -5874,  5297,  4075,   453,
+     4782, -5919,  -468,  1489,  5057,  6099, -1050, -3434,
+};
+
+const int16_t ntt_red512_inv_mixed_powers_rev[512] = {
+        0,  -493,  2381,  5444,  -435,  4337,  1912, -1378,
+    -5277,  1168, -3248, -1207,  4645,  -404, -1065,  2143,
+    -4976, -1607, -3780,  -875,  5088, -4284,  5011, -1002,
+     2566,  2187,  6039,  2422, -6022, -2987, -3646, -2437,
+    -3833,  3778,   773,  -390,   442, -2401, -1067,  5101,
+    -2859,  1045,  2481,  5012, -4861,   354, -5698, -2912,
+     1440, -3763,    27, -3066,  1017, -4885,  1632, -5084,
+     -545, -5019,  2678, -3704, -1537,  -242, -4714,  4143,
+    -3531,  -476, -4905,  3985,  -420, -5559, -1544, -2178,
+    -3400,  2399, -3136,  5191,   671,  3000,   243, -3016,
+     3247,  2686,  3978,  2969,  2370, -2865, -5332, -3510,
+     1630, -2126,  5407,  3186, -1153, -2884, -2249, -4048,
+      113,  4919, -3915,  2166,     3, -4437, -3149,  -160,
+     5291,  2704,  4938, -3636,  1663, -1777, -4654,  1426,
+    -3271, -4057, -3364, -1689,  4372, -2174,  2847,  4414,
+    -2645,  4053, -5042, -2305, -1484, -4895,  5195, -2780,
+      953,  3748,  -827, -5767, -2476,  -118, -2197,  5067,
+     3949, -3296,  4452,  2396, -4354,   130,  2837, -5374,
+     4278,  1673, -4989,  5331, -3584,  4177, -2525, -1381,
+     -339, -2468,  -544,  5791,    -9,  1022, -2842,   480,
+     3241,  -729, -2013,  3289, -2089,  5092, -2881, -3284,
+    -1696,  1428,  2426,   334,  1260,  4388,  4632, -5755,
+      145, -5542,  3459, -3637, -4890, -5911, -3932,  2731,
+     2548,  4231,   355,  3382,  5179, -3694,  3707, -1759,
+    -5860,  3195, -1646,  1212,  3542, -3504, -2545,  3621,
+       -1,  1479,  5146, -4043,  1305,  -722, -5736,  4134,
+     4978, -1351,  5777, -3328,  4591,  5728, -5828,  5023,
+     2639,  4821,  -949,  2625, -2975,   563, -2744,  3006,
+     3553,  4805,  2294, -1062, -3712, -3135,  4846, -2747,
+     -790,   955, -2319,  1170, -1326, -5086,  3201, -3014,
+      140,  1853,  4611,   726,  1635,  2768,  4255, -1177,
+    -4320, -1000,   -81, -3091, -3051,  2366, -4896,  2963,
+    -1105,  -142, -3477,  5681,  4212,   975,  2844, -3438,
+     6008,  -885,  1956, -5009,   -58,  -241,  3532, -1003,
+     3602,  6068, -4080,   421,  6077, -4624,  3263,  3600,
+    -2302,   605,  -504, -4213,  5594, -3029, -5886,  4782,
+     -431, -1579,  5906,  2505, -2839, -3957, -2127,  -151,
+     2766,  1323, -3174,   -52,  3336, -6055,   677, -5874,
+    -5468,  1010, -3482,   787, -4169, -3127, -2920,  5241,
+      192, -1321, -4912,  2049, -4780,  3445, -4698,  5057,
+     6137,  4948,  1728,   400,  3643, -5415,  6136, -5862,
+     1987, -1702,  -654, -3565,   -56, -3199,  5529, -5206,
+     1359,  5435,  -973,  1254, -3879, -1922,  3998, -2033,
+     3710,  6093,  5446, -5339,   316,  -382, -3988,  -468,
+    -5925,  1018,  1041, -3514,  2344, -1278,  5574,  1973,
+    -3262, -5079,  -522, -2169,  4916,  4324,  5315,  4075,
+     4467,  4789,  5537, -4749, -4449,  5456,   147,  3789,
+     6118, -3818,  1190, -2683,  3860,  5445, -4536, -1050,
+     -922,  -441,  1058, -4079, -1112, -2078, -4322,  1958,
+    -3150,  1319,   709, -4046, -6065,  -835, -3570, -4240,
+      -64, -3656, -2459,  -683, -2503,  2948,  1566, -5782,
+     5486, -3054, -3123, -1747,  5257,  3834, -4433, -5919,
+    -3329, -4298,   168, -2692, -5961,  5106,  1962, -1594,
+    -6122, -2555, -5184, -1200,  1360,  3956, -6119,  5297,
+    -1404,  -325,  -948,  1146,  1159, -5990, -4049,  3728,
+    -4077, -4016,  2919, -3762,  -652,  5766,   295,  6099,
+    -3009,  1693,   174,   723, -5735,  2655, -5868,  2738,
+     3315,   426, -1858, -4754,  -347, -2925,  3757, -1975,
+     2057,  5369, -4493, -3202, -5383, -1815,  1512,   350,
+     1483, -5915,   -49, -1263, -5942,  1583,  2500,  1489,
+    -5333, -2031,  2281,  5876,  3991, -3969, -2767,   156,
+     1293,  4737, -5429,  4774, -3772,  -418, -5908,   453,
+     2882,  1805,  2051,  1954,  -576,  3963,  2447,  6142,
+     4115, -3030, -1843, -2361,   218, -2908, -3529, -3434,
+};
+
@@ -3,6 +3,24 @@
 
 #include "sampler.h"
 #include "tables.h"
+#include "cdtables.h"
+
+/*
+ * Convert the table c (ell rows of precision/8 bytes, big-endian)
+ * to native 64bit words.
+ */
+static void init_c_words(sampler_t *sampler) {
+  uint32_t i, j;
+  uint64_t w;
+
+  for (i = 0; i < sampler->ell * sampler->words; i++) {
+    w = 0;
+    for (j = 0; j < 8; j++) {
+      w = (w << 8) | sampler->c[8 * i + j];
+    }
+    sampler->c_words[i] = w;
+  }
+}
 
 /*
  * Initialize sampler:
@@ -15,8 +33,14 @@ bool sampler_init(sampler_t *sampler, uint32_t sigma, uint32_t ell, uint32_t pre
   sampler->ell = ell;
   sampler->precision = precision;
   sampler->columns = sampler->precision / 8;
+  sampler->words = sampler->precision / 64;
+  sampler->method = SAMPLER_BERNOULLI;
+  sampler->cdt = get_cdt(sigma, &sampler->cdt_size);
+  sampler->cdt_guide = get_cdt_guide(sigma);
   sampler->c = get_table(sigma, ell, precision);
   if (sampler->c != NULL) {
+    assert(ell <= SAMPLER_MAX_ELL && sampler->words <= SAMPLER_MAX_WORDS);
+    init_c_words(sampler);
     sampler->k_sigma = get_k_sigma(sigma, precision);
     sampler->k_sigma_bits = get_k_sigma_bits(sigma, precision);
     return true;
@@ -25,45 +49,68 @@ bool sampler_init(sampler_t *sampler, uint32_t sigma, uint32_t ell, uint32_t pre
 }
 
 
+bool sampler_set_method(sampler_t *sampler, sampler_method_t method) {
+  assert(sampler != NULL);
+
+  if (method == SAMPLER_CDT && sampler->cdt == NULL) {
+    return false;
+  }
+  sampler->method = method;
+  return true;
+}
+
+
 /*
  * Sampling Bernoulli_c with c a constant in [0, 1]
  * - p = array of bytes (encoding c in big-endian format)
  * - p must have as many bytes as sampler->columns (= precision/8)
  */
 bool sampler_ber(sampler_t *sampler, const uint8_t *p) {
-  uint32_t i;
-  uint8_t uc;
+  uint64_t w[SAMPLER_MAX_WORDS];
+  uint32_t i, j;
 
   assert(sampler != NULL && p != NULL);
+  assert(sampler->words <= SAMPLER_MAX_WORDS);
 
-  for(i = 0; i < sampler->columns; i++) {
-    uc = entropy_random_uint8(sampler->entropy);
-    if (uc < p[i]) return true;
-    if (uc > p[i]) return false;
+  for (i = 0; i < sampler->words; i++) {
+    w[i] = 0;
+    for (j = 0; j < 8; j++) {
+      w[i] = (w[i] << 8) | p[8 * i + j];
+    }
   }
-  return true; // default value
+  return entropy_random_below(sampler->entropy, w, sampler->words);
+}
+
+// index of the most significant bit of x (x must be non-zero)
+#if defined(__GNUC__)
+#define highest_bit(x) (31 - (uint32_t) __builtin_clz(x))
+#else
+static inline uint32_t highest_bit(uint32_t x) {
+  uint32_t i;
+
+  for (i = 0; x > 1; i++) x >>= 1;
+  return i;
 }
+#endif
 
 /*
  * Sampling Bernoulli_E with E = exp(-x/(2*sigma*sigma)).
  * Algorithm 8 from DDLL
+ *
+ * We iterate over the bits of x that are set, starting from the
+ * most significant one. Each Bernoulli trial compares 64bit words
+ * of the table with random bits (see entropy_random_below).
  */
 bool sampler_ber_exp(sampler_t* sampler, uint32_t x) {
-  const uint8_t* row;
-  uint32_t mask;
   uint32_t ri;
-  bool bit;
 
-  ri = sampler->ell - 1;
-  mask = 1u << ri;
-  row = sampler->c + (ri * sampler->columns);
-  while (mask > 0) {
-    if (x & mask) {
-      bit = sampler_ber(sampler, row);
-      if(!bit) return false;
+  x &= (1u << sampler->ell) - 1;
+  while (x != 0) {
+    ri = highest_bit(x);
+    if (!entropy_random_below(sampler->entropy, sampler->c_words + ri * sampler->words, sampler->words)) {
+      return false;
     }
-    mask >>= 1;
-    row -= sampler->columns;
+    x ^= 1u << ri;
   }
 
   return true;
@@ -163,6 +210,10 @@ int32_t sampler_gauss(sampler_t *sampler) {
   uint32_t u, e, x, y;
   int32_t val_pos;
 
+  if (sampler->method == SAMPLER_CDT) {
+    return sampler_gauss_CDT(sampler);
+  }
+
   while (true) {
     x = sampler_pos_binary(sampler);
 
@@ -185,9 +236,32 @@ int32_t sampler_gauss(sampler_t *sampler) {
 }
 
 
-#if 0
+/*
+ * Index of the first entry of the table that's larger than r
+ * (or cdt_size if r is larger than all entries).
+ *
+ * The guide table gives the range where to search: if j = r >> 56
+ * then the index is between guide[j] and guide[j+1].
+ */
+static inline uint32_t cdt_search(const sampler_t *sampler, uint64_t r) {
+  const uint64_t *cdt;
+  uint32_t j, lo, hi, mid;
+
+  cdt = sampler->cdt;
+  j = (uint32_t) (r >> 56);
+  lo = sampler->cdt_guide[j];
+  hi = sampler->cdt_guide[j + 1];
+  while (lo < hi) {
+    mid = (lo + hi) >> 1;
+    if (r < cdt[mid]) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
 
-// TO BE DONE
+  return lo;
+}
 
 /* 
  * Sampling the Gaussian distribution exp(-x^2/(2*sigma*sigma)) using a cumulative distribution table
@@ -195,8 +269,95 @@ int32_t sampler_gauss(sampler_t *sampler) {
  * returns the sampled value.
  */
 int32_t sampler_gauss_CDT(sampler_t *sampler) {
-  assert(0);
-  return 0;
+  int32_t x;
+
+  assert(sampler != NULL && sampler->cdt != NULL);
+
+  x = (int32_t) cdt_search(sampler, entropy_random_uint64(sampler->entropy));
+  if (x != 0 && entropy_random_bit(sampler->entropy)) {
+    x = -x;
+  }
+
+  return x;
 }
 
-#endif
+/*
+ * Batch version: the signs are taken from 64bit random words
+ */
+static void sampler_gauss_CDT_n(sampler_t *sampler, int32_t *out, uint32_t n) {
+  uint64_t signs;
+  uint32_t i;
+  int32_t x;
+
+  assert(sampler->cdt != NULL);
+
+  signs = 0;
+  for (i = 0; i < n; i++) {
+    if ((i & 63) == 0) {
+      signs = entropy_random_uint64(sampler->entropy);
+    }
+    x = (int32_t) cdt_search(sampler, entropy_random_uint64(sampler->entropy));
+    out[i] = (signs & 1) ? -x : x;
+    signs >>= 1;
+  }
+}
+
+
+/*
+ * Batch version of sampler_gauss: store n independent samples in out.
+ *
+ * We work on blocks of at most GAUSS_BATCH candidates. All the (x, y)
+ * pairs of a block are sampled first, then the exponents, then the
+ * signs are taken from a single 64bit random word, then the Bernoulli
+ * rejection step runs over the block. The accepted samples are stored
+ * contiguously in out, and the next block replaces the rejected ones.
+ */
+#define GAUSS_BATCH 64
+
+void sampler_gauss_n(sampler_t *sampler, int32_t *out, uint32_t n) {
+  uint32_t x[GAUSS_BATCH], y[GAUSS_BATCH], e[GAUSS_BATCH];
+  uint64_t signs;
+  uint32_t i, k, m, u, r, k_sigma, k_sigma_bits;
+  int32_t val_pos;
+
+  assert(sampler != NULL && out != NULL);
+
+  if (sampler->method == SAMPLER_CDT) {
+    sampler_gauss_CDT_n(sampler, out, n);
+    return;
+  }
+
+  k_sigma = sampler->k_sigma;
+  k_sigma_bits = sampler->k_sigma_bits;
+
+  while (n > 0) {
+    k = n < GAUSS_BATCH ? n : GAUSS_BATCH;
+
+    for (i = 0; i < k; i++) {
+      x[i] = sampler_pos_binary(sampler);
+    }
+    for (i = 0; i < k; i++) {
+      do {
+        r = entropy_random_bits(sampler->entropy, k_sigma_bits);
+      } while (r >= k_sigma);
+      y[i] = r;
+    }
+    for (i = 0; i < k; i++) {
+      e[i] = y[i] * (y[i] + 2u * k_sigma * x[i]);
+    }
+    signs = entropy_random_uint64(sampler->entropy);
+
+    m = 0;
+    for (i = 0; i < k; i++) {
+      u = (uint32_t) (signs >> i) & 1;
+      // same acceptance test as sampler_gauss
+      if ((x[i] | y[i] | u) && sampler_ber_exp(sampler, e[i])) {
+        val_pos = (int32_t)(k_sigma * x[i] + y[i]);
+        out[m++] = u ? val_pos : - val_pos;
+      }
+    }
+
+    out += m;
+    n -= m;
+  }
+}
@@ -0,0 +1,115 @@
+/*
+ * Gaussian sampling throughput: n calls to sampler_gauss vs.
+ * one call to sampler_gauss_n, for the sigma of each kind, with
+ * the Bernoulli sampler and with the CDT sampler.
+ * Also prints the empirical variance of both samples divided by
+ * sigma^2 (which should be close to 1).
+ *
+ * Usage: speed_sampler [iterations]
+ */
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include "bliss_b_params.h"
+#include "entropy.h"
+#include "sampler.h"
+
+#include "tests.h"
+
+// hard-coded seed for testing
+static uint8_t seed[SHA3_512_DIGEST_LENGTH] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7
+};
+
+static entropy_t entropy;
+
+static sampler_t sampler;
+
+static int32_t samples[512];
+
+static double elapsed_us(struct timeval *start, struct timeval *end) {
+  return (double) ((end->tv_sec * 1000000 + end->tv_usec) - (start->tv_sec * 1000000 + start->tv_usec));
+}
+
+static double sum_squares(const int32_t *v, uint32_t n) {
+  double s;
+  uint32_t i;
+
+  s = 0.0;
+  for (i = 0; i < n; i++) {
+    s += (double) v[i] * v[i];
+  }
+  return s;
+}
+
+int main(int argc, char* argv[]) {
+  bliss_param_t p;
+  int32_t type, count, iterations;
+  uint32_t i;
+  double t_scalar, t_batch, s_scalar, s_batch, total, sigma2;
+  sampler_method_t method;
+  struct timeval t_start, t_end;
+
+  iterations = 2000;
+  if (argc > 1) {
+    iterations = atoi(argv[1]);
+    if (iterations <= 0) {
+      fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  entropy_init(&entropy, seed);
+
+  for (type = BLISS_B_0; type <= BLISS_B_4; type++) {
+    bliss_params_init(&p, type);
+    if (!sampler_init(&sampler, p.sigma, p.ell, p.precision, &entropy)) {
+      fprintf(stderr, "sampler_init failed: type = %d\n", type);
+      return 1;
+    }
+
+    for (method = SAMPLER_BERNOULLI; method <= SAMPLER_CDT; method++) {
+      if (!sampler_set_method(&sampler, method)) {
+        fprintf(stderr, "sampler_set_method failed: type = %d\n", type);
+        return 1;
+      }
+
+      // scalar: n calls to sampler_gauss
+      s_scalar = 0.0;
+      gettimeofday(&t_start, NULL);
+      for (count = 0; count < iterations; count++) {
+        for (i = 0; i < p.n; i++) {
+          samples[i] = sampler_gauss(&sampler);
+        }
+        s_scalar += sum_squares(samples, p.n);
+      }
+      gettimeofday(&t_end, NULL);
+      t_scalar = elapsed_us(&t_start, &t_end);
+
+      // batch: one call to sampler_gauss_n
+      s_batch = 0.0;
+      gettimeofday(&t_start, NULL);
+      for (count = 0; count < iterations; count++) {
+        sampler_gauss_n(&sampler, samples, p.n);
+        s_batch += sum_squares(samples, p.n);
+      }
+      gettimeofday(&t_end, NULL);
+      t_batch = elapsed_us(&t_start, &t_end);
+
+      total = (double) iterations * p.n;
+      sigma2 = (double) p.sigma * p.sigma;
+      fprintf(stdout, "bliss_b type = %d (sigma = %"PRIu32", %s): sampler_gauss %.2f Msamples/sec (var/sigma^2 %.4f), "
+              "sampler_gauss_n %.2f Msamples/sec (var/sigma^2 %.4f)\n",
+              type, p.sigma, method == SAMPLER_CDT ? "cdt" : "bernoulli", total / t_scalar, s_scalar / (total * sigma2), total / t_batch, s_batch / (total * sigma2));
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Scaling of bliss_b_sign_batch: sign the same batch of messages with
+ * 1, 2, ... N threads, check the signatures, and report the throughput
+ * and the speedup relative to one thread.
+ *
+ * Usage: speed_sign_batch [messages] [max threads]
+ * (max threads defaults to the number of processors)
+ */
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bliss_b_errors.h"
+#include "bliss_b_keys.h"
+#include "bliss_b_signatures.h"
+#include "entropy.h"
+
+#include "tests.h"
+
+// hard-coded seed for testing
+static uint8_t seed[SHA3_512_DIGEST_LENGTH] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7
+};
+
+static entropy_t entropy;
+
+static bliss_private_key_t private_key;
+
+static bliss_public_key_t public_key;
+
+static double elapsed_us(struct timeval *start, struct timeval *end) {
+  return (double) ((end->tv_sec * 1000000 + end->tv_usec) - (start->tv_sec * 1000000 + start->tv_usec));
+}
+
+int main(int argc, char* argv[]) {
+  uint8_t (*buffers)[32];
+  const uint8_t **msgs;
+  size_t *lens;
+  bliss_signature_t *sigs;
+  struct timeval t_start, t_end;
+  double t, t1;
+  int32_t count, max_threads, threads, type, retcode;
+  uint32_t i, failures;
+
+  count = 2000;
+  max_threads = (int32_t) sysconf(_SC_NPROCESSORS_ONLN);
+  if (argc > 1) count = atoi(argv[1]);
+  if (argc > 2) max_threads = atoi(argv[2]);
+  if (count <= 0 || max_threads <= 0) {
+    fprintf(stderr, "Usage: %s [messages] [max threads]\n", argv[0]);
+    return 1;
+  }
+
+  buffers = calloc((size_t) count, sizeof(*buffers));
+  msgs = calloc((size_t) count, sizeof(uint8_t *));
+  lens = calloc((size_t) count, sizeof(size_t));
+  sigs = calloc((size_t) count, sizeof(bliss_signature_t));
+  if (buffers == NULL || msgs == NULL || lens == NULL || sigs == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  for (i = 0; i < (uint32_t) count; i++) {
+    snprintf((char *) buffers[i], sizeof(buffers[i]), "log record %"PRIu32, i);
+    msgs[i] = buffers[i];
+    lens[i] = sizeof(buffers[i]);
+  }
+
+  entropy_init(&entropy, seed);
+
+  failures = 0;
+  for (type = BLISS_B_0; type <= BLISS_B_4; type++) {
+    if (bliss_b_private_key_gen(&private_key, type, &entropy) != BLISS_B_NO_ERROR ||
+        bliss_b_public_key_extract(&public_key, &private_key) != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "key generation failed: type = %d\n", type);
+      return 1;
+    }
+
+    t1 = 0.0;
+    for (threads = 1; threads <= max_threads; threads++) {
+      gettimeofday(&t_start, NULL);
+      retcode = bliss_b_sign_batch(&private_key, msgs, lens, sigs, (uint32_t) count, (uint32_t) threads, &entropy);
+      gettimeofday(&t_end, NULL);
+      t = elapsed_us(&t_start, &t_end);
+      if (threads == 1) t1 = t;
+
+      if (retcode != BLISS_B_NO_ERROR) {
+        fprintf(stderr, "bliss_b_sign_batch failed: type = %d, retcode = %d\n", type, retcode);
+        failures ++;
+        continue;
+      }
+      for (i = 0; i < (uint32_t) count; i++) {
+        if (bliss_b_verify(sigs + i, &public_key, msgs[i], lens[i]) != BLISS_B_NO_ERROR) {
+          failures ++;
+        }
+        bliss_signature_delete(sigs + i);
+      }
+
+      fprintf(stdout, "bliss_b type = %d: %2d threads %8.0f signatures/sec (speedup %.2f)\n",
+              type, threads, count * 1e6 / t, t1 / t);
+    }
+
+    bliss_b_public_key_delete(&public_key);
+    bliss_b_private_key_delete(&private_key);
+  }
+
+  free(buffers);
+  free(msgs);
+  free(lens);
+  free(sigs);
+
+  if (failures > 0) {
+    fprintf(stdout, "%"PRIu32" failures\n", failures);
+  }
+
+  return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Verification throughput: one-shot bliss_b_verify vs. a
+ * verification context bound to the public key.
+ *
+ * Usage: speed_verify [iterations]
+ */
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bliss_b_errors.h"
+#include "bliss_b_keys.h"
+#include "bliss_b_signatures.h"
+#include "entropy.h"
+
+#include "tests.h"
+
+// hard-coded seed for testing
+static uint8_t seed[SHA3_512_DIGEST_LENGTH] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7
+};
+
+static entropy_t entropy;
+
+static bliss_private_key_t private_key;
+
+static bliss_public_key_t public_key;
+
+static bliss_signature_t signature;
+
+static bliss_b_verify_ctx_t verify_ctx;
+
+static double elapsed_us(struct timeval *start, struct timeval *end) {
+  return (double) ((end->tv_sec * 1000000 + end->tv_usec) - (start->tv_sec * 1000000 + start->tv_usec));
+}
+
+int main(int argc, char* argv[]) {
+  int32_t type;
+  int32_t count, iterations;
+  int32_t retcode;
+  uint32_t failures = 0;
+  double t_plain, t_ctx;
+  struct timeval t_start, t_end;
+
+  char* text = "The lunatics have taken over the asylum";
+  uint8_t* msg = (uint8_t*)text;
+  size_t msg_sz = strlen(text) + 1;
+
+  iterations = 10000;
+  if (argc > 1) {
+    iterations = atoi(argv[1]);
+    if (iterations <= 0) {
+      fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  entropy_init(&entropy, seed);
+
+  for (type = BLISS_B_0; type <= BLISS_B_4; type++) {
+    retcode = bliss_b_private_key_gen(&private_key, type, &entropy);
+    if (retcode != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "bliss_b_private_key_gen failed: type = %d, retcode = %d\n", type, retcode);
+      return 1;
+    }
+    retcode = bliss_b_public_key_extract(&public_key, &private_key);
+    if (retcode != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "bliss_b_public_key_extract failed: type = %d, retcode = %d\n", type, retcode);
+      return 1;
+    }
+    retcode = bliss_b_sign(&signature, &private_key, msg, msg_sz, &entropy);
+    if (retcode != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "bliss_b_sign failed: type = %d, retcode = %d\n", type, retcode);
+      return 1;
+    }
+
+    // before: one-shot verification
+    gettimeofday(&t_start, NULL);
+    for (count = 0; count < iterations; count++) {
+      if (bliss_b_verify(&signature, &public_key, msg, msg_sz) != BLISS_B_NO_ERROR) {
+        failures ++;
+      }
+    }
+    gettimeofday(&t_end, NULL);
+    t_plain = elapsed_us(&t_start, &t_end);
+
+    // after: verification context
+    retcode = bliss_b_verify_ctx_init(&verify_ctx, &public_key);
+    if (retcode != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "bliss_b_verify_ctx_init failed: type = %d, retcode = %d\n", type, retcode);
+      return 1;
+    }
+    gettimeofday(&t_start, NULL);
+    for (count = 0; count < iterations; count++) {
+      if (bliss_b_ctx_verify(&verify_ctx, &signature, msg, msg_sz) != BLISS_B_NO_ERROR) {
+        failures ++;
+      }
+    }
+    gettimeofday(&t_end, NULL);
+    t_ctx = elapsed_us(&t_start, &t_end);
+    bliss_b_verify_ctx_delete(&verify_ctx);
+
+    fprintf(stdout, "bliss_b type = %d: bliss_b_verify %.0f verifies/sec, bliss_b_ctx_verify %.0f verifies/sec\n",
+            type, iterations * 1e6 / t_plain, iterations * 1e6 / t_ctx);
+
+    bliss_signature_delete(&signature);
+    bliss_b_public_key_delete(&public_key);
+    bliss_b_private_key_delete(&private_key);
+  }
+
+  if (failures > 0) {
+    fprintf(stdout, "%"PRIu32" verification failures\n", failures);
+  }
+  return failures > 0 ? 1 : 0;
+}
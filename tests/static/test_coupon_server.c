@@ -0,0 +1,141 @@
+/*
+ * Sign from several threads using one coupon server, verify all
+ * the signatures, and print the server's counters.
+ *
+ * Usage: test_coupon_server [signatures per thread]
+ */
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bliss_b_errors.h"
+#include "bliss_b_keys.h"
+#include "bliss_b_signatures.h"
+#include "bliss_b_coupon_server.h"
+#include "entropy.h"
+
+#include "tests.h"
+
+#define NTHREADS 4
+
+// hard-coded seed for testing
+static uint8_t seed[SHA3_512_DIGEST_LENGTH] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7
+};
+
+static bliss_private_key_t private_key;
+
+static bliss_public_key_t public_key;
+
+static bliss_b_coupon_server_t server;
+
+typedef struct {
+  uint32_t id;
+  uint32_t count;
+  uint32_t failures;
+} signer_t;
+
+static int32_t signatures_per_thread = 200;
+
+static void *signer(void *arg) {
+  signer_t *s = arg;
+  uint8_t thread_seed[SHA3_512_DIGEST_LENGTH];
+  uint8_t msg[32];
+  entropy_t entropy;
+  bliss_b_sign_ctx_t ctx;
+  bliss_signature_t signature;
+  int32_t i;
+
+  memcpy(thread_seed, seed, sizeof(thread_seed));
+  thread_seed[0] = (uint8_t) (s->id + 1);
+  entropy_init(&entropy, thread_seed);
+
+  if (bliss_b_sign_ctx_init(&ctx, &private_key, &entropy) != BLISS_B_NO_ERROR ||
+      bliss_signature_init(&signature, private_key.kind) != BLISS_B_NO_ERROR) {
+    s->failures = (uint32_t) signatures_per_thread;
+    return NULL;
+  }
+
+  for (i = 0; i < signatures_per_thread; i++) {
+    memset(msg, 0, sizeof(msg));
+    snprintf((char *) msg, sizeof(msg), "thread %"PRIu32" message %"PRId32, s->id, i);
+    if (bliss_b_ctx_sign_server(&ctx, &server, &signature, msg, sizeof(msg)) != BLISS_B_NO_ERROR ||
+        bliss_b_verify(&signature, &public_key, msg, sizeof(msg)) != BLISS_B_NO_ERROR) {
+      s->failures ++;
+    }
+    s->count ++;
+  }
+
+  bliss_signature_delete(&signature);
+  bliss_b_sign_ctx_delete(&ctx);
+
+  return NULL;
+}
+
+int main(int argc, char* argv[]) {
+  entropy_t entropy, producer_entropy;
+  pthread_t threads[NTHREADS];
+  signer_t signers[NTHREADS];
+  bliss_b_coupon_stats_t stats;
+  uint32_t i, failures;
+  int32_t type, retcode;
+
+  if (argc > 1) {
+    signatures_per_thread = atoi(argv[1]);
+    if (signatures_per_thread <= 0) {
+      fprintf(stderr, "Usage: %s [signatures per thread]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  entropy_init(&entropy, seed);
+  seed[0] = 0xff;
+  entropy_init(&producer_entropy, seed);
+
+  failures = 0;
+  for (type = BLISS_B_0; type <= BLISS_B_4; type++) {
+    if (bliss_b_private_key_gen(&private_key, type, &entropy) != BLISS_B_NO_ERROR ||
+        bliss_b_public_key_extract(&public_key, &private_key) != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "key generation failed: type = %d\n", type);
+      return 1;
+    }
+
+    retcode = bliss_b_coupon_server_init(&server, &private_key, &producer_entropy, 64, 16, 48);
+    if (retcode != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "bliss_b_coupon_server_init failed: type = %d, retcode = %d\n", type, retcode);
+      return 1;
+    }
+
+    for (i = 0; i < NTHREADS; i++) {
+      signers[i].id = i;
+      signers[i].count = 0;
+      signers[i].failures = 0;
+      pthread_create(threads + i, NULL, signer, signers + i);
+    }
+    for (i = 0; i < NTHREADS; i++) {
+      pthread_join(threads[i], NULL);
+      failures += signers[i].failures;
+    }
+
+    bliss_b_coupon_server_stats(&server, &stats);
+    fprintf(stdout, "bliss_b type = %d: %d signatures, %"PRIu32" failures, ring %"PRIu32"/%"PRIu32", "
+            "produced %"PRIu64", consumed %"PRIu64", fallbacks %"PRIu64" (%.1f%%)\n",
+            type, NTHREADS * signatures_per_thread, failures, stats.occupancy, stats.capacity,
+            stats.produced, stats.consumed, stats.fallbacks,
+            100.0 * (double) stats.fallbacks / (double) (stats.consumed + stats.fallbacks));
+
+    bliss_b_coupon_server_delete(&server);
+    bliss_b_public_key_delete(&public_key);
+    bliss_b_private_key_delete(&private_key);
+  }
+
+  return failures > 0 ? 1 : 0;
+}
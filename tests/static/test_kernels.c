@@ -0,0 +1,177 @@
+/*
+ * Specialized kernels: for each kind, check that the table entry has
+ * the kind's parameters and that the kernels agree with the generic
+ * code on random inputs.
+ *
+ * Usage: test_kernels [rounds]
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bliss_b_kernels.h"
+#include "bliss_b_params.h"
+#include "bliss_b_utils.h"
+#include "greedy_sc.h"
+
+#include "tests.h"
+
+#define MAX_N 512
+
+static int32_t random_in(int32_t low, int32_t high) {
+  return low + (int32_t) (random() % (high - low + 1));
+}
+
+static int32_t mod(int32_t x, int32_t q) {
+  x %= q;
+  return x < 0 ? x + q : x;
+}
+
+static int32_t drop_bits(int32_t x, uint32_t d, int32_t q) {
+  if (x >= q) x -= 2 * q;
+  return (x >> d) + ((x >> (d - 1)) & 1);
+}
+
+static int32_t center(int32_t x, int32_t p) {
+  if (x < -p/2) return x + p;
+  if (x > p/2) return x - p;
+  return x;
+}
+
+static bool same(const int32_t *a, const int32_t *b, uint32_t n) {
+  return memcmp(a, b, n * sizeof(int32_t)) == 0;
+}
+
+/*
+ * Random secret key extensions and random c
+ */
+static void random_key(int8_t *s1x, int8_t *s2x, uint32_t *c, const bliss_param_t *p) {
+  int32_t s1[MAX_N], s2[MAX_N];
+  bool used[MAX_N];
+  uint32_t i, j;
+
+  for (i = 0; i < p->n; i++) {
+    s1[i] = random_in(-1, 1);
+    s2[i] = 2 * random_in(-2, 2);
+    used[i] = false;
+  }
+  greedy_sc_extend(s1x, s1, p->n);
+  greedy_sc_extend(s2x, s2, p->n);
+
+  for (i = 0; i < p->kappa; i++) {
+    do {
+      j = (uint32_t) random() % p->n;
+    } while (used[j]);
+    used[j] = true;
+    c[i] = j;
+  }
+}
+
+static uint32_t test_kind(bliss_kind_t kind, uint32_t rounds) {
+  bliss_param_t p;
+  const bliss_b_kernels_t *k;
+  int32_t v[MAX_N], dv[MAX_N], y[MAX_N], z[MAX_N], w[MAX_N];
+  int32_t r[MAX_N], rdv[MAX_N], rz[MAX_N], v1[MAX_N], v2[MAX_N], u1[MAX_N], u2[MAX_N];
+  int8_t s1x[2 * MAX_N], s2x[2 * MAX_N];
+  uint32_t c[64];
+  uint32_t i, j, n, errors;
+  int32_t q;
+
+  errors = 0;
+  bliss_params_init(&p, kind);
+  k = bliss_b_kernels(kind);
+  if (k == NULL || k->kind != kind || k->n != p.n || k->q != p.q || k->d != p.d ||
+      k->mod_p != p.mod_p || k->kappa != p.kappa) {
+    printf("  kind %d: bad parameters in the kernel table\n", (int) kind);
+    return 1;
+  }
+
+  n = p.n;
+  q = p.q;
+  for (j = 0; j < rounds; j++) {
+    for (i = 0; i < n; i++) {
+      v[i] = random_in(0, q - 1);
+      y[i] = random_in(-2000, 2000);
+      z[i] = random_in(-p.mod_p/2, p.mod_p/2 - 1);
+    }
+    random_key(s1x, s2x, c, &p);
+
+    // coupon
+    for (i = 0; i < n; i++) {
+      r[i] = mod(2 * v[i] * p.one_q2 + y[i], p.q2);
+      rdv[i] = mod(drop_bits(r[i], p.d, q), p.mod_p);
+    }
+    memcpy(w, v, sizeof(v));
+    k->coupon(w, dv, y);
+    if (! same(w, r, n) || ! same(dv, rdv, n)) {
+      printf("  kind %d: coupon failed\n", (int) kind);
+      errors ++;
+    }
+
+    // compress_z2 (with v = r in [0, 2q-1])
+    for (i = 0; i < n; i++) {
+      rz[i] = center(drop_bits(r[i], p.d, q) - drop_bits(mod(r[i] - y[i], p.q2), p.d, q), p.mod_p);
+    }
+    memcpy(w, y, sizeof(y));
+    k->compress_z2(w, r);
+    if (! same(w, rz, n)) {
+      printf("  kind %d: compress_z2 failed\n", (int) kind);
+      errors ++;
+    }
+
+    // verify_v
+    for (i = 0; i < n; i++) {
+      r[i] = mod(2 * v[i] * p.one_q2, p.q2);
+    }
+    for (i = 0; i < p.kappa; i++) {
+      r[c[i]] = mod(r[c[i]] + q * p.one_q2, p.q2);
+    }
+    for (i = 0; i < n; i++) {
+      r[i] = mod(drop_bits(r[i], p.d, q) + z[i], p.mod_p);
+    }
+    memcpy(w, v, sizeof(v));
+    k->verify_v(w, c, z);
+    if (! same(w, r, n)) {
+      printf("  kind %d: verify_v failed\n", (int) kind);
+      errors ++;
+    }
+
+    // mul2d and norms
+    k->mul2d(w, z);
+    for (i = 0; i < n; i++) {
+      if (w[i] != z[i] * (1 << p.d)) break;
+    }
+    if (i < n || k->max_norm(y) != vector_max_norm(y, n) || k->norm2(y) != vector_norm2(y, n) ||
+        k->scalar_product(y, z) != vector_scalar_product(y, z, n)) {
+      printf("  kind %d: mul2d or norms failed\n", (int) kind);
+      errors ++;
+    }
+
+    // greedy_sc
+    greedy_sc(s1x, s2x, n, c, p.kappa, u1, u2);
+    k->greedy_sc(s1x, s2x, c, v1, v2);
+    if (! same(u1, v1, n) || ! same(u2, v2, n)) {
+      printf("  kind %d: greedy_sc failed\n", (int) kind);
+      errors ++;
+    }
+  }
+
+  return errors;
+}
+
+int main(int argc, char* argv[]) {
+  bliss_kind_t kind;
+  uint32_t rounds, errors;
+
+  rounds = 1000;
+  if (argc > 1) rounds = (uint32_t) atoi(argv[1]);
+
+  srandom(1234);
+  errors = 0;
+  for (kind = BLISS_B_0; kind <= BLISS_B_4; kind++) {
+    errors += test_kind(kind, rounds);
+    printf("kernels for BLISS-B %d: %s\n", (int) kind, errors == 0 ? "ok" : "FAILED");
+  }
+
+  return errors == 0 ? 0 : 1;
+}
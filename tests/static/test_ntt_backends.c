@@ -0,0 +1,283 @@
+/*
+ * Check that all NTT backends available on this machine compute
+ * the same NTTs as ntt_blzzd, the right products and inverses, and report
+ * their speed. Then do the
+ * same for the batch NTT on k interleaved polynomials.
+ *
+ * Usage: test_ntt_backends [iterations]
+ */
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bliss_b_params.h"
+#include "ntt_api.h"
+
+#include "tests.h"
+
+static int32_t a[512], b[512];
+static int32_t ref_fwd[512], ref_inv[512], ref_prod[512];
+static int32_t fwd[512], inv[512], prod[512];
+
+#define MAX_LANES 16
+
+static int32_t batch_a[512 * MAX_LANES], batch_b[512 * MAX_LANES];
+static int32_t batch_fwd[512 * MAX_LANES], batch_inv[512 * MAX_LANES], batch_prod[512 * MAX_LANES];
+
+static double elapsed_us(struct timeval *start, struct timeval *end) {
+  return (double) ((end->tv_sec * 1000000 + end->tv_usec) - (start->tv_sec * 1000000 + start->tv_usec));
+}
+
+static bool equal_arrays(const int32_t *x, const int32_t *y, uint32_t n) {
+  return memcmp(x, y, n * sizeof(int32_t)) == 0;
+}
+
+/*
+ * Compute forward, inverse, and product using the backend selected for kind
+ * - a is the input polynomial (small coefficients)
+ * - b is an NTT (coefficients in [0, q-1])
+ */
+static ntt_backend_t run(bliss_kind_t kind, int32_t *f, int32_t *i, int32_t *p) {
+  ntt_state_t state;
+  ntt_backend_t backend;
+
+  state = init_ntt_state(kind);
+  if (state == NULL) {
+    fprintf(stderr, "init_ntt_state failed: type = %d\n", kind);
+    exit(1);
+  }
+  forward_ntt(state, f, a);
+  inverse_ntt(state, i, b);
+  product_ntt(state, p, f, b);
+  backend = ntt_state_backend(state);
+  delete_ntt_state(state);
+
+  return backend;
+}
+
+/*
+ * Check that forward, product, and inverse compute a * c modulo (x^n + 1, q)
+ * for small random a and c, using the backend selected for kind,
+ * and that multiply_ntt_into computes the same thing
+ */
+static bool check_product(bliss_kind_t kind) {
+  ntt_state_t state;
+  bliss_param_t p;
+  int32_t c[512], ntt_c[512], scratch[512], expected[512];
+  int64_t x;
+  uint32_t i, j;
+
+  bliss_params_init(&p, kind);
+  for (i = 0; i < p.n; i++) {
+    a[i] = (int32_t) (random() % 4097) - 2048;
+    c[i] = (int32_t) (random() % 3) - 1;
+  }
+  for (i = 0; i < p.n; i++) {
+    x = 0;
+    for (j = 0; j <= i; j++) x += (int64_t) a[j] * c[i - j];
+    for (j = i + 1; j < p.n; j++) x -= (int64_t) a[j] * c[p.n + i - j];
+    x %= p.q;
+    expected[i] = (int32_t) (x < 0 ? x + p.q : x);
+  }
+
+  state = init_ntt_state(kind);
+  forward_ntt(state, fwd, a);
+  forward_ntt(state, ntt_c, c);
+  product_ntt(state, prod, fwd, ntt_c);
+  inverse_ntt(state, inv, prod);
+  multiply_ntt_into(state, prod, a, ntt_c, scratch);
+  delete_ntt_state(state);
+
+  return equal_arrays(inv, expected, p.n) && equal_arrays(prod, expected, p.n);
+}
+
+/*
+ * Check invert_polynomial: NTT(a) * inverse must be 1 everywhere, and the
+ * zero polynomial is not invertible
+ */
+static bool check_invert(bliss_kind_t kind) {
+  ntt_state_t state;
+  bliss_param_t p;
+  int32_t zero[512];
+  uint32_t i;
+  bool ok;
+
+  bliss_params_init(&p, kind);
+  for (i = 0; i < p.n; i++) {
+    a[i] = (int32_t) (random() % 5) - 2;
+    zero[i] = 0;
+  }
+
+  state = init_ntt_state(kind);
+  ok = true;
+  if (invert_polynomial(state, inv, a)) {
+    forward_ntt(state, fwd, a);
+    product_ntt(state, prod, fwd, inv);
+    for (i = 0; i < p.n; i++) {
+      ok &= prod[i] == 1;
+    }
+  }
+  ok &= ! invert_polynomial(state, inv, zero);
+  delete_ntt_state(state);
+
+  return ok;
+}
+
+static double speed(bliss_kind_t kind, int32_t iterations) {
+  struct timeval t_start, t_end;
+  ntt_state_t state;
+  int32_t count;
+
+  state = init_ntt_state(kind);
+  gettimeofday(&t_start, NULL);
+  for (count = 0; count < iterations; count++) {
+    multiply_ntt_into(state, inv, a, b, fwd);
+  }
+  gettimeofday(&t_end, NULL);
+  delete_ntt_state(state);
+
+  return elapsed_us(&t_start, &t_end) / iterations;
+}
+
+/*
+ * Compare the batch NTT on k lanes with the ntt_blzzd on each lane
+ * - batch_a: k input polynomials (small coefficients)
+ * - batch_b: k NTTs (coefficients in [0, q-1])
+ * - b: the shared right-hand side of the product
+ */
+static bool check_batch(bliss_kind_t kind, uint32_t k) {
+  ntt_state_t state;
+  bliss_param_t p;
+  uint32_t i, l;
+
+  bliss_params_init(&p, kind);
+  for (i = 0; i < p.n * k; i++) {
+    batch_a[i] = (int32_t) (random() % 4097) - 2048;
+    batch_b[i] = (int32_t) (random() % (uint32_t) p.q);
+  }
+  for (i = 0; i < p.n; i++) {
+    b[i] = (int32_t) (random() % (uint32_t) p.q);
+  }
+
+  ntt_force_backend(NTT_BACKEND_BLZZD);
+  state = init_ntt_state(kind);
+  forward_ntt_batch(state, batch_fwd, batch_a, k);
+  inverse_ntt_batch(state, batch_inv, batch_b, k);
+  product_ntt_batch(state, batch_prod, batch_fwd, b, k);
+
+  for (l = 0; l < k; l++) {
+    for (i = 0; i < p.n; i++) {
+      a[i] = batch_a[i * k + l];
+      fwd[i] = batch_b[i * k + l];
+    }
+    forward_ntt(state, ref_fwd, a);
+    inverse_ntt(state, ref_inv, fwd);
+    product_ntt(state, ref_prod, ref_fwd, b);
+    for (i = 0; i < p.n; i++) {
+      if (batch_fwd[i * k + l] != ref_fwd[i] || batch_inv[i * k + l] != ref_inv[i] ||
+          batch_prod[i * k + l] != ref_prod[i]) {
+        delete_ntt_state(state);
+        return false;
+      }
+    }
+  }
+  delete_ntt_state(state);
+
+  return true;
+}
+
+static double speed_batch(bliss_kind_t kind, uint32_t k, int32_t iterations) {
+  struct timeval t_start, t_end;
+  ntt_state_t state;
+  int32_t count;
+
+  state = init_ntt_state(kind);
+  gettimeofday(&t_start, NULL);
+  for (count = 0; count < iterations; count++) {
+    forward_ntt_batch(state, batch_fwd, batch_a, k);
+    product_ntt_batch(state, batch_fwd, batch_fwd, b, k);
+    inverse_ntt_batch(state, batch_inv, batch_fwd, k);
+  }
+  gettimeofday(&t_end, NULL);
+  delete_ntt_state(state);
+
+  return elapsed_us(&t_start, &t_end) / iterations / k;
+}
+
+int main(int argc, char* argv[]) {
+  bliss_param_t p;
+  int32_t type, backend, iterations, round;
+  uint32_t i, k, failures = 0;
+
+  iterations = 10000;
+  if (argc > 1) {
+    iterations = atoi(argv[1]);
+    if (iterations <= 0) {
+      fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  for (type = BLISS_B_0; type <= BLISS_B_4; type++) {
+    bliss_params_init(&p, type);
+
+    for (backend = NTT_BACKEND_BLZZD; backend < NUM_NTT_BACKENDS; backend++) {
+      if (! ntt_backend_supported(backend, type)) {
+        fprintf(stdout, "bliss_b type = %d: %-6s unsupported\n", type, ntt_backend_name(backend));
+        continue;
+      }
+
+      for (round = 0; round < 100; round++) {
+        for (i = 0; i < p.n; i++) {
+          a[i] = (int32_t) (random() % 4097) - 2048;
+          b[i] = (int32_t) (random() % (uint32_t) p.q);
+        }
+
+        ntt_force_backend(NTT_BACKEND_BLZZD);
+        run(type, ref_fwd, ref_inv, ref_prod);
+
+        ntt_force_backend(backend);
+        if (run(type, fwd, inv, prod) != backend) {
+          fprintf(stdout, "bliss_b type = %d: %s not selected\n", type, ntt_backend_name(backend));
+          failures ++;
+          break;
+        }
+
+        if (! equal_arrays(fwd, ref_fwd, p.n) || ! equal_arrays(inv, ref_inv, p.n) ||
+            ! equal_arrays(prod, ref_prod, p.n)) {
+          fprintf(stdout, "bliss_b type = %d: %s and blzzd disagree\n", type, ntt_backend_name(backend));
+          failures ++;
+          break;
+        }
+      }
+
+      ntt_force_backend(backend);
+      if (! check_product(type)) {
+        fprintf(stdout, "bliss_b type = %d: %s computes a wrong product\n", type, ntt_backend_name(backend));
+        failures ++;
+      }
+      if (! check_invert(type)) {
+        fprintf(stdout, "bliss_b type = %d: invert_polynomial is wrong with %s\n", type, ntt_backend_name(backend));
+        failures ++;
+      }
+
+      fprintf(stdout, "bliss_b type = %d: %-6s %.2f us per multiplication\n",
+              type, ntt_backend_name(backend), speed(type, iterations));
+    }
+  }
+
+  for (type = BLISS_B_0; type <= BLISS_B_4; type++) {
+    for (k = 1; k <= MAX_LANES; k++) {
+      if (! check_batch(type, k)) {
+        fprintf(stdout, "bliss_b type = %d: batch NTT on %"PRIu32" lanes and blzzd disagree\n", type, k);
+        failures ++;
+      }
+    }
+    fprintf(stdout, "bliss_b type = %d: batch %.2f us per multiplication (8 lanes), %.2f (16 lanes)\n",
+            type, speed_batch(type, 8, iterations / 8 + 1), speed_batch(type, 16, iterations / 16 + 1));
+  }
+
+  ntt_force_backend(NTT_BACKEND_AUTO);
+
+  return failures > 0 ? 1 : 0;
+}
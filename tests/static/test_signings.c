@@ -29,6 +29,67 @@ static bliss_public_key_t public_key;
 
 static bliss_signature_t signature;
 
+static bliss_b_sign_ctx_t sign_ctx;
+
+static bliss_b_verify_ctx_t verify_ctx;
+
+/*
+ * Sign through a signing context (same as bliss_b_sign but
+ * exercises the context API), using the given Gaussian sampler.
+ * If coupons > 0, that many coupons are precomputed before signing
+ * (restarts use them up, then bliss_b_ctx_sign computes its own).
+ */
+static int32_t ctx_sign(bliss_signature_t *signature, const bliss_private_key_t *private_key,
+                        const uint8_t *msg, size_t msg_sz, entropy_t *entropy, sampler_method_t method,
+                        uint32_t coupons) {
+  int32_t retcode;
+
+  retcode = bliss_b_sign_ctx_init(&sign_ctx, private_key, entropy);
+  if (retcode != BLISS_B_NO_ERROR) {
+    return retcode;
+  }
+  if (!sampler_set_method(&sign_ctx.sampler, method)) {
+    bliss_b_sign_ctx_delete(&sign_ctx);
+    return BLISS_B_BAD_ARGS;
+  }
+  if (coupons > 0) {
+    retcode = bliss_b_sign_ctx_reserve_coupons(&sign_ctx, coupons);
+    if (retcode != BLISS_B_NO_ERROR) {
+      bliss_b_sign_ctx_delete(&sign_ctx);
+      return retcode;
+    }
+    if (bliss_b_sign_ctx_precompute(&sign_ctx, coupons + 1) != coupons ||
+        bliss_b_sign_ctx_coupons(&sign_ctx) != coupons) {
+      bliss_b_sign_ctx_delete(&sign_ctx);
+      return BLISS_B_BAD_ARGS;
+    }
+  }
+  retcode = bliss_signature_init(signature, private_key->kind);
+  if (retcode == BLISS_B_NO_ERROR) {
+    retcode = bliss_b_ctx_sign(&sign_ctx, signature, msg, msg_sz);
+  }
+  bliss_b_sign_ctx_delete(&sign_ctx);
+
+  return retcode;
+}
+
+/*
+ * Verify through a verification context.
+ */
+static int32_t ctx_verify(const bliss_signature_t *signature, const bliss_public_key_t *public_key,
+                          const uint8_t *msg, size_t msg_sz) {
+  int32_t retcode;
+
+  retcode = bliss_b_verify_ctx_init(&verify_ctx, public_key);
+  if (retcode != BLISS_B_NO_ERROR) {
+    return retcode;
+  }
+  retcode = bliss_b_ctx_verify(&verify_ctx, signature, msg, msg_sz);
+  bliss_b_verify_ctx_delete(&verify_ctx);
+
+  return retcode;
+}
+
 int main(int argc, char* argv[]) {
   int32_t type;
   int32_t count;
@@ -71,7 +132,12 @@ int main(int argc, char* argv[]) {
       }
 
       gettimeofday(&t_start, NULL);
-      retcode = bliss_b_sign(&signature, &private_key, msg, msg_sz, &entropy);
+      if (count & 1) {
+        retcode = ctx_sign(&signature, &private_key, msg, msg_sz, &entropy,
+                           (count & 2) ? SAMPLER_CDT : SAMPLER_BERNOULLI, (count & 4) ? 2 : 0);
+      } else {
+        retcode = bliss_b_sign(&signature, &private_key, msg, msg_sz, &entropy);
+      }
       gettimeofday(&t_end, NULL);
       tsign[count] = (double) ((t_end.tv_sec * 1000000 + t_end.tv_usec) - (t_start.tv_sec * 1000000 + t_start.tv_usec));;
       if (retcode != BLISS_B_NO_ERROR) {
@@ -81,7 +147,11 @@ int main(int argc, char* argv[]) {
       }
 
       gettimeofday(&t_start, NULL);
-      retcode = bliss_b_verify(&signature, &public_key, msg, msg_sz);
+      if (count & 1) {
+        retcode = ctx_verify(&signature, &public_key, msg, msg_sz);
+      } else {
+        retcode = bliss_b_verify(&signature, &public_key, msg, msg_sz);
+      }
       gettimeofday(&t_end, NULL);
       tverify[count] = (double) ((t_end.tv_sec * 1000000 + t_end.tv_usec) - (t_start.tv_sec * 1000000 + t_start.tv_usec));;
       if (retcode != BLISS_B_NO_ERROR) {
@@ -0,0 +1,152 @@
+/*
+ * Batch verification: sign a batch of messages, tamper with some of
+ * the messages and signatures, then check that bliss_b_verify_batch
+ * agrees with bliss_b_verify on every item. Also compare the time
+ * with a loop of bliss_b_ctx_verify.
+ *
+ * Usage: test_verify_batch [messages] [threads]
+ * (threads defaults to the number of processors)
+ */
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bliss_b_errors.h"
+#include "bliss_b_keys.h"
+#include "bliss_b_signatures.h"
+#include "entropy.h"
+
+#include "tests.h"
+
+// hard-coded seed for testing
+static uint8_t seed[SHA3_512_DIGEST_LENGTH] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7,
+    0, 1, 2, 3, 4, 5, 6, 7
+};
+
+static entropy_t entropy;
+
+static bliss_private_key_t private_key;
+
+static bliss_public_key_t public_key;
+
+static bliss_b_verify_ctx_t verify_ctx;
+
+static double elapsed_us(struct timeval *start, struct timeval *end) {
+  return (double) ((end->tv_sec * 1000000 + end->tv_usec) - (start->tv_sec * 1000000 + start->tv_usec));
+}
+
+int main(int argc, char* argv[]) {
+  uint8_t (*buffers)[48];
+  const uint8_t **msgs;
+  size_t *lens;
+  bliss_signature_t *sigs;
+  uint8_t *valid;
+  struct timeval t_start, t_end;
+  double t_batch, t_loop;
+  int32_t count, threads, type, retcode;
+  uint32_t i, n, expected, failures;
+
+  count = 1000;
+  threads = 0;
+  if (argc > 1) count = atoi(argv[1]);
+  if (argc > 2) threads = atoi(argv[2]);
+  if (count <= 0 || threads < 0) {
+    fprintf(stderr, "Usage: %s [messages] [threads]\n", argv[0]);
+    return 1;
+  }
+
+  n = (uint32_t) count;
+  buffers = calloc(n, sizeof(*buffers));
+  msgs = calloc(n, sizeof(uint8_t *));
+  lens = calloc(n, sizeof(size_t));
+  sigs = calloc(n, sizeof(bliss_signature_t));
+  valid = calloc((n + 7)/8, sizeof(uint8_t));
+  if (buffers == NULL || msgs == NULL || lens == NULL || sigs == NULL || valid == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  /*
+   * Most messages have the same length (so they're hashed four at a time),
+   * every 7th message is shorter.
+   */
+  for (i = 0; i < n; i++) {
+    snprintf((char *) buffers[i], sizeof(buffers[i]), "log record %"PRIu32, i);
+    msgs[i] = buffers[i];
+    lens[i] = (i % 7 == 6) ? 20 : sizeof(buffers[i]);
+  }
+
+  entropy_init(&entropy, seed);
+
+  failures = 0;
+  for (type = BLISS_B_0; type <= BLISS_B_4; type++) {
+    if (bliss_b_private_key_gen(&private_key, type, &entropy) != BLISS_B_NO_ERROR ||
+        bliss_b_public_key_extract(&public_key, &private_key) != BLISS_B_NO_ERROR ||
+        bliss_b_verify_ctx_init(&verify_ctx, &public_key) != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "key generation failed: type = %d\n", type);
+      return 1;
+    }
+
+    retcode = bliss_b_sign_batch(&private_key, msgs, lens, sigs, n, 0, &entropy);
+    if (retcode != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "bliss_b_sign_batch failed: type = %d, retcode = %d\n", type, retcode);
+      return 1;
+    }
+
+    // tamper: change every 5th message, and z1 in every 11th signature
+    for (i = 0; i < n; i += 5) buffers[i][0] ^= 1;
+    for (i = 3; i < n; i += 11) sigs[i].z1[0] += 1;
+
+    gettimeofday(&t_start, NULL);
+    retcode = bliss_b_verify_batch(&public_key, sigs, msgs, lens, n, valid, (uint32_t) threads);
+    gettimeofday(&t_end, NULL);
+    t_batch = elapsed_us(&t_start, &t_end);
+    if (retcode != BLISS_B_NO_ERROR) {
+      fprintf(stderr, "bliss_b_verify_batch failed: type = %d, retcode = %d\n", type, retcode);
+      return 1;
+    }
+
+    gettimeofday(&t_start, NULL);
+    for (i = 0; i < n; i++) {
+      bliss_b_ctx_verify(&verify_ctx, sigs + i, msgs[i], lens[i]);
+    }
+    gettimeofday(&t_end, NULL);
+    t_loop = elapsed_us(&t_start, &t_end);
+
+    for (i = 0; i < n; i++) {
+      expected = bliss_b_verify(sigs + i, &public_key, msgs[i], lens[i]) == BLISS_B_NO_ERROR;
+      if (((valid[i >> 3] >> (i & 7)) & 1) != expected) {
+        fprintf(stderr, "type = %d: item %"PRIu32" is %s by bliss_b_verify but not by bliss_b_verify_batch\n",
+                type, i, expected ? "valid" : "invalid");
+        failures ++;
+      }
+      bliss_signature_delete(sigs + i);
+    }
+    for (i = 0; i < n; i += 5) buffers[i][0] ^= 1;
+
+    fprintf(stdout, "bliss_b type = %d: batch %.2f us/signature, loop %.2f us/signature (speedup %.2f)\n",
+            type, t_batch / n, t_loop / n, t_loop / t_batch);
+
+    bliss_b_verify_ctx_delete(&verify_ctx);
+    bliss_b_public_key_delete(&public_key);
+    bliss_b_private_key_delete(&private_key);
+  }
+
+  free(buffers);
+  free(msgs);
+  free(lens);
+  free(sigs);
+  free(valid);
+
+  if (failures > 0) {
+    fprintf(stdout, "%"PRIu32" failures\n", failures);
+  }
+
+  return failures > 0 ? 1 : 0;
+}
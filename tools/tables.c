@@ -71,6 +71,123 @@ static void init_c(unsigned long int sigma, uint32_t ell, uint8_t *c, mpfr_t f,
   
 }
 
+/*
+ * Cumulative distribution table for sampler_gauss_CDT.
+ *
+ * We use the same distribution as the Bernoulli sampler (i.e., the standard
+ * deviation is k_sigma/sqrt(2 ln 2) rather than sigma). With rho(x) = exp(-x^2/f),
+ * f = k_sigma^2/ln 2, and S = rho(0) + 2 * sum_{i>0} rho(i), the table stores
+ *
+ *    cdt[i] = floor(2^64 * (rho(0) + 2 * sum_{0<j<=i} rho(j)) / S)
+ *
+ * i.e., the cumulative distribution of |x| scaled to 64 bits. We stop
+ * before the first i where cdt[i] would be 2^64-1 (the remaining mass is
+ * less than 2^-64).
+ *
+ * The guide table splits [0, 2^64) into 256 intervals indexed by the top
+ * 8 bits of a random r: guide[j] = smallest i such that cdt[i] > j * 2^56
+ * and guide[256] = size of cdt. The index to find for r is then between
+ * guide[r >> 56] and guide[(r >> 56) + 1].
+ *
+ * The computation uses CDT_PRECISION bits.
+ */
+#define CDT_PRECISION 256
+
+static void init_cdt(unsigned long int sigma, uint64_t k_sigma){
+  mpfr_t s2, rho, sum, acc, t, two64, max;
+  uint64_t *cdt;
+  uint32_t i, n, size, j, g;
+
+  mpfr_init2(s2, CDT_PRECISION);
+  mpfr_init2(rho, CDT_PRECISION);
+  mpfr_init2(sum, CDT_PRECISION);
+  mpfr_init2(acc, CDT_PRECISION);
+  mpfr_init2(t, CDT_PRECISION);
+  mpfr_init2(two64, CDT_PRECISION);
+  mpfr_init2(max, CDT_PRECISION);
+
+  /* s2 = f = k_sigma^2 / ln 2 (recomputed with CDT_PRECISION bits) */
+  mpfr_set_ui(rho, 2, GMP_RNDN);
+  mpfr_log(rho, rho, GMP_RNDN);
+  mpfr_set_ui(s2, k_sigma, GMP_RNDN);
+  mpfr_sqr(s2, s2, GMP_RNDN);
+  mpfr_div(s2, s2, rho, GMP_RNDN);
+
+  /* two64 = 2^64, max = 2^64 - 1 */
+  mpfr_set_ui(two64, 64, GMP_RNDN);
+  mpfr_exp2(two64, two64, GMP_RNDN);
+  mpfr_sub_ui(max, two64, 1, GMP_RNDN);
+
+  /* sum = S: the terms for i >= 16 sigma are below 2^-180 */
+  n = 16 * sigma;
+  mpfr_set_ui(sum, 1, GMP_RNDN);
+  for (i = 1; i < n; i++) {
+    mpfr_set_ui(rho, i, GMP_RNDN);
+    mpfr_sqr(rho, rho, GMP_RNDN);
+    mpfr_div(rho, rho, s2, GMP_RNDN);
+    mpfr_neg(rho, rho, GMP_RNDN);
+    mpfr_exp(rho, rho, GMP_RNDN);   /* rho = exp(-i^2/f) */
+    mpfr_mul_ui(rho, rho, 2, GMP_RNDN);
+    mpfr_add(sum, sum, rho, GMP_RNDN);
+  }
+
+  cdt = calloc(n, sizeof(uint64_t));
+  if (cdt == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  size = 0;
+  mpfr_set_ui(acc, 1, GMP_RNDN);
+  for (i = 0; i < n; i++) {
+    mpfr_div(t, acc, sum, GMP_RNDN);
+    mpfr_mul(t, t, two64, GMP_RNDN);
+    mpfr_floor(t, t);
+    if (mpfr_cmp(t, max) >= 0) break;
+    cdt[size++] = (uint64_t) mpfr_get_ui(t, GMP_RNDD);
+
+    mpfr_set_ui(rho, i + 1, GMP_RNDN);
+    mpfr_sqr(rho, rho, GMP_RNDN);
+    mpfr_div(rho, rho, s2, GMP_RNDN);
+    mpfr_neg(rho, rho, GMP_RNDN);
+    mpfr_exp(rho, rho, GMP_RNDN);
+    mpfr_mul_ui(rho, rho, 2, GMP_RNDN);
+    mpfr_add(acc, acc, rho, GMP_RNDN);
+  }
+
+  fprintf(stderr, "\n#define CDT_%d_SIZE %"PRIu32"\n", (int)sigma, size);
+  fprintf(stderr, "\nstatic const uint64_t cdt_bliss_%d[CDT_%d_SIZE] = {\n", (int)sigma, (int)sigma);
+  for (i = 0; i < size; i++) {
+    if ((i & 3) == 0) fprintf(stderr, "\t");
+    fprintf(stderr, "0x%016"PRIx64"ULL,", cdt[i]);
+    fprintf(stderr, (i & 3) == 3 || i == size - 1 ? "\n" : " ");
+  }
+  fprintf(stderr, "};\n");
+
+  fprintf(stderr, "\nstatic const uint16_t cdt_guide_bliss_%d[257] = {\n", (int)sigma);
+  g = 0;
+  for (j = 0; j <= 256; j++) {
+    if (j < 256) {
+      while (g < size && cdt[g] <= ((uint64_t) j) << 56) g++;
+    } else {
+      g = size;
+    }
+    if ((j & 15) == 0) fprintf(stderr, "\t");
+    fprintf(stderr, "%4"PRIu32",", g);
+    fprintf(stderr, (j & 15) == 15 || j == 256 ? "\n" : " ");
+  }
+  fprintf(stderr, "};\n");
+
+  free(cdt);
+  mpfr_clear(s2);
+  mpfr_clear(rho);
+  mpfr_clear(sum);
+  mpfr_clear(acc);
+  mpfr_clear(t);
+  mpfr_clear(two64);
+  mpfr_clear(max);
+}
+
 static uint32_t  get_bits(uint64_t num){
   uint32_t retval = 0;
 
@@ -149,6 +266,8 @@ int main(int argc, char* argv[]){
       init_c(sigma, ell, c, f, precision);
     }
 
+    init_cdt(sigma, k_sigma);
+
 
     
   